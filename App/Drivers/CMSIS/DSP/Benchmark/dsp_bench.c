@@ -0,0 +1,1189 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        dsp_bench.c
+ * Description:  Host micro-benchmark for the CMSIS DSP functions
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: x86 / AArch64 hosts
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Times the functions over a range of sizes and writes the results to
+ * stdout as JSON. Each result gives the cost per call in cycles and in
+ * nanoseconds.
+ *
+ * Cycles are read from the x86 time stamp counter where there is one and
+ * are otherwise nanoseconds; the "counter" member of the output says which.
+ *
+ * The optional argument is the minimum time, in milliseconds, to spend on
+ * each measurement (default 50).
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#else
+#define BENCH_HAVE_TSC 0
+#endif
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* Largest number of float32_t values used by one call */
+#define BENCH_MAX_VALUES 32768U
+
+/* Frames transformed by each call of the multi-frame benchmarks */
+#define BENCH_FRAMES 16U
+
+/* Iterations to run before each timed measurement */
+#define BENCH_WARMUP 3U
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+typedef void (*bench_fn)(uint32_t size);
+
+/* Floating-point operations done by one call, for the GFLOPS figure */
+typedef float64_t (*bench_flops_fn)(uint32_t size);
+
+typedef struct
+{
+  const char *name;
+  bench_fn fn;
+  bench_fn setup;
+  const uint32_t *sizes;
+  uint32_t nsizes;
+  bench_flops_fn flops;
+} bench_case;
+
+static float32_t bench_in[BENCH_MAX_VALUES];
+static float32_t bench_buf[BENCH_MAX_VALUES];
+static float32_t bench_twiddle[BENCH_MAX_VALUES];
+static float32_t bench_scratch[BENCH_MAX_VALUES];
+static volatile float32_t bench_sink;
+
+/* Frame lengths which are not a power of two */
+static const uint32_t frame_sizes[] = { 480U, 960U, 1000U };
+
+/* Lengths of the multi-frame transforms */
+static const uint32_t batch_sizes[] = { 64U, 256U, 1024U };
+
+/* Lengths of the real FFTs with tables computed in RAM */
+static const uint32_t fft_ram_sizes[] = { 256U, 1024U, 4096U };
+
+/* Sides of the square matrices */
+static const uint32_t matrix_sizes[] = { 16U, 32U, 64U, 128U, 256U, 512U };
+
+/* Kernel lengths of the convolutions, with a signal of CONV_SIGNAL_LEN samples */
+static const uint32_t conv_sizes[] = { 16U, 32U, 64U, 128U, 256U, 1024U, 4096U, 8192U };
+#define CONV_SIGNAL_LEN 16384U
+
+/* Numbers of taps of the FIR filters, run on blocks of FIR_BLOCK_LEN samples */
+static const uint32_t fir_sizes[] = { 256U, 1024U, 4096U, 16384U };
+#define FIR_BLOCK_LEN 64U
+
+/* Numbers of taps of the FIR filters with and without circular state, each run on
+   blocks of 1, 16 and 64 samples */
+static const uint32_t fir_circ_sizes[] = { 16U, 64U, 256U, 1024U };
+
+/* Taps per polyphase component of the 44.1 kHz to 48 kHz resamplers, run on blocks of
+   RESAMPLE_M input samples */
+static const uint32_t resample_sizes[] = { 8U, 16U, 32U };
+#define RESAMPLE_L 160U
+#define RESAMPLE_M 147U
+
+/* Numbers of channels of the FIR filters of FIR_MC_TAPS taps shared by all channels, run
+   on blocks of FIR_MC_BLOCK_LEN samples per channel */
+static const uint32_t fir_mc_sizes[] = { 8U, 16U, 64U };
+#define FIR_MC_MAX_CHANNELS 64U
+#define FIR_MC_TAPS 64U
+#define FIR_MC_BLOCK_LEN 64U
+
+/* FFT lengths of the spectrograms of STFT_MELS log mel bands, with a hop of half a frame */
+static const uint32_t stft_sizes[] = { 256U, 512U, 1024U };
+#define STFT_MAX_LEN 1024U
+#define STFT_MELS 40U
+
+/* Numbers of bins of the tone detectors, over frames of 256 and 1024 samples, against the
+   power spectrum of the frame by the real FFT */
+static const uint32_t goertzel_sizes[] = { 1U, 4U, 16U, 64U };
+#define GOERTZEL_MAX_BINS 64U
+#define GOERTZEL_MAX_LEN 1024U
+
+/* Lengths of the vectors of the transcendental functions, against loops over the C library */
+static const uint32_t vmath_sizes[] = { 256U, 1024U, 4096U };
+#define VMATH_MAX_LEN 4096U
+
+/* Lengths of the windows of the monitors, which take blocks of MOVING_BLOCK samples, against
+   the batch statistics of the window after each block */
+static const uint32_t moving_sizes[] = { 256U, 1024U, 4096U };
+#define MOVING_BLOCK 64U
+
+/* Lengths of the sorted vectors, against qsort from the C library on a copy */
+static const uint32_t sort_sizes[] = { 64U, 1024U, 4096U };
+#define SORT_MAX_LEN 4096U
+
+/* Lengths of the windows of the median filters, which take blocks of MEDIAN_BLOCK samples,
+   against qsort of each window */
+static const uint32_t median_sizes[] = { 7U, 31U, 127U };
+#define MEDIAN_BLOCK 256U
+
+/* ---- Clocks ------------------------------------------------------------ */
+
+static uint64_t bench_ns(void)
+{
+  struct timespec ts;
+
+  (void) clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t) ts.tv_sec * UINT64_C(1000000000)) + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t bench_cycles(void)
+{
+#if BENCH_HAVE_TSC != 0
+  return __rdtsc();
+#else
+  return bench_ns();
+#endif
+}
+
+/* ---- Functions under test ---------------------------------------------- */
+
+static arm_cfft_mixed_instance_f32 cfft_mixed;
+
+static void setup_cfft_mixed(uint32_t size)
+{
+  if (arm_cfft_mixed_init_f32(&cfft_mixed, (uint16_t) size, bench_twiddle, bench_scratch) != ARM_MATH_SUCCESS)
+  {
+    fprintf(stderr, "dsp_bench: no mixed-radix CFFT of length %" PRIu32 "\n", size);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void run_cfft_mixed(uint32_t size)
+{
+  memcpy(bench_buf, bench_in, 2U * size * sizeof(float32_t));
+  arm_cfft_mixed_f32(&cfft_mixed, bench_buf, 0U);
+  bench_sink += bench_buf[0];
+}
+
+static const arm_cfft_instance_f32 *cfft_padded;
+
+/* The frame is zero padded to the next power-of-two length */
+static void setup_cfft_padded(uint32_t size)
+{
+  if (size <= 512U)
+  {
+    cfft_padded = &arm_cfft_sR_f32_len512;
+  }
+  else if (size <= 1024U)
+  {
+    cfft_padded = &arm_cfft_sR_f32_len1024;
+  }
+  else
+  {
+    cfft_padded = &arm_cfft_sR_f32_len2048;
+  }
+}
+
+static void run_cfft_padded(uint32_t size)
+{
+  memcpy(bench_buf, bench_in, 2U * size * sizeof(float32_t));
+  memset(bench_buf + 2U * size, 0, 2U * (cfft_padded->fftLen - size) * sizeof(float32_t));
+  arm_cfft_f32(cfft_padded, bench_buf, 0U, 1U);
+  bench_sink += bench_buf[0];
+}
+
+static const arm_cfft_instance_f32 *cfft_frame;
+static arm_rfft_fast_instance_f32 rfft_frame;
+
+static void setup_frames(uint32_t size)
+{
+  switch (size)
+  {
+  case 32U:
+    cfft_frame = &arm_cfft_sR_f32_len32;
+    break;
+  case 64U:
+    cfft_frame = &arm_cfft_sR_f32_len64;
+    break;
+  case 256U:
+    cfft_frame = &arm_cfft_sR_f32_len256;
+    break;
+  case 512U:
+    cfft_frame = &arm_cfft_sR_f32_len512;
+    break;
+  default:
+    cfft_frame = &arm_cfft_sR_f32_len1024;
+    break;
+  }
+
+  if (arm_rfft_fast_init_f32(&rfft_frame, (uint16_t) size) != ARM_MATH_SUCCESS)
+  {
+    fprintf(stderr, "dsp_bench: no real FFT of length %" PRIu32 "\n", size);
+    exit(EXIT_FAILURE);
+  }
+}
+
+/* BENCH_FRAMES frames of the single-frame CFFT, one call each */
+static void run_cfft_loop(uint32_t size)
+{
+  uint32_t f;
+
+  memcpy(bench_buf, bench_in, BENCH_FRAMES * 2U * size * sizeof(float32_t));
+  for (f = 0U; f < BENCH_FRAMES; f++)
+  {
+    arm_cfft_f32(cfft_frame, bench_buf + f * 2U * size, 0U, 1U);
+  }
+  bench_sink += bench_buf[0];
+}
+
+static void run_cfft_batch(uint32_t size)
+{
+  memcpy(bench_buf, bench_in, BENCH_FRAMES * 2U * size * sizeof(float32_t));
+  arm_cfft_batch_f32(cfft_frame, bench_buf, BENCH_FRAMES, 2U * size, 0U, 1U);
+  bench_sink += bench_buf[0];
+}
+
+static void run_rfft_loop(uint32_t size)
+{
+  uint32_t f;
+
+  memcpy(bench_buf, bench_in, BENCH_FRAMES * size * sizeof(float32_t));
+  for (f = 0U; f < BENCH_FRAMES; f++)
+  {
+    arm_rfft_fast_f32(&rfft_frame, bench_buf + f * size, bench_scratch + f * size, 0U);
+  }
+  bench_sink += bench_scratch[0];
+}
+
+static void run_rfft_batch(uint32_t size)
+{
+  memcpy(bench_buf, bench_in, BENCH_FRAMES * size * sizeof(float32_t));
+  arm_rfft_fast_batch_f32(&rfft_frame, bench_buf, bench_scratch, BENCH_FRAMES, size, 0U);
+  bench_sink += bench_scratch[0];
+}
+
+/* Real FFT with the twiddle factors and bit reversal table computed in RAM */
+static uint16_t rfft_ram_bitrev[4096];
+
+static void setup_frames_ram(uint32_t size)
+{
+  if (arm_rfft_fast_init_ram_f32(&rfft_frame, (uint16_t) size, bench_twiddle, rfft_ram_bitrev) != ARM_MATH_SUCCESS)
+  {
+    fprintf(stderr, "dsp_bench: no real FFT of length %" PRIu32 "\n", size);
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void run_rfft_init(uint32_t size)
+{
+  (void) arm_rfft_fast_init_f32(&rfft_frame, (uint16_t) size);
+  bench_sink += rfft_frame.pTwiddleRFFT[1];
+}
+
+static void run_rfft_init_ram(uint32_t size)
+{
+  (void) arm_rfft_fast_init_ram_f32(&rfft_frame, (uint16_t) size, bench_twiddle, rfft_ram_bitrev);
+  bench_sink += rfft_frame.pTwiddleRFFT[1];
+}
+
+static void run_rfft_single(uint32_t size)
+{
+  memcpy(bench_buf, bench_in, size * sizeof(float32_t));
+  arm_rfft_fast_f32(&rfft_frame, bench_buf, bench_scratch, 0U);
+  bench_sink += bench_scratch[0];
+}
+
+static float32_t *mat_a;
+static float32_t *mat_b;
+static float32_t *mat_c;
+static arm_matrix_instance_f32 mat_inst_a, mat_inst_b, mat_inst_c;
+
+static void setup_mat_mult(uint32_t size)
+{
+  uint32_t i;
+
+  free(mat_a);
+  free(mat_b);
+  free(mat_c);
+  mat_a = malloc(size * size * sizeof(float32_t));
+  mat_b = malloc(size * size * sizeof(float32_t));
+  mat_c = malloc(size * size * sizeof(float32_t));
+  if ((mat_a == NULL) || (mat_b == NULL) || (mat_c == NULL))
+  {
+    fprintf(stderr, "dsp_bench: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0U; i < size * size; i++)
+  {
+    mat_a[i] = bench_in[i % BENCH_MAX_VALUES];
+    mat_b[i] = bench_in[(i * 7U) % BENCH_MAX_VALUES];
+  }
+
+  arm_mat_init_f32(&mat_inst_a, (uint16_t) size, (uint16_t) size, mat_a);
+  arm_mat_init_f32(&mat_inst_b, (uint16_t) size, (uint16_t) size, mat_b);
+  arm_mat_init_f32(&mat_inst_c, (uint16_t) size, (uint16_t) size, mat_c);
+}
+
+static void run_mat_mult(uint32_t size)
+{
+  (void) arm_mat_mult_f32(&mat_inst_a, &mat_inst_b, &mat_inst_c);
+  bench_sink += mat_c[size - 1U];
+}
+
+static float64_t flops_mat_mult(uint32_t size)
+{
+  return 2.0 * (float64_t) size * (float64_t) size * (float64_t) size;
+}
+
+static float32_t *conv_sig;
+static float32_t *conv_ker;
+static float32_t *conv_out;
+static float32_t *conv_scratch;
+
+static void setup_conv(uint32_t size)
+{
+  uint32_t i;
+
+  free(conv_sig);
+  free(conv_ker);
+  free(conv_out);
+  free(conv_scratch);
+  conv_sig = malloc(CONV_SIGNAL_LEN * sizeof(float32_t));
+  conv_ker = malloc(size * sizeof(float32_t));
+  conv_out = malloc((CONV_SIGNAL_LEN + size - 1U) * sizeof(float32_t));
+  conv_scratch = malloc(arm_conv_fft_scratch_size_f32(CONV_SIGNAL_LEN, size) * sizeof(float32_t));
+  if ((conv_sig == NULL) || (conv_ker == NULL) || (conv_out == NULL) || (conv_scratch == NULL))
+  {
+    fprintf(stderr, "dsp_bench: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0U; i < CONV_SIGNAL_LEN; i++)
+  {
+    conv_sig[i] = bench_in[i % BENCH_MAX_VALUES];
+  }
+  for (i = 0U; i < size; i++)
+  {
+    conv_ker[i] = bench_in[(i * 7U) % BENCH_MAX_VALUES];
+  }
+}
+
+static void run_conv(uint32_t size)
+{
+  arm_conv_f32(conv_sig, CONV_SIGNAL_LEN, conv_ker, size, conv_out);
+  bench_sink += conv_out[size];
+}
+
+static void run_conv_fft(uint32_t size)
+{
+  (void) arm_conv_fft_f32(conv_sig, CONV_SIGNAL_LEN, conv_ker, size, conv_out, conv_scratch);
+  bench_sink += conv_out[size];
+}
+
+static void run_conv_auto(uint32_t size)
+{
+  (void) arm_conv_auto_f32(conv_sig, CONV_SIGNAL_LEN, conv_ker, size, conv_out, conv_scratch);
+  bench_sink += conv_out[size];
+}
+
+static float32_t *fir_coeffs;
+static float32_t *fir_state;
+static arm_fir_instance_f32 fir_inst;
+static arm_fir_fft_instance_f32 fir_fft_inst;
+
+static void setup_fir(uint32_t size)
+{
+  uint32_t i;
+
+  free(fir_coeffs);
+  free(fir_state);
+  fir_coeffs = malloc(size * sizeof(float32_t));
+  fir_state = malloc((4U * (size / FIR_BLOCK_LEN) + 5U) * FIR_BLOCK_LEN * sizeof(float32_t));
+  if ((fir_coeffs == NULL) || (fir_state == NULL))
+  {
+    fprintf(stderr, "dsp_bench: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0U; i < size; i++)
+  {
+    fir_coeffs[i] = bench_in[(i * 7U) % BENCH_MAX_VALUES] / (float32_t) size;
+  }
+}
+
+static void setup_fir_direct(uint32_t size)
+{
+  setup_fir(size);
+  arm_fir_init_f32(&fir_inst, (uint16_t) size, fir_coeffs, fir_state, FIR_BLOCK_LEN);
+}
+
+static void setup_fir_fft(uint32_t size)
+{
+  setup_fir(size);
+  (void) arm_fir_fft_init_f32(&fir_fft_inst, size, fir_coeffs, fir_state, FIR_BLOCK_LEN);
+}
+
+static void run_fir_direct(uint32_t size)
+{
+  arm_fir_f32(&fir_inst, bench_in, bench_buf, FIR_BLOCK_LEN);
+  bench_sink += bench_buf[size % FIR_BLOCK_LEN];
+}
+
+static void run_fir_fft(uint32_t size)
+{
+  arm_fir_fft_f32(&fir_fft_inst, bench_in, bench_buf, FIR_BLOCK_LEN);
+  bench_sink += bench_buf[size % FIR_BLOCK_LEN];
+}
+
+static arm_fir_circ_instance_f32 fir_circ_inst;
+static uint32_t fir_circ_block;
+
+static void setup_fir_circ(uint32_t size)
+{
+  /* The state buffer of setup_fir() also holds the two images of the circular state */
+  setup_fir(size);
+  arm_fir_init_f32(&fir_inst, (uint16_t) size, fir_coeffs, fir_state, fir_circ_block);
+  arm_fir_circ_init_f32(&fir_circ_inst, (uint16_t) size, fir_coeffs, fir_state, fir_circ_block);
+}
+
+static void setup_fir_circ_1(uint32_t size)
+{
+  fir_circ_block = 1U;
+  setup_fir_circ(size);
+}
+
+static void setup_fir_circ_16(uint32_t size)
+{
+  fir_circ_block = 16U;
+  setup_fir_circ(size);
+}
+
+static void setup_fir_circ_64(uint32_t size)
+{
+  fir_circ_block = 64U;
+  setup_fir_circ(size);
+}
+
+static void run_fir_linear(uint32_t size)
+{
+  arm_fir_f32(&fir_inst, bench_in, bench_buf, fir_circ_block);
+  bench_sink += bench_buf[size % fir_circ_block];
+}
+
+static void run_fir_circ(uint32_t size)
+{
+  arm_fir_circ_f32(&fir_circ_inst, bench_in, bench_buf, fir_circ_block);
+  bench_sink += bench_buf[size % fir_circ_block];
+}
+
+static float32_t *resample_coeffs;
+static float32_t *resample_state;
+static arm_fir_interpolate_instance_f32 interp_inst;
+static arm_fir_resample_instance_f32 resample_inst;
+
+static void setup_resample(uint32_t size)
+{
+  uint32_t i;
+
+  free(resample_coeffs);
+  free(resample_state);
+  resample_coeffs = malloc(size * RESAMPLE_L * sizeof(float32_t));
+  resample_state = malloc((size + RESAMPLE_M) * sizeof(float32_t));
+  if ((resample_coeffs == NULL) || (resample_state == NULL))
+  {
+    fprintf(stderr, "dsp_bench: out of memory\n");
+    exit(EXIT_FAILURE);
+  }
+
+  for (i = 0U; i < size * RESAMPLE_L; i++)
+  {
+    resample_coeffs[i] = bench_in[(i * 7U) % BENCH_MAX_VALUES] / (float32_t) size;
+  }
+
+  arm_fir_interpolate_init_f32(&interp_inst, (uint8_t) RESAMPLE_L, (uint16_t) (size * RESAMPLE_L),
+                               resample_coeffs, resample_state, RESAMPLE_M);
+  (void) arm_fir_resample_init_f32(&resample_inst, (uint16_t) RESAMPLE_L, RESAMPLE_M, 0U,
+                                   (uint16_t) (size * RESAMPLE_L), resample_coeffs,
+                                   resample_state, RESAMPLE_M);
+}
+
+/* Interpolate by L, then keep one sample every M */
+static void run_interp_decim(uint32_t size)
+{
+  uint32_t i;
+
+  arm_fir_interpolate_f32(&interp_inst, bench_in, bench_scratch, RESAMPLE_M);
+  for (i = 0U; i < RESAMPLE_L; i++)
+  {
+    bench_buf[i] = bench_scratch[i * RESAMPLE_M];
+  }
+  bench_sink += bench_buf[size % RESAMPLE_L];
+}
+
+static void run_resample(uint32_t size)
+{
+  (void) arm_fir_resample_f32(&resample_inst, bench_in, bench_buf, RESAMPLE_M);
+  bench_sink += bench_buf[size % RESAMPLE_L];
+}
+
+static float32_t fir_mc_coeffs[FIR_MC_TAPS];
+static float32_t fir_mc_state[(FIR_MC_TAPS + FIR_MC_BLOCK_LEN - 1U) * FIR_MC_MAX_CHANNELS];
+static arm_fir_instance_f32 fir_mc_ref_inst[FIR_MC_MAX_CHANNELS];
+static arm_fir_multichannel_instance_f32 fir_mc_inst;
+
+static void setup_fir_mc(uint32_t size, uint8_t interleaved)
+{
+  uint32_t c;
+
+  for (c = 0U; c < FIR_MC_TAPS; c++)
+  {
+    fir_mc_coeffs[c] = bench_in[c * 7U] / (float32_t) FIR_MC_TAPS;
+  }
+
+  for (c = 0U; c < size; c++)
+  {
+    arm_fir_init_f32(&fir_mc_ref_inst[c], (uint16_t) FIR_MC_TAPS, fir_mc_coeffs,
+                     fir_mc_state + (FIR_MC_TAPS + FIR_MC_BLOCK_LEN - 1U) * c, FIR_MC_BLOCK_LEN);
+  }
+  arm_fir_multichannel_init_f32(&fir_mc_inst, (uint16_t) FIR_MC_TAPS, (uint16_t) size, interleaved,
+                                fir_mc_coeffs, fir_mc_state, FIR_MC_BLOCK_LEN);
+}
+
+static void setup_fir_mc_interleaved(uint32_t size)
+{
+  setup_fir_mc(size, 1U);
+}
+
+static void setup_fir_mc_planar(uint32_t size)
+{
+  setup_fir_mc(size, 0U);
+}
+
+/* One single-channel filter per channel of planar data */
+static void run_fir_mc_loop(uint32_t size)
+{
+  uint32_t c;
+
+  for (c = 0U; c < size; c++)
+  {
+    arm_fir_f32(&fir_mc_ref_inst[c], bench_in + c * FIR_MC_BLOCK_LEN,
+                bench_buf + c * FIR_MC_BLOCK_LEN, FIR_MC_BLOCK_LEN);
+  }
+  bench_sink += bench_buf[size];
+}
+
+static void run_fir_mc(uint32_t size)
+{
+  arm_fir_multichannel_f32(&fir_mc_inst, bench_in, bench_buf, FIR_MC_BLOCK_LEN);
+  bench_sink += bench_buf[size];
+}
+
+static float32_t stft_window[STFT_MAX_LEN];
+static float32_t stft_state[2U * STFT_MAX_LEN];
+static float32_t stft_coefs[2U * (STFT_MAX_LEN / 2U + 1U)];
+static uint32_t stft_pos[STFT_MELS];
+static uint32_t stft_len[STFT_MELS];
+static arm_stft_instance_f32 stft_inst;
+static arm_rfft_fast_instance_f32 stft_rfft;
+static uint32_t stft_ring_pos;
+
+/* Hann window, and triangular bands of equal width which overlap by half */
+static void setup_stft(uint32_t size)
+{
+  uint32_t m, k, offset = 0U;
+  uint32_t width = (size / 2U) / (STFT_MELS + 1U);
+
+  for (k = 0U; k < size; k++)
+  {
+    stft_window[k] = 0.5f - 0.5f * cosf(6.28318531f * (float32_t) k / (float32_t) size);
+  }
+
+  for (m = 0U; m < STFT_MELS; m++)
+  {
+    stft_pos[m] = m * width;
+    stft_len[m] = 2U * width + 1U;
+    for (k = 0U; k < stft_len[m]; k++)
+    {
+      stft_coefs[offset + k] = 1.0f - fabsf((float32_t) k / (float32_t) width - 1.0f);
+    }
+    offset += stft_len[m];
+  }
+
+  (void) arm_rfft_fast_init_f32(&stft_rfft, (uint16_t) size);
+  (void) arm_stft_init_f32(&stft_inst, (uint16_t) size, (uint16_t) (size / 2U), stft_window, STFT_MELS,
+                           stft_pos, stft_len, stft_coefs, 1U, stft_state);
+  stft_ring_pos = 0U;
+}
+
+/* One frame through the separate passes */
+static void run_stft_passes(uint32_t size)
+{
+  uint32_t m, k, offset = 0U;
+
+  arm_mult_f32(bench_in, stft_window, bench_scratch, size);
+  arm_rfft_fast_f32(&stft_rfft, bench_scratch, bench_buf, 0U);
+  bench_scratch[0] = bench_buf[0] * bench_buf[0];
+  bench_scratch[size / 2U] = bench_buf[1] * bench_buf[1];
+  arm_cmplx_mag_squared_f32(bench_buf + 2, bench_scratch + 1, size / 2U - 1U);
+
+  for (m = 0U; m < STFT_MELS; m++)
+  {
+    float32_t acc = 0.0f;
+
+    for (k = 0U; k < stft_len[m]; k++)
+    {
+      acc += stft_coefs[offset + k] * bench_scratch[stft_pos[m] + k];
+    }
+    offset += stft_len[m];
+    bench_buf[m] = logf(acc + 1.0e-6f);
+  }
+  bench_sink += bench_buf[size % STFT_MELS];
+}
+
+/* One hop of input, which completes one frame */
+static void run_stft(uint32_t size)
+{
+  uint32_t hop = size / 2U;
+
+  (void) arm_stft_f32(&stft_inst, bench_in + stft_ring_pos, bench_buf, hop);
+  stft_ring_pos = (stft_ring_pos + hop) % (BENCH_MAX_VALUES / 2U);
+  bench_sink += bench_buf[size % STFT_MELS];
+}
+
+static uint16_t goertzel_bins[GOERTZEL_MAX_BINS];
+static float32_t goertzel_coeffs[3U * GOERTZEL_MAX_BINS];
+static float32_t goertzel_state[2U * GOERTZEL_MAX_BINS];
+static float32_t goertzel_delay[GOERTZEL_MAX_LEN];
+static arm_goertzel_instance_f32 goertzel_inst;
+static arm_sdft_instance_f32 sdft_inst;
+static arm_rfft_fast_instance_f32 goertzel_rfft;
+static uint32_t goertzel_len;
+
+/* Bins spread over the spectrum */
+static void setup_goertzel(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    goertzel_bins[k] = (uint16_t) (1U + k * (goertzel_len / 2U - 2U) / size);
+  }
+
+  (void) arm_rfft_fast_init_f32(&goertzel_rfft, (uint16_t) goertzel_len);
+  (void) arm_goertzel_init_f32(&goertzel_inst, (uint16_t) size, (uint16_t) goertzel_len, goertzel_bins,
+                               goertzel_coeffs, goertzel_state);
+  (void) arm_sdft_init_f32(&sdft_inst, (uint16_t) size, (uint16_t) goertzel_len, goertzel_bins, 1.0f,
+                           goertzel_coeffs, goertzel_state, goertzel_delay);
+}
+
+static void setup_goertzel_256(uint32_t size)
+{
+  goertzel_len = 256U;
+  setup_goertzel(size);
+}
+
+static void setup_goertzel_1024(uint32_t size)
+{
+  goertzel_len = 1024U;
+  setup_goertzel(size);
+}
+
+/* Power spectrum of one frame, which gives all the bins */
+static void run_goertzel_rfft(uint32_t size)
+{
+  /* The real FFT overwrites its input, which is shared with the other benchmarks */
+  memcpy(bench_scratch, bench_in, goertzel_len * sizeof(float32_t));
+  arm_rfft_fast_f32(&goertzel_rfft, bench_scratch, bench_buf, 0U);
+  arm_cmplx_mag_squared_f32(bench_buf + 2, bench_scratch, goertzel_len / 2U - 1U);
+  bench_sink += bench_scratch[goertzel_bins[size - 1U] - 1U];
+}
+
+/* One frame, and the powers of its bins */
+static void run_goertzel(uint32_t size)
+{
+  (void) arm_goertzel_f32(&goertzel_inst, bench_in, bench_buf, goertzel_len);
+  arm_cmplx_mag_squared_f32(bench_buf, bench_scratch, size);
+  bench_sink += bench_scratch[size - 1U];
+}
+
+/* One frame of samples, with the bins updated at every sample */
+static void run_sdft(uint32_t size)
+{
+  arm_sdft_f32(&sdft_inst, bench_in, bench_buf, goertzel_len);
+  arm_cmplx_mag_squared_f32(bench_buf, bench_scratch, size);
+  bench_sink += bench_scratch[size - 1U];
+}
+
+/* Arguments in the ranges of activations and phases: x in [-8, 8), and positive values for the logarithm */
+static float32_t vmath_x[VMATH_MAX_LEN];
+static float32_t vmath_y[VMATH_MAX_LEN];
+static float32_t vmath_pos[VMATH_MAX_LEN];
+
+static void setup_vmath(uint32_t size)
+{
+  uint32_t k;
+
+  (void) size;
+  for (k = 0U; k < VMATH_MAX_LEN; k++)
+  {
+    vmath_x[k] = 8.0f * bench_in[k];
+    vmath_y[k] = bench_in[(k * 7U) % BENCH_MAX_VALUES];
+    vmath_pos[k] = fabsf(1000.0f * bench_in[k]) + 1.0e-3f;
+  }
+}
+
+static void run_libm_exp(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    bench_buf[k] = expf(vmath_x[k]);
+  }
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_vexp(uint32_t size)
+{
+  arm_vexp_f32(vmath_x, bench_buf, size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_libm_log(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    bench_buf[k] = logf(vmath_pos[k]);
+  }
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_vlog(uint32_t size)
+{
+  arm_vlog_f32(vmath_pos, bench_buf, size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_libm_tanh(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    bench_buf[k] = tanhf(vmath_x[k]);
+  }
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_vtanh(uint32_t size)
+{
+  arm_vtanh_f32(vmath_x, bench_buf, size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_libm_atan2(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    bench_buf[k] = atan2f(vmath_y[k], vmath_x[k]);
+  }
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_atan2(uint32_t size)
+{
+  arm_atan2_f32(vmath_y, vmath_x, bench_buf, size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_sqrt_loop(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    (void) arm_sqrt_f32(vmath_pos[k], bench_buf + k);
+  }
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_vsqrt(uint32_t size)
+{
+  arm_vsqrt_f32(vmath_pos, bench_buf, (uint16_t) size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_sincos_table(uint32_t size)
+{
+  uint32_t k;
+
+  for (k = 0U; k < size; k++)
+  {
+    bench_buf[k] = arm_sin_f32(vmath_x[k]);
+    bench_scratch[k] = arm_cos_f32(vmath_x[k]);
+  }
+  bench_sink += bench_buf[size - 1U] + bench_scratch[size - 1U];
+}
+
+static void run_vsincos(uint32_t size)
+{
+  arm_vsincos_f32(vmath_x, bench_buf, bench_scratch, size);
+  bench_sink += bench_buf[size - 1U] + bench_scratch[size - 1U];
+}
+
+static void run_vsin(uint32_t size)
+{
+  arm_vsin_f32(vmath_x, bench_buf, size);
+  bench_sink += bench_buf[size - 1U];
+}
+
+static void run_nco(uint32_t size)
+{
+  arm_nco_instance_f32 S;
+
+  arm_nco_init_f32(&S, 0.0123f, 0.0f);
+  arm_nco_f32(&S, bench_buf, bench_scratch, size);
+  bench_sink += bench_buf[size - 1U] + bench_scratch[size - 1U];
+}
+
+static arm_moving_stats_instance_f32 moving_stats;
+static arm_moving_minmax_instance_f32 moving_minmax;
+static uint32_t moving_pos[2U * 4096U];
+static uint32_t moving_offset;
+
+static void setup_moving(uint32_t size)
+{
+  (void) arm_moving_stats_init_f32(&moving_stats, size, bench_buf);
+  (void) arm_moving_minmax_init_f32(&moving_minmax, size, bench_scratch, moving_pos);
+  arm_moving_stats_f32(&moving_stats, bench_in, size);
+  arm_moving_minmax_f32(&moving_minmax, bench_in, size);
+  moving_offset = size;
+}
+
+/* Next block of the stream, which wraps before the end of bench_in */
+static const float32_t *moving_next(uint32_t size)
+{
+  if (moving_offset + MOVING_BLOCK > BENCH_MAX_VALUES)
+  {
+    moving_offset = size;
+  }
+
+  moving_offset += MOVING_BLOCK;
+  return bench_in + moving_offset - MOVING_BLOCK;
+}
+
+static void run_moving_batch(uint32_t size)
+{
+  const float32_t *pWin = moving_next(size) + MOVING_BLOCK - size;
+  float32_t mean, var, rms, max, min;
+  uint32_t maxIndex, minIndex;
+
+  arm_mean_f32(pWin, size, &mean);
+  arm_var_f32(pWin, size, &var);
+  arm_rms_f32(pWin, size, &rms);
+  arm_max_f32(pWin, size, &max, &maxIndex);
+  arm_min_f32(pWin, size, &min, &minIndex);
+  bench_sink += mean + var + rms + max + min;
+}
+
+static void run_moving(uint32_t size)
+{
+  const float32_t *pSrc = moving_next(size);
+  float32_t mean, var, rms, max, min;
+  uint32_t maxIndex, minIndex;
+
+  arm_moving_stats_f32(&moving_stats, pSrc, MOVING_BLOCK);
+  arm_moving_minmax_f32(&moving_minmax, pSrc, MOVING_BLOCK);
+  arm_moving_mean_f32(&moving_stats, &mean);
+  arm_moving_var_f32(&moving_stats, &var);
+  arm_moving_rms_f32(&moving_stats, &rms);
+  arm_moving_max_f32(&moving_minmax, &max, &maxIndex);
+  arm_moving_min_f32(&moving_minmax, &min, &minIndex);
+  bench_sink += mean + var + rms + max + min;
+}
+
+static q31_t sort_q31[3U * SORT_MAX_LEN];
+static q15_t sort_q15[3U * SORT_MAX_LEN];
+
+static int sort_cmp_f32(const void *a, const void *b)
+{
+  const float32_t x = *(const float32_t *) a;
+  const float32_t y = *(const float32_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+static int sort_cmp_q31(const void *a, const void *b)
+{
+  const q31_t x = *(const q31_t *) a;
+  const q31_t y = *(const q31_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+static int sort_cmp_q15(const void *a, const void *b)
+{
+  const q15_t x = *(const q15_t *) a;
+  const q15_t y = *(const q15_t *) b;
+
+  return (x > y) - (x < y);
+}
+
+/* Scattered samples, where the period of 256 of bench_in would give many equal samples */
+static void setup_sort(uint32_t size)
+{
+  uint32_t i;
+
+  for (i = 0U; i < size; i++)
+  {
+    sort_q31[i] = (q31_t) (i * 2654435761U);
+    sort_q15[i] = (q15_t) (sort_q31[i] >> 16);
+    bench_buf[i] = (float32_t) sort_q31[i];
+  }
+}
+
+static void run_qsort_f32(uint32_t size)
+{
+  memcpy(bench_scratch, bench_buf, size * sizeof(float32_t));
+  qsort(bench_scratch, size, sizeof(float32_t), sort_cmp_f32);
+  bench_sink += bench_scratch[size >> 1U];
+}
+
+static void run_sort_f32(uint32_t size)
+{
+  arm_sort_f32(bench_buf, bench_scratch, bench_scratch + size, size);
+  bench_sink += bench_scratch[size >> 1U];
+}
+
+static void run_qsort_q31(uint32_t size)
+{
+  memcpy(sort_q31 + size, sort_q31, size * sizeof(q31_t));
+  qsort(sort_q31 + size, size, sizeof(q31_t), sort_cmp_q31);
+  bench_sink += (float32_t) sort_q31[size + (size >> 1U)];
+}
+
+static void run_sort_q31(uint32_t size)
+{
+  arm_sort_q31(sort_q31, sort_q31 + size, sort_q31 + 2U * size, size);
+  bench_sink += (float32_t) sort_q31[size + (size >> 1U)];
+}
+
+static void run_qsort_q15(uint32_t size)
+{
+  memcpy(sort_q15 + size, sort_q15, size * sizeof(q15_t));
+  qsort(sort_q15 + size, size, sizeof(q15_t), sort_cmp_q15);
+  bench_sink += (float32_t) sort_q15[size + (size >> 1U)];
+}
+
+static void run_sort_q15(uint32_t size)
+{
+  arm_sort_q15(sort_q15, sort_q15 + size, sort_q15 + 2U * size, size);
+  bench_sink += (float32_t) sort_q15[size + (size >> 1U)];
+}
+
+static arm_median_filter_instance_f32 median_filter;
+static float32_t median_state[127U];
+static uint32_t median_index[2U * 127U];
+
+static void setup_median(uint32_t size)
+{
+  (void) arm_median_filter_init_f32(&median_filter, size, median_state, median_index);
+  moving_offset = size;
+}
+
+static void run_median_qsort(uint32_t size)
+{
+  const float32_t *pSrc = bench_in + moving_offset;
+  float32_t win[127U];
+  uint32_t n;
+
+  for (n = 0U; n < MEDIAN_BLOCK; n++)
+  {
+    memcpy(win, pSrc + n + 1U - size, size * sizeof(float32_t));
+    qsort(win, size, sizeof(float32_t), sort_cmp_f32);
+    bench_buf[n] = win[size >> 1U];
+  }
+
+  moving_offset = (moving_offset + 2U * MEDIAN_BLOCK > BENCH_MAX_VALUES) ? size : moving_offset + MEDIAN_BLOCK;
+  bench_sink += bench_buf[MEDIAN_BLOCK - 1U];
+}
+
+static void run_median_filter(uint32_t size)
+{
+  const float32_t *pSrc = bench_in + moving_offset;
+
+  arm_median_filter_f32(&median_filter, pSrc, bench_buf, MEDIAN_BLOCK);
+
+  moving_offset = (moving_offset + 2U * MEDIAN_BLOCK > BENCH_MAX_VALUES) ? size : moving_offset + MEDIAN_BLOCK;
+  bench_sink += bench_buf[MEDIAN_BLOCK - 1U];
+}
+
+static const bench_case bench_cases[] = {
+  { "arm_cfft_mixed_f32", run_cfft_mixed, setup_cfft_mixed, frame_sizes, ARRAY_SIZE(frame_sizes), NULL },
+  { "arm_cfft_f32_padded", run_cfft_padded, setup_cfft_padded, frame_sizes, ARRAY_SIZE(frame_sizes), NULL },
+  { "arm_cfft_f32_x16", run_cfft_loop, setup_frames, batch_sizes, ARRAY_SIZE(batch_sizes), NULL },
+  { "arm_cfft_batch_f32_x16", run_cfft_batch, setup_frames, batch_sizes, ARRAY_SIZE(batch_sizes), NULL },
+  { "arm_rfft_fast_f32_x16", run_rfft_loop, setup_frames, batch_sizes, ARRAY_SIZE(batch_sizes), NULL },
+  { "arm_rfft_fast_batch_f32_x16", run_rfft_batch, setup_frames, batch_sizes, ARRAY_SIZE(batch_sizes), NULL },
+  { "arm_rfft_fast_init_f32", run_rfft_init, setup_frames, fft_ram_sizes, ARRAY_SIZE(fft_ram_sizes), NULL },
+  { "arm_rfft_fast_init_ram_f32", run_rfft_init_ram, setup_frames_ram, fft_ram_sizes, ARRAY_SIZE(fft_ram_sizes), NULL },
+  { "arm_rfft_fast_f32", run_rfft_single, setup_frames, fft_ram_sizes, ARRAY_SIZE(fft_ram_sizes), NULL },
+  { "arm_rfft_fast_f32_ram", run_rfft_single, setup_frames_ram, fft_ram_sizes, ARRAY_SIZE(fft_ram_sizes), NULL },
+  { "arm_mat_mult_f32", run_mat_mult, setup_mat_mult, matrix_sizes, ARRAY_SIZE(matrix_sizes), flops_mat_mult },
+  { "arm_conv_f32_16384", run_conv, setup_conv, conv_sizes, ARRAY_SIZE(conv_sizes), NULL },
+  { "arm_conv_fft_f32_16384", run_conv_fft, setup_conv, conv_sizes, ARRAY_SIZE(conv_sizes), NULL },
+  { "arm_conv_auto_f32_16384", run_conv_auto, setup_conv, conv_sizes, ARRAY_SIZE(conv_sizes), NULL },
+  { "arm_fir_f32_block64", run_fir_direct, setup_fir_direct, fir_sizes, ARRAY_SIZE(fir_sizes), NULL },
+  { "arm_fir_fft_f32_block64", run_fir_fft, setup_fir_fft, fir_sizes, ARRAY_SIZE(fir_sizes), NULL },
+  { "arm_fir_f32_grid_block1", run_fir_linear, setup_fir_circ_1, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_circ_f32_grid_block1", run_fir_circ, setup_fir_circ_1, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_f32_grid_block16", run_fir_linear, setup_fir_circ_16, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_circ_f32_grid_block16", run_fir_circ, setup_fir_circ_16, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_f32_grid_block64", run_fir_linear, setup_fir_circ_64, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_circ_f32_grid_block64", run_fir_circ, setup_fir_circ_64, fir_circ_sizes, ARRAY_SIZE(fir_circ_sizes), NULL },
+  { "arm_fir_interpolate_f32_160_147", run_interp_decim, setup_resample, resample_sizes, ARRAY_SIZE(resample_sizes), NULL },
+  { "arm_fir_resample_f32_160_147", run_resample, setup_resample, resample_sizes, ARRAY_SIZE(resample_sizes), NULL },
+  { "arm_fir_f32_64taps_xN", run_fir_mc_loop, setup_fir_mc_planar, fir_mc_sizes, ARRAY_SIZE(fir_mc_sizes), NULL },
+  { "arm_fir_multichannel_f32_planar", run_fir_mc, setup_fir_mc_planar, fir_mc_sizes, ARRAY_SIZE(fir_mc_sizes), NULL },
+  { "arm_fir_multichannel_f32_interleaved", run_fir_mc, setup_fir_mc_interleaved, fir_mc_sizes, ARRAY_SIZE(fir_mc_sizes), NULL },
+  { "stft_passes_f32_logmel40", run_stft_passes, setup_stft, stft_sizes, ARRAY_SIZE(stft_sizes), NULL },
+  { "arm_stft_f32_logmel40", run_stft, setup_stft, stft_sizes, ARRAY_SIZE(stft_sizes), NULL },
+  { "arm_rfft_fast_f32_power_256", run_goertzel_rfft, setup_goertzel_256, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "arm_goertzel_f32_256", run_goertzel, setup_goertzel_256, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "arm_sdft_f32_256", run_sdft, setup_goertzel_256, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "arm_rfft_fast_f32_power_1024", run_goertzel_rfft, setup_goertzel_1024, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "arm_goertzel_f32_1024", run_goertzel, setup_goertzel_1024, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "arm_sdft_f32_1024", run_sdft, setup_goertzel_1024, goertzel_sizes, ARRAY_SIZE(goertzel_sizes), NULL },
+  { "libm_expf", run_libm_exp, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vexp_f32", run_vexp, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "libm_logf", run_libm_log, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vlog_f32", run_vlog, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "libm_tanhf", run_libm_tanh, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vtanh_f32", run_vtanh, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "libm_atan2f", run_libm_atan2, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_atan2_f32", run_atan2, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_sqrt_f32_loop", run_sqrt_loop, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vsqrt_f32", run_vsqrt, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_sin_f32_cos_f32_loop", run_sincos_table, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vsincos_f32", run_vsincos, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_vsin_f32", run_vsin, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "arm_nco_f32", run_nco, setup_vmath, vmath_sizes, ARRAY_SIZE(vmath_sizes), NULL },
+  { "stats_f32_window_block64", run_moving_batch, setup_moving, moving_sizes, ARRAY_SIZE(moving_sizes), NULL },
+  { "arm_moving_stats_f32_block64", run_moving, setup_moving, moving_sizes, ARRAY_SIZE(moving_sizes), NULL },
+  { "libc_qsort_f32", run_qsort_f32, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "arm_sort_f32", run_sort_f32, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "libc_qsort_q31", run_qsort_q31, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "arm_sort_q31", run_sort_q31, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "libc_qsort_q15", run_qsort_q15, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "arm_sort_q15", run_sort_q15, setup_sort, sort_sizes, ARRAY_SIZE(sort_sizes), NULL },
+  { "median_f32_qsort_block256", run_median_qsort, setup_median, median_sizes, ARRAY_SIZE(median_sizes), NULL },
+  { "arm_median_filter_f32_block256", run_median_filter, setup_median, median_sizes, ARRAY_SIZE(median_sizes), NULL },
+};
+
+/* ---- Driver ------------------------------------------------------------- */
+
+static void bench_run(const bench_case *c, uint32_t size, uint64_t min_ns, int first)
+{
+  uint64_t iterations = 1U;
+  uint64_t ns, ns0;
+  uint64_t cycles, c0;
+  uint64_t i;
+
+  for (i = 0U; i < BENCH_WARMUP; i++)
+  {
+    c->fn(size);
+  }
+
+  /* Double the batch until it runs long enough to time reliably */
+  for (;;)
+  {
+    ns0 = bench_ns();
+    c0 = bench_cycles();
+    for (i = 0U; i < iterations; i++)
+    {
+      c->fn(size);
+    }
+    cycles = bench_cycles() - c0;
+    ns = bench_ns() - ns0;
+
+    if ((ns >= min_ns) || (iterations >= (UINT64_C(1) << 40)))
+    {
+      break;
+    }
+    iterations *= 2U;
+  }
+
+  printf("%s\n    {\"name\": \"%s\", \"size\": %" PRIu32 ", \"iterations\": %" PRIu64 ", "
+         "\"cycles_per_op\": %.1f, \"ns_per_op\": %.1f",
+         first ? "" : ",", c->name, size, iterations,
+         (double) cycles / (double) iterations, (double) ns / (double) iterations);
+  if (c->flops != NULL)
+  {
+    printf(", \"gflops\": %.2f", c->flops(size) * (float64_t) iterations / (float64_t) ns);
+  }
+  printf("}");
+}
+
+int main(int argc, char *argv[])
+{
+  const uint64_t min_ns = ((argc > 1) ? strtoull(argv[1], NULL, 0) : 50U) * UINT64_C(1000000);
+  uint32_t i, s;
+  int first = 1;
+
+  for (i = 0U; i < BENCH_MAX_VALUES; i++)
+  {
+    bench_in[i] = (float32_t) ((int32_t) ((i * 131U + 7U) % 256U) - 128) / 128.0f;
+  }
+
+  printf("{\n  \"counter\": \"%s\",\n  \"results\": [", BENCH_HAVE_TSC ? "tsc" : "ns");
+
+  for (i = 0U; i < ARRAY_SIZE(bench_cases); i++)
+  {
+    const bench_case *const c = &bench_cases[i];
+
+    for (s = 0U; s < c->nsizes; s++)
+    {
+      if (c->setup != NULL)
+      {
+        c->setup(c->sizes[s]);
+      }
+      bench_run(c, c->sizes[s], min_ns, first);
+      first = 0;
+    }
+  }
+
+  printf("\n  ]\n}\n");
+
+  return EXIT_SUCCESS;
+}
@@ -5,5 +5,6 @@
 /* Declare Test Groups */
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP(fast_math_tests);
+JTEST_DECLARE_GROUP(vmath_tests);
 
 #endif /* _FAST_MATH_TEST_GROUP_H_ */
@@ -7,8 +7,13 @@
 
 JTEST_DECLARE_GROUP(biquad_tests);
 JTEST_DECLARE_GROUP(conv_tests);
+JTEST_DECLARE_GROUP(conv_fft_tests);
 JTEST_DECLARE_GROUP(correlate_tests);
 JTEST_DECLARE_GROUP(fir_tests);
+JTEST_DECLARE_GROUP(fir_circ_tests);
+JTEST_DECLARE_GROUP(fir_fft_tests);
+JTEST_DECLARE_GROUP(fir_multichannel_tests);
+JTEST_DECLARE_GROUP(fir_resample_tests);
 JTEST_DECLARE_GROUP(iir_tests);
 JTEST_DECLARE_GROUP(lms_tests);
 
@@ -6,6 +6,7 @@
 /*--------------------------------------------------------------------------------*/
 JTEST_DECLARE_GROUP(copy_tests);
 JTEST_DECLARE_GROUP(fill_tests);
+JTEST_DECLARE_GROUP(sort_tests);
 JTEST_DECLARE_GROUP(x_to_y_tests);
 
 #endif /* _SUPPORT_TESTS_H_ */
@@ -13,6 +13,7 @@
 /*--------------------------------------------------------------------------------*/
 
 #define TRANSFORM_MAX_FFT_LEN 4096
+#define TRANSFORM_MAX_LARGE_FFT_LEN 8192
 #define TRANFORM_BIGGEST_INPUT_TYPE float32_t
 
 /*--------------------------------------------------------------------------------*/
@@ -32,6 +33,9 @@ extern float32_t transform_fft_f32_inputs[TRANSFORM_MAX_FFT_LEN * 2];
 extern q31_t transform_fft_q31_inputs[TRANSFORM_MAX_FFT_LEN * 2];
 extern q15_t * transform_fft_q15_inputs;
 extern q15_t dct4_transform_fft_q15_inputs[TRANSFORM_MAX_FFT_LEN * 2];
+extern float32_t transform_large_fft_fut[TRANSFORM_MAX_LARGE_FFT_LEN * 2];
+extern float32_t transform_large_fft_ref[TRANSFORM_MAX_LARGE_FFT_LEN * 2];
+extern float32_t transform_large_fft_work[TRANSFORM_MAX_LARGE_FFT_LEN * 2];
 
 /* FFT Lengths */
 ARR_DESC_DECLARE(transform_radix2_fftlens);
@@ -39,6 +43,8 @@ ARR_DESC_DECLARE(transform_radix4_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fftlens);
 ARR_DESC_DECLARE(transform_rfft_fast_fftlens);
 ARR_DESC_DECLARE(transform_dct_fftlens);
+ARR_DESC_DECLARE(transform_cfft_mixed_fftlens);
+ARR_DESC_DECLARE(transform_cfft_large_fftlens);
 
 /* CFFT Structs */
 ARR_DESC_DECLARE(transform_cfft_f32_structs);
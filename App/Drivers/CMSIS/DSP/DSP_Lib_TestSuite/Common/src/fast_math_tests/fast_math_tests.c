@@ -3,6 +3,7 @@
 #include "arr_desc.h"
 #include "fast_math_templates.h"
 #include "fast_math_test_data.h"
+#include "fast_math_test_group.h"
 #include "type_abbrev.h"
 
 SQRT_TEST_TEMPLATE_ELT1(q31);
@@ -35,4 +36,6 @@ JTEST_DEFINE_GROUP(fast_math_tests)
     JTEST_TEST_CALL(arm_cos_f32_test);
     JTEST_TEST_CALL(arm_cos_q31_test);
     JTEST_TEST_CALL(arm_cos_q15_test);
+
+    JTEST_GROUP_CALL(vmath_tests);
 }
@@ -0,0 +1,620 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "fast_math_templates.h"
+#include "fast_math_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* The vector functions are compared with the C library, computed in double
+ * precision. The floating-point outputs are checked against the error in ULP
+ * documented for each function, over sweeps of the input range and at the special
+ * values; the fixed-point outputs against the error in LSB of the output format.
+ * The inputs are given in blocks of several sizes, which end in the scalar tails
+ * of the vector loops. */
+/*--------------------------------------------------------------------------------*/
+
+#define VMATH_SWEEP_ELTS    4096
+#define VMATH_MAX_BLOCK     1000
+
+static float32_t vmath_input_x[VMATH_SWEEP_ELTS];
+static float32_t vmath_input_y[VMATH_SWEEP_ELTS];
+static float32_t vmath_fut[VMATH_SWEEP_ELTS];
+static q31_t vmath_input_q31[VMATH_SWEEP_ELTS];
+static q31_t vmath_fut_q31[VMATH_SWEEP_ELTS];
+static q15_t vmath_input_q15[VMATH_SWEEP_ELTS];
+static q15_t vmath_fut_q15[VMATH_SWEEP_ELTS];
+
+/* Input block sizes, used in turn */
+static const uint32_t vmath_blocks[] = {1, 7, VMATH_MAX_BLOCK, 64, 33};
+
+/**
+ *  Assert that the largest error is within the documented bound.
+ */
+#define VMATH_ASSERT_MAX_ERROR(err, bound)                        \
+    do                                                            \
+    {                                                             \
+        if ((err) > (bound))                                      \
+        {                                                         \
+            JTEST_DUMP_STRF("Max error: %f\n", (double) (err));   \
+            return JTEST_TEST_FAILED;                             \
+        }                                                         \
+    } while (0)
+
+static uint32_t vmath_block_len(uint32_t n, uint32_t blk, uint32_t len)
+{
+    uint32_t blk_len = vmath_blocks[blk % (sizeof(vmath_blocks) / sizeof(vmath_blocks[0]))];
+
+    return (blk_len < len - n) ? blk_len : len - n;
+}
+
+/**
+ *  Distance in ULP between a float and the float nearest to a double. Equal
+ *  values, including infinities and NaNs, are 0 ULP apart.
+ */
+static float64_t vmath_ulp_f32(float32_t x, float64_t ref)
+{
+    union { float32_t f; int32_t i; } a, b;
+    int64_t ia, ib;
+
+    b.f = (float32_t) ref;
+    a.f = x;
+
+    if ((a.f == b.f) || (isnan(a.f) && isnan(b.f)))
+    {
+        return 0.0;
+    }
+
+#if defined(ARM_MATH_NEON) && !defined(__aarch64__)
+    /* Armv7 Neon flushes subnormal results to zero */
+    if ((a.f == 0.0f) && (fabs(ref) < FLT_MIN))
+    {
+        return 0.0;
+    }
+#endif
+
+    if (isnan(a.f) || isnan(b.f) || isinf(a.f) || isinf(b.f))
+    {
+        return 1e30;
+    }
+
+    /* Integers in the order of the floats */
+    ia = (a.i < 0) ? (int64_t) INT32_MIN - a.i : a.i;
+    ib = (b.i < 0) ? (int64_t) INT32_MIN - b.i : b.i;
+
+    return (float64_t) ((ia > ib) ? ia - ib : ib - ia);
+}
+
+/**
+ *  Floats evenly spaced in their ordering between lo and hi, so that every
+ *  binade of the range is sampled.
+ */
+static void vmath_sweep_f32(float32_t * dst, uint32_t len, float32_t lo, float32_t hi)
+{
+    union { float32_t f; int32_t i; } a, b, x;
+    int64_t ia, ib, ix;
+    uint32_t n;
+
+    a.f = lo;
+    b.f = hi;
+    ia = (a.i < 0) ? (int64_t) INT32_MIN - a.i : a.i;
+    ib = (b.i < 0) ? (int64_t) INT32_MIN - b.i : b.i;
+
+    for (n = 0; n < len; n++)
+    {
+        ix = ia + (ib - ia) * (int64_t) n / (int64_t) (len - 1);
+        x.i = (int32_t) ((ix < 0) ? (int64_t) INT32_MIN - ix : ix);
+        dst[n] = x.f;
+    }
+}
+
+typedef void (*vmath_fn_f32)(const float32_t *, float32_t *, uint32_t);
+
+/**
+ *  Run a function on len inputs in blocks, and return the largest error in ULP
+ *  against the C library function.
+ */
+static float64_t vmath_run_f32(vmath_fn_f32 fut, float64_t (*ref)(float64_t),
+                               const float32_t * pSrc, uint32_t len)
+{
+    float64_t err, max_err = 0.0;
+    uint32_t n, blk, blk_len;
+
+    for (n = 0, blk = 0; n < len; n += blk_len, blk++)
+    {
+        blk_len = vmath_block_len(n, blk, len);
+
+        JTEST_COUNT_CYCLES(fut(pSrc + n, vmath_fut + n, blk_len));
+    }
+
+    for (n = 0; n < len; n++)
+    {
+        err = vmath_ulp_f32(vmath_fut[n], ref((float64_t) pSrc[n]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    return max_err;
+}
+
+static const float32_t vmath_specials[] = {
+    0.0f, -0.0f, 1.0f, -1.0f, INFINITY, -INFINITY, NAN, 1.0e-45f, -1.0e-45f,
+    1.0e-40f, FLT_MIN, FLT_MAX, -FLT_MAX, 88.8f, -88.0f, 100.0f, -100.0f, 0.5f
+};
+
+#define VMATH_NUM_SPECIALS (sizeof(vmath_specials) / sizeof(vmath_specials[0]))
+
+JTEST_DEFINE_TEST(arm_vexp_f32_test, arm_vexp_f32)
+{
+    vmath_sweep_f32(vmath_input_x, VMATH_SWEEP_ELTS / 2, -87.3f, 88.7f);
+    vmath_sweep_f32(vmath_input_x + VMATH_SWEEP_ELTS / 2, VMATH_SWEEP_ELTS / 2, -1.0f, 1.0f);
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vexp_f32, exp, vmath_input_x, VMATH_SWEEP_ELTS), 1.0);
+
+    /* Overflow to +Inf, flush to 0 below the normal range */
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vexp_f32, exp, vmath_specials, 13), 1.0);
+    arm_vexp_f32(vmath_specials + 13, vmath_fut, 4);
+    TEST_ASSERT_EQUAL(INFINITY, vmath_fut[0]);
+    TEST_ASSERT_EQUAL(0.0f, vmath_fut[1]);
+    TEST_ASSERT_EQUAL(INFINITY, vmath_fut[2]);
+    TEST_ASSERT_EQUAL(0.0f, vmath_fut[3]);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vlog_f32_test, arm_vlog_f32)
+{
+    vmath_sweep_f32(vmath_input_x, VMATH_SWEEP_ELTS / 2, 1.0e-45f, FLT_MAX);
+    vmath_sweep_f32(vmath_input_x + VMATH_SWEEP_ELTS / 2, VMATH_SWEEP_ELTS / 2, 0.5f, 2.0f);
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vlog_f32, log, vmath_input_x, VMATH_SWEEP_ELTS), 1.0);
+
+    /* -Inf for zeros, NaN for negative inputs */
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vlog_f32, log, vmath_specials, VMATH_NUM_SPECIALS), 1.0);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vtanh_f32_test, arm_vtanh_f32)
+{
+    vmath_sweep_f32(vmath_input_x, VMATH_SWEEP_ELTS, -20.0f, 20.0f);
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vtanh_f32, tanh, vmath_input_x, VMATH_SWEEP_ELTS), 2.0);
+    VMATH_ASSERT_MAX_ERROR(vmath_run_f32(arm_vtanh_f32, tanh, vmath_specials, VMATH_NUM_SPECIALS), 2.0);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_atan2_f32_test, arm_atan2_f32)
+{
+    float64_t err, max_err = 0.0;
+    uint32_t n, blk, blk_len, i, j;
+
+    /* Points around circles of radii from 1e-30 to 1e30, and on the diagonals */
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        float64_t a = 6.283185307179586 * (float64_t) n / 997.0;
+        float64_t r = pow(10.0, -30.0 + 60.0 * (float64_t) (n % 101) / 100.0);
+
+        vmath_input_x[n] = (float32_t) (r * cos(a));
+        vmath_input_y[n] = (float32_t) (r * sin(a));
+
+        if ((n % 17) == 0)
+        {
+            vmath_input_y[n] = ((n % 2) == 0) ? vmath_input_x[n] : -vmath_input_x[n];
+        }
+    }
+
+    for (n = 0, blk = 0; n < VMATH_SWEEP_ELTS; n += blk_len, blk++)
+    {
+        blk_len = vmath_block_len(n, blk, VMATH_SWEEP_ELTS);
+
+        JTEST_COUNT_CYCLES(
+            arm_atan2_f32(vmath_input_y + n, vmath_input_x + n, vmath_fut + n, blk_len));
+    }
+
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        err = vmath_ulp_f32(vmath_fut[n], atan2((float64_t) vmath_input_y[n], (float64_t) vmath_input_x[n]));
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 3.0);
+
+    /* All the pairs of special values, with the signs of zeros */
+    n = 0;
+    for (i = 0; i < VMATH_NUM_SPECIALS; i++)
+    {
+        for (j = 0; j < VMATH_NUM_SPECIALS; j++)
+        {
+            vmath_input_y[n] = vmath_specials[i];
+            vmath_input_x[n] = vmath_specials[j];
+            n++;
+        }
+    }
+
+    arm_atan2_f32(vmath_input_y, vmath_input_x, vmath_fut, n);
+
+    for (i = 0; i < n; i++)
+    {
+        float64_t ref = atan2((float64_t) vmath_input_y[i], (float64_t) vmath_input_x[i]);
+
+        VMATH_ASSERT_MAX_ERROR(vmath_ulp_f32(vmath_fut[i], ref), 3.0);
+        if (!isnan(ref))
+        {
+            TEST_ASSERT_EQUAL(signbit(ref) != 0, signbit(vmath_fut[i]) != 0);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Check the sines and cosines of len inputs against the documented bounds:
+ *  2^-23 in absolute value, and 2 ULP for outputs of magnitude above 0.5.
+ */
+static int vmath_check_sincos_f32(const float32_t * pSrc, const float32_t * pSin,
+                                  const float32_t * pCos, uint32_t len)
+{
+    float64_t ref_s, ref_c;
+    uint32_t n;
+
+    for (n = 0; n < len; n++)
+    {
+        ref_s = sin((float64_t) pSrc[n]);
+        ref_c = cos((float64_t) pSrc[n]);
+
+        if ((fabs(pSin[n] - ref_s) > 0x1p-23) || (fabs(pCos[n] - ref_c) > 0x1p-23) ||
+            ((fabs(ref_s) > 0.5) && (vmath_ulp_f32(pSin[n], ref_s) > 2.0)) ||
+            ((fabs(ref_c) > 0.5) && (vmath_ulp_f32(pCos[n], ref_c) > 2.0)))
+        {
+            JTEST_DUMP_STRF("x: %g sin: %g cos: %g\n",
+                            (double) pSrc[n], (double) pSin[n], (double) pCos[n]);
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+JTEST_DEFINE_TEST(arm_vsincos_f32_test, arm_vsincos_f32)
+{
+    uint32_t n, blk, blk_len;
+
+    /* The documented range, then one turn and the small angles */
+    for (n = 0; n < VMATH_SWEEP_ELTS / 2; n++)
+    {
+        vmath_input_x[n] = -8192.0f + 16384.0f * (float32_t) n / (VMATH_SWEEP_ELTS / 2 - 1);
+    }
+    vmath_sweep_f32(vmath_input_x + VMATH_SWEEP_ELTS / 2, VMATH_SWEEP_ELTS / 4, -PI, PI);
+    vmath_sweep_f32(vmath_input_x + 3 * VMATH_SWEEP_ELTS / 4, VMATH_SWEEP_ELTS / 4, 1.0e-45f, 1.0f);
+
+    for (n = 0, blk = 0; n < VMATH_SWEEP_ELTS; n += blk_len, blk++)
+    {
+        blk_len = vmath_block_len(n, blk, VMATH_SWEEP_ELTS);
+
+        JTEST_COUNT_CYCLES(
+            arm_vsincos_f32(vmath_input_x + n, vmath_fut + n, vmath_input_y + n, blk_len));
+    }
+
+    TEST_ASSERT_EQUAL(1, vmath_check_sincos_f32(vmath_input_x, vmath_fut, vmath_input_y, VMATH_SWEEP_ELTS));
+
+    /* NaN for infinite and NaN inputs */
+    arm_vsincos_f32(vmath_specials + 4, vmath_fut, vmath_input_y, 3);
+
+    for (n = 0; n < 3; n++)
+    {
+        VMATH_ASSERT_MAX_ERROR(vmath_ulp_f32(vmath_fut[n], sin((float64_t) vmath_specials[4 + n])), 0.0);
+        VMATH_ASSERT_MAX_ERROR(vmath_ulp_f32(vmath_input_y[n], cos((float64_t) vmath_specials[4 + n])), 0.0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsin_f32_test, arm_vsin_f32)
+{
+    uint32_t n;
+
+    /* Same outputs as arm_vsincos_f32(), in place */
+    for (n = 0; n < VMATH_MAX_BLOCK + 3; n++)
+    {
+        vmath_input_x[n] = -100.0f + 0.2f * (float32_t) n;
+    }
+
+    arm_vsincos_f32(vmath_input_x, vmath_input_y, vmath_fut, VMATH_MAX_BLOCK + 3);
+
+    JTEST_COUNT_CYCLES(arm_vsin_f32(vmath_input_x, vmath_input_x, VMATH_MAX_BLOCK + 3));
+
+    for (n = 0; n < VMATH_MAX_BLOCK + 3; n++)
+    {
+        TEST_ASSERT_EQUAL(vmath_input_y[n], vmath_input_x[n]);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vcos_f32_test, arm_vcos_f32)
+{
+    uint32_t n;
+
+    for (n = 0; n < VMATH_MAX_BLOCK + 3; n++)
+    {
+        vmath_input_x[n] = -100.0f + 0.2f * (float32_t) n;
+    }
+
+    arm_vsincos_f32(vmath_input_x, vmath_fut, vmath_input_y, VMATH_MAX_BLOCK + 3);
+
+    JTEST_COUNT_CYCLES(arm_vcos_f32(vmath_input_x, vmath_input_x, VMATH_MAX_BLOCK + 3));
+
+    for (n = 0; n < VMATH_MAX_BLOCK + 3; n++)
+    {
+        TEST_ASSERT_EQUAL(vmath_input_y[n], vmath_input_x[n]);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_nco_f32_test, arm_nco_f32)
+{
+    static const float32_t freqs[] = {0.0f, 1.0e-6f, 0.0123f, 0.25f, 0.4999f, 0.5f, -0.1f};
+    arm_nco_instance_f32 S;
+    float64_t a, err, max_err = 0.0;
+    uint32_t f, n, blk, blk_len, phase0;
+
+    for (f = 0; f < sizeof(freqs) / sizeof(freqs[0]); f++)
+    {
+        arm_nco_init_f32(&S, freqs[f], 1.0f);
+        phase0 = S.phase;
+
+        /* Consecutive blocks continue the phase */
+        for (n = 0, blk = 0; n < VMATH_SWEEP_ELTS; n += blk_len, blk++)
+        {
+            blk_len = vmath_block_len(n, blk, VMATH_SWEEP_ELTS);
+
+            JTEST_COUNT_CYCLES(arm_nco_f32(&S, vmath_fut + n, vmath_input_y + n, blk_len));
+        }
+
+        TEST_ASSERT_EQUAL(phase0 + VMATH_SWEEP_ELTS * S.phaseInc, S.phase);
+
+        for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+        {
+            a = 6.283185307179586 * (float64_t) (uint32_t) (phase0 + n * S.phaseInc) / 4294967296.0;
+            err = fabs(vmath_fut[n] - sin(a));
+            max_err = (err > max_err) ? err : max_err;
+            err = fabs(vmath_input_y[n] - cos(a));
+            max_err = (err > max_err) ? err : max_err;
+        }
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 1.0e-6);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsqrt_f32_test, arm_vsqrt_f32)
+{
+    uint32_t n;
+
+    vmath_sweep_f32(vmath_input_x, VMATH_MAX_BLOCK + 3, -1.0f, FLT_MAX);
+
+    JTEST_COUNT_CYCLES(arm_vsqrt_f32(vmath_input_x, vmath_fut, VMATH_MAX_BLOCK + 3));
+
+    for (n = 0; n < VMATH_MAX_BLOCK + 3; n++)
+    {
+        float64_t ref = (vmath_input_x[n] >= 0.0f) ? sqrt((float64_t) vmath_input_x[n]) : 0.0;
+
+        VMATH_ASSERT_MAX_ERROR(vmath_ulp_f32(vmath_fut[n], ref), 2.0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsqrt_q31_test, arm_vsqrt_q31)
+{
+    q31_t ref;
+    uint32_t n;
+
+    JTEST_COUNT_CYCLES(
+        arm_vsqrt_q31((q31_t *) fast_math_q31_inputs, vmath_fut_q31, FAST_MATH_MAX_LEN - 1));
+
+    for (n = 0; n < FAST_MATH_MAX_LEN - 1; n++)
+    {
+        arm_sqrt_q31(fast_math_q31_inputs[n], &ref);
+        VMATH_ASSERT_MAX_ERROR(fabs((float64_t) vmath_fut_q31[n] - ref), 128.0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vsqrt_q15_test, arm_vsqrt_q15)
+{
+    float64_t ref;
+    uint32_t n;
+
+    JTEST_COUNT_CYCLES(
+        arm_vsqrt_q15((q15_t *) fast_math_q15_inputs, vmath_fut_q15, FAST_MATH_MAX_LEN - 1));
+
+    /* Against the exact root, from which arm_sqrt_q15() itself is up to 6 LSB away */
+    for (n = 0; n < FAST_MATH_MAX_LEN - 1; n++)
+    {
+        ref = (fast_math_q15_inputs[n] > 0) ? sqrt((float64_t) fast_math_q15_inputs[n] * 32768.0) : 0.0;
+        VMATH_ASSERT_MAX_ERROR(fabs((float64_t) vmath_fut_q15[n] - ref), 6.0);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  Q31 inputs in (0, 1), spread over all the normalization shifts, and the
+ *  extreme values.
+ */
+static void vmath_make_log_inputs_q31(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        vmath_input_q31[n] = (q31_t) ((((uint32_t) n * 2654435761u) & 0x7FFFFFFFu) >> (n % 31));
+        vmath_input_q31[n] = (vmath_input_q31[n] > 0) ? vmath_input_q31[n] : 1;
+    }
+
+    vmath_input_q31[0] = 1;
+    vmath_input_q31[1] = 0x7FFFFFFF;
+    vmath_input_q31[2] = 0x40000000;
+}
+
+JTEST_DEFINE_TEST(arm_vlog_q31_test, arm_vlog_q31)
+{
+    float64_t err, max_err = 0.0;
+    uint32_t n, blk, blk_len;
+
+    vmath_make_log_inputs_q31();
+
+    for (n = 0, blk = 0; n < VMATH_SWEEP_ELTS; n += blk_len, blk++)
+    {
+        blk_len = vmath_block_len(n, blk, VMATH_SWEEP_ELTS);
+
+        JTEST_COUNT_CYCLES(arm_vlog_q31(vmath_input_q31 + n, vmath_fut_q31 + n, blk_len));
+    }
+
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        err = fabs(vmath_fut_q31[n] - log(vmath_input_q31[n] / 2147483648.0) * 67108864.0);
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 1.0);
+
+    /* Zero and negative inputs give the most negative output */
+    vmath_input_q31[0] = 0;
+    vmath_input_q31[1] = (q31_t) 0x80000000;
+    arm_vlog_q31(vmath_input_q31, vmath_fut_q31, 2);
+    TEST_ASSERT_EQUAL((q31_t) 0x80000000, vmath_fut_q31[0]);
+    TEST_ASSERT_EQUAL((q31_t) 0x80000000, vmath_fut_q31[1]);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vlog_q15_test, arm_vlog_q15)
+{
+    float64_t err, max_err = 0.0;
+    uint32_t n, i, len;
+
+    /* All the positive Q15 inputs, and 0 */
+    for (n = 0; n < 0x8000; n += len)
+    {
+        len = (0x8000 - n < VMATH_SWEEP_ELTS) ? 0x8000 - n : VMATH_SWEEP_ELTS;
+
+        for (i = 0; i < len; i++)
+        {
+            vmath_input_q15[i] = (q15_t) (n + i);
+        }
+
+        JTEST_COUNT_CYCLES(arm_vlog_q15(vmath_input_q15, vmath_fut_q15, len));
+
+        for (i = (n == 0) ? 1 : 0; i < len; i++)
+        {
+            err = fabs(vmath_fut_q15[i] - log((n + i) / 32768.0) * 2048.0);
+            max_err = (err > max_err) ? err : max_err;
+        }
+
+        if (n == 0)
+        {
+            TEST_ASSERT_EQUAL((q15_t) 0x8000, vmath_fut_q15[0]);
+        }
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 0.5 + 1e-3);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vexp_q31_test, arm_vexp_q31)
+{
+    float64_t err, ref, max_err = 0.0;
+    uint32_t n, blk, blk_len;
+
+    /* Negative 5.26 inputs of all magnitudes, then 0 and positive inputs which saturate */
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        vmath_input_q31[n] = -(q31_t) ((((uint32_t) n * 2654435761u) & 0x7FFFFFFFu) >> (n % 28));
+    }
+
+    vmath_input_q31[0] = (q31_t) 0x80000000;
+    vmath_input_q31[1] = -1;
+    vmath_input_q31[2] = 0;
+    vmath_input_q31[3] = 0x7FFFFFFF;
+
+    for (n = 0, blk = 0; n < VMATH_SWEEP_ELTS; n += blk_len, blk++)
+    {
+        blk_len = vmath_block_len(n, blk, VMATH_SWEEP_ELTS);
+
+        JTEST_COUNT_CYCLES(arm_vexp_q31(vmath_input_q31 + n, vmath_fut_q31 + n, blk_len));
+    }
+
+    for (n = 0; n < VMATH_SWEEP_ELTS; n++)
+    {
+        ref = exp(vmath_input_q31[n] / 67108864.0) * 2147483648.0;
+        ref = (ref < 2147483647.0) ? ref : 2147483647.0;
+        err = fabs(vmath_fut_q31[n] - ref);
+        max_err = (err > max_err) ? err : max_err;
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 3.0);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_vexp_q15_test, arm_vexp_q15)
+{
+    float64_t err, ref, max_err = 0.0;
+    uint32_t n, i, len;
+
+    /* All the Q15 inputs */
+    for (n = 0; n < 0x10000; n += len)
+    {
+        len = (0x10000 - n < VMATH_SWEEP_ELTS) ? 0x10000 - n : VMATH_SWEEP_ELTS;
+
+        for (i = 0; i < len; i++)
+        {
+            vmath_input_q15[i] = (q15_t) (n + i - 0x8000);
+        }
+
+        JTEST_COUNT_CYCLES(arm_vexp_q15(vmath_input_q15, vmath_fut_q15, len));
+
+        for (i = 0; i < len; i++)
+        {
+            ref = exp(vmath_input_q15[i] / 2048.0) * 32768.0;
+            ref = (ref < 32767.0) ? ref : 32767.0;
+            err = fabs(vmath_fut_q15[i] - ref);
+            max_err = (err > max_err) ? err : max_err;
+        }
+    }
+
+    VMATH_ASSERT_MAX_ERROR(max_err, 0.5 + 1e-3);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(vmath_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_vexp_f32_test);
+    JTEST_TEST_CALL(arm_vlog_f32_test);
+    JTEST_TEST_CALL(arm_vtanh_f32_test);
+    JTEST_TEST_CALL(arm_atan2_f32_test);
+    JTEST_TEST_CALL(arm_vsincos_f32_test);
+    JTEST_TEST_CALL(arm_vsin_f32_test);
+    JTEST_TEST_CALL(arm_vcos_f32_test);
+    JTEST_TEST_CALL(arm_nco_f32_test);
+    JTEST_TEST_CALL(arm_vsqrt_f32_test);
+    JTEST_TEST_CALL(arm_vsqrt_q31_test);
+    JTEST_TEST_CALL(arm_vsqrt_q15_test);
+    JTEST_TEST_CALL(arm_vlog_q31_test);
+    JTEST_TEST_CALL(arm_vlog_q15_test);
+    JTEST_TEST_CALL(arm_vexp_q31_test);
+    JTEST_TEST_CALL(arm_vexp_q15_test);
+}
@@ -0,0 +1,125 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_conv_fft_f32() and arm_correlate_fft_f32() are compared with arm_conv_f32()
+ * and arm_correlate_f32(). The lengths cover a kernel longer than the signal, a
+ * single partition of the kernel and a kernel split into partitions. */
+/*--------------------------------------------------------------------------------*/
+
+#define CONV_FFT_MAX_INPUT_ELTS   5000
+#define CONV_FFT_MAX_OUTPUT_ELTS  (CONV_FFT_MAX_INPUT_ELTS * 2)
+#define CONV_FFT_MAX_SCRATCH_ELTS (2 * 3 * 4096)
+
+static float32_t conv_fft_a[CONV_FFT_MAX_INPUT_ELTS];
+static float32_t conv_fft_b[CONV_FFT_MAX_INPUT_ELTS];
+static float32_t conv_fft_fut[CONV_FFT_MAX_OUTPUT_ELTS];
+static float32_t conv_fft_ref[CONV_FFT_MAX_OUTPUT_ELTS];
+static float32_t conv_fft_scratch[CONV_FFT_MAX_SCRATCH_ELTS];
+
+/* {srcALen, srcBLen} */
+static const uint16_t conv_fft_lengths[][2] =
+{
+    {1, 1}, {3, 5}, {100, 40}, {40, 100}, {1000, 33},
+    {700, 700}, {5000, 2500}, {600, 3000}
+};
+
+/**
+ *  Fill #count values at #buf with a deterministic pattern in [-1, 1).
+ */
+#define CONV_FFT_FILL(buf, count, seed)                                 \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            (buf)[fill_idx] = (float32_t)                               \
+                ((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127)     \
+                / 128.0f;                                               \
+        }                                                               \
+    } while (0)
+
+/**
+ *  Run #fut and #ref over all the lengths and compare #out_len(a, b) outputs.
+ */
+#define CONV_FFT_DEFINE_TEST(fut, ref, out_len)                         \
+    JTEST_DEFINE_TEST(fut##_test, fut)                                  \
+    {                                                                   \
+        uint32_t a_len, b_len, i;                                       \
+        arm_status status;                                              \
+                                                                        \
+        for (i = 0; i < sizeof(conv_fft_lengths) / sizeof(conv_fft_lengths[0]); i++) \
+        {                                                               \
+            a_len = conv_fft_lengths[i][0];                             \
+            b_len = conv_fft_lengths[i][1];                             \
+                                                                        \
+            JTEST_DUMP_STRF("Lengths: %d, %d\n", (int)a_len, (int)b_len); \
+                                                                        \
+            if (arm_conv_fft_scratch_size_f32(a_len, b_len) >           \
+                CONV_FFT_MAX_SCRATCH_ELTS)                              \
+            {                                                           \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+                                                                        \
+            CONV_FFT_FILL(conv_fft_a, a_len, 5u);                       \
+            CONV_FFT_FILL(conv_fft_b, b_len, 13u);                      \
+            memset(conv_fft_ref, 0, sizeof(conv_fft_ref));              \
+            memset(conv_fft_fut, 0xFF, sizeof(conv_fft_fut));           \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                status = fut(conv_fft_a, a_len, conv_fft_b, b_len,      \
+                             conv_fft_fut, conv_fft_scratch));          \
+            ref(conv_fft_a, a_len, conv_fft_b, b_len, conv_fft_ref);    \
+                                                                        \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, status);                \
+            TEST_ASSERT_SNR(conv_fft_ref, conv_fft_fut,                 \
+                            out_len(a_len, b_len),                      \
+                            FILTERING_SNR_THRESHOLD_float32_t);         \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+#define CONV_FFT_CONV_LEN(a_len, b_len)   ((a_len) + (b_len) - 1)
+#define CONV_FFT_CORR_LEN(a_len, b_len)   \
+    (2 * (((a_len) > (b_len)) ? (a_len) : (b_len)) - 1)
+
+CONV_FFT_DEFINE_TEST(arm_conv_fft_f32, arm_conv_f32, CONV_FFT_CONV_LEN);
+CONV_FFT_DEFINE_TEST(arm_conv_auto_f32, arm_conv_f32, CONV_FFT_CONV_LEN);
+CONV_FFT_DEFINE_TEST(arm_correlate_fft_f32, arm_correlate_f32, CONV_FFT_CORR_LEN);
+CONV_FFT_DEFINE_TEST(arm_correlate_auto_f32, arm_correlate_f32, CONV_FFT_CORR_LEN);
+
+JTEST_DEFINE_TEST(arm_conv_fft_f32_empty_test, arm_conv_fft_f32)
+{
+    TEST_ASSERT_EQUAL(0, arm_conv_fft_scratch_size_f32(0, 16));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_conv_fft_f32(conv_fft_a, 0, conv_fft_b, 16,
+                                       conv_fft_fut, conv_fft_scratch));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_correlate_fft_f32(conv_fft_a, 16, conv_fft_b, 0,
+                                            conv_fft_fut, conv_fft_scratch));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(conv_fft_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_conv_fft_f32_test);
+    JTEST_TEST_CALL(arm_conv_auto_f32_test);
+    JTEST_TEST_CALL(arm_correlate_fft_f32_test);
+    JTEST_TEST_CALL(arm_correlate_auto_f32_test);
+    JTEST_TEST_CALL(arm_conv_fft_f32_empty_test);
+}
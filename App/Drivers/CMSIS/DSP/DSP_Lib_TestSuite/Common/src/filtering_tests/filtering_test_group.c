@@ -8,8 +8,13 @@ JTEST_DEFINE_GROUP(filtering_tests)
   */
   JTEST_GROUP_CALL(biquad_tests);
   JTEST_GROUP_CALL(conv_tests);
+  JTEST_GROUP_CALL(conv_fft_tests);
   JTEST_GROUP_CALL(correlate_tests);
   JTEST_GROUP_CALL(fir_tests);
+  JTEST_GROUP_CALL(fir_circ_tests);
+  JTEST_GROUP_CALL(fir_fft_tests);
+  JTEST_GROUP_CALL(fir_multichannel_tests);
+  JTEST_GROUP_CALL(fir_resample_tests);
   JTEST_GROUP_CALL(iir_tests);
   JTEST_GROUP_CALL(lms_tests);
 
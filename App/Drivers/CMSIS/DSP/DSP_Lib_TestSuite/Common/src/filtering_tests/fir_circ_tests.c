@@ -0,0 +1,131 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_fir_circ_<suffix>() is compared with arm_fir_<suffix>(), which must give the
+ * same bits. The calls process varying numbers of samples up to the block size, so
+ * that the blocks start anywhere in the circular buffer and often wrap around it. */
+/*--------------------------------------------------------------------------------*/
+
+#define FIR_CIRC_MAX_TAPS       100
+#define FIR_CIRC_MAX_BLOCK      40
+#define FIR_CIRC_INPUT_ELTS     600
+
+static float32_t fir_circ_coeffs[FIR_CIRC_MAX_TAPS];
+static float32_t fir_circ_input[FIR_CIRC_INPUT_ELTS];
+static float32_t fir_circ_fut[FIR_CIRC_INPUT_ELTS];
+static float32_t fir_circ_ref[FIR_CIRC_INPUT_ELTS];
+static float32_t fir_circ_state[2 * (FIR_CIRC_MAX_TAPS + FIR_CIRC_MAX_BLOCK - 1)];
+static float32_t fir_circ_ref_state[FIR_CIRC_MAX_TAPS + FIR_CIRC_MAX_BLOCK - 1];
+
+/* {numTaps, blockSize} */
+static const uint16_t fir_circ_configs[][2] =
+{
+    {1, 1}, {1, 16}, {5, 1}, {32, 8}, {33, 40}, {100, 7}, {100, 40}
+};
+
+/* arm_fir_q15() needs an even number of taps */
+static const uint16_t fir_circ_configs_q15[][2] =
+{
+    {2, 1}, {4, 16}, {6, 1}, {32, 8}, {34, 40}, {100, 7}, {100, 40}
+};
+
+/**
+ *  Fill #count values of #type at #buf with a deterministic pattern of the
+ *  integers -127 .. 127 multiplied by #step.
+ */
+#define FIR_CIRC_FILL(type, buf, count, seed, step)                     \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            ((type *) (buf))[fill_idx] = (type)                         \
+                (((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127) *  \
+                 (step));                                               \
+        }                                                               \
+    } while (0)
+
+#define FIR_CIRC_DEFINE_TEST(suffix, type, step, configs)               \
+    JTEST_DEFINE_TEST(arm_fir_circ_##suffix##_test,                     \
+                      arm_fir_circ_##suffix)                            \
+    {                                                                   \
+        arm_fir_circ_instance_##suffix fir_circ_inst_fut;               \
+        arm_fir_instance_##suffix fir_inst_ref;                         \
+        uint32_t num_taps, block_size, call_len, i, n;                  \
+                                                                        \
+        FIR_CIRC_FILL(type, fir_circ_input, FIR_CIRC_INPUT_ELTS, 5u, step); \
+                                                                        \
+        for (i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)     \
+        {                                                               \
+            num_taps = configs[i][0];                                   \
+            block_size = configs[i][1];                                 \
+                                                                        \
+            JTEST_DUMP_STRF("Taps: %d, Block: %d\n",                    \
+                            (int)num_taps, (int)block_size);            \
+                                                                        \
+            FIR_CIRC_FILL(type, fir_circ_coeffs, num_taps, 13u, step);  \
+                                                                        \
+            arm_fir_circ_init_##suffix(&fir_circ_inst_fut, num_taps,    \
+                                       (type *) fir_circ_coeffs,        \
+                                       (type *) fir_circ_state,         \
+                                       block_size);                     \
+            arm_fir_init_##suffix(&fir_inst_ref, num_taps,              \
+                                  (type *) fir_circ_coeffs,             \
+                                  (type *) fir_circ_ref_state,          \
+                                  block_size);                          \
+                                                                        \
+            for (n = 0; n < FIR_CIRC_INPUT_ELTS; n += call_len)         \
+            {                                                           \
+                /* Full blocks, and blocks of 1 .. blockSize samples */ \
+                call_len = ((n / 3) % 2 == 0) ? block_size :            \
+                    ((n * 7u) % block_size) + 1;                        \
+                if (n + call_len > FIR_CIRC_INPUT_ELTS)                 \
+                {                                                       \
+                    call_len = FIR_CIRC_INPUT_ELTS - n;                 \
+                }                                                       \
+                                                                        \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_fir_circ_##suffix(&fir_circ_inst_fut,           \
+                                          (type *) fir_circ_input + n,  \
+                                          (type *) fir_circ_fut + n,    \
+                                          call_len));                   \
+                arm_fir_##suffix(&fir_inst_ref,                         \
+                                 (type *) fir_circ_input + n,           \
+                                 (type *) fir_circ_ref + n,             \
+                                 call_len);                             \
+            }                                                           \
+                                                                        \
+            TEST_ASSERT_BUFFERS_EQUAL(fir_circ_ref, fir_circ_fut,       \
+                                      FIR_CIRC_INPUT_ELTS * sizeof(type)); \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/* The fixed-point inputs span 1/16 of full scale to leave room for the accumulation */
+FIR_CIRC_DEFINE_TEST(f32, float32_t, 1.0f / 128.0f, fir_circ_configs);
+FIR_CIRC_DEFINE_TEST(q31, q31_t, 0x100000, fir_circ_configs);
+FIR_CIRC_DEFINE_TEST(q15, q15_t, 16, fir_circ_configs_q15);
+FIR_CIRC_DEFINE_TEST(q7, q7_t, 1, fir_circ_configs);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_circ_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fir_circ_f32_test);
+    JTEST_TEST_CALL(arm_fir_circ_q31_test);
+    JTEST_TEST_CALL(arm_fir_circ_q15_test);
+    JTEST_TEST_CALL(arm_fir_circ_q7_test);
+}
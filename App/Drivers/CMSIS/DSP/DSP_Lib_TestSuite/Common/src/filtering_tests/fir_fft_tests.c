@@ -0,0 +1,122 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_fir_fft_f32() is compared with arm_fir_f32() over several calls, so that the
+ * ring of input spectra wraps around. The configurations cover a filter shorter
+ * than one block, a filter of exactly one block, and many partitions processed
+ * one or more blocks per call. */
+/*--------------------------------------------------------------------------------*/
+
+#define FIR_FFT_MAX_TAPS        2000
+#define FIR_FFT_MAX_BLOCK       256
+#define FIR_FFT_INPUT_ELTS      2048
+#define FIR_FFT_MAX_STATE_ELTS  ((4 * 32 + 5) * 64)
+
+static float32_t fir_fft_coeffs[FIR_FFT_MAX_TAPS];
+static float32_t fir_fft_input[FIR_FFT_INPUT_ELTS];
+static float32_t fir_fft_fut[FIR_FFT_INPUT_ELTS];
+static float32_t fir_fft_ref[FIR_FFT_INPUT_ELTS];
+static float32_t fir_fft_state[FIR_FFT_MAX_STATE_ELTS];
+static float32_t fir_fft_ref_state[FIR_FFT_MAX_TAPS + FIR_FFT_MAX_BLOCK - 1];
+
+/* {numTaps, partition length, samples per call} */
+static const uint16_t fir_fft_configs[][3] =
+{
+    {1, 16, 16}, {33, 16, 48}, {64, 64, 64}, {100, 32, 32},
+    {2000, 64, 128}, {700, 256, 256}
+};
+
+/**
+ *  Fill #count values at #buf with a deterministic pattern in [-1, 1).
+ */
+#define FIR_FFT_FILL(buf, count, seed)                                  \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            (buf)[fill_idx] = (float32_t)                               \
+                ((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127)     \
+                / 128.0f;                                               \
+        }                                                               \
+    } while (0)
+
+JTEST_DEFINE_TEST(arm_fir_fft_f32_test, arm_fir_fft_f32)
+{
+    arm_fir_fft_instance_f32 fir_fft_inst_fut;
+    arm_fir_instance_f32 fir_inst_ref;
+    uint32_t num_taps, part_len, call_len, i, n;
+
+    FIR_FFT_FILL(fir_fft_input, FIR_FFT_INPUT_ELTS, 5u);
+
+    for (i = 0; i < sizeof(fir_fft_configs) / sizeof(fir_fft_configs[0]); i++)
+    {
+        num_taps = fir_fft_configs[i][0];
+        part_len = fir_fft_configs[i][1];
+        call_len = fir_fft_configs[i][2];
+
+        JTEST_DUMP_STRF("Taps: %d, Partition: %d, Block: %d\n",
+                        (int)num_taps, (int)part_len, (int)call_len);
+
+        FIR_FFT_FILL(fir_fft_coeffs, num_taps, 13u);
+
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                          arm_fir_fft_init_f32(&fir_fft_inst_fut, num_taps,
+                                               fir_fft_coeffs, fir_fft_state,
+                                               part_len));
+        arm_fir_init_f32(&fir_inst_ref, num_taps, fir_fft_coeffs,
+                         fir_fft_ref_state, call_len);
+
+        for (n = 0; n + call_len <= FIR_FFT_INPUT_ELTS; n += call_len)
+        {
+            JTEST_COUNT_CYCLES(
+                arm_fir_fft_f32(&fir_fft_inst_fut, fir_fft_input + n,
+                                fir_fft_fut + n, call_len));
+            arm_fir_f32(&fir_inst_ref, fir_fft_input + n,
+                        fir_fft_ref + n, call_len);
+        }
+
+        TEST_ASSERT_SNR(fir_fft_ref, fir_fft_fut, n,
+                        FILTERING_SNR_THRESHOLD_float32_t);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fir_fft_init_f32_test, arm_fir_fft_init_f32)
+{
+    arm_fir_fft_instance_f32 fir_fft_inst_fut;
+
+    /* No taps, partitions shorter than 16 or not a power of two */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_fft_init_f32(&fir_fft_inst_fut, 0, fir_fft_coeffs,
+                                           fir_fft_state, 64));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_fft_init_f32(&fir_fft_inst_fut, 10, fir_fft_coeffs,
+                                           fir_fft_state, 8));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_fft_init_f32(&fir_fft_inst_fut, 10, fir_fft_coeffs,
+                                           fir_fft_state, 48));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_fft_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fir_fft_f32_test);
+    JTEST_TEST_CALL(arm_fir_fft_init_f32_test);
+}
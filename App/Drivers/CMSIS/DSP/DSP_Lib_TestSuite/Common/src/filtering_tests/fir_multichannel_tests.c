@@ -0,0 +1,179 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_fir_multichannel_<suffix>() is compared with one instance of arm_fir_<suffix>()
+ * per channel, for interleaved and planar data. The numbers of channels cover the
+ * vector groups, the groups of 4 channels and the remaining channels. Several blocks
+ * are processed to check the state. */
+/*--------------------------------------------------------------------------------*/
+
+#define FIR_MC_MAX_TAPS         100
+#define FIR_MC_MAX_CHANNELS     21
+#define FIR_MC_MAX_BLOCK        40
+#define FIR_MC_BLOCKS           3
+#define FIR_MC_ELTS             (FIR_MC_MAX_CHANNELS * FIR_MC_MAX_BLOCK * FIR_MC_BLOCKS)
+
+static float32_t fir_mc_coeffs[FIR_MC_MAX_TAPS];
+static float32_t fir_mc_input[FIR_MC_ELTS];
+static float32_t fir_mc_fut[FIR_MC_ELTS];
+static float32_t fir_mc_ref[FIR_MC_ELTS];
+static float32_t fir_mc_chan_in[FIR_MC_MAX_BLOCK];
+static float32_t fir_mc_chan_out[FIR_MC_MAX_BLOCK];
+static float32_t fir_mc_state[(FIR_MC_MAX_TAPS + FIR_MC_MAX_BLOCK - 1) * FIR_MC_MAX_CHANNELS];
+static float32_t fir_mc_ref_state[FIR_MC_MAX_CHANNELS][FIR_MC_MAX_TAPS + FIR_MC_MAX_BLOCK];
+
+/* {numTaps, numChannels, blockSize} */
+static const uint16_t fir_mc_configs[][3] =
+{
+    {1, 1, 8}, {5, 3, 16}, {32, 4, 7}, {31, 8, 32}, {64, 13, 20}, {3, 16, 5},
+    {100, FIR_MC_MAX_CHANNELS, FIR_MC_MAX_BLOCK}
+};
+
+/* arm_fir_q15() needs an even number of taps */
+static const uint16_t fir_mc_configs_q15[][3] =
+{
+    {2, 1, 8}, {6, 3, 16}, {32, 4, 7}, {32, 8, 32}, {64, 13, 20}, {4, 16, 5},
+    {100, FIR_MC_MAX_CHANNELS, FIR_MC_MAX_BLOCK}
+};
+
+/**
+ *  Fill #count values of #type at #buf with a deterministic pattern of the
+ *  integers -127 .. 127 multiplied by #step.
+ */
+#define FIR_MC_FILL(type, buf, count, seed, step)                       \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            ((type *) (buf))[fill_idx] = (type)                         \
+                (((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127) *  \
+                 (step));                                               \
+        }                                                               \
+    } while (0)
+
+#define FIR_MC_COMPARE_f32(n)                                   \
+    TEST_ASSERT_SNR((float32_t *) fir_mc_ref,                   \
+                    (float32_t *) fir_mc_fut,                   \
+                    (n),                                        \
+                    FILTERING_SNR_THRESHOLD_float32_t)
+
+#define FIR_MC_COMPARE_q31(n)                                   \
+    TEST_ASSERT_BUFFERS_EQUAL(fir_mc_ref,                       \
+                              fir_mc_fut,                       \
+                              (n) * sizeof(q31_t))
+
+#define FIR_MC_COMPARE_q15(n)                                   \
+    TEST_ASSERT_BUFFERS_EQUAL(fir_mc_ref,                       \
+                              fir_mc_fut,                       \
+                              (n) * sizeof(q15_t))
+
+#define FIR_MC_DEFINE_TEST(suffix, type, step, configs)                 \
+    JTEST_DEFINE_TEST(arm_fir_multichannel_##suffix##_test,             \
+                      arm_fir_multichannel_##suffix)                    \
+    {                                                                   \
+        arm_fir_multichannel_instance_##suffix fir_mc_inst_fut;         \
+        arm_fir_instance_##suffix fir_inst_ref[FIR_MC_MAX_CHANNELS];    \
+        uint32_t num_taps, num_ch, block_size, interleaved;             \
+        uint32_t blk, c, i, n;                                          \
+        type *in, *out;                                                 \
+                                                                        \
+        FIR_MC_FILL(type, fir_mc_input, FIR_MC_ELTS, 5u, step);         \
+                                                                        \
+        for (i = 0; i < sizeof(configs) / sizeof(configs[0]); i++)     \
+        {                                                               \
+            num_taps = configs[i][0];                                   \
+            num_ch = configs[i][1];                                     \
+            block_size = configs[i][2];                                 \
+                                                                        \
+            FIR_MC_FILL(type, fir_mc_coeffs, num_taps, 13u, step);      \
+                                                                        \
+            for (interleaved = 0; interleaved < 2; interleaved++)       \
+            {                                                           \
+                JTEST_DUMP_STRF("Taps: %d, Channels: %d, Block: %d, "   \
+                                "Interleaved: %d\n",                    \
+                                (int)num_taps, (int)num_ch,             \
+                                (int)block_size, (int)interleaved);     \
+                                                                        \
+                arm_fir_multichannel_init_##suffix(                     \
+                    &fir_mc_inst_fut, num_taps, num_ch, interleaved,    \
+                    (type *) fir_mc_coeffs, (type *) fir_mc_state,      \
+                    block_size);                                        \
+                                                                        \
+                for (c = 0; c < num_ch; c++)                            \
+                {                                                       \
+                    arm_fir_init_##suffix(&fir_inst_ref[c], num_taps,   \
+                                          (type *) fir_mc_coeffs,       \
+                                          (type *) fir_mc_ref_state[c], \
+                                          block_size);                  \
+                }                                                       \
+                                                                        \
+                for (blk = 0; blk < FIR_MC_BLOCKS; blk++)               \
+                {                                                       \
+                    in = (type *) fir_mc_input + blk * num_ch * block_size; \
+                    out = (type *) fir_mc_fut + blk * num_ch * block_size; \
+                                                                        \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_fir_multichannel_##suffix(                  \
+                            &fir_mc_inst_fut, in, out, block_size));    \
+                                                                        \
+                    /* Each channel through its own instance */         \
+                    out = (type *) fir_mc_ref + blk * num_ch * block_size; \
+                                                                        \
+                    for (c = 0; c < num_ch; c++)                        \
+                    {                                                   \
+                        for (n = 0; n < block_size; n++)                \
+                        {                                               \
+                            ((type *) fir_mc_chan_in)[n] =              \
+                                (interleaved != 0) ?                    \
+                                in[n * num_ch + c] :                    \
+                                in[c * block_size + n];                 \
+                        }                                               \
+                                                                        \
+                        arm_fir_##suffix(&fir_inst_ref[c],              \
+                                         (type *) fir_mc_chan_in,       \
+                                         (type *) fir_mc_chan_out,      \
+                                         block_size);                   \
+                                                                        \
+                        for (n = 0; n < block_size; n++)                \
+                        {                                               \
+                            out[(interleaved != 0) ?                    \
+                                (n * num_ch + c) :                      \
+                                (c * block_size + n)] =                 \
+                                ((type *) fir_mc_chan_out)[n];          \
+                        }                                               \
+                    }                                                   \
+                }                                                       \
+                                                                        \
+                FIR_MC_COMPARE_##suffix(FIR_MC_BLOCKS * num_ch * block_size); \
+            }                                                           \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/* The fixed-point inputs span 1/16 of full scale to leave room for the accumulation */
+FIR_MC_DEFINE_TEST(f32, float32_t, 1.0f / 128.0f, fir_mc_configs);
+FIR_MC_DEFINE_TEST(q31, q31_t, 0x100000, fir_mc_configs);
+FIR_MC_DEFINE_TEST(q15, q15_t, 16, fir_mc_configs_q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_multichannel_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fir_multichannel_f32_test);
+    JTEST_TEST_CALL(arm_fir_multichannel_q31_test);
+    JTEST_TEST_CALL(arm_fir_multichannel_q15_test);
+}
@@ -0,0 +1,218 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_fir_resample_<suffix>() with a ratio of L/M is compared with one sample every
+ * M of arm_fir_interpolate_<suffix>(). The resampler is called on blocks which are
+ * not a multiple of M, so that the position of the outputs is carried between
+ * calls. A fractional step is checked against the interpolator outputs on either
+ * side of each output. */
+/*--------------------------------------------------------------------------------*/
+
+#define FIR_RESAMPLE_L              5
+#define FIR_RESAMPLE_PHASE_LEN      8
+#define FIR_RESAMPLE_NUM_TAPS       (FIR_RESAMPLE_L * FIR_RESAMPLE_PHASE_LEN)
+#define FIR_RESAMPLE_INPUT_ELTS     240
+#define FIR_RESAMPLE_BLOCK          37
+#define FIR_RESAMPLE_OUTPUT_ELTS    (FIR_RESAMPLE_INPUT_ELTS * FIR_RESAMPLE_L)
+
+static float32_t fir_resample_coeffs[FIR_RESAMPLE_NUM_TAPS];
+static float32_t fir_resample_input[FIR_RESAMPLE_INPUT_ELTS];
+static float32_t fir_resample_fut[FIR_RESAMPLE_OUTPUT_ELTS];
+static float32_t fir_resample_ref[FIR_RESAMPLE_OUTPUT_ELTS];
+static float32_t fir_resample_interp[FIR_RESAMPLE_OUTPUT_ELTS];
+static float32_t fir_resample_state[FIR_RESAMPLE_PHASE_LEN + FIR_RESAMPLE_INPUT_ELTS];
+
+/* Downsample factors below, equal to and above L */
+static const uint32_t fir_resample_m[] = {1, 3, 5, 7, 12};
+
+/**
+ *  Fill #count values of #type at #buf with a deterministic pattern of the
+ *  integers -127 .. 127 multiplied by #step.
+ */
+#define FIR_RESAMPLE_FILL(type, buf, count, seed, step)                 \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            ((type *) (buf))[fill_idx] = (type)                         \
+                (((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127) *  \
+                 (step));                                               \
+        }                                                               \
+    } while (0)
+
+#define FIR_RESAMPLE_COMPARE_f32(n)                             \
+    TEST_ASSERT_SNR((float32_t *) fir_resample_ref,             \
+                    (float32_t *) fir_resample_fut,             \
+                    (n),                                        \
+                    FILTERING_SNR_THRESHOLD_float32_t)
+
+#define FIR_RESAMPLE_COMPARE_q31(n)                             \
+    TEST_ASSERT_BUFFERS_EQUAL(fir_resample_ref,                 \
+                              fir_resample_fut,                 \
+                              (n) * sizeof(q31_t))
+
+#define FIR_RESAMPLE_COMPARE_q15(n)                             \
+    TEST_ASSERT_BUFFERS_EQUAL(fir_resample_ref,                 \
+                              fir_resample_fut,                 \
+                              (n) * sizeof(q15_t))
+
+#define FIR_RESAMPLE_DEFINE_TEST(suffix, type, step)                    \
+    JTEST_DEFINE_TEST(arm_fir_resample_##suffix##_test,                 \
+                      arm_fir_resample_##suffix)                        \
+    {                                                                   \
+        arm_fir_resample_instance_##suffix resample_inst_fut;           \
+        arm_fir_interpolate_instance_##suffix interp_inst_ref;          \
+        uint32_t m, i, n, out_len, ref_len;                             \
+                                                                        \
+        FIR_RESAMPLE_FILL(type, fir_resample_input,                     \
+                          FIR_RESAMPLE_INPUT_ELTS, 5u, step);           \
+        FIR_RESAMPLE_FILL(type, fir_resample_coeffs,                    \
+                          FIR_RESAMPLE_NUM_TAPS, 13u, step);            \
+                                                                        \
+        arm_fir_interpolate_init_##suffix(                              \
+            &interp_inst_ref, FIR_RESAMPLE_L, FIR_RESAMPLE_NUM_TAPS,    \
+            (type *) fir_resample_coeffs, (type *) fir_resample_state,  \
+            FIR_RESAMPLE_INPUT_ELTS);                                   \
+        arm_fir_interpolate_##suffix(                                   \
+            &interp_inst_ref, (type *) fir_resample_input,              \
+            (type *) fir_resample_interp, FIR_RESAMPLE_INPUT_ELTS);     \
+                                                                        \
+        for (i = 0; i < sizeof(fir_resample_m) / sizeof(fir_resample_m[0]); i++) \
+        {                                                               \
+            m = fir_resample_m[i];                                      \
+                                                                        \
+            JTEST_DUMP_STRF("L: %d, M: %d\n", FIR_RESAMPLE_L, (int)m);  \
+                                                                        \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,                         \
+                arm_fir_resample_init_##suffix(                         \
+                    &resample_inst_fut, FIR_RESAMPLE_L, m, 0,           \
+                    FIR_RESAMPLE_NUM_TAPS, (type *) fir_resample_coeffs, \
+                    (type *) fir_resample_state, FIR_RESAMPLE_BLOCK));  \
+                                                                        \
+            out_len = 0;                                                \
+            for (n = 0; n + FIR_RESAMPLE_BLOCK <= FIR_RESAMPLE_INPUT_ELTS; \
+                 n += FIR_RESAMPLE_BLOCK)                               \
+            {                                                           \
+                JTEST_COUNT_CYCLES(                                     \
+                    out_len += arm_fir_resample_##suffix(               \
+                        &resample_inst_fut,                             \
+                        (type *) fir_resample_input + n,                \
+                        (type *) fir_resample_fut + out_len,            \
+                        FIR_RESAMPLE_BLOCK));                           \
+            }                                                           \
+                                                                        \
+            /* One output every M interpolated samples */               \
+            for (ref_len = 0; ref_len * m < n * FIR_RESAMPLE_L; ref_len++) \
+            {                                                           \
+                ((type *) fir_resample_ref)[ref_len] =                  \
+                    ((type *) fir_resample_interp)[ref_len * m];        \
+            }                                                           \
+                                                                        \
+            TEST_ASSERT_EQUAL(ref_len, out_len);                        \
+            FIR_RESAMPLE_COMPARE_##suffix(out_len);                     \
+        }                                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/* The fixed-point inputs span 1/16 of full scale to leave room for the accumulation */
+FIR_RESAMPLE_DEFINE_TEST(f32, float32_t, 1.0f / 128.0f);
+FIR_RESAMPLE_DEFINE_TEST(q31, q31_t, 0x100000);
+FIR_RESAMPLE_DEFINE_TEST(q15, q15_t, 16);
+
+JTEST_DEFINE_TEST(arm_fir_resample_f32_frac_test, arm_fir_resample_f32)
+{
+    arm_fir_resample_instance_f32 resample_inst_fut;
+    arm_fir_interpolate_instance_f32 interp_inst_ref;
+    uint32_t i, n, out_len, ref_len;
+
+    FIR_RESAMPLE_FILL(float32_t, fir_resample_input, FIR_RESAMPLE_INPUT_ELTS, 5u, 1.0f / 128.0f);
+    FIR_RESAMPLE_FILL(float32_t, fir_resample_coeffs, FIR_RESAMPLE_NUM_TAPS, 13u, 1.0f / 128.0f);
+
+    arm_fir_interpolate_init_f32(&interp_inst_ref, FIR_RESAMPLE_L, FIR_RESAMPLE_NUM_TAPS,
+                                 fir_resample_coeffs, fir_resample_state,
+                                 FIR_RESAMPLE_INPUT_ELTS);
+    arm_fir_interpolate_f32(&interp_inst_ref, fir_resample_input,
+                            fir_resample_interp, FIR_RESAMPLE_INPUT_ELTS);
+
+    /* A step of 2.25 components: outputs fall on a component or a quarter,
+       a half or three quarters of the way to the next one */
+    TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                      arm_fir_resample_init_f32(&resample_inst_fut, FIR_RESAMPLE_L, 2, 0x40000000,
+                                                FIR_RESAMPLE_NUM_TAPS, fir_resample_coeffs,
+                                                fir_resample_state, FIR_RESAMPLE_BLOCK));
+
+    out_len = 0;
+    for (n = 0; n + FIR_RESAMPLE_BLOCK <= FIR_RESAMPLE_INPUT_ELTS; n += FIR_RESAMPLE_BLOCK)
+    {
+        JTEST_COUNT_CYCLES(
+            out_len += arm_fir_resample_f32(&resample_inst_fut, fir_resample_input + n,
+                                            fir_resample_fut + out_len, FIR_RESAMPLE_BLOCK));
+    }
+
+    /* Output k is at 9k/4 components, which needs the next component when not exact */
+    ref_len = 0;
+    for (i = 0; (9 * i + 3) / 4 < n * FIR_RESAMPLE_L; i++)
+    {
+        float32_t w = (float32_t) ((9 * i) % 4) / 4.0f;
+        uint32_t j = (9 * i) / 4;
+
+        fir_resample_ref[ref_len++] = fir_resample_interp[j] +
+            w * (fir_resample_interp[j + ((w != 0.0f) ? 1 : 0)] - fir_resample_interp[j]);
+    }
+
+    TEST_ASSERT_EQUAL(ref_len, out_len);
+    TEST_ASSERT_SNR(fir_resample_ref, fir_resample_fut, out_len,
+                    FILTERING_SNR_THRESHOLD_float32_t);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_fir_resample_init_f32_test, arm_fir_resample_init_f32)
+{
+    arm_fir_resample_instance_f32 resample_inst_fut;
+
+    /* No polyphase component, steps of zero and below one component, a filter which is
+       not a multiple of L, and a block whose positions do not fit in 32 bits */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_resample_init_f32(&resample_inst_fut, 0, 3, 0, 40,
+                                                fir_resample_coeffs, fir_resample_state, 16));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_resample_init_f32(&resample_inst_fut, 5, 0, 0, 40,
+                                                fir_resample_coeffs, fir_resample_state, 16));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_fir_resample_init_f32(&resample_inst_fut, 5, 0, 0x80000000, 40,
+                                                fir_resample_coeffs, fir_resample_state, 16));
+    TEST_ASSERT_EQUAL(ARM_MATH_LENGTH_ERROR,
+                      arm_fir_resample_init_f32(&resample_inst_fut, 3, 2, 0, 40,
+                                                fir_resample_coeffs, fir_resample_state, 16));
+    TEST_ASSERT_EQUAL(ARM_MATH_LENGTH_ERROR,
+                      arm_fir_resample_init_f32(&resample_inst_fut, 5, 2, 0, 40,
+                                                fir_resample_coeffs, fir_resample_state, 0x1999999A));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(fir_resample_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_fir_resample_f32_test);
+    JTEST_TEST_CALL(arm_fir_resample_q31_test);
+    JTEST_TEST_CALL(arm_fir_resample_q15_test);
+    JTEST_TEST_CALL(arm_fir_resample_f32_frac_test);
+    JTEST_TEST_CALL(arm_fir_resample_init_f32_test);
+}
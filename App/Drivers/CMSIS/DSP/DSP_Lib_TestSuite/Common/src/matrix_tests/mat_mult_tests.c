@@ -44,6 +44,53 @@ JTEST_DEFINE_TEST(arm_mat_mult_q15_test, arm_mat_mult_q15)
         MATRIX_COMPARE_INTERFACE);
 }
 
+/*--------------------------------------------------------------------------------*/
+/* Large F32 matrices, which take the cache-blocked path of arm_mat_mult_f32(). */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_MULT_LARGE_ROWS_A 45
+#define MAT_MULT_LARGE_COLS_A 37
+#define MAT_MULT_LARGE_COLS_B 70
+
+static float32_t mat_mult_large_a[MAT_MULT_LARGE_ROWS_A * MAT_MULT_LARGE_COLS_A];
+static float32_t mat_mult_large_b[MAT_MULT_LARGE_COLS_A * MAT_MULT_LARGE_COLS_B];
+static float32_t mat_mult_large_fut[MAT_MULT_LARGE_ROWS_A * MAT_MULT_LARGE_COLS_B];
+static float32_t mat_mult_large_ref[MAT_MULT_LARGE_ROWS_A * MAT_MULT_LARGE_COLS_B];
+
+JTEST_DEFINE_TEST(arm_mat_mult_f32_large_test, arm_mat_mult_f32)
+{
+    arm_matrix_instance_f32 a, b, fut, ref;
+    arm_status status;
+    uint32_t i;
+
+    /* Deterministic values in [-1, 1) */
+    for (i = 0; i < MAT_MULT_LARGE_ROWS_A * MAT_MULT_LARGE_COLS_A; i++)
+    {
+        mat_mult_large_a[i] = (float32_t)((int32_t)((i * 97u + 13u) % 256u) - 128) / 128.0f;
+    }
+    for (i = 0; i < MAT_MULT_LARGE_COLS_A * MAT_MULT_LARGE_COLS_B; i++)
+    {
+        mat_mult_large_b[i] = (float32_t)((int32_t)((i * 61u + 5u) % 256u) - 128) / 128.0f;
+    }
+
+    arm_mat_init_f32(&a, MAT_MULT_LARGE_ROWS_A, MAT_MULT_LARGE_COLS_A, mat_mult_large_a);
+    arm_mat_init_f32(&b, MAT_MULT_LARGE_COLS_A, MAT_MULT_LARGE_COLS_B, mat_mult_large_b);
+    arm_mat_init_f32(&fut, MAT_MULT_LARGE_ROWS_A, MAT_MULT_LARGE_COLS_B, mat_mult_large_fut);
+    arm_mat_init_f32(&ref, MAT_MULT_LARGE_ROWS_A, MAT_MULT_LARGE_COLS_B, mat_mult_large_ref);
+
+    JTEST_COUNT_CYCLES(status = arm_mat_mult_f32(&a, &b, &fut));
+    TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, status);
+
+    ref_mat_mult_f32(&a, &b, &ref);
+
+    TEST_ASSERT_SNR(mat_mult_large_ref,
+                    mat_mult_large_fut,
+                    MAT_MULT_LARGE_ROWS_A * MAT_MULT_LARGE_COLS_B,
+                    MATRIX_SNR_THRESHOLD);
+
+    return JTEST_TEST_PASSED;
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -54,6 +101,7 @@ JTEST_DEFINE_GROUP(mat_mult_tests)
       To skip a test, comment it out.
     */
     JTEST_TEST_CALL(arm_mat_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_mult_f32_large_test);
     JTEST_TEST_CALL(arm_mat_mult_q31_test);
     JTEST_TEST_CALL(arm_mat_mult_q15_test);
 }
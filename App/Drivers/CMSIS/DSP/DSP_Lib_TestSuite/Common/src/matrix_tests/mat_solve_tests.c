@@ -0,0 +1,303 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Each decomposition is checked by solving A * X = I and comparing X with the
+ * inverse computed by the reference library. The inverse is always computed in
+ * f64, so that only the error of the function under test is measured. */
+/*--------------------------------------------------------------------------------*/
+
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_solve_a[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_solve_work[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_solve_fut[MATRIX_TEST_MAX_ELTS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_solve_ref[MATRIX_TEST_MAX_ELTS];
+static float64_t mat_solve_a_f64[MATRIX_TEST_MAX_ELTS];
+static float64_t mat_solve_ref_f64[MATRIX_TEST_MAX_ELTS];
+static uint16_t mat_solve_pivots[MATRIX_TEST_MAX_ROWS];
+
+/**
+ *  Set the instance #mat to the #n x #n matrix held in #buf.
+ */
+#define MAT_SOLVE_SET(mat, n, buf, type)        \
+    do                                          \
+    {                                           \
+        (mat).numRows = (n);                    \
+        (mat).numCols = (n);                    \
+        (mat).pData = (type *) (buf);           \
+    } while (0)
+
+/**
+ *  Define the helpers which build the test matrices for one type:
+ *
+ *  - mat_solve_identity_<suffix>(): the identity, used as right-hand side.
+ *  - mat_solve_spd_<suffix>(): S = A * A' + n * I, symmetric positive definite.
+ *  - mat_solve_tri_<suffix>(): the lower or upper triangle of A with its
+ *    diagonal moved away from zero.
+ */
+#define MAT_SOLVE_DEFINE_HELPERS(suffix, type)                          \
+    static void mat_solve_identity_##suffix(type * pDst, uint32_t n)   \
+    {                                                                   \
+        uint32_t i;                                                     \
+        for (i = 0; i < n * n; i++)                                     \
+        {                                                               \
+            pDst[i] = (i % (n + 1) == 0) ? 1 : 0;                       \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    static void mat_solve_spd_##suffix(                                 \
+        const type * pA, type * pDst, uint32_t n)                       \
+    {                                                                   \
+        uint32_t i, j, k;                                               \
+        for (i = 0; i < n; i++)                                         \
+        {                                                               \
+            for (j = 0; j < n; j++)                                     \
+            {                                                           \
+                type sum = (i == j) ? (type) n : 0;                     \
+                for (k = 0; k < n; k++)                                 \
+                {                                                       \
+                    sum += pA[i * n + k] * pA[j * n + k];               \
+                }                                                       \
+                pDst[i * n + j] = sum;                                  \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+                                                                        \
+    static void mat_solve_tri_##suffix(                                 \
+        const type * pA, type * pDst, uint32_t n, int lower)            \
+    {                                                                   \
+        uint32_t i, j;                                                  \
+        for (i = 0; i < n; i++)                                         \
+        {                                                               \
+            for (j = 0; j < n; j++)                                     \
+            {                                                           \
+                if (i == j)                                             \
+                {                                                       \
+                    pDst[i * n + j] = pA[i * n + j] < 0 ?               \
+                        pA[i * n + j] - 1 : pA[i * n + j] + 1;          \
+                }                                                       \
+                else if ((j < i) == (lower != 0))                       \
+                {                                                       \
+                    pDst[i * n + j] = pA[i * n + j];                    \
+                }                                                       \
+                else                                                    \
+                {                                                       \
+                    pDst[i * n + j] = 0;                                \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+    }
+
+MAT_SOLVE_DEFINE_HELPERS(f32, float32_t)
+MAT_SOLVE_DEFINE_HELPERS(f64, float64_t)
+
+/**
+ *  Compute the reference inverse of #pA into #pRef, in f64 whatever the type.
+ */
+static void mat_solve_ref_inverse_f32(const arm_matrix_instance_f32 * pA,
+                                      arm_matrix_instance_f32 * pRef)
+{
+    arm_matrix_instance_f64 a;
+    arm_matrix_instance_f64 ref;
+    uint32_t n = pA->numRows;
+    uint32_t i;
+
+    MAT_SOLVE_SET(a, n, mat_solve_a_f64, float64_t);
+    MAT_SOLVE_SET(ref, n, mat_solve_ref_f64, float64_t);
+    for (i = 0; i < n * n; i++)
+    {
+        a.pData[i] = pA->pData[i];
+    }
+
+    ref_mat_inverse_f64(&a, &ref);
+
+    for (i = 0; i < n * n; i++)
+    {
+        pRef->pData[i] = (float32_t) ref.pData[i];
+    }
+}
+
+static void mat_solve_ref_inverse_f64(const arm_matrix_instance_f64 * pA,
+                                      arm_matrix_instance_f64 * pRef)
+{
+    ref_mat_inverse_f64(pA, pRef);
+}
+
+/**
+ *  An f32 solve loses about 20 * log10(cond(A)) dB of its 24 bits, so it
+ *  cannot reach the threshold of the other matrix tests.
+ */
+#define MAT_SOLVE_SNR_THRESHOLD_f32 100
+
+#define MAT_SOLVE_COMPARE_f32(n)                                \
+    TEST_ASSERT_SNR((float32_t *) mat_solve_ref,                \
+                    (float32_t *) mat_solve_fut,                \
+                    (n) * (n),                                  \
+                    MAT_SOLVE_SNR_THRESHOLD_f32)
+
+#define MAT_SOLVE_COMPARE_f64(n)                                \
+    TEST_ASSERT_DBL_SNR((float64_t *) mat_solve_ref,            \
+                        (float64_t *) mat_solve_fut,            \
+                        (n) * (n),                              \
+                        MATRIX_SNR_THRESHOLD)
+
+/**
+ *  Loop over the invertible inputs of one type. #body runs with a, work, fut
+ *  and ref set to n x n instances; a holds a copy of the input and fut the
+ *  identity.
+ */
+#define MAT_SOLVE_TEST_TEMPLATE(suffix, type, body)                     \
+    do                                                                  \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_##suffix *, mat_ptr,           \
+            matrix_##suffix##_invertible_inputs                         \
+            ,                                                           \
+            arm_matrix_instance_##suffix a;                             \
+            arm_matrix_instance_##suffix work;                          \
+            arm_matrix_instance_##suffix fut;                           \
+            arm_matrix_instance_##suffix ref;                           \
+            uint32_t n = mat_ptr->numRows;                              \
+                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            if (MATRIX_TEST_VALID_SQUARE_DIMENSIONS(                    \
+                    arm_matrix_instance_##suffix *, mat_ptr))           \
+            {                                                           \
+                MAT_SOLVE_SET(a, n, mat_solve_a, type);                 \
+                MAT_SOLVE_SET(work, n, mat_solve_work, type);           \
+                MAT_SOLVE_SET(fut, n, mat_solve_fut, type);             \
+                MAT_SOLVE_SET(ref, n, mat_solve_ref, type);             \
+                memcpy(a.pData, mat_ptr->pData, n * n * sizeof(type));  \
+                mat_solve_identity_##suffix(fut.pData, n);              \
+                                                                        \
+                body;                                                   \
+                                                                        \
+                MAT_SOLVE_COMPARE_##suffix(n);                          \
+            });                                                         \
+    } while (0)
+
+/*--------------------------------------------------------------------------------*/
+/* Cholesky: out of place, then solve into a separate output. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_SOLVE_DEFINE_CHOLESKY_TEST(suffix, type)                    \
+    JTEST_DEFINE_TEST(arm_mat_cholesky_##suffix##_test,                 \
+                      arm_mat_cholesky_##suffix)                        \
+    {                                                                   \
+        MAT_SOLVE_TEST_TEMPLATE(                                        \
+            suffix, type,                                               \
+            mat_solve_spd_##suffix(mat_ptr->pData, a.pData, n);         \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,                         \
+                              arm_mat_cholesky_##suffix(&a, &work));    \
+            TEST_ASSERT_EQUAL(                                          \
+                ARM_MATH_SUCCESS,                                       \
+                arm_mat_cholesky_solve_##suffix(&work, &fut, &fut));    \
+            mat_solve_ref_inverse_##suffix(&a, &ref));                  \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*--------------------------------------------------------------------------------*/
+/* LDLT: in place, then solve in place. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_SOLVE_DEFINE_LDLT_TEST(suffix, type)                        \
+    JTEST_DEFINE_TEST(arm_mat_ldlt_##suffix##_test,                     \
+                      arm_mat_ldlt_##suffix)                            \
+    {                                                                   \
+        MAT_SOLVE_TEST_TEMPLATE(                                        \
+            suffix, type,                                               \
+            mat_solve_spd_##suffix(mat_ptr->pData, a.pData, n);         \
+            memcpy(work.pData, a.pData, n * n * sizeof(type));          \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,                         \
+                              arm_mat_ldlt_##suffix(&work, &work));     \
+            TEST_ASSERT_EQUAL(                                          \
+                ARM_MATH_SUCCESS,                                       \
+                arm_mat_ldlt_solve_##suffix(&work, &fut, &fut));        \
+            mat_solve_ref_inverse_##suffix(&a, &ref));                  \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*--------------------------------------------------------------------------------*/
+/* LU: in place on the general input, then solve into a separate output. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_SOLVE_DEFINE_LU_TEST(suffix, type)                          \
+    JTEST_DEFINE_TEST(arm_mat_lu_##suffix##_test,                       \
+                      arm_mat_lu_##suffix)                              \
+    {                                                                   \
+        MAT_SOLVE_TEST_TEMPLATE(                                        \
+            suffix, type,                                               \
+            memcpy(work.pData, a.pData, n * n * sizeof(type));          \
+            TEST_ASSERT_EQUAL(                                          \
+                ARM_MATH_SUCCESS,                                       \
+                arm_mat_lu_##suffix(&work, &work, mat_solve_pivots));   \
+            memcpy(ref.pData, fut.pData, n * n * sizeof(type));         \
+            TEST_ASSERT_EQUAL(                                          \
+                ARM_MATH_SUCCESS,                                       \
+                arm_mat_lu_solve_##suffix(&work, mat_solve_pivots,      \
+                                          &ref, &fut));                 \
+            mat_solve_ref_inverse_##suffix(&a, &ref));                  \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*--------------------------------------------------------------------------------*/
+/* Triangular solves. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_SOLVE_DEFINE_TRI_TEST(suffix, type, fn, lower)              \
+    JTEST_DEFINE_TEST(arm_mat_##fn##_##suffix##_test,                   \
+                      arm_mat_##fn##_##suffix)                          \
+    {                                                                   \
+        MAT_SOLVE_TEST_TEMPLATE(                                        \
+            suffix, type,                                               \
+            mat_solve_tri_##suffix(mat_ptr->pData, a.pData, n, lower);  \
+            TEST_ASSERT_EQUAL(                                          \
+                ARM_MATH_SUCCESS,                                       \
+                arm_mat_##fn##_##suffix(&a, &fut, &fut));               \
+            mat_solve_ref_inverse_##suffix(&a, &ref));                  \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+MAT_SOLVE_DEFINE_CHOLESKY_TEST(f32, float32_t);
+MAT_SOLVE_DEFINE_CHOLESKY_TEST(f64, float64_t);
+MAT_SOLVE_DEFINE_LDLT_TEST(f32, float32_t);
+MAT_SOLVE_DEFINE_LDLT_TEST(f64, float64_t);
+MAT_SOLVE_DEFINE_LU_TEST(f32, float32_t);
+MAT_SOLVE_DEFINE_LU_TEST(f64, float64_t);
+MAT_SOLVE_DEFINE_TRI_TEST(f32, float32_t, solve_lower_triangular, 1);
+MAT_SOLVE_DEFINE_TRI_TEST(f64, float64_t, solve_lower_triangular, 1);
+MAT_SOLVE_DEFINE_TRI_TEST(f32, float32_t, solve_upper_triangular, 0);
+MAT_SOLVE_DEFINE_TRI_TEST(f64, float64_t, solve_upper_triangular, 0);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_solve_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_cholesky_f32_test);
+    JTEST_TEST_CALL(arm_mat_cholesky_f64_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f32_test);
+    JTEST_TEST_CALL(arm_mat_ldlt_f64_test);
+    JTEST_TEST_CALL(arm_mat_lu_f32_test);
+    JTEST_TEST_CALL(arm_mat_lu_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_lower_triangular_f64_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f32_test);
+    JTEST_TEST_CALL(arm_mat_solve_upper_triangular_f64_test);
+}
@@ -0,0 +1,209 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/*--------------------------------------------------------------------------------*/
+/* arm_mat_vec_mult_<suffix>() is compared with arm_mat_mult_<suffix>() applied to
+ * a one-column matrix. Besides the common inputs, a larger matrix exercises the
+ * groups of four rows and the remaining rows and columns. */
+/*--------------------------------------------------------------------------------*/
+
+#define MAT_VEC_MULT_ROWS 11
+#define MAT_VEC_MULT_COLS 37
+
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_vec_mult_a[MAT_VEC_MULT_ROWS * MAT_VEC_MULT_COLS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_vec_mult_x[MAT_VEC_MULT_COLS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_vec_mult_fut[MAT_VEC_MULT_ROWS];
+static MATRIX_TEST_BIGGEST_INPUT_TYPE mat_vec_mult_ref[MAT_VEC_MULT_ROWS];
+static q15_t mat_vec_mult_state[MAT_VEC_MULT_ROWS * MAT_VEC_MULT_COLS];
+
+/**
+ *  Fill #count values of #type at #buf with a deterministic pattern of the
+ *  integers -127 .. 127 multiplied by #step.
+ */
+#define MAT_VEC_MULT_FILL(type, buf, count, seed, step)                 \
+    do                                                                  \
+    {                                                                   \
+        uint32_t fill_idx;                                              \
+        for (fill_idx = 0; fill_idx < (count); fill_idx++)              \
+        {                                                               \
+            ((type *) (buf))[fill_idx] = (type)                         \
+                (((int32_t)((fill_idx * 97u + (seed)) % 255u) - 127) *  \
+                 (step));                                               \
+        }                                                               \
+    } while (0)
+
+#define MAT_VEC_MULT_CALL_REF_f32(a, b, dst)    arm_mat_mult_f32(a, b, dst)
+#define MAT_VEC_MULT_CALL_REF_q31(a, b, dst)    arm_mat_mult_q31(a, b, dst)
+#define MAT_VEC_MULT_CALL_REF_q15(a, b, dst)    \
+    arm_mat_mult_q15(a, b, dst, mat_vec_mult_state)
+
+#define MAT_VEC_MULT_COMPARE_f32(n)                             \
+    TEST_ASSERT_SNR((float32_t *) mat_vec_mult_ref,             \
+                    (float32_t *) mat_vec_mult_fut,             \
+                    (n),                                        \
+                    MATRIX_SNR_THRESHOLD)
+
+#define MAT_VEC_MULT_COMPARE_q31(n)                             \
+    TEST_ASSERT_BUFFERS_EQUAL(mat_vec_mult_ref,                 \
+                              mat_vec_mult_fut,                 \
+                              (n) * sizeof(q31_t))
+
+#define MAT_VEC_MULT_COMPARE_q15(n)                             \
+    TEST_ASSERT_BUFFERS_EQUAL(mat_vec_mult_ref,                 \
+                              mat_vec_mult_fut,                 \
+                              (n) * sizeof(q15_t))
+
+/**
+ *  Multiply #mat_ptr by the vector in mat_vec_mult_x with both functions and
+ *  compare the results.
+ */
+#define MAT_VEC_MULT_CHECK(suffix, type, mat_ptr)                       \
+    do                                                                  \
+    {                                                                   \
+        arm_matrix_instance_##suffix vec;                               \
+        arm_matrix_instance_##suffix ref;                               \
+                                                                        \
+        vec.numRows = (mat_ptr)->numCols;                               \
+        vec.numCols = 1;                                                \
+        vec.pData = (type *) mat_vec_mult_x;                            \
+        ref.numRows = (mat_ptr)->numRows;                               \
+        ref.numCols = 1;                                                \
+        ref.pData = (type *) mat_vec_mult_ref;                          \
+                                                                        \
+        JTEST_COUNT_CYCLES(                                             \
+            arm_mat_vec_mult_##suffix((mat_ptr),                        \
+                                      (type *) mat_vec_mult_x,          \
+                                      (type *) mat_vec_mult_fut));      \
+                                                                        \
+        MAT_VEC_MULT_CALL_REF_##suffix((mat_ptr), &vec, &ref);          \
+                                                                        \
+        MAT_VEC_MULT_COMPARE_##suffix((mat_ptr)->numRows);              \
+    } while (0)
+
+#define MAT_VEC_MULT_DEFINE_TEST(suffix, type, step)                    \
+    JTEST_DEFINE_TEST(arm_mat_vec_mult_##suffix##_test,                 \
+                      arm_mat_vec_mult_##suffix)                        \
+    {                                                                   \
+        arm_matrix_instance_##suffix large;                             \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            mat_idx, arm_matrix_instance_##suffix *, mat_ptr,           \
+            matrix_##suffix##_a_inputs                                  \
+            ,                                                           \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)mat_ptr->numRows,                      \
+                            (int)mat_ptr->numCols);                     \
+                                                                        \
+            MAT_VEC_MULT_FILL(type, mat_vec_mult_x,                     \
+                              mat_ptr->numCols, 5u, step);              \
+            MAT_VEC_MULT_CHECK(suffix, type, mat_ptr));                 \
+                                                                        \
+        large.numRows = MAT_VEC_MULT_ROWS;                              \
+        large.numCols = MAT_VEC_MULT_COLS;                              \
+        large.pData = (type *) mat_vec_mult_a;                          \
+        MAT_VEC_MULT_FILL(type, mat_vec_mult_a,                         \
+                          MAT_VEC_MULT_ROWS * MAT_VEC_MULT_COLS,        \
+                          13u, step);                                   \
+        MAT_VEC_MULT_FILL(type, mat_vec_mult_x,                         \
+                          MAT_VEC_MULT_COLS, 5u, step);                 \
+                                                                        \
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",                   \
+                        MAT_VEC_MULT_ROWS, MAT_VEC_MULT_COLS);          \
+        MAT_VEC_MULT_CHECK(suffix, type, &large);                       \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/*
+ * The Q31 inputs span 1/8 of full scale to leave room for the 64-bit accumulation, whose
+ * products still need more than 32 bits. The Q15 inputs span half of full scale, so that
+ * one of the sums of the larger matrix needs more than 32 bits and most of its results
+ * saturate.
+ */
+MAT_VEC_MULT_DEFINE_TEST(f32, float32_t, 1.0f);
+MAT_VEC_MULT_DEFINE_TEST(q31, q31_t, 0x200000);
+MAT_VEC_MULT_DEFINE_TEST(q15, q15_t, 128);
+
+/*--------------------------------------------------------------------------------*/
+/* Q7 has no matrix multiplication. The inputs are widened to Q15 by a shift of 8,
+ * for which arm_mat_mult_q15() gives the Q7 result shifted by 8, with the same
+ * saturation. */
+/*--------------------------------------------------------------------------------*/
+
+static q7_t mat_vec_mult_a_q7[MAT_VEC_MULT_ROWS * MAT_VEC_MULT_COLS];
+static q7_t mat_vec_mult_x_q7[MAT_VEC_MULT_COLS];
+static q7_t mat_vec_mult_fut_q7[MAT_VEC_MULT_ROWS];
+
+JTEST_DEFINE_TEST(arm_mat_vec_mult_q7_test, arm_mat_vec_mult_q7)
+{
+    arm_matrix_instance_q7 mat;
+    arm_matrix_instance_q15 mat_q15;
+    arm_matrix_instance_q15 vec_q15;
+    arm_matrix_instance_q15 ref_q15;
+    uint32_t rows, cols, i;
+
+    /* Sizes covering no full group of rows, one group and groups with remainders */
+    static const uint16_t sizes[][2] = {{1, 1}, {3, 5}, {4, 4}, {4, 16}, {MAT_VEC_MULT_ROWS, MAT_VEC_MULT_COLS}};
+
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        rows = sizes[i][0];
+        cols = sizes[i][1];
+
+        JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n", (int)rows, (int)cols);
+
+        /* Full-scale values, so that some of the results saturate */
+        MAT_VEC_MULT_FILL(q7_t, mat_vec_mult_a_q7, rows * cols, 13u, 1);
+        MAT_VEC_MULT_FILL(q7_t, mat_vec_mult_x_q7, cols, 5u, 1);
+
+        mat.numRows = rows;
+        mat.numCols = cols;
+        mat.pData = mat_vec_mult_a_q7;
+
+        JTEST_COUNT_CYCLES(
+            arm_mat_vec_mult_q7(&mat, mat_vec_mult_x_q7, mat_vec_mult_fut_q7));
+
+        arm_q7_to_q15(mat_vec_mult_a_q7, (q15_t *) mat_vec_mult_a, rows * cols);
+        arm_q7_to_q15(mat_vec_mult_x_q7, (q15_t *) mat_vec_mult_x, cols);
+
+        mat_q15.numRows = rows;
+        mat_q15.numCols = cols;
+        mat_q15.pData = (q15_t *) mat_vec_mult_a;
+        vec_q15.numRows = cols;
+        vec_q15.numCols = 1;
+        vec_q15.pData = (q15_t *) mat_vec_mult_x;
+        ref_q15.numRows = rows;
+        ref_q15.numCols = 1;
+        ref_q15.pData = (q15_t *) mat_vec_mult_ref;
+
+        arm_mat_mult_q15(&mat_q15, &vec_q15, &ref_q15, mat_vec_mult_state);
+        arm_q15_to_q7((q15_t *) mat_vec_mult_ref, (q7_t *) mat_vec_mult_fut, rows);
+
+        TEST_ASSERT_BUFFERS_EQUAL(mat_vec_mult_fut,
+                                  mat_vec_mult_fut_q7,
+                                  rows * sizeof(q7_t));
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_vec_mult_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_vec_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q31_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q7_test);
+}
@@ -15,5 +15,7 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_sub_tests);
     JTEST_GROUP_CALL(mat_trans_tests);
     JTEST_GROUP_CALL(mat_scale_tests);
+    JTEST_GROUP_CALL(mat_solve_tests);
+    JTEST_GROUP_CALL(mat_vec_mult_tests);
     return;
 }
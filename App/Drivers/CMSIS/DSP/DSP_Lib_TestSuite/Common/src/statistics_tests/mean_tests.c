@@ -7,18 +7,19 @@
 #include "statistics_templates.h"
 #include "type_abbrev.h"
 
-#define JTEST_ARM_MEAN_TEST(suffix)             \
+#define JTEST_ARM_MEAN_TEST(suffix, comparison_interface)  \
     STATISTICS_DEFINE_TEST_TEMPLATE_BUF1_BLK(   \
         mean,                                   \
         suffix,                                 \
         TYPE_FROM_ABBREV(suffix),               \
         TYPE_FROM_ABBREV(suffix),               \
-        STATISTICS_COMPARE_INTERFACE)
+        comparison_interface)
 
-JTEST_ARM_MEAN_TEST(f32);
-JTEST_ARM_MEAN_TEST(q31);
-JTEST_ARM_MEAN_TEST(q15);
-JTEST_ARM_MEAN_TEST(q7);
+/* The vectorized floating-point sums add the samples in another order than the reference */
+JTEST_ARM_MEAN_TEST(f32, STATISTICS_SNR_COMPARE_INTERFACE);
+JTEST_ARM_MEAN_TEST(q31, STATISTICS_COMPARE_INTERFACE);
+JTEST_ARM_MEAN_TEST(q15, STATISTICS_COMPARE_INTERFACE);
+JTEST_ARM_MEAN_TEST(q7, STATISTICS_COMPARE_INTERFACE);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
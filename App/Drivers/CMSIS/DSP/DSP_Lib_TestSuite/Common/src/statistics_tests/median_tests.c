@@ -0,0 +1,200 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "statistics_tests.h"
+#include <stdlib.h>
+
+/*--------------------------------------------------------------------------------*/
+/* arm_median_f32() is compared with the middle samples of the vector sorted by
+ * qsort(). arm_median_filter_<suffix>() is compared after each block with the median
+ * of the last windowLen samples, preceded by zeros, for odd and even windows and
+ * blocks of several sizes. The results must be equal. */
+/*--------------------------------------------------------------------------------*/
+
+#define MEDIAN_MAX_LEN          64
+#define MEDIAN_INPUT_ELTS       1500
+
+static float32_t median_input[MEDIAN_INPUT_ELTS];
+static q15_t median_input_q15[MEDIAN_INPUT_ELTS];
+static float32_t median_output[MEDIAN_INPUT_ELTS];
+static q15_t median_output_q15[MEDIAN_INPUT_ELTS];
+static float32_t median_sorted[MEDIAN_INPUT_ELTS];
+static float32_t median_scratch[MEDIAN_INPUT_ELTS];
+static float32_t median_state[MEDIAN_MAX_LEN];
+static q15_t median_state_q15[MEDIAN_MAX_LEN];
+static uint32_t median_index[2 * MEDIAN_MAX_LEN];
+
+static const uint32_t median_lengths[] = {1, 2, 3, 8, 31, MEDIAN_MAX_LEN};
+
+/* Input block sizes, used in turn */
+static const uint32_t median_blocks[] = {1, 7, 300, 64, 33};
+
+/**
+ *  Slow signal with impulses, repeated values and negative samples, and its
+ *  Q15 values at 1/8 of full scale.
+ */
+static void median_make_input(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < MEDIAN_INPUT_ELTS; n++)
+    {
+        median_input[n] = (float32_t) ((int32_t) ((n * 37u) % 101u) - 50) / 64.0f;
+        if ((n % 13u) == 0u)
+        {
+            median_input[n] = 100.0f;
+        }
+        if ((n % 17u) == 0u)
+        {
+            median_input[n] = (float32_t) (n & 3u);
+        }
+        median_input_q15[n] = (q15_t) (median_input[n] * 512.0f);
+    }
+}
+
+static int median_cmp_f32(const void *a, const void *b)
+{
+    float32_t x = *(const float32_t *) a, y = *(const float32_t *) b;
+    return (x > y) - (x < y);
+}
+
+static int median_cmp_q15(const void *a, const void *b)
+{
+    q15_t x = *(const q15_t *) a, y = *(const q15_t *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ *  Median of the len samples of the window ending with sample n, preceded by zeros.
+ */
+static float32_t median_ref_f32(const float32_t *pSrc, uint32_t n, uint32_t len)
+{
+    uint32_t k;
+
+    for (k = 0; k < len; k++)
+    {
+        median_sorted[k] = (n + k + 1 >= len) ? pSrc[n + k + 1 - len] : 0.0f;
+    }
+    qsort(median_sorted, len, sizeof(float32_t), median_cmp_f32);
+
+    return (len & 1u) ? median_sorted[len / 2] :
+        0.5f * (median_sorted[len / 2 - 1] + median_sorted[len / 2]);
+}
+
+static q15_t median_ref_q15(const q15_t *pSrc, uint32_t n, uint32_t len)
+{
+    q15_t sorted[MEDIAN_MAX_LEN];
+    uint32_t k;
+
+    for (k = 0; k < len; k++)
+    {
+        sorted[k] = (n + k + 1 >= len) ? pSrc[n + k + 1 - len] : 0;
+    }
+    qsort(sorted, len, sizeof(q15_t), median_cmp_q15);
+
+    return (len & 1u) ? sorted[len / 2] :
+        (q15_t) (((q31_t) sorted[len / 2 - 1] + sorted[len / 2]) >> 1);
+}
+
+JTEST_DEFINE_TEST(arm_median_f32_test, arm_median_f32)
+{
+    static const uint32_t lengths[] = {1, 2, 3, 4, 9, 10, 255, 256, MEDIAN_INPUT_ELTS};
+    float32_t fut, ref;
+    uint32_t l, k, len;
+
+    median_make_input();
+
+    for (l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+    {
+        len = lengths[l];
+
+        arm_median_f32(median_input, len, median_scratch, &fut);
+        ref = median_ref_f32(median_input, len - 1, len);
+        TEST_ASSERT_EQUAL(ref, fut);
+
+        /* Sorted and reversed inputs */
+        memcpy(median_output, median_sorted, len * sizeof(float32_t));
+        arm_median_f32(median_output, len, median_scratch, &fut);
+        TEST_ASSERT_EQUAL(ref, fut);
+
+        for (k = 0; k < len; k++)
+        {
+            median_output[k] = median_sorted[len - 1 - k];
+        }
+        arm_median_f32(median_output, len, median_scratch, &fut);
+        TEST_ASSERT_EQUAL(ref, fut);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+#define JTEST_ARM_MEDIAN_FILTER_TEST(suffix, type)                              \
+    JTEST_DEFINE_TEST(arm_median_filter_##suffix##_test,                        \
+                      arm_median_filter_##suffix)                               \
+    {                                                                           \
+        arm_median_filter_instance_##suffix S;                                  \
+        uint32_t l, b, n, k, len, num;                                          \
+                                                                                \
+        median_make_input();                                                    \
+                                                                                \
+        for (l = 0; l < sizeof(median_lengths) / sizeof(median_lengths[0]); l++) \
+        {                                                                       \
+            len = median_lengths[l];                                            \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, arm_median_filter_init_##suffix( \
+                &S, len, median_state_##suffix, median_index));                 \
+                                                                                \
+            for (n = 0, b = 0; n < MEDIAN_INPUT_ELTS; n += num, b++)            \
+            {                                                                   \
+                num = median_blocks[b % (sizeof(median_blocks) / sizeof(median_blocks[0]))]; \
+                num = (num < MEDIAN_INPUT_ELTS - n) ? num : MEDIAN_INPUT_ELTS - n; \
+                                                                                \
+                arm_median_filter_##suffix(&S, median_input_##suffix + n,       \
+                                           median_output_##suffix + n, num);    \
+            }                                                                   \
+                                                                                \
+            for (k = 0; k < MEDIAN_INPUT_ELTS; k++)                             \
+            {                                                                   \
+                TEST_ASSERT_EQUAL(median_ref_##suffix(median_input_##suffix, k, len), \
+                                  median_output_##suffix[k]);                   \
+            }                                                                   \
+                                                                                \
+            JTEST_DUMP_STRF("Window: %d\n", (int)len);                          \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+/* The f32 names of the buffers, for the macro */
+#define median_input_f32        median_input
+#define median_output_f32       median_output
+#define median_state_f32        median_state
+
+JTEST_ARM_MEDIAN_FILTER_TEST(f32, float32_t);
+JTEST_ARM_MEDIAN_FILTER_TEST(q15, q15_t);
+
+JTEST_DEFINE_TEST(arm_median_filter_init_test, arm_median_filter_init_f32)
+{
+    arm_median_filter_instance_f32 S;
+    arm_median_filter_instance_q15 Sq;
+
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, arm_median_filter_init_f32(&S, 0, median_state, median_index));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR, arm_median_filter_init_q15(&Sq, 0, median_state_q15, median_index));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_median_f32_test);
+    JTEST_TEST_CALL(arm_median_filter_f32_test);
+    JTEST_TEST_CALL(arm_median_filter_q15_test);
+    JTEST_TEST_CALL(arm_median_filter_init_test);
+}
@@ -0,0 +1,265 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "statistics_tests.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* arm_moving_stats_<suffix>() and arm_moving_minmax_<suffix>() are compared after
+ * each call with the batch functions on the last windowLen samples, or on all the
+ * samples while the window is being filled. The input is given in blocks of several
+ * sizes. The Q31 results and the minima and maxima must be equal, the floating-point
+ * statistics within a relative error. */
+/*--------------------------------------------------------------------------------*/
+
+#define MOVING_MAX_LEN          256
+#define MOVING_INPUT_ELTS       3000
+
+/* Relative error of the floating-point statistics, of their values or of the mean of the squares */
+#define MOVING_REL_ERROR        1.0e-4f
+
+static float32_t moving_input[MOVING_INPUT_ELTS];
+static q31_t moving_input_q31[MOVING_INPUT_ELTS];
+static float32_t moving_state[2 * MOVING_MAX_LEN];
+static q31_t moving_state_q31[2 * MOVING_MAX_LEN];
+static uint32_t moving_pos[2 * MOVING_MAX_LEN];
+
+static const uint32_t moving_lengths[] = {1, 5, 64, MOVING_MAX_LEN};
+
+/* Input block sizes, used in turn */
+static const uint32_t moving_blocks[] = {1, 7, 300, 64, 33};
+
+/**
+ *  Input samples around an offset, which makes the variance small against the
+ *  mean of the squares, with repeated values for the minima and maxima, and their
+ *  Q31 values at 1/8 of full scale.
+ */
+static void moving_make_input(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < MOVING_INPUT_ELTS; n++)
+    {
+        moving_input[n] = 3.0f + 0.5f * sinf(0.013f * n) +
+            (float32_t) ((int32_t) ((n * 97u + 5u) % 255u) - 127) / 512.0f;
+        moving_input_q31[n] = (q31_t) (((n * 2654435761u) >> 4) & 0x0FFFFFF0u) - 0x08000000;
+        if ((n % 50u) < 3u)
+        {
+            moving_input_q31[n] = 0x07FFFFF0;
+        }
+    }
+}
+
+static int moving_close_f32(float32_t fut, float32_t ref, float32_t scale)
+{
+    return fabsf(fut - ref) <= MOVING_REL_ERROR * scale;
+}
+
+JTEST_DEFINE_TEST(arm_moving_stats_f32_test, arm_moving_stats_f32)
+{
+    arm_moving_stats_instance_f32 S;
+    float32_t fut, ref, meanOfSquares;
+    const float32_t *pWin;
+    uint32_t l, b, n, len, num;
+
+    moving_make_input();
+
+    for (l = 0; l < sizeof(moving_lengths) / sizeof(moving_lengths[0]); l++)
+    {
+        len = moving_lengths[l];
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, arm_moving_stats_init_f32(&S, len, moving_state));
+
+        for (n = 0, b = 0; n < MOVING_INPUT_ELTS; n += num, b++)
+        {
+            num = moving_blocks[b % (sizeof(moving_blocks) / sizeof(moving_blocks[0]))];
+            num = (num < MOVING_INPUT_ELTS - n) ? num : MOVING_INPUT_ELTS - n;
+
+            arm_moving_stats_f32(&S, moving_input + n, num);
+
+            /* Window of the batch functions */
+            pWin = moving_input + n + num - ((n + num < len) ? n + num : len);
+            len = (n + num < len) ? n + num : len;
+
+            arm_rms_f32(pWin, len, &ref);
+            meanOfSquares = ref * ref;
+
+            arm_moving_mean_f32(&S, &fut);
+            arm_mean_f32(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(1, moving_close_f32(fut, ref, fabsf(ref)));
+
+            arm_moving_var_f32(&S, &fut);
+            arm_var_f32(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(1, moving_close_f32(fut, ref, meanOfSquares));
+
+            arm_moving_std_f32(&S, &fut);
+            arm_std_f32(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(1, moving_close_f32(fut * fut, ref * ref, meanOfSquares));
+
+            arm_moving_rms_f32(&S, &fut);
+            arm_rms_f32(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(1, moving_close_f32(fut, ref, ref));
+
+            len = moving_lengths[l];
+        }
+
+        JTEST_DUMP_STRF("Window: %d\n", (int)len);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_moving_stats_q31_test, arm_moving_stats_q31)
+{
+    arm_moving_stats_instance_q31 S;
+    q31_t fut, ref;
+    const q31_t *pWin;
+    uint32_t l, b, n, len, num;
+
+    moving_make_input();
+
+    for (l = 0; l < sizeof(moving_lengths) / sizeof(moving_lengths[0]); l++)
+    {
+        len = moving_lengths[l];
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS, arm_moving_stats_init_q31(&S, len, moving_state_q31));
+
+        for (n = 0, b = 0; n < MOVING_INPUT_ELTS; n += num, b++)
+        {
+            num = moving_blocks[b % (sizeof(moving_blocks) / sizeof(moving_blocks[0]))];
+            num = (num < MOVING_INPUT_ELTS - n) ? num : MOVING_INPUT_ELTS - n;
+
+            arm_moving_stats_q31(&S, moving_input_q31 + n, num);
+
+            pWin = moving_input_q31 + n + num - ((n + num < len) ? n + num : len);
+            len = (n + num < len) ? n + num : len;
+
+            arm_moving_mean_q31(&S, &fut);
+            arm_mean_q31(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(ref, fut);
+
+            arm_moving_var_q31(&S, &fut);
+            arm_var_q31(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(ref, fut);
+
+            arm_moving_std_q31(&S, &fut);
+            arm_std_q31(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(ref, fut);
+
+            arm_moving_rms_q31(&S, &fut);
+            arm_rms_q31(pWin, len, &ref);
+            TEST_ASSERT_EQUAL(ref, fut);
+
+            len = moving_lengths[l];
+        }
+
+        JTEST_DUMP_STRF("Window: %d\n", (int)len);
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/* Minimum and maximum test template. Arguments are: function suffix and sample type */
+#define MOVING_MINMAX_DEFINE_TEST(suffix, type)                                         \
+    JTEST_DEFINE_TEST(arm_moving_minmax_##suffix##_test, arm_moving_minmax_##suffix)    \
+    {                                                                                   \
+        arm_moving_minmax_instance_##suffix S;                                          \
+        type fut, ref;                                                                  \
+        uint32_t futIndex, refIndex;                                                    \
+        const type *pWin;                                                               \
+        uint32_t l, b, n, len, num;                                                     \
+                                                                                        \
+        moving_make_input();                                                            \
+                                                                                        \
+        for (l = 0; l < sizeof(moving_lengths) / sizeof(moving_lengths[0]); l++)        \
+        {                                                                               \
+            len = moving_lengths[l];                                                    \
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,                                         \
+                              arm_moving_minmax_init_##suffix(&S, len,                  \
+                                                              moving_state_##suffix,    \
+                                                              moving_pos));             \
+                                                                                        \
+            for (n = 0, b = 0; n < MOVING_INPUT_ELTS; n += num, b++)                    \
+            {                                                                           \
+                num = moving_blocks[b % (sizeof(moving_blocks) /                        \
+                                         sizeof(moving_blocks[0]))];                    \
+                num = (num < MOVING_INPUT_ELTS - n) ? num : MOVING_INPUT_ELTS - n;      \
+                                                                                        \
+                arm_moving_minmax_##suffix(&S, moving_input_##suffix + n, num);         \
+                                                                                        \
+                pWin = moving_input_##suffix + n + num -                                \
+                    ((n + num < len) ? n + num : len);                                  \
+                len = (n + num < len) ? n + num : len;                                  \
+                                                                                        \
+                arm_moving_max_##suffix(&S, &fut, &futIndex);                           \
+                arm_max_##suffix(pWin, len, &ref, &refIndex);                           \
+                TEST_ASSERT_EQUAL(1, fut == ref);                                       \
+                TEST_ASSERT_EQUAL(refIndex, futIndex);                                  \
+                                                                                        \
+                arm_moving_min_##suffix(&S, &fut, &futIndex);                           \
+                arm_min_##suffix(pWin, len, &ref, &refIndex);                           \
+                TEST_ASSERT_EQUAL(1, fut == ref);                                       \
+                TEST_ASSERT_EQUAL(refIndex, futIndex);                                  \
+                                                                                        \
+                len = moving_lengths[l];                                                \
+            }                                                                           \
+                                                                                        \
+            JTEST_DUMP_STRF("Window: %d\n", (int)len);                                  \
+        }                                                                               \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    }
+
+/* Sample buffers under the names used by the template */
+#define moving_input_f32 moving_input
+#define moving_state_f32 moving_state
+
+MOVING_MINMAX_DEFINE_TEST(f32, float32_t);
+MOVING_MINMAX_DEFINE_TEST(q31, q31_t);
+
+JTEST_DEFINE_TEST(arm_moving_stats_init_test, arm_moving_stats_init_f32)
+{
+    arm_moving_stats_instance_f32 stats_f32;
+    arm_moving_stats_instance_q31 stats_q31;
+    arm_moving_minmax_instance_f32 minmax_f32;
+    arm_moving_minmax_instance_q31 minmax_q31;
+    float32_t result;
+    uint32_t index;
+
+    /* Empty windows */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_moving_stats_init_f32(&stats_f32, 0, moving_state));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_moving_stats_init_q31(&stats_q31, 0, moving_state_q31));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_moving_minmax_init_f32(&minmax_f32, 0, moving_state, moving_pos));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_moving_minmax_init_q31(&minmax_q31, 0, moving_state_q31, moving_pos));
+
+    /* No samples yet */
+    arm_moving_stats_init_f32(&stats_f32, 4, moving_state);
+    arm_moving_rms_f32(&stats_f32, &result);
+    TEST_ASSERT_EQUAL(1, result == 0.0f);
+
+    arm_moving_minmax_init_f32(&minmax_f32, 4, moving_state, moving_pos);
+    arm_moving_max_f32(&minmax_f32, &result, &index);
+    TEST_ASSERT_EQUAL(1, result == 0.0f);
+    TEST_ASSERT_EQUAL(0, index);
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(moving_stats_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_moving_stats_f32_test);
+    JTEST_TEST_CALL(arm_moving_stats_q31_test);
+    JTEST_TEST_CALL(arm_moving_minmax_f32_test);
+    JTEST_TEST_CALL(arm_moving_minmax_q31_test);
+    JTEST_TEST_CALL(arm_moving_stats_init_test);
+}
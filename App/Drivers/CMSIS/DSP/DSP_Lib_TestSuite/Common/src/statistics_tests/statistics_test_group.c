@@ -5,7 +5,9 @@ JTEST_DEFINE_GROUP(statistics_tests)
 {
     JTEST_GROUP_CALL(max_tests);
     JTEST_GROUP_CALL(mean_tests);
+    JTEST_GROUP_CALL(median_tests);
     JTEST_GROUP_CALL(min_tests);
+    JTEST_GROUP_CALL(moving_stats_tests);
     JTEST_GROUP_CALL(power_tests);
     JTEST_GROUP_CALL(rms_tests);
     JTEST_GROUP_CALL(std_tests);
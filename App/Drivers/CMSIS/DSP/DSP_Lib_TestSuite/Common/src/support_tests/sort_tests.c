@@ -0,0 +1,94 @@
+#include "jtest.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "test_templates.h"
+#include "support_tests.h"
+#include <stdlib.h>
+
+/*--------------------------------------------------------------------------------*/
+/* arm_sort_<suffix>() is compared with qsort() from the C library, out of place and
+ * in place, on lengths around those of the sorting network, of the merge passes and
+ * of the radix sort, for random samples, samples with few distinct values and
+ * samples of alternating signs. */
+/*--------------------------------------------------------------------------------*/
+
+#define SORT_MAX_LEN            2048
+
+static const uint32_t sort_lengths[] = {1, 2, 7, 8, 9, 16, 63, 64, 65, 100, 255, 256, 257, 1000, SORT_MAX_LEN};
+
+/**
+ *  Sample n of the input pattern, full scale for the fixed-point types.
+ */
+static q31_t sort_pattern(uint32_t pattern, uint32_t n)
+{
+    switch (pattern)
+    {
+    case 0:
+        return (q31_t) (n * 2654435761u);
+    case 1:
+        return (q31_t) ((n * 7u) % 5u) << 28;
+    default:
+        return (n & 1u) ? (q31_t) (n << 16) : -(q31_t) (n << 16);
+    }
+}
+
+#define JTEST_ARM_SORT_TEST(suffix, type, scale)                                \
+    static type sort_input_##suffix[SORT_MAX_LEN];                              \
+    static type sort_ref_##suffix[SORT_MAX_LEN];                                \
+    static type sort_output_##suffix[SORT_MAX_LEN];                             \
+    static type sort_scratch_##suffix[SORT_MAX_LEN];                            \
+                                                                                \
+    static int sort_cmp_##suffix(const void *a, const void *b)                  \
+    {                                                                           \
+        type x = *(const type *) a, y = *(const type *) b;                      \
+        return (x > y) - (x < y);                                               \
+    }                                                                           \
+                                                                                \
+    JTEST_DEFINE_TEST(arm_sort_##suffix##_test, arm_sort_##suffix)              \
+    {                                                                           \
+        uint32_t l, p, n, len;                                                  \
+                                                                                \
+        for (p = 0; p < 3; p++)                                                 \
+        {                                                                       \
+            for (l = 0; l < sizeof(sort_lengths) / sizeof(sort_lengths[0]); l++) \
+            {                                                                   \
+                len = sort_lengths[l];                                          \
+                for (n = 0; n < len; n++)                                       \
+                {                                                               \
+                    sort_input_##suffix[n] = (type) (sort_pattern(p, n) scale); \
+                }                                                               \
+                memcpy(sort_ref_##suffix, sort_input_##suffix, len * sizeof(type)); \
+                qsort(sort_ref_##suffix, len, sizeof(type), sort_cmp_##suffix); \
+                                                                                \
+                arm_sort_##suffix(sort_input_##suffix, sort_output_##suffix,    \
+                                  sort_scratch_##suffix, len);                  \
+                TEST_ASSERT_EQUAL(0, memcmp(sort_output_##suffix,               \
+                                  sort_ref_##suffix, len * sizeof(type)));      \
+                                                                                \
+                arm_sort_##suffix(sort_input_##suffix, sort_input_##suffix,     \
+                                  sort_scratch_##suffix, len);                  \
+                TEST_ASSERT_EQUAL(0, memcmp(sort_input_##suffix,                \
+                                  sort_ref_##suffix, len * sizeof(type)));      \
+            }                                                                   \
+        }                                                                       \
+                                                                                \
+        return JTEST_TEST_PASSED;                                               \
+    }
+
+JTEST_ARM_SORT_TEST(f32, float32_t, / 2147483648.0f);
+JTEST_ARM_SORT_TEST(q31, q31_t, );
+JTEST_ARM_SORT_TEST(q15, q15_t, >> 16);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(sort_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_sort_f32_test);
+    JTEST_TEST_CALL(arm_sort_q31_test);
+    JTEST_TEST_CALL(arm_sort_q15_test);
+}
@@ -3,6 +3,7 @@
 #include "arr_desc.h"
 #include "transform_templates.h"
 #include "transform_test_data.h"
+#include "arm_const_structs.h"
 
 #define CFFT_SNR_THRESHOLD 120
 
@@ -96,6 +97,270 @@
     } while (0)
 
 
+/*
+  Mixed-radix CFFT test template. Argument is the inverse-transform flag. The
+  twiddle table and scratch buffer are placed in the out-of-place input arrays,
+  which the in-place tests do not use.
+*/
+#define CFFT_MIXED_TEST_BODY(ifft_flag)                                                 \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_mixed_instance_f32 cfft_inst;                                          \
+                                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            fftlen_idx, uint16_t, fftlen, transform_cfft_mixed_fftlens                  \
+            ,                                                                           \
+                                                                                        \
+            arm_cfft_mixed_init_f32(&cfft_inst, fftlen,                                 \
+                                    transform_fft_input_fut,                            \
+                                    transform_fft_input_ref);                           \
+                                                                                        \
+            TRANSFORM_PREPARE_INPLACE_INPUTS(                                           \
+                transform_fft_f32_inputs,                                               \
+                fftlen * sizeof(float32_t) * 2 /*complex_inputs*/);                     \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)fftlen,                                                \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_mixed_f32(&cfft_inst,                                          \
+                                   transform_fft_inplace_input_fut,                     \
+                                   ifft_flag));                                         \
+            ref_cfft_mixed_f32(&cfft_inst,                                              \
+                               transform_fft_inplace_input_ref,                         \
+                               ifft_flag);                                              \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(                                      \
+                fftlen,                                                                 \
+                float32_t));                                                            \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  Large CFFT test template. Argument is the inverse-transform flag. The inputs
+  are longer than transform_fft_f32_inputs, so it is repeated with a different
+  weight on each repetition. The twiddle table is placed in
+  transform_fft_input_fut.
+*/
+#define CFFT_LARGE_TEST_BODY(ifft_flag)                                                 \
+    do                                                                                  \
+    {                                                                                   \
+        arm_cfft_large_instance_f32 cfft_inst;                                          \
+        uint32_t i;                                                                     \
+                                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            fftlen_idx, uint32_t, fftlen, transform_cfft_large_fftlens                  \
+            ,                                                                           \
+                                                                                        \
+            arm_cfft_large_init_f32(&cfft_inst, fftlen,                                 \
+                                    transform_fft_input_fut,                            \
+                                    transform_large_fft_work);                          \
+                                                                                        \
+            for (i = 0; i < fftlen * 2; i++)                                            \
+            {                                                                           \
+                transform_large_fft_fut[i] =                                            \
+                    transform_fft_f32_inputs[i % (TRANSFORM_MAX_FFT_LEN * 2)] *         \
+                    (float32_t) (1 + i / (TRANSFORM_MAX_FFT_LEN * 2));                  \
+                transform_large_fft_ref[i] = transform_large_fft_fut[i];                \
+            }                                                                           \
+                                                                                        \
+            /* Display parameter values */                                              \
+            JTEST_DUMP_STRF("Block Size: %d\n"                                          \
+                            "Inverse-transform flag: %d\n",                             \
+                            (int)fftlen,                                                \
+                            (int)ifft_flag);                                            \
+                                                                                        \
+            /* Display cycle count and run test */                                      \
+            JTEST_COUNT_CYCLES(                                                         \
+                arm_cfft_large_f32(&cfft_inst,                                          \
+                                   transform_large_fft_fut,                             \
+                                   ifft_flag));                                         \
+            ref_cfft_large_f32(&cfft_inst,                                              \
+                               transform_large_fft_ref,                                 \
+                               ifft_flag);                                              \
+                                                                                        \
+            /* Test correctness */                                                      \
+            TEST_ASSERT_SNR(                                                            \
+                transform_large_fft_ref,                                                \
+                transform_large_fft_fut,                                                \
+                fftlen * 2,                                                             \
+                TRANSFORM_SNR_THRESHOLD_float32_t));                                    \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  Batched CFFT test template. Argument is the inverse-transform flag. Frames
+  are separated by a gap to check that the stride is honoured, and each frame
+  is compared with the reference transform of that frame. Lengths whose frames
+  do not fit in the buffers are skipped.
+*/
+#define CFFT_BATCH_FRAMES 3
+#define CFFT_BATCH_GAP    8
+
+#define CFFT_BATCH_TEST_BODY(ifft_flag)                                                 \
+    do                                                                                  \
+    {                                                                                   \
+        uint32_t stride;                                                                \
+        uint32_t f;                                                                     \
+                                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                                           \
+            cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,                \
+            transform_cfft_f32_structs                                                  \
+            ,                                                                           \
+                                                                                        \
+            stride = 2 * cfft_inst_ptr->fftLen + CFFT_BATCH_GAP;                        \
+            if (CFFT_BATCH_FRAMES * stride <= TRANSFORM_MAX_FFT_LEN * 2)                \
+            {                                                                           \
+                memset(transform_fft_inplace_input_fut, 0,                              \
+                       CFFT_BATCH_FRAMES * stride * sizeof(float32_t));                 \
+                memset(transform_fft_inplace_input_ref, 0,                              \
+                       CFFT_BATCH_FRAMES * stride * sizeof(float32_t));                 \
+                for (f = 0; f < CFFT_BATCH_FRAMES; f++)                                 \
+                {                                                                       \
+                    memcpy(transform_fft_inplace_input_fut + f * stride,                \
+                           transform_fft_f32_inputs + f * 2 * cfft_inst_ptr->fftLen,    \
+                           cfft_inst_ptr->fftLen * sizeof(float32_t) * 2);              \
+                    memcpy(transform_fft_inplace_input_ref + f * stride,                \
+                           transform_fft_f32_inputs + f * 2 * cfft_inst_ptr->fftLen,    \
+                           cfft_inst_ptr->fftLen * sizeof(float32_t) * 2);              \
+                }                                                                       \
+                                                                                        \
+                /* Display parameter values */                                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                                      \
+                                "Frames: %d\n"                                          \
+                                "Inverse-transform flag: %d\n",                         \
+                                (int)cfft_inst_ptr->fftLen,                             \
+                                (int)CFFT_BATCH_FRAMES,                                 \
+                                (int)ifft_flag);                                        \
+                                                                                        \
+                /* Display cycle count and run test */                                  \
+                JTEST_COUNT_CYCLES(                                                     \
+                    arm_cfft_batch_f32(cfft_inst_ptr,                                   \
+                                       transform_fft_inplace_input_fut,                 \
+                                       CFFT_BATCH_FRAMES,                               \
+                                       stride,                                          \
+                                       ifft_flag,                                       \
+                                       1));                                             \
+                for (f = 0; f < CFFT_BATCH_FRAMES; f++)                                 \
+                {                                                                       \
+                    ref_cfft_f32(cfft_inst_ptr,                                         \
+                                 transform_fft_inplace_input_ref + f * stride,          \
+                                 ifft_flag,                                             \
+                                 1);                                                    \
+                }                                                                       \
+                                                                                        \
+                /* Test correctness */                                                  \
+                TEST_ASSERT_SNR(                                                        \
+                    transform_fft_inplace_input_ref,                                    \
+                    transform_fft_inplace_input_fut,                                    \
+                    CFFT_BATCH_FRAMES * stride,                                         \
+                    TRANSFORM_SNR_THRESHOLD_float32_t);                                 \
+            });                                                                         \
+                                                                                        \
+        return JTEST_TEST_PASSED;                                                       \
+    } while (0)
+
+
+/*
+  CFFT with tables computed in RAM. The tables are compared with the constant
+  tables of all the lengths: twiddle factors within 1 ULP, and bit reversal
+  tables of the same length which give the same permutation. The transforms of
+  the tested lengths are compared with the reference.
+*/
+static float32_t cfft_ram_twiddle[TRANSFORM_MAX_FFT_LEN * 2];
+static uint16_t cfft_ram_bitrev[TRANSFORM_MAX_FFT_LEN * 2];
+static uint16_t cfft_ram_perm_fut[TRANSFORM_MAX_FFT_LEN];
+static uint16_t cfft_ram_perm_ref[TRANSFORM_MAX_FFT_LEN];
+
+static const arm_cfft_instance_f32 * const cfft_ram_const_structs[] =
+{
+    &arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+    &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+    &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+};
+
+/* Distance in ULPs of two floats of the same sign, or of zeros */
+static uint32_t cfft_ram_ulps(float32_t a, float32_t b)
+{
+    int32_t ia, ib;
+
+    if (a == b)
+    {
+        return 0;
+    }
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    return (ia > ib) ? (uint32_t)(ia - ib) : (uint32_t)(ib - ia);
+}
+
+/* Applies the swaps of a bit reversal table to the indices of the complex values */
+static void cfft_ram_permute(uint16_t * perm,
+                             uint16_t fftLen,
+                             const uint16_t * pBitRevTable,
+                             uint16_t bitRevLength)
+{
+    uint16_t i, a, b, t;
+
+    for (i = 0; i < fftLen; i++)
+    {
+        perm[i] = i;
+    }
+
+    for (i = 0; i < bitRevLength; i += 2)
+    {
+        a = pBitRevTable[i] / 8;
+        b = pBitRevTable[i + 1] / 8;
+        t = perm[a];
+        perm[a] = perm[b];
+        perm[b] = t;
+    }
+}
+
+/* Checks the tables of a RAM instance against those of the constant instance */
+static JTEST_TEST_RET_t cfft_ram_check_tables(const arm_cfft_instance_f32 * S,
+                                              const arm_cfft_instance_f32 * ref)
+{
+    uint32_t i;
+    uint32_t ulps = 0;
+
+    for (i = 0; i < 2U * ref->fftLen; i++)
+    {
+        if (cfft_ram_ulps(S->pTwiddle[i], ref->pTwiddle[i]) > ulps)
+        {
+            ulps = cfft_ram_ulps(S->pTwiddle[i], ref->pTwiddle[i]);
+        }
+    }
+
+    cfft_ram_permute(cfft_ram_perm_fut, S->fftLen, S->pBitRevTable, S->bitRevLength);
+    cfft_ram_permute(cfft_ram_perm_ref, ref->fftLen, ref->pBitRevTable, ref->bitRevLength);
+
+    JTEST_DUMP_STRF("Block Size: %d\n"
+                    "Twiddle factor error: %d ULP\n"
+                    "Bit reversal table length: %d\n",
+                    (int)S->fftLen,
+                    (int)ulps,
+                    (int)S->bitRevLength);
+
+    TEST_ASSERT_EQUAL(ref->fftLen, S->fftLen);
+    TEST_ASSERT_EQUAL(ref->bitRevLength, S->bitRevLength);
+    TEST_ASSERT_EQUAL(1, ulps <= 1);
+    TEST_ASSERT_EQUAL(0, memcmp(cfft_ram_perm_fut, cfft_ram_perm_ref,
+                                S->fftLen * sizeof(uint16_t)));
+
+    return JTEST_TEST_PASSED;
+}
+
 /* Test declarations */
 JTEST_DEFINE_TEST(cfft_f32_test, cfft_f32)
 {
@@ -107,6 +372,91 @@ JTEST_DEFINE_TEST(cfft_f32_ifft_test, cfft_f32)
     CFFT_TEST_BODY((uint8_t) 1, f32, float32_t);
 }
 
+JTEST_DEFINE_TEST(cfft_batch_f32_test, cfft_batch_f32)
+{
+    CFFT_BATCH_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_batch_f32_ifft_test, cfft_batch_f32)
+{
+    CFFT_BATCH_TEST_BODY((uint8_t) 1);
+}
+
+JTEST_DEFINE_TEST(cfft_mixed_f32_test, cfft_mixed_f32)
+{
+    CFFT_MIXED_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_mixed_f32_ifft_test, cfft_mixed_f32)
+{
+    CFFT_MIXED_TEST_BODY((uint8_t) 1);
+}
+
+JTEST_DEFINE_TEST(cfft_large_f32_test, cfft_large_f32)
+{
+    CFFT_LARGE_TEST_BODY((uint8_t) 0);
+}
+
+JTEST_DEFINE_TEST(cfft_large_f32_ifft_test, cfft_large_f32)
+{
+    CFFT_LARGE_TEST_BODY((uint8_t) 1);
+}
+
+JTEST_DEFINE_TEST(cfft_init_ram_f32_test, cfft_init_ram_f32)
+{
+    arm_cfft_instance_f32 cfft_inst_fut;
+    uint32_t i;
+
+    /* Lengths which are not powers of two between 16 and 4096 */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_cfft_init_ram_f32(&cfft_inst_fut, 8, cfft_ram_twiddle, cfft_ram_bitrev));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_cfft_init_ram_f32(&cfft_inst_fut, 96, cfft_ram_twiddle, cfft_ram_bitrev));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_cfft_init_ram_f32(&cfft_inst_fut, 8192, cfft_ram_twiddle, cfft_ram_bitrev));
+
+    for (i = 0; i < sizeof(cfft_ram_const_structs) / sizeof(cfft_ram_const_structs[0]); i++)
+    {
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                          arm_cfft_init_ram_f32(&cfft_inst_fut,
+                                                cfft_ram_const_structs[i]->fftLen,
+                                                cfft_ram_twiddle,
+                                                cfft_ram_bitrev));
+
+        if (cfft_ram_check_tables(&cfft_inst_fut, cfft_ram_const_structs[i]) != JTEST_TEST_PASSED)
+        {
+            return JTEST_TEST_FAILED;
+        }
+    }
+
+    TEMPLATE_DO_ARR_DESC(
+        cfft_inst_idx, const arm_cfft_instance_f32 *, cfft_inst_ptr,
+        transform_cfft_f32_structs
+        ,
+        arm_cfft_init_ram_f32(&cfft_inst_fut, cfft_inst_ptr->fftLen,
+                              cfft_ram_twiddle, cfft_ram_bitrev);
+
+        TRANSFORM_PREPARE_INPLACE_INPUTS(
+            transform_fft_f32_inputs,
+            cfft_inst_ptr->fftLen * sizeof(float32_t) * 2);
+
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_cfft_f32(&cfft_inst_fut,
+                         transform_fft_inplace_input_fut,
+                         0, 1));
+        ref_cfft_f32(cfft_inst_ptr,
+                     transform_fft_inplace_input_ref,
+                     0, 1);
+
+        /* Test correctness */
+        TRANSFORM_SNR_COMPARE_CMPLX_INTERFACE(
+            cfft_inst_ptr->fftLen,
+            float32_t));
+
+    return JTEST_TEST_PASSED;
+}
+
 JTEST_DEFINE_TEST(cfft_q31_test, cfft_q31)
 {
     CFFT_TEST_BODY((uint8_t) 0, q31, q31_t);
@@ -136,6 +486,17 @@ JTEST_DEFINE_GROUP(cfft_tests)
     JTEST_TEST_CALL(cfft_f32_test);
     JTEST_TEST_CALL(cfft_f32_ifft_test);
 
+    JTEST_TEST_CALL(cfft_batch_f32_test);
+    JTEST_TEST_CALL(cfft_batch_f32_ifft_test);
+
+    JTEST_TEST_CALL(cfft_mixed_f32_test);
+    JTEST_TEST_CALL(cfft_mixed_f32_ifft_test);
+
+    JTEST_TEST_CALL(cfft_large_f32_test);
+    JTEST_TEST_CALL(cfft_large_f32_ifft_test);
+
+    JTEST_TEST_CALL(cfft_init_ram_f32_test);
+
     JTEST_TEST_CALL(cfft_q31_test);
     JTEST_TEST_CALL(cfft_q31_ifft_test);
 
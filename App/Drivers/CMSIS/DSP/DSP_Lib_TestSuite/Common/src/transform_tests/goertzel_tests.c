@@ -0,0 +1,393 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* arm_goertzel_<suffix>() and arm_sdft_<suffix>() are compared with the bins given
+ * by arm_rfft_fast_f32(): the Goertzel bins with those of each frame, the sliding DFT
+ * bins with those of the last windowLen samples after each call. The input is given
+ * in blocks of several sizes. The Q31 outputs are compared with the floating-point
+ * bins divided by the length. */
+/*--------------------------------------------------------------------------------*/
+
+#define GOERTZEL_MAX_LEN        256
+#define GOERTZEL_INPUT_ELTS     1500
+#define GOERTZEL_MAX_BINS       11
+#define GOERTZEL_MAX_OUTPUTS    (2 * GOERTZEL_MAX_BINS * 200)
+
+static float32_t goertzel_input[GOERTZEL_MAX_LEN + GOERTZEL_INPUT_ELTS];
+static q31_t goertzel_input_q31[GOERTZEL_INPUT_ELTS];
+static float32_t goertzel_frame[GOERTZEL_MAX_LEN];
+static float32_t goertzel_spectrum[GOERTZEL_MAX_LEN];
+static float32_t goertzel_coeffs[3 * GOERTZEL_MAX_BINS];
+static float32_t goertzel_state[2 * GOERTZEL_MAX_BINS];
+static float32_t goertzel_delay[GOERTZEL_MAX_LEN];
+static q31_t goertzel_coeffs_q31[3 * GOERTZEL_MAX_BINS];
+static q63_t goertzel_state_q63[2 * GOERTZEL_MAX_BINS];
+static q31_t goertzel_delay_q31[GOERTZEL_MAX_LEN];
+static q31_t goertzel_fut_q31[GOERTZEL_MAX_OUTPUTS];
+static float32_t goertzel_fut[GOERTZEL_MAX_OUTPUTS];
+static float32_t goertzel_ref[GOERTZEL_MAX_OUTPUTS];
+static uint16_t goertzel_bins[GOERTZEL_MAX_BINS];
+
+static const uint16_t goertzel_lengths[] = {32, 64, 256};
+
+static const uint16_t goertzel_num_bins[] = {1, 4, GOERTZEL_MAX_BINS};
+
+/* Input block sizes, used in turn */
+static const uint32_t goertzel_blocks[] = {1, 7, 300, 64, 33};
+
+/**
+ *  Input samples, after #GOERTZEL_MAX_LEN zeros which precede the first sliding
+ *  DFT window, and their Q31 values at half scale.
+ */
+static void goertzel_make_input(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < GOERTZEL_MAX_LEN; n++)
+    {
+        goertzel_input[n] = 0.0f;
+    }
+
+    for (n = 0; n < GOERTZEL_INPUT_ELTS; n++)
+    {
+        goertzel_input[GOERTZEL_MAX_LEN + n] = 0.5f * sinf(0.05f * n) + 0.25f * cosf(0.71f * n) +
+            (float32_t) ((int32_t) ((n * 97u + 5u) % 255u) - 127) / 1024.0f;
+    }
+
+    arm_float_to_q31(goertzel_input + GOERTZEL_MAX_LEN, goertzel_input_q31, GOERTZEL_INPUT_ELTS);
+}
+
+/**
+ *  DC, Nyquist, bins just above and below them and bins in between.
+ */
+static void goertzel_make_bins(uint32_t len)
+{
+    uint32_t k;
+
+    goertzel_bins[0] = 0;
+    goertzel_bins[1] = len / 2;
+    goertzel_bins[2] = 1;
+    goertzel_bins[3] = len / 2 - 1;
+
+    for (k = 4; k < GOERTZEL_MAX_BINS; k++)
+    {
+        goertzel_bins[k] = (k * 7 * len / 64 + k) % len;
+    }
+}
+
+/**
+ *  #num_bins bins of the frame at #frame_in through arm_rfft_fast_f32(), multiplied by #scale.
+ */
+static void goertzel_ref_bins(arm_rfft_fast_instance_f32 * rfft,
+                              const float32_t * frame_in,
+                              uint32_t len,
+                              uint32_t num_bins,
+                              float32_t scale,
+                              float32_t * out)
+{
+    uint32_t i, k;
+
+    memcpy(goertzel_frame, frame_in, len * sizeof(float32_t));
+    arm_rfft_fast_f32(rfft, goertzel_frame, goertzel_spectrum, 0);
+
+    for (i = 0; i < num_bins; i++)
+    {
+        k = goertzel_bins[i];
+
+        /* DC and Nyquist are packed in the first complex value, and the bins above
+           Nyquist are the conjugates of those below */
+        if (k == 0)
+        {
+            out[2 * i] = goertzel_spectrum[0];
+            out[2 * i + 1] = 0.0f;
+        }
+        else if (k == len / 2)
+        {
+            out[2 * i] = goertzel_spectrum[1];
+            out[2 * i + 1] = 0.0f;
+        }
+        else if (k < len / 2)
+        {
+            out[2 * i] = goertzel_spectrum[2 * k];
+            out[2 * i + 1] = goertzel_spectrum[2 * k + 1];
+        }
+        else
+        {
+            out[2 * i] = goertzel_spectrum[2 * (len - k)];
+            out[2 * i + 1] = -goertzel_spectrum[2 * (len - k) + 1];
+        }
+
+        out[2 * i] *= scale;
+        out[2 * i + 1] *= scale;
+    }
+}
+
+/**
+ *  Number of samples of the call #blk at sample #n.
+ */
+static uint32_t goertzel_block_len(uint32_t n, uint32_t blk)
+{
+    uint32_t len = goertzel_blocks[blk % (sizeof(goertzel_blocks) / sizeof(goertzel_blocks[0]))];
+
+    return (n + len > GOERTZEL_INPUT_ELTS) ? (GOERTZEL_INPUT_ELTS - n) : len;
+}
+
+JTEST_DEFINE_TEST(arm_goertzel_f32_test, arm_goertzel_f32)
+{
+    arm_goertzel_instance_f32 goertzel_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    uint32_t len, num_bins, i, j, n, blk, blk_len, frames, ref_frames;
+
+    goertzel_make_input();
+
+    for (i = 0; i < sizeof(goertzel_lengths) / sizeof(goertzel_lengths[0]); i++)
+    {
+        len = goertzel_lengths[i];
+        goertzel_make_bins(len);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, len);
+
+        for (j = 0; j < sizeof(goertzel_num_bins) / sizeof(goertzel_num_bins[0]); j++)
+        {
+            num_bins = goertzel_num_bins[j];
+
+            JTEST_DUMP_STRF("Length: %d, Bins: %d\n", (int)len, (int)num_bins);
+
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                              arm_goertzel_init_f32(&goertzel_inst_fut, num_bins, len,
+                                                    goertzel_bins, goertzel_coeffs,
+                                                    goertzel_state));
+
+            frames = 0;
+            for (n = 0, blk = 0; n < GOERTZEL_INPUT_ELTS; n += blk_len, blk++)
+            {
+                blk_len = goertzel_block_len(n, blk);
+
+                JTEST_COUNT_CYCLES(
+                    frames += arm_goertzel_f32(&goertzel_inst_fut,
+                                               goertzel_input + GOERTZEL_MAX_LEN + n,
+                                               goertzel_fut + frames * 2 * num_bins,
+                                               blk_len));
+            }
+
+            ref_frames = 0;
+            for (n = 0; n + len <= GOERTZEL_INPUT_ELTS; n += len)
+            {
+                goertzel_ref_bins(&rfft_inst_ref, goertzel_input + GOERTZEL_MAX_LEN + n, len,
+                                  num_bins, 1.0f, goertzel_ref + ref_frames * 2 * num_bins);
+                ref_frames++;
+            }
+
+            TEST_ASSERT_EQUAL(ref_frames, frames);
+            TEST_ASSERT_SNR(goertzel_ref, goertzel_fut, frames * 2 * num_bins,
+                            TRANSFORM_SNR_THRESHOLD_float32_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_goertzel_q31_test, arm_goertzel_q31)
+{
+    arm_goertzel_instance_q31 goertzel_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    uint32_t len, num_bins, i, j, n, blk, blk_len, frames, ref_frames;
+
+    goertzel_make_input();
+
+    for (i = 0; i < sizeof(goertzel_lengths) / sizeof(goertzel_lengths[0]); i++)
+    {
+        len = goertzel_lengths[i];
+        goertzel_make_bins(len);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, len);
+
+        for (j = 0; j < sizeof(goertzel_num_bins) / sizeof(goertzel_num_bins[0]); j++)
+        {
+            num_bins = goertzel_num_bins[j];
+
+            JTEST_DUMP_STRF("Length: %d, Bins: %d\n", (int)len, (int)num_bins);
+
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                              arm_goertzel_init_q31(&goertzel_inst_fut, num_bins, len,
+                                                    goertzel_bins, goertzel_coeffs_q31,
+                                                    goertzel_state_q63));
+
+            frames = 0;
+            for (n = 0, blk = 0; n < GOERTZEL_INPUT_ELTS; n += blk_len, blk++)
+            {
+                blk_len = goertzel_block_len(n, blk);
+
+                JTEST_COUNT_CYCLES(
+                    frames += arm_goertzel_q31(&goertzel_inst_fut,
+                                               goertzel_input_q31 + n,
+                                               goertzel_fut_q31 + frames * 2 * num_bins,
+                                               blk_len));
+            }
+
+            ref_frames = 0;
+            for (n = 0; n + len <= GOERTZEL_INPUT_ELTS; n += len)
+            {
+                goertzel_ref_bins(&rfft_inst_ref, goertzel_input + GOERTZEL_MAX_LEN + n, len,
+                                  num_bins, 1.0f / len, goertzel_ref + ref_frames * 2 * num_bins);
+                ref_frames++;
+            }
+
+            arm_q31_to_float(goertzel_fut_q31, goertzel_fut, frames * 2 * num_bins);
+
+            TEST_ASSERT_EQUAL(ref_frames, frames);
+            TEST_ASSERT_SNR(goertzel_ref, goertzel_fut, frames * 2 * num_bins,
+                            TRANSFORM_SNR_THRESHOLD_q31_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_sdft_f32_test, arm_sdft_f32)
+{
+    arm_sdft_instance_f32 sdft_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    uint32_t len, num_bins, i, j, n, blk, blk_len, calls;
+
+    goertzel_make_input();
+
+    for (i = 0; i < sizeof(goertzel_lengths) / sizeof(goertzel_lengths[0]); i++)
+    {
+        len = goertzel_lengths[i];
+        goertzel_make_bins(len);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, len);
+
+        for (j = 0; j < sizeof(goertzel_num_bins) / sizeof(goertzel_num_bins[0]); j++)
+        {
+            num_bins = goertzel_num_bins[j];
+
+            JTEST_DUMP_STRF("Length: %d, Bins: %d\n", (int)len, (int)num_bins);
+
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                              arm_sdft_init_f32(&sdft_inst_fut, num_bins, len, goertzel_bins,
+                                                1.0f, goertzel_coeffs, goertzel_state,
+                                                goertzel_delay));
+
+            calls = 0;
+            for (n = 0, blk = 0; n < GOERTZEL_INPUT_ELTS; n += blk_len, blk++)
+            {
+                blk_len = goertzel_block_len(n, blk);
+
+                JTEST_COUNT_CYCLES(
+                    arm_sdft_f32(&sdft_inst_fut, goertzel_input + GOERTZEL_MAX_LEN + n,
+                                 goertzel_fut + calls * 2 * num_bins, blk_len));
+
+                /* The window ends with the last sample of the block */
+                goertzel_ref_bins(&rfft_inst_ref, goertzel_input + GOERTZEL_MAX_LEN + n + blk_len - len,
+                                  len, num_bins, 1.0f, goertzel_ref + calls * 2 * num_bins);
+                calls++;
+            }
+
+            TEST_ASSERT_SNR(goertzel_ref, goertzel_fut, calls * 2 * num_bins,
+                            TRANSFORM_SNR_THRESHOLD_float32_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_sdft_q31_test, arm_sdft_q31)
+{
+    arm_sdft_instance_q31 sdft_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    uint32_t len, num_bins, i, j, n, blk, blk_len, calls;
+
+    goertzel_make_input();
+
+    for (i = 0; i < sizeof(goertzel_lengths) / sizeof(goertzel_lengths[0]); i++)
+    {
+        len = goertzel_lengths[i];
+        goertzel_make_bins(len);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, len);
+
+        for (j = 0; j < sizeof(goertzel_num_bins) / sizeof(goertzel_num_bins[0]); j++)
+        {
+            num_bins = goertzel_num_bins[j];
+
+            JTEST_DUMP_STRF("Length: %d, Bins: %d\n", (int)len, (int)num_bins);
+
+            TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                              arm_sdft_init_q31(&sdft_inst_fut, num_bins, len, goertzel_bins,
+                                                0x7FFFFFFF, goertzel_coeffs_q31,
+                                                goertzel_state_q63, goertzel_delay_q31));
+
+            calls = 0;
+            for (n = 0, blk = 0; n < GOERTZEL_INPUT_ELTS; n += blk_len, blk++)
+            {
+                blk_len = goertzel_block_len(n, blk);
+
+                JTEST_COUNT_CYCLES(
+                    arm_sdft_q31(&sdft_inst_fut, goertzel_input_q31 + n,
+                                 goertzel_fut_q31 + calls * 2 * num_bins, blk_len));
+
+                /* The window ends with the last sample of the block */
+                goertzel_ref_bins(&rfft_inst_ref, goertzel_input + GOERTZEL_MAX_LEN + n + blk_len - len,
+                                  len, num_bins, 1.0f / len, goertzel_ref + calls * 2 * num_bins);
+                calls++;
+            }
+
+            arm_q31_to_float(goertzel_fut_q31, goertzel_fut, calls * 2 * num_bins);
+
+            TEST_ASSERT_SNR(goertzel_ref, goertzel_fut, calls * 2 * num_bins,
+                            TRANSFORM_SNR_THRESHOLD_q31_t);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_goertzel_init_test, arm_goertzel_init_f32)
+{
+    arm_goertzel_instance_f32 goertzel_inst_f32;
+    arm_goertzel_instance_q31 goertzel_inst_q31;
+    arm_sdft_instance_f32 sdft_inst_f32;
+    arm_sdft_instance_q31 sdft_inst_q31;
+
+    goertzel_make_bins(32);
+
+    /* No samples, a bin past the length, and a damping factor out of range */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_goertzel_init_f32(&goertzel_inst_f32, 4, 0, goertzel_bins,
+                                            goertzel_coeffs, goertzel_state));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_goertzel_init_q31(&goertzel_inst_q31, 4, 16, goertzel_bins,
+                                            goertzel_coeffs_q31, goertzel_state_q63));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_sdft_init_f32(&sdft_inst_f32, 4, 16, goertzel_bins, 1.0f,
+                                        goertzel_coeffs, goertzel_state, goertzel_delay));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_sdft_init_f32(&sdft_inst_f32, 4, 32, goertzel_bins, 1.5f,
+                                        goertzel_coeffs, goertzel_state, goertzel_delay));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_sdft_init_q31(&sdft_inst_q31, 4, 32, goertzel_bins, 0,
+                                        goertzel_coeffs_q31, goertzel_state_q63,
+                                        goertzel_delay_q31));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(goertzel_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_goertzel_f32_test);
+    JTEST_TEST_CALL(arm_goertzel_q31_test);
+    JTEST_TEST_CALL(arm_sdft_f32_test);
+    JTEST_TEST_CALL(arm_sdft_q31_test);
+    JTEST_TEST_CALL(arm_goertzel_init_test);
+}
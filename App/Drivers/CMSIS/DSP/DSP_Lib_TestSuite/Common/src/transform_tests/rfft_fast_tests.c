@@ -61,8 +61,216 @@ FFT fast function test template. Arguments are: function configuration suffix
         return JTEST_TEST_PASSED;                                       \
     }
 
+/*
+Batched FFT fast function test template. Arguments are: function configuration
+suffix and inverse-transform flag. Frames are separated by a gap to check that
+the stride is honoured. Lengths whose frames do not fit in the buffers, or which
+are not built, are skipped.
+*/
+#define RFFT_FAST_BATCH_FRAMES 3
+#define RFFT_FAST_BATCH_GAP    8
+
+#define RFFT_FAST_BATCH_DEFINE_TEST(config_suffix, ifft_flag)           \
+    JTEST_DEFINE_TEST(arm_rfft_fast_batch_f32_##config_suffix##_test,   \
+                      arm_rfft_fast_batch_f32)                          \
+    {                                                                   \
+        arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};         \
+        arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};         \
+        uint32_t stride;                                                \
+        uint32_t f;                                                     \
+                                                                        \
+        /* Go through all FFT lengths */                                \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens   \
+            ,                                                           \
+                                                                        \
+            stride = fftlen + RFFT_FAST_BATCH_GAP;                      \
+            if ((RFFT_FAST_BATCH_FRAMES * stride <=                     \
+                 TRANSFORM_MAX_FFT_LEN * 2) &&                          \
+                (arm_rfft_fast_init_f32(&rfft_inst_fut, fftlen) ==      \
+                 ARM_MATH_SUCCESS) &&                                   \
+                (arm_rfft_fast_init_f32(&rfft_inst_ref, fftlen) ==      \
+                 ARM_MATH_SUCCESS))                                     \
+            {                                                           \
+                memset(transform_fft_input_fut, 0,                      \
+                       RFFT_FAST_BATCH_FRAMES * stride *                \
+                       sizeof(float32_t));                              \
+                memset(transform_fft_output_fut, 0,                     \
+                       RFFT_FAST_BATCH_FRAMES * stride *                \
+                       sizeof(float32_t));                              \
+                for (f = 0; f < RFFT_FAST_BATCH_FRAMES; f++)            \
+                {                                                       \
+                    memcpy(transform_fft_input_fut + f * stride,        \
+                           transform_fft_f32_inputs + f * fftlen,       \
+                           fftlen * sizeof(float32_t));                 \
+                }                                                       \
+                memcpy(transform_fft_input_ref,                         \
+                       transform_fft_input_fut,                         \
+                       RFFT_FAST_BATCH_FRAMES * stride *                \
+                       sizeof(float32_t));                              \
+                                                                        \
+                /* Display parameter values */                          \
+                JTEST_DUMP_STRF("Block Size: %d\n"                      \
+                                "Frames: %d\n"                          \
+                                "Inverse-transform flag: %d\n",         \
+                                (int)fftlen,                            \
+                                (int)RFFT_FAST_BATCH_FRAMES,            \
+                                (int)ifft_flag);                        \
+                                                                        \
+                /* Display cycle count and run test */                  \
+                JTEST_COUNT_CYCLES(                                     \
+                    arm_rfft_fast_batch_f32(                            \
+                        &rfft_inst_fut,                                 \
+                        transform_fft_input_fut,                        \
+                        transform_fft_output_fut,                       \
+                        RFFT_FAST_BATCH_FRAMES,                         \
+                        stride,                                         \
+                        ifft_flag));                                    \
+                                                                        \
+                /* The reference output is twice as long as a frame, */ \
+                /* so the frames are compared one at a time. */         \
+                for (f = 0; f < RFFT_FAST_BATCH_FRAMES; f++)            \
+                {                                                       \
+                    ref_rfft_fast_f32(                                  \
+                        &rfft_inst_ref,                                 \
+                        transform_fft_input_ref + f * stride,           \
+                        transform_fft_output_ref,                       \
+                        ifft_flag);                                     \
+                                                                        \
+                    /* Test correctness */                              \
+                    TEST_ASSERT_SNR(                                    \
+                        transform_fft_output_ref,                       \
+                        transform_fft_output_fut + f * stride,          \
+                        fftlen,                                         \
+                        TRANSFORM_SNR_THRESHOLD_float32_t);             \
+                }                                                       \
+            });                                                         \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
 RFFT_FAST_DEFINE_TEST(forward, 0U);
 RFFT_FAST_DEFINE_TEST(inverse, 1U);
+RFFT_FAST_BATCH_DEFINE_TEST(forward, 0U);
+RFFT_FAST_BATCH_DEFINE_TEST(inverse, 1U);
+
+/*
+Real FFT with tables computed in RAM. The twiddle factors of the real stage are
+compared with the constant ones, within 1 ULP, and the transforms of the tested
+lengths with the reference. The length 8192 has no constant tables: its forward
+and inverse transforms must give back the input.
+*/
+static float32_t rfft_ram_twiddle[TRANSFORM_MAX_FFT_LEN * 4];
+static uint16_t rfft_ram_bitrev[TRANSFORM_MAX_FFT_LEN * 2];
+
+static const uint16_t rfft_ram_fftlens[] =
+{
+    32, 64, 128, 256, 512, 1024, 2048, 4096
+};
+
+/* Distance in ULPs of two floats of the same sign, or of zeros */
+static uint32_t rfft_ram_ulps(float32_t a, float32_t b)
+{
+    int32_t ia, ib;
+
+    if (a == b)
+    {
+        return 0;
+    }
+
+    memcpy(&ia, &a, sizeof(ia));
+    memcpy(&ib, &b, sizeof(ib));
+
+    return (ia > ib) ? (uint32_t)(ia - ib) : (uint32_t)(ib - ia);
+}
+
+JTEST_DEFINE_TEST(arm_rfft_fast_init_ram_f32_test,
+                  arm_rfft_fast_init_ram_f32)
+{
+    arm_rfft_fast_instance_f32 rfft_inst_fut = {{0}, 0, 0};
+    arm_rfft_fast_instance_f32 rfft_inst_ref = {{0}, 0, 0};
+    uint32_t i, k;
+
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_rfft_fast_init_ram_f32(&rfft_inst_fut, 16,
+                                                 rfft_ram_twiddle, rfft_ram_bitrev));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_rfft_fast_init_ram_f32(&rfft_inst_fut, 96,
+                                                 rfft_ram_twiddle, rfft_ram_bitrev));
+
+    for (i = 0; i < sizeof(rfft_ram_fftlens) / sizeof(rfft_ram_fftlens[0]); i++)
+    {
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                          arm_rfft_fast_init_ram_f32(&rfft_inst_fut, rfft_ram_fftlens[i],
+                                                     rfft_ram_twiddle, rfft_ram_bitrev));
+        TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                          arm_rfft_fast_init_f32(&rfft_inst_ref, rfft_ram_fftlens[i]));
+        TEST_ASSERT_EQUAL(rfft_inst_ref.Sint.bitRevLength,
+                          rfft_inst_fut.Sint.bitRevLength);
+
+        for (k = 0; k < rfft_ram_fftlens[i]; k++)
+        {
+            if (rfft_ram_ulps(rfft_inst_fut.pTwiddleRFFT[k],
+                              rfft_inst_ref.pTwiddleRFFT[k]) > 1)
+            {
+                JTEST_DUMP_STRF("Block Size: %d\n"
+                                "Twiddle factor %d differs by more than 1 ULP\n",
+                                (int)rfft_ram_fftlens[i],
+                                (int)k);
+                return JTEST_TEST_FAILED;
+            }
+        }
+    }
+
+    TEMPLATE_DO_ARR_DESC(
+        fftlen_idx, uint16_t, fftlen, transform_rfft_fast_fftlens
+        ,
+        arm_rfft_fast_init_ram_f32(&rfft_inst_fut, fftlen,
+                                   rfft_ram_twiddle, rfft_ram_bitrev);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, fftlen);
+
+        TRANSFORM_COPY_INPUTS(
+            transform_fft_f32_inputs,
+            fftlen * sizeof(float32_t));
+
+        JTEST_DUMP_STRF("Block Size: %d\n", (int)fftlen);
+
+        /* Display cycle count and run test */
+        JTEST_COUNT_CYCLES(
+            arm_rfft_fast_f32(&rfft_inst_fut,
+                              transform_fft_input_fut,
+                              transform_fft_output_fut,
+                              0));
+
+        ref_rfft_fast_f32(&rfft_inst_ref,
+                          transform_fft_input_ref,
+                          transform_fft_output_ref,
+                          0);
+
+        /* Test correctness */
+        TRANSFORM_SNR_COMPARE_INTERFACE(
+            fftlen,
+            float32_t));
+
+    /* Round trip at 8192, the forward transform overwriting its input */
+    TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                      arm_rfft_fast_init_ram_f32(&rfft_inst_fut, 8192,
+                                                 rfft_ram_twiddle, rfft_ram_bitrev));
+
+    memcpy(transform_fft_input_fut, transform_fft_f32_inputs, 8192 * sizeof(float32_t));
+
+    JTEST_DUMP_STRF("Block Size: %d\n", 8192);
+
+    arm_rfft_fast_f32(&rfft_inst_fut, transform_fft_input_fut, transform_fft_output_fut, 0);
+    arm_rfft_fast_f32(&rfft_inst_fut, transform_fft_output_fut, transform_fft_output_ref, 1);
+
+    TEST_ASSERT_SNR(transform_fft_f32_inputs,
+                    transform_fft_output_ref,
+                    8192,
+                    TRANSFORM_SNR_THRESHOLD_float32_t);
+
+    return JTEST_TEST_PASSED;
+}
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group */
@@ -72,4 +280,7 @@ JTEST_DEFINE_GROUP(rfft_fast_tests)
 {
     JTEST_TEST_CALL(arm_rfft_fast_f32_forward_test);
     JTEST_TEST_CALL(arm_rfft_fast_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_forward_test);
+    JTEST_TEST_CALL(arm_rfft_fast_batch_f32_inverse_test);
+    JTEST_TEST_CALL(arm_rfft_fast_init_ram_f32_test);
 }
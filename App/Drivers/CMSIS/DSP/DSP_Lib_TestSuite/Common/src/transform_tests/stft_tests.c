@@ -0,0 +1,223 @@
+#include "jtest.h"
+#include "ref.h"
+#include "arr_desc.h"
+#include "transform_templates.h"
+#include "transform_test_data.h"
+#include "type_abbrev.h"
+#include <math.h>
+
+/*--------------------------------------------------------------------------------*/
+/* arm_stft_f32() is compared with the separate passes it replaces: arm_mult_f32()
+ * for the window, arm_rfft_fast_f32(), the power of each bin, a dense mel
+ * projection and the log, on frames read from the input at every hop. The input is
+ * given in blocks of several sizes, so that the frames wrap around the ring. */
+/*--------------------------------------------------------------------------------*/
+
+#define STFT_MAX_FFT_LEN    256
+#define STFT_INPUT_ELTS     1500
+#define STFT_MAX_FRAMES     (STFT_INPUT_ELTS / 16)
+#define STFT_MAX_OUTPUTS    (STFT_MAX_FFT_LEN / 2 + 1)
+#define STFT_NUM_MELS       10
+
+static float32_t stft_input[STFT_INPUT_ELTS];
+static float32_t stft_window[STFT_MAX_FFT_LEN];
+static float32_t stft_state[2 * STFT_MAX_FFT_LEN];
+static float32_t stft_frame[STFT_MAX_FFT_LEN];
+static float32_t stft_spectrum[STFT_MAX_FFT_LEN];
+static float32_t stft_power[STFT_MAX_OUTPUTS];
+static float32_t stft_fut[STFT_MAX_FRAMES * STFT_MAX_OUTPUTS];
+static float32_t stft_ref[STFT_MAX_FRAMES * STFT_MAX_OUTPUTS];
+static uint32_t stft_filter_pos[STFT_NUM_MELS];
+static uint32_t stft_filter_len[STFT_NUM_MELS];
+static float32_t stft_filter_coefs[STFT_NUM_MELS * STFT_MAX_OUTPUTS];
+
+/* {fftLen, hopSize} */
+static const uint16_t stft_configs[][2] =
+{
+    {32, 32}, {64, 16}, {64, 48}, {256, 100}
+};
+
+/* Input block sizes, used in turn */
+static const uint32_t stft_blocks[] = {1, 7, 300, 64, 33};
+
+/**
+ *  Overlapping triangular bands of increasing width over the bins 0 .. fftLen/2.
+ */
+static void stft_make_filterbank(uint32_t fft_len)
+{
+    uint32_t m, k, offset = 0;
+    uint32_t num_bins = fft_len / 2 + 1;
+
+    for (m = 0; m < STFT_NUM_MELS; m++)
+    {
+        stft_filter_pos[m] = (m * (num_bins - 3)) / (STFT_NUM_MELS + 1);
+        stft_filter_len[m] = ((m + 2) * (num_bins - 3)) / (STFT_NUM_MELS + 1)
+            - stft_filter_pos[m] + 1;
+
+        for (k = 0; k < stft_filter_len[m]; k++)
+        {
+            stft_filter_coefs[offset + k] = 1.0f - fabsf(
+                2.0f * (float32_t) k / (float32_t) (stft_filter_len[m] - 1) - 1.0f);
+        }
+        offset += stft_filter_len[m];
+    }
+}
+
+/**
+ *  Outputs of one frame through the separate passes.
+ */
+static void stft_ref_frame(arm_rfft_fast_instance_f32 * rfft,
+                           const float32_t * frame_in,
+                           uint32_t fft_len,
+                           uint32_t num_mels,
+                           uint32_t log_output,
+                           float32_t * out)
+{
+    uint32_t k, m, offset = 0;
+    uint32_t num_bins = fft_len / 2 + 1;
+
+    arm_mult_f32((float32_t *) frame_in, stft_window, stft_frame, fft_len);
+    arm_rfft_fast_f32(rfft, stft_frame, stft_spectrum, 0);
+
+    /* DC and Nyquist are packed in the first complex value */
+    stft_power[0] = stft_spectrum[0] * stft_spectrum[0];
+    stft_power[fft_len / 2] = stft_spectrum[1] * stft_spectrum[1];
+    arm_cmplx_mag_squared_f32(stft_spectrum + 2, stft_power + 1, fft_len / 2 - 1);
+
+    if (num_mels == 0)
+    {
+        for (k = 0; k < num_bins; k++)
+        {
+            out[k] = (log_output != 0) ? logf(stft_power[k] + 1.0e-6f) : stft_power[k];
+        }
+        return;
+    }
+
+    for (m = 0; m < num_mels; m++)
+    {
+        out[m] = 0.0f;
+        for (k = 0; k < stft_filter_len[m]; k++)
+        {
+            out[m] += stft_filter_coefs[offset + k] * stft_power[stft_filter_pos[m] + k];
+        }
+        offset += stft_filter_len[m];
+
+        if (log_output != 0)
+        {
+            out[m] = logf(out[m] + 1.0e-6f);
+        }
+    }
+}
+
+JTEST_DEFINE_TEST(arm_stft_f32_test, arm_stft_f32)
+{
+    arm_stft_instance_f32 stft_inst_fut;
+    arm_rfft_fast_instance_f32 rfft_inst_ref;
+    uint32_t fft_len, hop, num_mels, log_output, num_out;
+    uint32_t i, n, blk, len, frames, ref_frames;
+
+    for (n = 0; n < STFT_INPUT_ELTS; n++)
+    {
+        stft_input[n] = 0.5f * sinf(0.05f * n) + 0.25f * cosf(0.71f * n) +
+            (float32_t) ((int32_t) ((n * 97u + 5u) % 255u) - 127) / 1024.0f;
+    }
+
+    for (i = 0; i < sizeof(stft_configs) / sizeof(stft_configs[0]); i++)
+    {
+        fft_len = stft_configs[i][0];
+        hop = stft_configs[i][1];
+
+        /* Hann window */
+        for (n = 0; n < fft_len; n++)
+        {
+            stft_window[n] = 0.5f - 0.5f * cosf(6.28318531f * n / fft_len);
+        }
+
+        stft_make_filterbank(fft_len);
+        arm_rfft_fast_init_f32(&rfft_inst_ref, fft_len);
+
+        for (num_mels = 0; num_mels <= STFT_NUM_MELS; num_mels += STFT_NUM_MELS)
+        {
+            for (log_output = 0; log_output < 2; log_output++)
+            {
+                JTEST_DUMP_STRF("FFT: %d, Hop: %d, Mels: %d, Log: %d\n",
+                                (int)fft_len, (int)hop, (int)num_mels,
+                                (int)log_output);
+
+                num_out = (num_mels != 0) ? num_mels : (fft_len / 2 + 1);
+
+                TEST_ASSERT_EQUAL(ARM_MATH_SUCCESS,
+                                  arm_stft_init_f32(&stft_inst_fut, fft_len, hop,
+                                                    stft_window, num_mels,
+                                                    stft_filter_pos, stft_filter_len,
+                                                    stft_filter_coefs, log_output,
+                                                    stft_state));
+
+                frames = 0;
+                for (n = 0, blk = 0; n < STFT_INPUT_ELTS; n += len, blk++)
+                {
+                    len = stft_blocks[blk % (sizeof(stft_blocks) / sizeof(stft_blocks[0]))];
+                    if (n + len > STFT_INPUT_ELTS)
+                    {
+                        len = STFT_INPUT_ELTS - n;
+                    }
+
+                    JTEST_COUNT_CYCLES(
+                        frames += arm_stft_f32(&stft_inst_fut, stft_input + n,
+                                               stft_fut + frames * num_out, len));
+                }
+
+                ref_frames = 0;
+                for (n = 0; n + fft_len <= STFT_INPUT_ELTS; n += hop)
+                {
+                    stft_ref_frame(&rfft_inst_ref, stft_input + n, fft_len, num_mels,
+                                   log_output, stft_ref + ref_frames * num_out);
+                    ref_frames++;
+                }
+
+                TEST_ASSERT_EQUAL(ref_frames, frames);
+                TEST_ASSERT_SNR(stft_ref, stft_fut, frames * num_out,
+                                TRANSFORM_SNR_THRESHOLD_float32_t);
+            }
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_DEFINE_TEST(arm_stft_init_f32_test, arm_stft_init_f32)
+{
+    arm_stft_instance_f32 stft_inst_fut;
+
+    stft_make_filterbank(64);
+
+    /* Unsupported length, no hop, a hop longer than the frame, and a band past Nyquist */
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_stft_init_f32(&stft_inst_fut, 48, 16, stft_window, 0,
+                                        NULL, NULL, NULL, 0, stft_state));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_stft_init_f32(&stft_inst_fut, 64, 0, stft_window, 0,
+                                        NULL, NULL, NULL, 0, stft_state));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_stft_init_f32(&stft_inst_fut, 64, 65, stft_window, 0,
+                                        NULL, NULL, NULL, 0, stft_state));
+    TEST_ASSERT_EQUAL(ARM_MATH_ARGUMENT_ERROR,
+                      arm_stft_init_f32(&stft_inst_fut, 32, 16, stft_window, STFT_NUM_MELS,
+                                        stft_filter_pos, stft_filter_len,
+                                        stft_filter_coefs, 0, stft_state));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(stft_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_stft_f32_test);
+    JTEST_TEST_CALL(arm_stft_init_f32_test);
+}
@@ -17,6 +17,12 @@ float32_t transform_fft_output_f32_ref[TRANSFORM_MAX_FFT_LEN * 2] = {0};
 float32_t * transform_fft_inplace_input_fut = transform_fft_output_fut;
 float32_t * transform_fft_inplace_input_ref = transform_fft_output_ref;
 
+/* The large CFFT tests go beyond TRANSFORM_MAX_FFT_LEN and have their own
+ * buffers. */
+float32_t transform_large_fft_fut[TRANSFORM_MAX_LARGE_FFT_LEN * 2] = {0};
+float32_t transform_large_fft_ref[TRANSFORM_MAX_LARGE_FFT_LEN * 2] = {0};
+float32_t transform_large_fft_work[TRANSFORM_MAX_LARGE_FFT_LEN * 2] = {0};
+
 q31_t transform_fft_q31_inputs[TRANSFORM_MAX_FFT_LEN * 2] =
 {
     0xC14A5524, 0xCCABDA17, 0xAD6F5B56, 0xFDAFCE3B, 0xA9B226EB,
@@ -3250,6 +3256,21 @@ ARR_DESC_DEFINE(uint16_t,
                       32, 64, 128, 256,
                       512, 1024, 2048));
 
+/* Products of powers of 2, 3 and 5 */
+ARR_DESC_DEFINE(uint16_t,
+                transform_cfft_mixed_fftlens,
+                8,
+                CURLY(
+                      12, 60, 100, 243,
+                      480, 960, 1000, 3000));
+
+/* Powers of two handled by the large CFFT, one beyond the constant tables */
+ARR_DESC_DEFINE(uint32_t,
+                transform_cfft_large_fftlens,
+                3,
+                CURLY(
+                      256, 2048, 8192));
+
 /*--------------------------------------------------------------------------------*/
 /* CFFT_F32 Structs */
 /*--------------------------------------------------------------------------------*/
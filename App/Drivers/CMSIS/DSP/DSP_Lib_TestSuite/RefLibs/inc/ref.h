@@ -1297,6 +1297,16 @@ void ref_cfft_f32(
    uint8_t ifftFlag,
    uint8_t bitReverseFlag);
 	 
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag);
+
+void ref_cfft_large_f32(
+	const arm_cfft_large_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag);
+
 void ref_cfft_q31(
 	const arm_cfft_instance_q31 * S,
     q31_t * p1,
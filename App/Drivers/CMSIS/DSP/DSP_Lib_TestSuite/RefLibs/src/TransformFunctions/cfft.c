@@ -596,3 +596,92 @@ void ref_cfft_radix4_q15(
 		}
 	}
 }
+
+/* Direct DFT, accumulated in double precision, for any fftLen */
+void ref_cfft_mixed_f32(
+	const arm_cfft_mixed_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLen;
+	uint32_t k, n;
+	double sign = (ifftFlag) ? 1.0 : -1.0;
+	double re, im, angle;
+
+	for(k = 0; k < N; k++)
+	{
+		re = 0.0;
+		im = 0.0;
+		for(n = 0; n < N; n++)
+		{
+			/* Reduce k*n modulo N to keep the angle accurate */
+			angle = sign * 6.283185307179586 * (double)((k * n) % N) / (double)N;
+			re += p1[2*n] * cos(angle) - p1[2*n+1] * sin(angle);
+			im += p1[2*n] * sin(angle) + p1[2*n+1] * cos(angle);
+		}
+		scratchArray[2*k]   = (float32_t)((ifftFlag) ? re / N : re);
+		scratchArray[2*k+1] = (float32_t)((ifftFlag) ? im / N : im);
+	}
+
+	for(k = 0; k < 2*N; k++)
+	{
+		p1[k] = scratchArray[k];
+	}
+}
+
+void ref_cfft_large_f32(
+	const arm_cfft_large_instance_f32 * S,
+	float32_t * p1,
+	uint8_t ifftFlag)
+{
+	uint32_t N = S->fftLen;
+	uint32_t i, j, k, m, len;
+	double sign = (ifftFlag) ? 1.0 : -1.0;
+	double angle, wr, wi, tr, ti;
+	float32_t t;
+
+	/* Bit reversal */
+	for(i = 1, j = 0; i < N; i++)
+	{
+		for(m = N >> 1; j & m; m >>= 1)
+		{
+			j ^= m;
+		}
+		j |= m;
+		if(i < j)
+		{
+			t = p1[2*i];   p1[2*i]   = p1[2*j];   p1[2*j]   = t;
+			t = p1[2*i+1]; p1[2*i+1] = p1[2*j+1]; p1[2*j+1] = t;
+		}
+	}
+
+	/* Radix-2 stages with each twiddle factor computed directly */
+	for(len = 2; len <= N; len <<= 1)
+	{
+		for(k = 0; k < len / 2; k++)
+		{
+			angle = sign * 6.283185307179586 * (double)k / (double)len;
+			wr = cos(angle);
+			wi = sin(angle);
+			for(i = k; i < N; i += len)
+			{
+				j = i + len / 2;
+				tr = wr * p1[2*j]   - wi * p1[2*j+1];
+				ti = wr * p1[2*j+1] + wi * p1[2*j];
+				p1[2*j]   = (float32_t)(p1[2*i]   - tr);
+				p1[2*j+1] = (float32_t)(p1[2*i+1] - ti);
+				p1[2*i]   = (float32_t)(p1[2*i]   + tr);
+				p1[2*i+1] = (float32_t)(p1[2*i+1] + ti);
+			}
+		}
+	}
+
+	/* Inverse transform is scaled by 1/N */
+	if (ifftFlag)
+	{
+		for(i = 0; i < 2*N; i++)
+		{
+			p1[i] /= N;
+		}
+	}
+}
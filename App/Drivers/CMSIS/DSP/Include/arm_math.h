@@ -128,6 +128,13 @@
    * of some DSP functions. Experimental Neon versions currently do not have better
    * performances than the scalar versions.
    *
+   * - ARM_MATH_X86_SIMD:
+   *
+   * Define macro ARM_MATH_X86_SIMD to enable SSE2 versions of the floating-point
+   * BasicMath, Statistics and ComplexMath functions, arm_mat_mult_f32 and arm_fir_f32
+   * when the library is built for an x86 host. AVX2 (and FMA) versions are used when
+   * the compiler targets them (for example -mavx2 -mfma).
+   *
    * <hr>
    * CMSIS-DSP in ARM::CMSIS Pack
    * -----------------------------
@@ -331,6 +338,16 @@
 #include <arm_neon.h>
 #endif
 
+#if defined(ARM_MATH_X86_SIMD)
+  #if !defined(__SSE2__) && !(defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #error "ARM_MATH_X86_SIMD requires an x86 target with SSE2"
+  #endif
+  #if defined(ARM_MATH_NEON) || defined(ARM_MATH_NEON_EXPERIMENTAL)
+    #error "ARM_MATH_X86_SIMD cannot be combined with ARM_MATH_NEON"
+  #endif
+#include <immintrin.h>
+#endif
+
 
 #ifdef   __cplusplus
 extern "C"
@@ -380,7 +397,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH  = -3,        /**< Size of matrices is not compatible with the operation */
     ARM_MATH_NANINF         = -4,        /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR       = -5,        /**< Input matrix is singular and cannot be inverted */
-    ARM_MATH_TEST_FAILURE   = -6         /**< Test Failed */
+    ARM_MATH_TEST_FAILURE   = -6,        /**< Test Failed */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Decomposition Failed */
   } arm_status;
 
   /**
@@ -856,6 +874,228 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
 
 #endif
 
+#if defined(ARM_MATH_X86_SIMD)
+
+/*
+ * @brief x86 vector of float32_t: 8 lanes with AVX2, otherwise 4 lanes of SSE2.
+ *
+ * The kernels are written once against the helpers below so the same source
+ * builds for either width.
+ */
+#if defined(__AVX2__)
+typedef __m256 arm_x86_f32_t;
+#define ARM_X86_F32_LANES 8U
+#else
+typedef __m128 arm_x86_f32_t;
+#define ARM_X86_F32_LANES 4U
+#endif
+
+#if defined(__AVX2__)
+
+static inline arm_x86_f32_t __arm_x86_ld_f32(const float32_t * p) { return _mm256_loadu_ps(p); }
+static inline void __arm_x86_st_f32(float32_t * p, arm_x86_f32_t v) { _mm256_storeu_ps(p, v); }
+static inline arm_x86_f32_t __arm_x86_dup_f32(float32_t x) { return _mm256_set1_ps(x); }
+static inline arm_x86_f32_t __arm_x86_add_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_add_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_sub_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_sub_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_mul_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_mul_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_max_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_max_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_min_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_min_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_sqrt_f32(arm_x86_f32_t a) { return _mm256_sqrt_ps(a); }
+static inline arm_x86_f32_t __arm_x86_xor_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_xor_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_andnot_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_andnot_ps(a, b); }
+static inline int __arm_x86_cmpeq_mask_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+static inline arm_x86_f32_t __arm_x86_div_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_div_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_and_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_and_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_or_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_or_ps(a, b); }
+
+/* Lanes set to all ones where the comparison holds; nge also holds for NaN */
+static inline arm_x86_f32_t __arm_x86_cmpeq_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+static inline arm_x86_f32_t __arm_x86_cmplt_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+static inline arm_x86_f32_t __arm_x86_cmple_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+static inline arm_x86_f32_t __arm_x86_cmpnge_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm256_cmp_ps(a, b, _CMP_NGE_UQ); }
+
+/* Integer lanes of the same width, for the exponent fields */
+typedef __m256i arm_x86_s32_t;
+static inline arm_x86_s32_t __arm_x86_as_s32_f32(arm_x86_f32_t v) { return _mm256_castps_si256(v); }
+static inline arm_x86_f32_t __arm_x86_as_f32_s32(arm_x86_s32_t v) { return _mm256_castsi256_ps(v); }
+static inline arm_x86_s32_t __arm_x86_dup_s32(int32_t x) { return _mm256_set1_epi32(x); }
+static inline arm_x86_s32_t __arm_x86_add_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm256_add_epi32(a, b); }
+static inline arm_x86_s32_t __arm_x86_sub_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm256_sub_epi32(a, b); }
+static inline arm_x86_s32_t __arm_x86_and_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm256_and_si256(a, b); }
+static inline arm_x86_s32_t __arm_x86_or_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm256_or_si256(a, b); }
+static inline arm_x86_f32_t __arm_x86_cvt_f32_s32(arm_x86_s32_t v) { return _mm256_cvtepi32_ps(v); }
+#define __ARM_X86_SLLI_S32(v, imm) _mm256_slli_epi32((v), (imm))
+#define __ARM_X86_SRAI_S32(v, imm) _mm256_srai_epi32((v), (imm))
+
+/* Sign bit set in the odd (imaginary) lanes */
+static inline arm_x86_f32_t __arm_x86_odd_sign_f32(void) { return _mm256_set_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f); }
+/* Sign bit set in the even (real) lanes */
+static inline arm_x86_f32_t __arm_x86_even_sign_f32(void) { return _mm256_set_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f); }
+
+/* Lane shuffle applied within each 128-bit half */
+#define __ARM_X86_SHUFFLE_F32(a, b, imm) _mm256_shuffle_ps((a), (b), (imm))
+
+/* Fold the upper half onto the lower half */
+static inline __m128 __arm_x86_fold_f32(arm_x86_f32_t v, __m128 (*op)(__m128, __m128))
+{
+  return op(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+}
+
+/* Sums of adjacent pairs, in order: a0+a1, a2+a3, ..., b0+b1, ... */
+static inline arm_x86_f32_t __arm_x86_pairsum_f32(arm_x86_f32_t a, arm_x86_f32_t b)
+{
+  arm_x86_f32_t s = _mm256_add_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                                  _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(s), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+/* Each of the lanes of r duplicated: lo = r0 r0 r1 r1 ..., hi = the upper half of r likewise */
+static inline void __arm_x86_dup_pairs_f32(arm_x86_f32_t r, arm_x86_f32_t * lo, arm_x86_f32_t * hi)
+{
+  arm_x86_f32_t l = _mm256_unpacklo_ps(r, r);
+  arm_x86_f32_t h = _mm256_unpackhi_ps(r, r);
+  *lo = _mm256_permute2f128_ps(l, h, 0x20);
+  *hi = _mm256_permute2f128_ps(l, h, 0x31);
+}
+
+#else
+
+static inline arm_x86_f32_t __arm_x86_ld_f32(const float32_t * p) { return _mm_loadu_ps(p); }
+static inline void __arm_x86_st_f32(float32_t * p, arm_x86_f32_t v) { _mm_storeu_ps(p, v); }
+static inline arm_x86_f32_t __arm_x86_dup_f32(float32_t x) { return _mm_set1_ps(x); }
+static inline arm_x86_f32_t __arm_x86_add_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_add_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_sub_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_sub_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_mul_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_mul_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_max_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_max_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_min_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_min_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_sqrt_f32(arm_x86_f32_t a) { return _mm_sqrt_ps(a); }
+static inline arm_x86_f32_t __arm_x86_xor_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_xor_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_andnot_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_andnot_ps(a, b); }
+static inline int __arm_x86_cmpeq_mask_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+static inline arm_x86_f32_t __arm_x86_div_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_div_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_and_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_and_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_or_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_or_ps(a, b); }
+
+static inline arm_x86_f32_t __arm_x86_cmpeq_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_cmpeq_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_cmplt_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_cmplt_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_cmple_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_cmple_ps(a, b); }
+static inline arm_x86_f32_t __arm_x86_cmpnge_f32(arm_x86_f32_t a, arm_x86_f32_t b) { return _mm_cmpnge_ps(a, b); }
+
+typedef __m128i arm_x86_s32_t;
+static inline arm_x86_s32_t __arm_x86_as_s32_f32(arm_x86_f32_t v) { return _mm_castps_si128(v); }
+static inline arm_x86_f32_t __arm_x86_as_f32_s32(arm_x86_s32_t v) { return _mm_castsi128_ps(v); }
+static inline arm_x86_s32_t __arm_x86_dup_s32(int32_t x) { return _mm_set1_epi32(x); }
+static inline arm_x86_s32_t __arm_x86_add_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm_add_epi32(a, b); }
+static inline arm_x86_s32_t __arm_x86_sub_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm_sub_epi32(a, b); }
+static inline arm_x86_s32_t __arm_x86_and_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm_and_si128(a, b); }
+static inline arm_x86_s32_t __arm_x86_or_s32(arm_x86_s32_t a, arm_x86_s32_t b) { return _mm_or_si128(a, b); }
+static inline arm_x86_f32_t __arm_x86_cvt_f32_s32(arm_x86_s32_t v) { return _mm_cvtepi32_ps(v); }
+#define __ARM_X86_SLLI_S32(v, imm) _mm_slli_epi32((v), (imm))
+#define __ARM_X86_SRAI_S32(v, imm) _mm_srai_epi32((v), (imm))
+
+/* Sign bit set in the odd (imaginary) lanes */
+static inline arm_x86_f32_t __arm_x86_odd_sign_f32(void) { return _mm_set_ps(-0.0f, 0.0f, -0.0f, 0.0f); }
+/* Sign bit set in the even (real) lanes */
+static inline arm_x86_f32_t __arm_x86_even_sign_f32(void) { return _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f); }
+
+#define __ARM_X86_SHUFFLE_F32(a, b, imm) _mm_shuffle_ps((a), (b), (imm))
+
+static inline __m128 __arm_x86_fold_f32(arm_x86_f32_t v, __m128 (*op)(__m128, __m128))
+{
+  (void)op;
+  return v;
+}
+
+static inline arm_x86_f32_t __arm_x86_pairsum_f32(arm_x86_f32_t a, arm_x86_f32_t b)
+{
+  return _mm_add_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)),
+                    _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+static inline void __arm_x86_dup_pairs_f32(arm_x86_f32_t r, arm_x86_f32_t * lo, arm_x86_f32_t * hi)
+{
+  *lo = _mm_unpacklo_ps(r, r);
+  *hi = _mm_unpackhi_ps(r, r);
+}
+
+#endif /* defined(__AVX2__) */
+
+static inline __m128 __arm_x86_add_m128(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+static inline __m128 __arm_x86_max_m128(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+static inline __m128 __arm_x86_min_m128(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+
+/* Reduce the four lanes of a 128-bit vector with op */
+static inline float32_t __arm_x86_reduce_m128(__m128 v, __m128 (*op)(__m128, __m128))
+{
+  v = op(v, _mm_movehl_ps(v, v));
+  v = op(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+  return _mm_cvtss_f32(v);
+}
+
+/* Horizontal sum, maximum and minimum of all lanes */
+static inline float32_t __arm_x86_hsum_f32(arm_x86_f32_t v)
+{
+  return __arm_x86_reduce_m128(__arm_x86_fold_f32(v, __arm_x86_add_m128), __arm_x86_add_m128);
+}
+
+static inline float32_t __arm_x86_hmax_f32(arm_x86_f32_t v)
+{
+  return __arm_x86_reduce_m128(__arm_x86_fold_f32(v, __arm_x86_max_m128), __arm_x86_max_m128);
+}
+
+static inline float32_t __arm_x86_hmin_f32(arm_x86_f32_t v)
+{
+  return __arm_x86_reduce_m128(__arm_x86_fold_f32(v, __arm_x86_min_m128), __arm_x86_min_m128);
+}
+
+/* acc + a * b, fused when the target has FMA */
+static inline arm_x86_f32_t __arm_x86_fma_f32(arm_x86_f32_t acc, arm_x86_f32_t a, arm_x86_f32_t b)
+{
+#if defined(__FMA__) && defined(__AVX2__)
+  return _mm256_fmadd_ps(a, b, acc);
+#elif defined(__FMA__)
+  return _mm_fmadd_ps(a, b, acc);
+#else
+  return __arm_x86_add_f32(acc, __arm_x86_mul_f32(a, b));
+#endif
+}
+
+static inline arm_x86_f32_t __arm_x86_abs_f32(arm_x86_f32_t v)
+{
+  return __arm_x86_andnot_f32(__arm_x86_dup_f32(-0.0f), v);
+}
+
+static inline arm_x86_f32_t __arm_x86_neg_f32(arm_x86_f32_t v)
+{
+  return __arm_x86_xor_f32(v, __arm_x86_dup_f32(-0.0f));
+}
+
+/* a in the lanes set in mask, b in the others */
+static inline arm_x86_f32_t __arm_x86_select_f32(arm_x86_f32_t mask, arm_x86_f32_t a, arm_x86_f32_t b)
+{
+  return __arm_x86_or_f32(__arm_x86_and_f32(mask, a), __arm_x86_andnot_f32(mask, b));
+}
+
+/* Product of interleaved complex vectors: (a + jb)(c + jd) = (ac - bd) + j(ad + bc)
+   Both products are rounded before the sum, as in the scalar code. */
+static inline arm_x86_f32_t __arm_x86_cmplx_mul_f32(arm_x86_f32_t x, arm_x86_f32_t y)
+{
+  arm_x86_f32_t xre = __ARM_X86_SHUFFLE_F32(x, x, _MM_SHUFFLE(2, 2, 0, 0));
+  arm_x86_f32_t xim = __ARM_X86_SHUFFLE_F32(x, x, _MM_SHUFFLE(3, 3, 1, 1));
+  arm_x86_f32_t yswap = __ARM_X86_SHUFFLE_F32(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+
+  return __arm_x86_add_f32(__arm_x86_mul_f32(xre, y),
+                           __arm_x86_mul_f32(__arm_x86_xor_f32(xim, __arm_x86_even_sign_f32()), yswap));
+}
+
+/* Swap the real and imaginary parts of interleaved complex values */
+static inline arm_x86_f32_t __arm_x86_cmplx_swap_f32(arm_x86_f32_t y)
+{
+  return __ARM_X86_SHUFFLE_F32(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+}
+
+#endif /* defined(ARM_MATH_X86_SIMD) */
+
 /*
  * @brief C custom defined intrinsic functions
  */
@@ -1372,6 +1612,301 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q7 FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;     /**< length of the circular buffer, numTaps+blockSize-1. */
+          uint32_t stateIndex;      /**< index in pState of the oldest sample used by the next output. */
+          q7_t *pState;             /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q7_t *pCoeffs;            /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q7;
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;     /**< length of the circular buffer, numTaps+blockSize-1. */
+          uint32_t stateIndex;      /**< index in pState of the oldest sample used by the next output. */
+          q15_t *pState;            /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;     /**< length of the circular buffer, numTaps+blockSize-1. */
+          uint32_t stateIndex;      /**< index in pState of the oldest sample used by the next output. */
+          q31_t *pState;            /**< points to the state variable array. The array is of length 2*stateLength. */
+    const q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter with circular state.
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter. */
+          uint32_t stateLength;     /**< length of the circular buffer, numTaps+blockSize-1. */
+          uint32_t stateIndex;      /**< index in pState of the oldest sample used by the next output. */
+          float32_t *pState;        /**< points to the state variable array. The array is of length 2*stateLength. */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_circ_instance_f32;
+
+  /**
+   * @brief Processing function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 FIR filter structure with circular state.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q7(
+        arm_fir_circ_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q7 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q7 FIR filter structure with circular state.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  maximum number of samples that are processed at a time.
+   */
+  void arm_fir_circ_init_q7(
+        arm_fir_circ_instance_q7 * S,
+        uint16_t numTaps,
+  const q7_t * pCoeffs,
+        q7_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 FIR filter structure with circular state.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q15(
+        arm_fir_circ_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q15 FIR filter structure with circular state.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  maximum number of samples that are processed at a time.
+   * @return     The function returns either
+   * <code>ARM_MATH_SUCCESS</code> if initialization was successful or
+   * <code>ARM_MATH_ARGUMENT_ERROR</code> if <code>numTaps</code> is odd.
+   */
+  arm_status arm_fir_circ_init_q15(
+        arm_fir_circ_instance_q15 * S,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 FIR filter structure with circular state.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_q31(
+        arm_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the Q31 FIR filter structure with circular state.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  maximum number of samples that are processed at a time.
+   */
+  void arm_fir_circ_init_q31(
+        arm_fir_circ_instance_q31 * S,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR filter structure with circular state.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_fir_circ_f32(
+        arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter with circular state.
+   * @param[in,out] S          points to an instance of the floating-point FIR filter structure with circular state.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer, of length 2*(numTaps+blockSize-1).
+   * @param[in]     blockSize  maximum number of samples that are processed at a time.
+   */
+  void arm_fir_circ_init_f32(
+        arm_fir_circ_instance_f32 * S,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 FIR filter. N channels
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter, shared by all channels. */
+          uint16_t numChannels;     /**< number of channels. */
+          uint8_t interleaved;      /**< 1 for interleaved input and output, 0 for planar. */
+          q15_t *pState;            /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChannels. */
+    const q15_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR filter. N channels
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter, shared by all channels. */
+          uint16_t numChannels;     /**< number of channels. */
+          uint8_t interleaved;      /**< 1 for interleaved input and output, 0 for planar. */
+          q31_t *pState;            /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChannels. */
+    const q31_t *pCoeffs;           /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR filter. N channels
+   */
+  typedef struct
+  {
+          uint16_t numTaps;         /**< number of filter coefficients in the filter, shared by all channels. */
+          uint16_t numChannels;     /**< number of channels. */
+          uint8_t interleaved;      /**< 1 for interleaved input and output, 0 for planar. */
+          float32_t *pState;        /**< points to the state variable array, interleaved. The array is of length (numTaps+blockSize-1)*numChannels. */
+    const float32_t *pCoeffs;       /**< points to the coefficient array. The array is of length numTaps. */
+  } arm_fir_multichannel_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 FIR filter. N channels
+   * @param[in]  S          points to an instance of the Q15 FIR filter structure for N channels.
+   * @param[in]  pSrc       points to the block of input data, blockSize samples per channel.
+   * @param[out] pDst       points to the block of output data, in the layout of the input.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multichannel_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR filter. N channels
+   * @param[in,out] S            points to an instance of the Q15 FIR filter structure for N channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  Number of channels.
+   * @param[in]     interleaved  1 for interleaved input and output, 0 for planar.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer, of length (numTaps+blockSize-1)*numChannels.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multichannel_init_q15(
+        arm_fir_multichannel_instance_q15 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        uint8_t interleaved,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR filter. N channels
+   * @param[in]  S          points to an instance of the Q31 FIR filter structure for N channels.
+   * @param[in]  pSrc       points to the block of input data, blockSize samples per channel.
+   * @param[out] pDst       points to the block of output data, in the layout of the input.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multichannel_q31(
+  const arm_fir_multichannel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR filter. N channels
+   * @param[in,out] S            points to an instance of the Q31 FIR filter structure for N channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  Number of channels.
+   * @param[in]     interleaved  1 for interleaved input and output, 0 for planar.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer, of length (numTaps+blockSize-1)*numChannels.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multichannel_init_q31(
+        arm_fir_multichannel_instance_q31 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        uint8_t interleaved,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR filter. N channels
+   * @param[in]  S          points to an instance of the floating-point FIR filter structure for N channels.
+   * @param[in]  pSrc       points to the block of input data, blockSize samples per channel.
+   * @param[out] pDst       points to the block of output data, in the layout of the input.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR filter. N channels
+   * @param[in,out] S            points to an instance of the floating-point FIR filter structure for N channels.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  Number of channels.
+   * @param[in]     interleaved  1 for interleaved input and output, 0 for planar.
+   * @param[in]     pCoeffs      points to the filter coefficients, shared by all channels.
+   * @param[in]     pState       points to the state buffer, of length (numTaps+blockSize-1)*numChannels.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multichannel_init_f32(
+        arm_fir_multichannel_instance_f32 * S,
+        uint16_t numTaps,
+        uint16_t numChannels,
+        uint8_t interleaved,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1553,6 +2088,16 @@ static inline int32x4_t __arm_vec_sqrt_q31_neon(int32x4_t vec)
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the Q7 matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;          /**< points to the data of the matrix. */
+  } arm_matrix_instance_q7;
+
   /**
    * @brief Floating-point matrix addition.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1734,6 +2279,50 @@ arm_status arm_mat_mult_fast_q31(
   const arm_matrix_instance_q31 * pSrcB,
         arm_matrix_instance_q31 * pDst);
 
+  /**
+   * @brief Floating-point matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of numCols values
+   * @param[out] pDst     points to the output vector, of numRows values
+   */
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst);
+
+  /**
+   * @brief Q31 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of numCols values
+   * @param[out] pDst     points to the output vector, of numRows values
+   */
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst);
+
+  /**
+   * @brief Q15 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of numCols values
+   * @param[out] pDst     points to the output vector, of numRows values
+   */
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst);
+
+  /**
+   * @brief Q7 matrix and vector multiplication
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector, of numCols values
+   * @param[out] pDst     points to the output vector, of numRows values
+   */
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  const q7_t * pVec,
+        q7_t * pDst);
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -2271,31 +2860,96 @@ void arm_cfft_q31(
           uint16_t bitRevLength;             /**< bit reversal table length. */
   } arm_cfft_instance_f32;
 
+  arm_status arm_cfft_init_ram_f32(
+        arm_cfft_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        uint16_t * pBitRevTable);
+
   void arm_cfft_f32(
   const arm_cfft_instance_f32 * S,
         float32_t * p1,
         uint8_t ifftFlag,
         uint8_t bitReverseFlag);
 
+  void arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint32_t numFrames,
+        uint32_t frameStride,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag);
+
   /**
-   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   * @brief Maximum number of stages of the mixed-radix CFFT.
+   */
+#define ARM_CFFT_MIXED_MAX_STAGES 16U
+
+  /**
+   * @brief Instance structure for the floating-point mixed-radix CFFT/CIFFT function.
    */
   typedef struct
   {
-          uint32_t fftLenReal;                      /**< length of the real FFT. */
-          uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
-          uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
-          uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
-    const q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
-    const q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
-    const arm_cfft_instance_q15 *pCfft;       /**< points to the complex FFT instance. */
-  } arm_rfft_instance_q15;
+          uint16_t fftLen;                               /**< length of the FFT, of the form 2^a * 3^b * 5^c. */
+          uint16_t numStages;                            /**< number of butterfly stages. */
+          uint8_t radix[ARM_CFFT_MIXED_MAX_STAGES];      /**< radix (2, 3, 4 or 5) of each stage. */
+    const float32_t *pTwiddle;                           /**< points to the twiddle factor table of 2*fftLen values. */
+          float32_t *pScratch;                           /**< points to a scratch buffer of 2*fftLen values. */
+  } arm_cfft_mixed_instance_f32;
+
+  arm_status arm_cfft_mixed_init_f32(
+        arm_cfft_mixed_instance_f32 * S,
+        uint16_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pScratch);
 
-  arm_status arm_rfft_init_q15(
-        arm_rfft_instance_q15 * S,
-        uint32_t fftLenReal,
-        uint32_t ifftFlagR,
-        uint32_t bitReverseFlag);
+  void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point large CFFT/CIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLen;                               /**< length of the FFT, fftLen = N1 * N2. */
+    const arm_cfft_instance_f32 *pCfft1;                 /**< points to the CFFT instance of length N1 used by the first pass. */
+    const arm_cfft_instance_f32 *pCfft2;                 /**< points to the CFFT instance of length N2 used by the second pass. */
+    const float32_t *pTwiddle;                           /**< points to the twiddle factor table of 2*(N1+N2) values. */
+          float32_t *pWork;                              /**< points to a working buffer of 2*fftLen values. */
+  } arm_cfft_large_instance_f32;
+
+  arm_status arm_cfft_large_init_f32(
+        arm_cfft_large_instance_f32 * S,
+        uint32_t fftLen,
+        float32_t * pTwiddle,
+        float32_t * pWork);
+
+  void arm_cfft_large_f32(
+  const arm_cfft_large_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the Q15 RFFT/RIFFT function.
+   */
+  typedef struct
+  {
+          uint32_t fftLenReal;                      /**< length of the real FFT. */
+          uint8_t ifftFlagR;                        /**< flag that selects forward (ifftFlagR=0) or inverse (ifftFlagR=1) transform. */
+          uint8_t bitReverseFlagR;                  /**< flag that enables (bitReverseFlagR=1) or disables (bitReverseFlagR=0) bit reversal of output. */
+          uint32_t twidCoefRModifier;               /**< twiddle coefficient modifier that supports different size FFTs with the same twiddle factor table. */
+    const q15_t *pTwiddleAReal;                     /**< points to the real twiddle factor table. */
+    const q15_t *pTwiddleBReal;                     /**< points to the imag twiddle factor table. */
+    const arm_cfft_instance_q15 *pCfft;       /**< points to the complex FFT instance. */
+  } arm_rfft_instance_q15;
+
+  arm_status arm_rfft_init_q15(
+        arm_rfft_instance_q15 * S,
+        uint32_t fftLenReal,
+        uint32_t ifftFlagR,
+        uint32_t bitReverseFlag);
 
   void arm_rfft_q15(
   const arm_rfft_instance_q15 * S,
@@ -2368,6 +3022,12 @@ arm_status arm_rfft_fast_init_f32 (
          arm_rfft_fast_instance_f32 * S,
          uint16_t fftLen);
 
+arm_status arm_rfft_fast_init_ram_f32 (
+         arm_rfft_fast_instance_f32 * S,
+         uint16_t fftLen,
+         float32_t * pTwiddle,
+         uint16_t * pBitRevTable);
+
 arm_status arm_rfft_32_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
 
 arm_status arm_rfft_64_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
@@ -2390,6 +3050,262 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * p, float32_t * pOut,
         uint8_t ifftFlag);
 
+  void arm_rfft_fast_batch_f32(
+        arm_rfft_fast_instance_f32 * S,
+        float32_t * p, float32_t * pOut,
+        uint32_t numFrames,
+        uint32_t frameStride,
+        uint8_t ifftFlag);
+
+  /**
+   * @brief Instance structure for the floating-point short-time Fourier transform.
+   */
+  typedef struct
+  {
+          arm_rfft_fast_instance_f32 rfft;  /**< real FFT of fftLen points. */
+          uint16_t fftLen;                  /**< length of the frames and of the FFT. */
+          uint16_t hopSize;                 /**< number of samples between the starts of two frames. */
+    const float32_t *pWindow;               /**< points to the window, of length fftLen. */
+          uint16_t numMels;                 /**< number of mel bands, or 0 for the power spectrum. */
+    const uint32_t *pFilterPos;             /**< points to the first FFT bin of each mel band. */
+    const uint32_t *pFilterLengths;         /**< points to the number of FFT bins of each mel band. */
+    const float32_t *pFilterCoefs;          /**< points to the weights of the bins of all the mel bands, one band after the other. */
+          uint8_t logOutput;                /**< 1 to output the natural log of the powers, 0 for the powers. */
+          uint32_t frameStart;              /**< index in the ring of the first sample of the next frame. */
+          uint32_t fill;                    /**< number of samples in the ring from frameStart. */
+          float32_t *pState;                /**< points to the state, of length 2*fftLen: the ring, then the FFT work buffer. */
+  } arm_stft_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point short-time Fourier transform.
+   * @param[in,out] S               points to an instance of the floating-point STFT structure.
+   * @param[in]     fftLen          length of the frames and of the FFT, a length supported by arm_rfft_fast_f32().
+   * @param[in]     hopSize         number of samples between the starts of two frames, from 1 to fftLen.
+   * @param[in]     pWindow         points to the window, of length fftLen.
+   * @param[in]     numMels         number of mel bands, or 0 for the power spectrum.
+   * @param[in]     pFilterPos      points to the first FFT bin of each mel band, in increasing order.
+   * @param[in]     pFilterLengths  points to the number of FFT bins of each mel band.
+   * @param[in]     pFilterCoefs    points to the weights of the bins of all the mel bands.
+   * @param[in]     logOutput       1 to output the natural log of the powers, 0 for the powers.
+   * @param[in]     pState          points to the state buffer, of length 2*fftLen.
+   * @return        execution status
+   */
+  arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        uint16_t numMels,
+  const uint32_t * pFilterPos,
+  const uint32_t * pFilterLengths,
+  const float32_t * pFilterCoefs,
+        uint8_t logOutput,
+        float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point short-time Fourier transform.
+   * @param[in,out] S          points to an instance of the floating-point STFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the outputs of the frames completed by the block, one frame after the other.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of frames written to pDst.
+   */
+  uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of bins. */
+          uint16_t frameLen;                /**< number of samples per frame. */
+          uint16_t count;                   /**< number of samples of the current frame already processed. */
+    const float32_t *pCoeffs;               /**< points to the offsets of the cosines of the bin frequencies from their signs, the sines, and the signs, of length 3*numBins. */
+          float32_t *pState;                /**< points to the state, of length 2*numBins: the last resonator outputs, then the differences of the last two. */
+  } arm_goertzel_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 Goertzel filter bank.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of bins. */
+          uint16_t frameLen;                /**< number of samples per frame. */
+          uint16_t count;                   /**< number of samples of the current frame already processed. */
+          uint8_t outShift;                 /**< right shift of the bins, the number of bits of frameLen-1. */
+    const q31_t *pCoeffs;                   /**< points to the offsets of the cosines of the bin frequencies from their signs, the sines, and the signs, of length 3*numBins. */
+          q63_t *pState;                    /**< points to the state, of length 2*numBins: the last resonator outputs, then the differences of the last two. */
+  } arm_goertzel_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point Goertzel filter bank.
+   * @param[in,out] S         points to an instance of the floating-point Goertzel structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     frameLen  number of samples per frame.
+   * @param[in]     pBins     points to the indices of the bins, each below frameLen.
+   * @param[out]    pCoeffs   points to the coefficient buffer, of length 3*numBins.
+   * @param[in]     pState    points to the state buffer, of length 2*numBins.
+   * @return        execution status
+   */
+  arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t frameLen,
+  const uint16_t * pBins,
+        float32_t * pCoeffs,
+        float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the floating-point Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bins of the frames completed by the block, one frame after the other.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of frames written to pDst.
+   */
+  uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 Goertzel filter bank.
+   * @param[in,out] S         points to an instance of the Q31 Goertzel structure.
+   * @param[in]     numBins   number of bins.
+   * @param[in]     frameLen  number of samples per frame.
+   * @param[in]     pBins     points to the indices of the bins, each below frameLen.
+   * @param[out]    pCoeffs   points to the coefficient buffer, of length 3*numBins.
+   * @param[in]     pState    points to the state buffer, of length 2*numBins.
+   * @return        execution status
+   */
+  arm_status arm_goertzel_init_q31(
+        arm_goertzel_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t frameLen,
+  const uint16_t * pBins,
+        q31_t * pCoeffs,
+        q63_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 Goertzel filter bank.
+   * @param[in,out] S          points to an instance of the Q31 Goertzel structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bins of the frames completed by the block, one frame after the other.
+   * @param[in]     blockSize  number of input samples.
+   * @return        number of frames written to pDst.
+   */
+  uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the floating-point sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of bins. */
+          uint16_t windowLen;               /**< number of samples in the window. */
+          uint16_t delayIndex;              /**< index of the oldest sample in the delay line. */
+          float32_t damping;                /**< damping factor r. */
+          float32_t dampingN;               /**< r to the power windowLen, the weight of the sample leaving the window. */
+    const float32_t *pCoeffs;               /**< points to the cosines, then the sines, of the bin frequencies, of length 2*numBins. */
+          float32_t *pState;                /**< points to the real parts, then the imaginary parts, of the bins, of length 2*numBins. */
+          float32_t *pDelay;                /**< points to the delay line, of length windowLen. */
+  } arm_sdft_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding DFT.
+   */
+  typedef struct
+  {
+          uint16_t numBins;                 /**< number of bins. */
+          uint16_t windowLen;               /**< number of samples in the window. */
+          uint16_t delayIndex;              /**< index of the oldest sample in the delay line. */
+          uint8_t outShift;                 /**< right shift of the bins, the number of bits of windowLen-1. */
+          q31_t damping;                    /**< damping factor r. */
+          q31_t dampingN;                   /**< r to the power windowLen, the weight of the sample leaving the window. */
+    const q31_t *pCoeffs;                   /**< points to the cosines, then the sines, of the bin frequencies, of length 2*numBins. */
+          q63_t *pState;                    /**< points to the real parts, then the imaginary parts, of the bins, of length 2*numBins. */
+          q31_t *pDelay;                    /**< points to the delay line, of length windowLen. */
+  } arm_sdft_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pBins      points to the indices of the bins, each below windowLen.
+   * @param[in]     damping    damping factor, in (0, 1].
+   * @param[out]    pCoeffs    points to the coefficient buffer, of length 2*numBins.
+   * @param[in]     pState     points to the state buffer, of length 2*numBins.
+   * @param[in]     pDelay     points to the delay line, of length windowLen.
+   * @return        execution status
+   */
+  arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t windowLen,
+  const uint16_t * pBins,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pDelay);
+
+  /**
+   * @brief  Processing function for the floating-point sliding DFT.
+   * @param[in,out] S          points to an instance of the floating-point sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bins after the last sample of the block, of length 2*numBins.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     numBins    number of bins.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pBins      points to the indices of the bins, each below windowLen.
+   * @param[in]     damping    damping factor in 1.31 format, 0x7FFFFFFF for no damping.
+   * @param[out]    pCoeffs    points to the coefficient buffer, of length 2*numBins.
+   * @param[in]     pState     points to the state buffer, of length 2*numBins.
+   * @param[in]     pDelay     points to the delay line, of length windowLen.
+   * @return        execution status
+   */
+  arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t windowLen,
+  const uint16_t * pBins,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q63_t * pState,
+        q31_t * pDelay);
+
+  /**
+   * @brief  Processing function for the Q31 sliding DFT.
+   * @param[in,out] S          points to an instance of the Q31 sliding DFT structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the complex bins after the last sample of the block, of length 2*numBins.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3048,6 +3964,48 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         uint32_t blockSize);
 
 
+  /**
+   * @brief  Sorts the elements of a floating-point vector in ascending order.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer, which can be equal to pSrc
+   * @param[in]  pScratch   scratch buffer, of length blockSize
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_sort_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a Q31 vector in ascending order.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer, which can be equal to pSrc
+   * @param[in]  pScratch   scratch buffer, of length blockSize
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_sort_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pScratch,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts the elements of a Q15 vector in ascending order.
+   * @param[in]  pSrc       input pointer
+   * @param[out] pDst       output pointer, which can be equal to pSrc
+   * @param[in]  pScratch   scratch buffer, of length blockSize
+   * @param[in]  blockSize  number of samples to process
+   */
+  void arm_sort_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        q15_t * pScratch,
+        uint32_t blockSize);
+
+
 /**
  * @brief Convolution of floating-point sequences.
  * @param[in]  pSrcA    points to the first input sequence.
@@ -3064,6 +4022,99 @@ arm_status arm_rfft_4096_fast_init_f32 ( arm_rfft_fast_instance_f32 * S );
         float32_t * pDst);
 
 
+/**
+ * @brief Size of the scratch buffer of FFT convolution and correlation.
+ * @param[in]  srcALen  length of the first input sequence.
+ * @param[in]  srcBLen  length of the second input sequence.
+ * @return number of float32_t words required, or 0 when the lengths are not supported.
+ */
+  uint32_t arm_conv_fft_scratch_size_f32(
+        uint32_t srcALen,
+        uint32_t srcBLen);
+
+
+/**
+ * @brief FFT convolution of floating-point sequences.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  pScratch  points to a scratch buffer of arm_conv_fft_scratch_size_f32() words.
+ * @return execution status.
+ */
+  arm_status arm_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+/**
+ * @brief Convolution of floating-point sequences, direct or with FFTs.
+ * @param[in]  pSrcA     points to the first input sequence.
+ * @param[in]  srcALen   length of the first input sequence.
+ * @param[in]  pSrcB     points to the second input sequence.
+ * @param[in]  srcBLen   length of the second input sequence.
+ * @param[out] pDst      points to the location where the output result is written.  Length srcALen+srcBLen-1.
+ * @param[in]  pScratch  points to a scratch buffer of arm_conv_fft_scratch_size_f32() words.
+ * @return execution status.
+ */
+  arm_status arm_conv_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+  /**
+   * @brief Instance structure for the floating-point partitioned FFT FIR filter.
+   */
+  typedef struct
+  {
+          uint32_t numTaps;     /**< number of filter coefficients in the filter. */
+          uint32_t blockSize;   /**< length of the partitions of the filter and of the blocks of input. */
+          uint32_t numParts;    /**< number of partitions, ceil(numTaps / blockSize). */
+          uint32_t partIndex;   /**< position in the ring of input spectra of the next block. */
+          float32_t *pState;    /**< points to the state variable array. The array is of length (4*numParts+5)*blockSize. */
+          arm_rfft_fast_instance_f32 rfft; /**< real FFT of length 2*blockSize. */
+  } arm_fir_fft_instance_f32;
+
+  /**
+   * @brief Processing function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process, a multiple of S->blockSize.
+   */
+  void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point partitioned FFT FIR filter.
+   * @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure.
+   * @param[in]     numTaps    Number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficients.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  length of the partitions, a power of two from 16 to 2048.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR
+   *                if <code>numTaps</code> is zero or <code>blockSize</code> is not supported.
+   */
+  arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
+
   /**
    * @brief Convolution of Q15 sequences.
    * @param[in]  pSrcA      points to the first input sequence.
@@ -3704,6 +4755,168 @@ arm_status arm_fir_decimate_init_f32(
         float32_t * pState,
         uint32_t blockSize);
 
+  /**
+   * @brief Instance structure for the Q15 FIR resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor, number of polyphase filter components. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint32_t M;                     /**< step between outputs, in polyphase components. */
+        uint32_t stepFrac;              /**< fractional part of the step, in units of 2^-32 of a component. */
+        int32_t phase;                  /**< position of the next output, in components from the first new input sample. */
+        uint32_t phaseFrac;             /**< fractional part of the position of the next output. */
+  const q15_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q15_t *pState;                  /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 FIR resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor, number of polyphase filter components. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint32_t M;                     /**< step between outputs, in polyphase components. */
+        uint32_t stepFrac;              /**< fractional part of the step, in units of 2^-32 of a component. */
+        int32_t phase;                  /**< position of the next output, in components from the first new input sample. */
+        uint32_t phaseFrac;             /**< fractional part of the position of the next output. */
+  const q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+        q31_t *pState;                  /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR resampler.
+   */
+  typedef struct
+  {
+        uint16_t L;                     /**< upsample factor, number of polyphase filter components. */
+        uint16_t phaseLength;           /**< length of each polyphase filter component. */
+        uint32_t M;                     /**< step between outputs, in polyphase components. */
+        uint32_t stepFrac;              /**< fractional part of the step, in units of 2^-32 of a component. */
+        int32_t phase;                  /**< position of the next output, in components from the first new input sample. */
+        uint32_t phaseFrac;             /**< fractional part of the position of the next output. */
+  const float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+        float32_t *pState;              /**< points to the state variable array. The array is of length phaseLength+blockSize. */
+  } arm_fir_resample_instance_f32;
+
+  /**
+   * @brief Processing function for the Q15 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of at most (blockSize*L)/(M+stepFrac/2^32)+1 samples,
+   *                           so at most (blockSize*L)/M+1 samples.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_q15(
+        arm_fir_resample_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q15 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor, integer part of the step between outputs.
+   * @param[in]     stepFrac   fractional part of the step, in units of 2^-32 of a polyphase component, 0 for a ratio of L/M.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize*L</code> is above
+   * INT32_MAX, or ARM_MATH_ARGUMENT_ERROR if <code>L</code> is zero or the step is below one component (<code>M</code> is zero).
+   */
+  arm_status arm_fir_resample_init_q15(
+        arm_fir_resample_instance_q15 * S,
+        uint16_t L,
+        uint32_t M,
+        uint32_t stepFrac,
+        uint16_t numTaps,
+  const q15_t * pCoeffs,
+        q15_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the Q31 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of at most (blockSize*L)/(M+stepFrac/2^32)+1 samples,
+   *                           so at most (blockSize*L)/M+1 samples.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 FIR resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor, integer part of the step between outputs.
+   * @param[in]     stepFrac   fractional part of the step, in units of 2^-32 of a polyphase component, 0 for a ratio of L/M.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize*L</code> is above
+   * INT32_MAX, or ARM_MATH_ARGUMENT_ERROR if <code>L</code> is zero or the step is below one component (<code>M</code> is zero).
+   */
+  arm_status arm_fir_resample_init_q31(
+        arm_fir_resample_instance_q31 * S,
+        uint16_t L,
+        uint32_t M,
+        uint32_t stepFrac,
+        uint16_t numTaps,
+  const q31_t * pCoeffs,
+        q31_t * pState,
+        uint32_t blockSize);
+
+  /**
+   * @brief Processing function for the floating-point FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of at most (blockSize*L)/(M+stepFrac/2^32)+1 samples,
+   *                           so at most (blockSize*L)/M+1 samples.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to <code>pDst</code>.
+   */
+  uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point FIR resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor, integer part of the step between outputs.
+   * @param[in]     stepFrac   fractional part of the step, in units of 2^-32 of a polyphase component, 0 for a ratio of L/M.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful, ARM_MATH_LENGTH_ERROR if
+   * the filter length <code>numTaps</code> is not a multiple of <code>L</code> or <code>blockSize*L</code> is above
+   * INT32_MAX, or ARM_MATH_ARGUMENT_ERROR if <code>L</code> is zero or the step is below one component (<code>M</code> is zero).
+   */
+  arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint32_t M,
+        uint32_t stepFrac,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize);
+
 
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
@@ -4435,17 +5648,55 @@ void arm_biquad_cascade_df2T_compute_coefs_f32(
         float32_t * pDst);
 
 
-/**
- @brief Correlation of Q15 sequences
- @param[in]  pSrcA     points to the first input sequence
- @param[in]  srcALen   length of the first input sequence
- @param[in]  pSrcB     points to the second input sequence
- @param[in]  srcBLen   length of the second input sequence
- @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
- @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
-*/
-void arm_correlate_opt_q15(
-  const q15_t * pSrcA,
+  /**
+   * @brief FFT correlation of floating-point sequences.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to a scratch buffer of arm_conv_fft_scratch_size_f32() words.
+   * @return execution status.
+   */
+  arm_status arm_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+  /**
+   * @brief Correlation of floating-point sequences, direct or with FFTs.
+   * @param[in]  pSrcA     points to the first input sequence.
+   * @param[in]  srcALen   length of the first input sequence.
+   * @param[in]  pSrcB     points to the second input sequence.
+   * @param[in]  srcBLen   length of the second input sequence.
+   * @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+   * @param[in]  pScratch  points to a scratch buffer of arm_conv_fft_scratch_size_f32() words.
+   * @return execution status.
+   */
+  arm_status arm_correlate_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+
+/**
+ @brief Correlation of Q15 sequences
+ @param[in]  pSrcA     points to the first input sequence
+ @param[in]  srcALen   length of the first input sequence
+ @param[in]  pSrcB     points to the second input sequence
+ @param[in]  srcBLen   length of the second input sequence
+ @param[out] pDst      points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+ @param[in]  pScratch  points to scratch buffer of size max(srcALen, srcBLen) + 2*min(srcALen, srcBLen) - 2.
+*/
+void arm_correlate_opt_q15(
+  const q15_t * pSrcA,
         uint32_t srcALen,
   const q15_t * pSrcB,
         uint32_t srcBLen,
@@ -5087,6 +6338,210 @@ __STATIC_FORCEINLINE q15_t arm_pid_q15(
   const arm_matrix_instance_f64 * src,
   arm_matrix_instance_f64 * dst);
 
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc  points to the instance of the input matrix.
+   * @param[out] pDst  points to the instance of the lower triangular factor, may be the same as pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_DECOMPOSITION_FAILURE
+   * if the input matrix is not positive definite, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B from the Cholesky factor of A.
+   * @param[in]  pL    points to the instance of the factor from arm_mat_cholesky_f32().
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if the factor has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_solve_f32(
+  const arm_matrix_instance_f32 * pL,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point LDLT decomposition of a symmetric matrix.
+   * @param[in]  pSrc  points to the instance of the input matrix.
+   * @param[out] pDst  points to the instance of the packed factors, may be the same as pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_DECOMPOSITION_FAILURE
+   * if a term of D is zero, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of A * X = B from the LDLT decomposition of A.
+   * @param[in]  pLD   points to the instance of the packed factors from arm_mat_ldlt_f32().
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if a term of D is zero, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_ldlt_solve_f32(
+  const arm_matrix_instance_f32 * pLD,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point LU decomposition with partial pivoting.
+   * @param[in]  pSrc     points to the instance of the input matrix.
+   * @param[out] pDst     points to the instance of the packed factors, may be the same as pSrc.
+   * @param[out] pPivots  points to numRows values which receive the row exchanges.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if the input matrix is singular, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst,
+  uint16_t * pPivots);
+
+  /**
+   * @brief Floating-point solve of A * X = B from the LU decomposition of A.
+   * @param[in]  pLU      points to the instance of the packed factors from arm_mat_lu_f32().
+   * @param[in]  pPivots  points to the row exchanges from arm_mat_lu_f32().
+   * @param[in]  pB       points to the instance of the right-hand side matrix.
+   * @param[out] pDst     points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if U has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPivots,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of T * X = B with T lower triangular.
+   * @param[in]  pT    points to the instance of the lower triangular matrix.
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if T has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point solve of T * X = B with T upper triangular.
+   * @param[in]  pT    points to the instance of the upper triangular matrix.
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if T has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pB,
+  arm_matrix_instance_f32 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  pSrc  points to the instance of the input matrix.
+   * @param[out] pDst  points to the instance of the lower triangular factor, may be the same as pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_DECOMPOSITION_FAILURE
+   * if the input matrix is not positive definite, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) solve of A * X = B from the Cholesky factor of A.
+   * @param[in]  pL    points to the instance of the factor from arm_mat_cholesky_f64().
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if the factor has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) LDLT decomposition of a symmetric matrix.
+   * @param[in]  pSrc  points to the instance of the input matrix.
+   * @param[out] pDst  points to the instance of the packed factors, may be the same as pSrc.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_DECOMPOSITION_FAILURE
+   * if a term of D is zero, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) solve of A * X = B from the LDLT decomposition of A.
+   * @param[in]  pLD   points to the instance of the packed factors from arm_mat_ldlt_f64().
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if a term of D is zero, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pLD,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) LU decomposition with partial pivoting.
+   * @param[in]  pSrc     points to the instance of the input matrix.
+   * @param[out] pDst     points to the instance of the packed factors, may be the same as pSrc.
+   * @param[out] pPivots  points to numRows values which receive the row exchanges.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if the input matrix is singular, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_lu_f64(
+  const arm_matrix_instance_f64 * pSrc,
+  arm_matrix_instance_f64 * pDst,
+  uint16_t * pPivots);
+
+  /**
+   * @brief Floating-point (64 bit) solve of A * X = B from the LU decomposition of A.
+   * @param[in]  pLU      points to the instance of the packed factors from arm_mat_lu_f64().
+   * @param[in]  pPivots  points to the row exchanges from arm_mat_lu_f64().
+   * @param[in]  pB       points to the instance of the right-hand side matrix.
+   * @param[out] pDst     points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if U has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_lu_solve_f64(
+  const arm_matrix_instance_f64 * pLU,
+  const uint16_t * pPivots,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) solve of T * X = B with T lower triangular.
+   * @param[in]  pT    points to the instance of the lower triangular matrix.
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if T has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_lower_triangular_f64(
+  const arm_matrix_instance_f64 * pT,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pDst);
+
+  /**
+   * @brief Floating-point (64 bit) solve of T * X = B with T upper triangular.
+   * @param[in]  pT    points to the instance of the upper triangular matrix.
+   * @param[in]  pB    points to the instance of the right-hand side matrix.
+   * @param[out] pDst  points to the instance of the solution, may be the same as pB.
+   * @return ARM_MATH_SIZE_MISMATCH if the dimensions do not match, ARM_MATH_SINGULAR
+   * if T has a zero diagonal term, otherwise ARM_MATH_SUCCESS.
+   */
+  arm_status arm_mat_solve_upper_triangular_f64(
+  const arm_matrix_instance_f64 * pT,
+  const arm_matrix_instance_f64 * pB,
+  arm_matrix_instance_f64 * pDst);
+
 
 
   /**
@@ -5807,6 +7262,178 @@ __STATIC_FORCEINLINE void arm_inv_park_q31(
   q15_t x);
 
 
+  /**
+   * @brief  Floating-point vector sine.
+   * @param[in]  pSrc       points to the input vector of angles in radians
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vsin_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector cosine.
+   * @param[in]  pSrc       points to the input vector of angles in radians
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector sine and cosine.
+   * @param[in]  pSrc       points to the input vector of angles in radians
+   * @param[out] pSin       points to the output vector of sines
+   * @param[out] pCos       points to the output vector of cosines
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pSin,
+        float32_t * pCos,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector exponential.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vexp_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector exponential.
+   * @param[in]  pSrc       points to the input vector in 5.26 format
+   * @param[out] pDst       points to the output vector in 1.31 format
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vexp_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector exponential.
+   * @param[in]  pSrc       points to the input vector in 4.11 format
+   * @param[out] pDst       points to the output vector in 1.15 format
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vexp_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Q31 vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector in 1.31 format
+   * @param[out] pDst       points to the output vector in 5.26 format
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 vector natural logarithm.
+   * @param[in]  pSrc       points to the input vector in 1.15 format
+   * @param[out] pDst       points to the output vector in 4.11 format
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vlog_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector hyperbolic tangent.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the output vector
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_vtanh_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point vector four-quadrant arctangent.
+   * @param[in]  pSrcY      points to the vector of ordinates
+   * @param[in]  pSrcX      points to the vector of abscissas
+   * @param[out] pDst       points to the output vector of angles in radians
+   * @param[in]  blockSize  number of samples in each vector
+   */
+  void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+
+  /**
+   * @brief Instance structure for the floating-point numerically controlled oscillator.
+   */
+  typedef struct
+  {
+    uint32_t phase;                /**< phase of the next sample, in units of 2^-32 turn. */
+    uint32_t phaseInc;             /**< phase increment per sample, in units of 2^-32 turn. */
+  } arm_nco_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the floating-point numerically controlled oscillator.
+   * @param[in,out] S      points to an instance of the floating-point NCO structure
+   * @param[in]     freq   frequency, as a fraction of the sampling frequency
+   * @param[in]     phase  phase of the first sample, in radians
+   */
+  void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t freq,
+  float32_t phase);
+
+
+  /**
+   * @brief  Processing function for the floating-point numerically controlled oscillator.
+   * @param[in,out] S          points to an instance of the floating-point NCO structure
+   * @param[out]    pSin       points to the block of sines
+   * @param[out]    pCos       points to the block of cosines
+   * @param[in]     blockSize  number of samples to generate
+   */
+  void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize);
+
+
   /**
    * @ingroup groupFastMath
    */
@@ -5910,8 +7537,7 @@ arm_status arm_sqrt_q15(
    * @param[in]  pIn   input vector.
    * @param[out] pOut  vector of square roots of input elements.
    * @param[in]  len   length of input vector.
-   * @return The function returns ARM_MATH_SUCCESS if input value is positive value or ARM_MATH_ARGUMENT_ERROR if
-   * <code>in</code> is negative value and returns zero output for negative values.
+   * @return none. The outputs of negative inputs are zero.
    */
   void arm_vsqrt_f32(
   float32_t * pIn,
@@ -6677,6 +8303,303 @@ arm_status arm_sqrt_q15(
         float32_t * pResult,
         uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point sliding window statistics.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t count;                   /**< number of samples in the window, below windowLen until the window is filled. */
+          uint32_t index;                   /**< position of the oldest sample in the state buffer. */
+          float32_t mean;                   /**< mean of the window. */
+          float32_t m2;                     /**< sum of the squared deviations from the mean. */
+          float32_t *pState;                /**< points to the state buffer, of length windowLen. */
+  } arm_moving_stats_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding window statistics.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t count;                   /**< number of samples in the window, below windowLen until the window is filled. */
+          uint32_t index;                   /**< position of the oldest sample in the state buffer. */
+          q63_t sum;                        /**< sum of the samples. */
+          q63_t sumIn;                      /**< sum of the samples downshifted to 1.23 format. */
+          q63_t sumOfSquaresIn;             /**< sum of the squares of the samples downshifted to 1.23 format. */
+          uint64_t sumOfSquares;            /**< sum of the squares of the samples. */
+          q31_t *pState;                    /**< points to the state buffer, of length windowLen. */
+  } arm_moving_stats_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length windowLen.
+   * @return        execution status
+   */
+  arm_status arm_moving_stats_init_f32(
+        arm_moving_stats_instance_f32 * S,
+        uint32_t windowLen,
+        float32_t * pState);
+
+  /**
+   * @brief  Processing function for the floating-point sliding window statistics.
+   * @param[in,out] S          points to an instance of the floating-point sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_moving_stats_f32(
+        arm_moving_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  void arm_moving_mean_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_moving_var_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_moving_std_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  void arm_moving_rms_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length windowLen.
+   * @return        execution status
+   */
+  arm_status arm_moving_stats_init_q31(
+        arm_moving_stats_instance_q31 * S,
+        uint32_t windowLen,
+        q31_t * pState);
+
+  /**
+   * @brief  Processing function for the Q31 sliding window statistics.
+   * @param[in,out] S          points to an instance of the Q31 sliding window statistics structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_moving_stats_q31(
+        arm_moving_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  void arm_moving_mean_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_moving_var_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_moving_std_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  void arm_moving_rms_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding window minimum and maximum.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t count;                   /**< number of samples in the window, below windowLen until the window is filled. */
+          uint32_t pos;                     /**< position in the stream of the next sample, modulo 2^32. */
+          uint32_t maxHead;                 /**< start of the maximum list in its circular buffer. */
+          uint32_t maxLen;                  /**< length of the maximum list. */
+          uint32_t minHead;                 /**< start of the minimum list in its circular buffer. */
+          uint32_t minLen;                  /**< length of the minimum list. */
+          float32_t *pState;                /**< points to the values of the maximum then minimum lists, of length 2*windowLen. */
+          uint32_t *pPos;                   /**< points to the positions of the maximum then minimum lists, of length 2*windowLen. */
+  } arm_moving_minmax_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding window minimum and maximum.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t count;                   /**< number of samples in the window, below windowLen until the window is filled. */
+          uint32_t pos;                     /**< position in the stream of the next sample, modulo 2^32. */
+          uint32_t maxHead;                 /**< start of the maximum list in its circular buffer. */
+          uint32_t maxLen;                  /**< length of the maximum list. */
+          uint32_t minHead;                 /**< start of the minimum list in its circular buffer. */
+          uint32_t minLen;                  /**< length of the minimum list. */
+          q31_t *pState;                    /**< points to the values of the maximum then minimum lists, of length 2*windowLen. */
+          uint32_t *pPos;                   /**< points to the positions of the maximum then minimum lists, of length 2*windowLen. */
+  } arm_moving_minmax_instance_q31;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window minimum and maximum.
+   * @param[in,out] S          points to an instance of the floating-point sliding window minimum and maximum structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length 2*windowLen.
+   * @param[in]     pPos       points to the position buffer, of length 2*windowLen.
+   * @return        execution status
+   */
+  arm_status arm_moving_minmax_init_f32(
+        arm_moving_minmax_instance_f32 * S,
+        uint32_t windowLen,
+        float32_t * pState,
+        uint32_t * pPos);
+
+  /**
+   * @brief  Processing function for the floating-point sliding window minimum and maximum.
+   * @param[in,out] S          points to an instance of the floating-point sliding window minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_moving_minmax_f32(
+        arm_moving_minmax_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize);
+
+  void arm_moving_max_f32(
+  const arm_moving_minmax_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex);
+
+  void arm_moving_min_f32(
+  const arm_moving_minmax_instance_f32 * S,
+        float32_t * pResult,
+        uint32_t * pIndex);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding window minimum and maximum.
+   * @param[in,out] S          points to an instance of the Q31 sliding window minimum and maximum structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length 2*windowLen.
+   * @param[in]     pPos       points to the position buffer, of length 2*windowLen.
+   * @return        execution status
+   */
+  arm_status arm_moving_minmax_init_q31(
+        arm_moving_minmax_instance_q31 * S,
+        uint32_t windowLen,
+        q31_t * pState,
+        uint32_t * pPos);
+
+  /**
+   * @brief  Processing function for the Q31 sliding window minimum and maximum.
+   * @param[in,out] S          points to an instance of the Q31 sliding window minimum and maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[in]     blockSize  number of input samples.
+   */
+  void arm_moving_minmax_q31(
+        arm_moving_minmax_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize);
+
+  void arm_moving_max_q31(
+  const arm_moving_minmax_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex);
+
+  void arm_moving_min_q31(
+  const arm_moving_minmax_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex);
+
+  /**
+   * @brief  Median of the elements of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[in]  pScratch   is scratch buffer, of length blockSize
+   * @param[out] pResult    is output value.
+   */
+  void arm_median_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pScratch,
+        float32_t * pResult);
+
+  /**
+   * @brief Instance structure for the floating-point sliding window median filter.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t head;                    /**< position in the state buffer of the oldest sample. */
+          float32_t *pState;                /**< points to the samples of the window, in a circular buffer of length windowLen. */
+          uint32_t *pIndex;                 /**< points to the lower then upper heap, then to the position in the heaps of each sample, of length 2*windowLen. */
+  } arm_median_filter_instance_f32;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding window median filter.
+   * @param[in,out] S          points to an instance of the floating-point sliding window median filter structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length windowLen.
+   * @param[in]     pIndex     points to the index buffer, of length 2*windowLen.
+   * @return        execution status
+   */
+  arm_status arm_median_filter_init_f32(
+        arm_median_filter_instance_f32 * S,
+        uint32_t windowLen,
+        float32_t * pState,
+        uint32_t * pIndex);
+
+  /**
+   * @brief  Processing function for the floating-point sliding window median filter.
+   * @param[in,out] S          points to an instance of the floating-point sliding window median filter structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_f32(
+        arm_median_filter_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+  /**
+   * @brief Instance structure for the Q15 sliding window median filter.
+   */
+  typedef struct
+  {
+          uint32_t windowLen;               /**< number of samples in the window. */
+          uint32_t head;                    /**< position in the state buffer of the oldest sample. */
+          q15_t *pState;                    /**< points to the samples of the window, in a circular buffer of length windowLen. */
+          uint32_t *pIndex;                 /**< points to the lower then upper heap, then to the position in the heaps of each sample, of length 2*windowLen. */
+  } arm_median_filter_instance_q15;
+
+  /**
+   * @brief  Initialization function for the Q15 sliding window median filter.
+   * @param[in,out] S          points to an instance of the Q15 sliding window median filter structure.
+   * @param[in]     windowLen  number of samples in the window.
+   * @param[in]     pState     points to the state buffer, of length windowLen.
+   * @param[in]     pIndex     points to the index buffer, of length 2*windowLen.
+   * @return        execution status
+   */
+  arm_status arm_median_filter_init_q15(
+        arm_median_filter_instance_q15 * S,
+        uint32_t windowLen,
+        q15_t * pState,
+        uint32_t * pIndex);
+
+  /**
+   * @brief  Processing function for the Q15 sliding window median filter.
+   * @param[in,out] S          points to an instance of the Q15 sliding window median filter structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of output samples.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_filter_q15(
+        arm_median_filter_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize);
+
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -107,6 +107,34 @@ void arm_dot_prod_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t acc0 = __arm_x86_dup_f32(0.0f);
+  arm_x86_f32_t acc1 = __arm_x86_dup_f32(0.0f);
+
+  /* Compute 2 * ARM_X86_F32_LANES products at a time into independent accumulators */
+  blkCnt = blockSize / (2U * ARM_X86_F32_LANES);
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0]* B[0] + A[1]* B[1] + A[2]* B[2] + .....+ A[blockSize-1]* B[blockSize-1] */
+
+    acc0 = __arm_x86_fma_f32(acc0, __arm_x86_ld_f32(pSrcA), __arm_x86_ld_f32(pSrcB));
+    acc1 = __arm_x86_fma_f32(acc1, __arm_x86_ld_f32(pSrcA + ARM_X86_F32_LANES),
+                                   __arm_x86_ld_f32(pSrcB + ARM_X86_F32_LANES));
+
+    /* Increment pointers */
+    pSrcA += 2U * ARM_X86_F32_LANES;
+    pSrcB += 2U * ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  sum = __arm_x86_hsum_f32(__arm_x86_add_f32(acc0, acc1));
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize % (2U * ARM_X86_F32_LANES);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -107,6 +107,30 @@ void arm_scale_f32(
     /* Tail */
     blkCnt = blockSize & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t vecScale = __arm_x86_dup_f32(scale);
+
+  /* Compute ARM_X86_F32_LANES outputs at a time */
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A * scale */
+
+    /* Scale the input and store the results in the destination buffer. */
+    __arm_x86_st_f32(pDst, __arm_x86_mul_f32(__arm_x86_ld_f32(pSrc), vecScale));
+
+    /* Increment pointers */
+    pSrc += ARM_X86_F32_LANES;
+    pDst += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -104,6 +104,30 @@ void arm_cmplx_conj_f32(
    /* Tail */
    blkCnt = numSamples & 0x3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t sign = __arm_x86_odd_sign_f32();
+
+  /* Compute ARM_X86_F32_LANES / 2 complex outputs at a time */
+  blkCnt = numSamples / (ARM_X86_F32_LANES / 2U);
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] + jC[1] = A[0]+ j(-1)A[1] */
+
+    /* Flip the sign of the imaginary parts and store result in destination buffer. */
+    __arm_x86_st_f32(pDst, __arm_x86_xor_f32(__arm_x86_ld_f32(pSrc), sign));
+
+    /* Increment pointers */
+    pSrc += ARM_X86_F32_LANES;
+    pDst += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = numSamples % (ARM_X86_F32_LANES / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
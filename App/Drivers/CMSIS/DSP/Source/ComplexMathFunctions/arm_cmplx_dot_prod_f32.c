@@ -144,6 +144,37 @@ void arm_cmplx_dot_prod_f32(
     /* Tail */
     blkCnt = numSamples & 0x7;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t x, y;
+  arm_x86_f32_t accRe = __arm_x86_dup_f32(0.0f);   /* a*c, b*d pairs */
+  arm_x86_f32_t accIm = __arm_x86_dup_f32(0.0f);   /* a*d, b*c pairs */
+
+  /* Compute ARM_X86_F32_LANES / 2 complex outputs at a time */
+  blkCnt = numSamples / (ARM_X86_F32_LANES / 2U);
+
+  while (blkCnt > 0U)
+  {
+    x = __arm_x86_ld_f32(pSrcA);
+    y = __arm_x86_ld_f32(pSrcB);
+
+    accRe = __arm_x86_fma_f32(accRe, x, y);
+    accIm = __arm_x86_fma_f32(accIm, x, __arm_x86_cmplx_swap_f32(y));
+
+    /* Increment pointers */
+    pSrcA += ARM_X86_F32_LANES;
+    pSrcB += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Re{C} = sum(a*c) - sum(b*d), Im{C} = sum(a*d) + sum(b*c) */
+  real_sum = __arm_x86_hsum_f32(__arm_x86_xor_f32(accRe, __arm_x86_odd_sign_f32()));
+  imag_sum = __arm_x86_hsum_f32(accIm);
+
+  /* Compute remaining outputs */
+  blkCnt = numSamples % (ARM_X86_F32_LANES / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -122,6 +122,31 @@ void arm_cmplx_mag_squared_f32(
 
   blkCnt = numSamples & 7;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t vecA, vecB;
+
+  /* Compute ARM_X86_F32_LANES outputs at a time */
+  blkCnt = numSamples / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* C[0] = (A[0] * A[0] + A[1] * A[1]) */
+
+    vecA = __arm_x86_ld_f32(pSrc);
+    vecB = __arm_x86_ld_f32(pSrc + ARM_X86_F32_LANES);
+    pSrc += 2U * ARM_X86_F32_LANES;
+
+    /* Store the result in the destination buffer. */
+    __arm_x86_st_f32(pDst, __arm_x86_pairsum_f32(__arm_x86_mul_f32(vecA, vecA), __arm_x86_mul_f32(vecB, vecB)));
+    pDst += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = numSamples % ARM_X86_F32_LANES;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
@@ -114,6 +114,30 @@ void arm_cmplx_mult_cmplx_f32(
     /* Tail */
     blkCnt = numSamples & 3;
 
+#elif defined(ARM_MATH_X86_SIMD)
+  /* Compute ARM_X86_F32_LANES / 2 complex outputs at a time */
+  blkCnt = numSamples / (ARM_X86_F32_LANES / 2U);
+
+  while (blkCnt > 0U)
+  {
+    /* C[2 * i    ] = A[2 * i] * B[2 * i    ] - A[2 * i + 1] * B[2 * i + 1]. */
+    /* C[2 * i + 1] = A[2 * i] * B[2 * i + 1] + A[2 * i + 1] * B[2 * i    ]. */
+
+    /* store result in destination buffer. */
+    __arm_x86_st_f32(pDst, __arm_x86_cmplx_mul_f32(__arm_x86_ld_f32(pSrcA), __arm_x86_ld_f32(pSrcB)));
+
+    /* Increment pointers */
+    pSrcA += ARM_X86_F32_LANES;
+    pSrcB += ARM_X86_F32_LANES;
+    pDst  += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = numSamples % (ARM_X86_F32_LANES / 2U);
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
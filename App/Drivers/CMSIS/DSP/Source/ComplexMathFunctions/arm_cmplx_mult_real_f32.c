@@ -105,6 +105,37 @@ void arm_cmplx_mult_real_f32(
 
     /* Tail */
     blkCnt = numSamples & 3;
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t lo, hi;
+
+  /* Compute ARM_X86_F32_LANES complex outputs at a time */
+  blkCnt = numSamples / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* C[2 * i    ] = A[2 * i    ] * B[i]. */
+    /* C[2 * i + 1] = A[2 * i + 1] * B[i]. */
+
+    /* Spread each real value over a complex pair */
+    __arm_x86_dup_pairs_f32(__arm_x86_ld_f32(pSrcReal), &lo, &hi);
+
+    /* store result in destination buffer. */
+    __arm_x86_st_f32(pCmplxDst, __arm_x86_mul_f32(__arm_x86_ld_f32(pSrcCmplx), lo));
+    __arm_x86_st_f32(pCmplxDst + ARM_X86_F32_LANES,
+                     __arm_x86_mul_f32(__arm_x86_ld_f32(pSrcCmplx + ARM_X86_F32_LANES), hi));
+
+    /* Increment pointers */
+    pSrcCmplx += 2U * ARM_X86_F32_LANES;
+    pSrcReal  += ARM_X86_F32_LANES;
+    pCmplxDst += 2U * ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = numSamples % ARM_X86_F32_LANES;
+
 #else
 #if defined (ARM_MATH_LOOPUNROLL)
 
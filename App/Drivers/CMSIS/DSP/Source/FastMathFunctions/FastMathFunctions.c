@@ -26,12 +26,28 @@
  * limitations under the License.
  */
 
+#include "arm_atan2_f32.c"
 #include "arm_cos_f32.c"
 #include "arm_cos_q15.c"
 #include "arm_cos_q31.c"
+#include "arm_nco_f32.c"
+#include "arm_nco_init_f32.c"
 #include "arm_sin_f32.c"
 #include "arm_sin_q15.c"
 #include "arm_sin_q31.c"
 #include "arm_sqrt_q15.c"
 #include "arm_sqrt_q31.c"
+#include "arm_vcos_f32.c"
+#include "arm_vexp_f32.c"
+#include "arm_vexp_q15.c"
+#include "arm_vexp_q31.c"
+#include "arm_vlog_f32.c"
+#include "arm_vlog_q15.c"
+#include "arm_vlog_q31.c"
+#include "arm_vsin_f32.c"
+#include "arm_vsincos_f32.c"
+#include "arm_vsqrt_f32.c"
+#include "arm_vsqrt_q15.c"
+#include "arm_vsqrt_q31.c"
+#include "arm_vtanh_f32.c"
 
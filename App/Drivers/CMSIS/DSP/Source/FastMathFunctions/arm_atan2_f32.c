@@ -0,0 +1,309 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_atan2_f32.c
+ * Description:  Floating-point vector four-quadrant arctangent
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup atan2 Vector Four-Quadrant Arctangent
+
+  Computes the angles <code>atan2(y, x)</code> in <code>[-pi, pi]</code> of the points <code>(x, y)</code>
+  given by two vectors, as used for the phases of complex values.
+
+  @par           Algorithm
+                   The ratio <code>a</code> of the smaller to the larger of <code>|x|</code> and <code>|y|</code>
+                   is in <code>[0, 1]</code>. Above <code>tan(pi/8)</code>, it is reduced to
+                   <code>(a - 1) / (a + 1)</code> with <code>atan(a) = pi/4 + atan((a - 1) / (a + 1))</code>,
+                   computed from <code>|x|</code> and <code>|y|</code> with a single division. <code>atan</code> of
+                   the reduced ratio is an odd polynomial of degree 9. The result is then reflected to the octant
+                   and the quadrant of <code>(x, y)</code>.
+  @par           Accuracy
+                   The maximum error is 3 ULP (unit in the last place), reached for ratios close to
+                   <code>tan(pi/8)</code>. This also holds with Armv7 Neon, which divides with a refined
+                   reciprocal estimate.
+                   The signs of zeros and the infinite inputs are handled as by the C library <code>atan2</code>:
+                   <code>atan2(+/-0, -0)</code> is <code>+/-pi</code> and <code>atan2(+/-Inf, +/-Inf)</code> is an odd
+                   multiple of <code>pi/4</code>. NaN inputs give NaN.
+                   As Armv7 Neon flushes subnormals to zero, its kernel scales points with both <code>|x|</code>
+                   and <code>|y|</code> below <code>2^-24</code> by <code>2^100</code>, from the bits of subnormal
+                   coordinates, and points with <code>|x|</code> or <code>|y|</code> from <code>2^64</code> by
+                   <code>2^-100</code>, so that the reciprocal of the larger one is normal. Results below the smallest
+                   normal float are still flushed to zero there.
+ */
+
+/**
+  @addtogroup atan2
+  @{
+ */
+
+#define ARM_ATAN2_TAN_PI_8  0.414213562373095f
+#define ARM_ATAN2_PI_4      0.785398163397448f
+#define ARM_ATAN2_PI_2      1.570796326794897f
+#define ARM_ATAN2_PI        3.141592653589793f
+#define ARM_ATAN2_P0        8.05374449538e-2f
+#define ARM_ATAN2_P1       -1.38776856032e-1f
+#define ARM_ATAN2_P2        1.99777106478e-1f
+#define ARM_ATAN2_P3       -3.33329491539e-1f
+#define ARM_ATAN2_TINY      0x33800000U         /* Bits of 2^-24 */
+#define ARM_ATAN2_HUGE      0x5F800000U         /* Bits of 2^64 */
+#define ARM_ATAN2_2_100     1.26765060e30f      /* 2^100 */
+#define ARM_ATAN2_2_M100    7.88860905e-31f     /* 2^-100 */
+#define ARM_ATAN2_2_M49     1.77635684e-15f     /* 2^-49 */
+
+__STATIC_FORCEINLINE float32_t arm_atan2_one_f32(
+  float32_t y,
+  float32_t x)
+{
+  union { float32_t f; uint32_t u; } ux, uy, r;
+  float32_t ax, ay, mx, mn, num, den, a, z, p;
+  uint32_t big;
+
+  ux.f = x;
+  uy.f = y;
+  ax = fabsf(x);
+  ay = fabsf(y);
+  mx = (ay > ax) ? ay : ax;
+  mn = (ay > ax) ? ax : ay;
+
+  /* Reduced ratio in [-tan(pi/8), tan(pi/8)], with 0/0 made 0 and Inf/Inf made pi/4 + 0 */
+  big = (mn >= ARM_ATAN2_TAN_PI_8 * mx) && (mn > 0.0f);
+  num = big ? (mn - mx) : mn;
+  den = big ? (mn + mx) : mx;
+  num = (ax == ay) ? 0.0f : num;
+  den = (mx == 0.0f) ? 1.0f : den;
+  a = num / den;
+
+  z = a * a;
+  p = ((ARM_ATAN2_P0 * z + ARM_ATAN2_P1) * z + ARM_ATAN2_P2) * z + ARM_ATAN2_P3;
+  p = (p * z) * a + a;
+  r.f = big ? (ARM_ATAN2_PI_4 + p) : p;
+
+  /* Octant, then quadrant */
+  r.f = (ay > ax) ? (ARM_ATAN2_PI_2 - r.f) : r.f;
+  r.f = (ux.u & 0x80000000U) ? (ARM_ATAN2_PI - r.f) : r.f;
+  r.u = r.u | (uy.u & 0x80000000U);
+
+  return (((x != x) || (y != y)) ? (x + y) : r.f);
+}
+
+#if defined(ARM_MATH_NEON) && !defined(__aarch64__)
+/*
+ * Magnitudes of points below 2^-24 times 2^100, with subnormals converted from their bits, times 2^-49,
+ * and of points from 2^64 times 2^-100
+ */
+__STATIC_FORCEINLINE float32x4_t arm_atan2_scale_neon(
+  float32x4_t v,
+  uint32x4_t tinyV,
+  uint32x4_t hugeV)
+{
+  uint32x4_t uV = vreinterpretq_u32_f32(v);
+
+  v = vbslq_f32(hugeV, vmulq_f32(v, vdupq_n_f32(ARM_ATAN2_2_M100)), v);
+  return vbslq_f32(tinyV,
+                   vbslq_f32(vcltq_u32(uV, vdupq_n_u32(0x00800000U)),
+                             vmulq_f32(vcvtq_f32_s32(vreinterpretq_s32_u32(uV)), vdupq_n_f32(ARM_ATAN2_2_M49)),
+                             vmulq_f32(v, vdupq_n_f32(ARM_ATAN2_2_100))),
+                   v);
+}
+#endif
+
+/**
+  @brief         Floating-point vector four-quadrant arctangent.
+  @param[in]     pSrcY      points to the vector of ordinates
+  @param[in]     pSrcX      points to the vector of abscissas
+  @param[out]    pDst       points to the output vector of angles in radians
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void arm_atan2_f32(
+  const float32_t * pSrcY,
+  const float32_t * pSrcX,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t xV, yV, axV, ayV, mxV, mnV, numV, denV, aV, zV, pV, rV;
+  uint32x4_t bigV, swapV;
+#if !defined(__aarch64__)
+  uint32x4_t maxV, tinyV, hugeV;
+#endif
+
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vld1q_f32(pSrcX);
+    yV = vld1q_f32(pSrcY);
+    axV = vabsq_f32(xV);
+    ayV = vabsq_f32(yV);
+
+#if !defined(__aarch64__)
+    /* Armv7 Neon flushes subnormals to zero: small points are scaled up, and large ones down */
+    maxV = vmaxq_u32(vreinterpretq_u32_f32(axV), vreinterpretq_u32_f32(ayV));
+    tinyV = vcltq_u32(maxV, vdupq_n_u32(ARM_ATAN2_TINY));
+    hugeV = vcgeq_u32(maxV, vdupq_n_u32(ARM_ATAN2_HUGE));
+    axV = arm_atan2_scale_neon(axV, tinyV, hugeV);
+    ayV = arm_atan2_scale_neon(ayV, tinyV, hugeV);
+#endif
+
+    swapV = vcgtq_f32(ayV, axV);
+    mxV = vbslq_f32(swapV, ayV, axV);
+    mnV = vbslq_f32(swapV, axV, ayV);
+
+    bigV = vandq_u32(vcgeq_f32(mnV, vmulq_f32(mxV, vdupq_n_f32(ARM_ATAN2_TAN_PI_8))), vcgtq_f32(mnV, vdupq_n_f32(0.0f)));
+    numV = vbslq_f32(bigV, vsubq_f32(mnV, mxV), mnV);
+    denV = vbslq_f32(bigV, vaddq_f32(mnV, mxV), mxV);
+    numV = vbslq_f32(vceqq_f32(axV, ayV), vdupq_n_f32(0.0f), numV);
+    denV = vbslq_f32(vceqq_f32(mxV, vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f), denV);
+
+#if defined(__aarch64__)
+    aV = vdivq_f32(numV, denV);
+#else
+    /* Reciprocal estimate refined three times */
+    rV = vrecpeq_f32(denV);
+    rV = vmulq_f32(vrecpsq_f32(denV, rV), rV);
+    rV = vmulq_f32(vrecpsq_f32(denV, rV), rV);
+    rV = vmulq_f32(vrecpsq_f32(denV, rV), rV);
+    aV = vmulq_f32(numV, rV);
+#endif
+
+    zV = vmulq_f32(aV, aV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_ATAN2_P1), vdupq_n_f32(ARM_ATAN2_P0), zV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_ATAN2_P2), pV, zV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_ATAN2_P3), pV, zV);
+    pV = vmlaq_f32(aV, vmulq_f32(pV, zV), aV);
+    rV = vbslq_f32(bigV, vaddq_f32(pV, vdupq_n_f32(ARM_ATAN2_PI_4)), pV);
+
+    rV = vbslq_f32(swapV, vsubq_f32(vdupq_n_f32(ARM_ATAN2_PI_2), rV), rV);
+    rV = vbslq_f32(vreinterpretq_u32_s32(vshrq_n_s32(vreinterpretq_s32_f32(xV), 31)),
+                   vsubq_f32(vdupq_n_f32(ARM_ATAN2_PI), rV), rV);
+    rV = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(rV),
+                                         vandq_u32(vreinterpretq_u32_f32(yV), vdupq_n_u32(0x80000000U))));
+
+    /* NaN inputs */
+    rV = vbslq_f32(vandq_u32(vceqq_f32(xV, xV), vceqq_f32(yV, yV)), rV, vaddq_f32(xV, yV));
+
+    vst1q_f32(pDst, rV);
+
+    pSrcX += 4;
+    pSrcY += 4;
+    pDst += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t xV, yV, axV, ayV, mxV, mnV, numV, denV, aV, zV, pV, rV, bigV, swapV, signV;
+
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+  signV = __arm_x86_dup_f32(-0.0f);
+
+  while (blkCnt > 0U)
+  {
+    xV = __arm_x86_ld_f32(pSrcX);
+    yV = __arm_x86_ld_f32(pSrcY);
+    axV = __arm_x86_abs_f32(xV);
+    ayV = __arm_x86_abs_f32(yV);
+    swapV = __arm_x86_cmplt_f32(axV, ayV);
+    mxV = __arm_x86_select_f32(swapV, ayV, axV);
+    mnV = __arm_x86_select_f32(swapV, axV, ayV);
+
+    bigV = __arm_x86_and_f32(__arm_x86_cmple_f32(__arm_x86_mul_f32(mxV, __arm_x86_dup_f32(ARM_ATAN2_TAN_PI_8)), mnV),
+                             __arm_x86_cmplt_f32(__arm_x86_dup_f32(0.0f), mnV));
+    numV = __arm_x86_select_f32(bigV, __arm_x86_sub_f32(mnV, mxV), mnV);
+    denV = __arm_x86_select_f32(bigV, __arm_x86_add_f32(mnV, mxV), mxV);
+    numV = __arm_x86_select_f32(__arm_x86_cmpeq_f32(axV, ayV), __arm_x86_dup_f32(0.0f), numV);
+    denV = __arm_x86_select_f32(__arm_x86_cmpeq_f32(mxV, __arm_x86_dup_f32(0.0f)), __arm_x86_dup_f32(1.0f), denV);
+    aV = __arm_x86_div_f32(numV, denV);
+
+    zV = __arm_x86_mul_f32(aV, aV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_ATAN2_P1), __arm_x86_dup_f32(ARM_ATAN2_P0), zV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_ATAN2_P2), pV, zV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_ATAN2_P3), pV, zV);
+    pV = __arm_x86_fma_f32(aV, __arm_x86_mul_f32(pV, zV), aV);
+    rV = __arm_x86_select_f32(bigV, __arm_x86_add_f32(pV, __arm_x86_dup_f32(ARM_ATAN2_PI_4)), pV);
+
+    rV = __arm_x86_select_f32(swapV, __arm_x86_sub_f32(__arm_x86_dup_f32(ARM_ATAN2_PI_2), rV), rV);
+    rV = __arm_x86_select_f32(__arm_x86_as_f32_s32(__ARM_X86_SRAI_S32(__arm_x86_as_s32_f32(xV), 31)),
+                              __arm_x86_sub_f32(__arm_x86_dup_f32(ARM_ATAN2_PI), rV), rV);
+    rV = __arm_x86_or_f32(rV, __arm_x86_and_f32(yV, signV));
+
+    /* NaN inputs */
+    rV = __arm_x86_select_f32(__arm_x86_and_f32(__arm_x86_cmpeq_f32(xV, xV), __arm_x86_cmpeq_f32(yV, yV)),
+                              rV, __arm_x86_add_f32(xV, yV));
+
+    __arm_x86_st_f32(pDst, rV);
+
+    pSrcX += ARM_X86_F32_LANES;
+    pSrcY += ARM_X86_F32_LANES;
+    pDst += ARM_X86_F32_LANES;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_atan2_one_f32(*pSrcY++, *pSrcX++);
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_ATAN2_TAN_PI_8
+#undef ARM_ATAN2_PI_4
+#undef ARM_ATAN2_PI_2
+#undef ARM_ATAN2_PI
+#undef ARM_ATAN2_P0
+#undef ARM_ATAN2_P1
+#undef ARM_ATAN2_P2
+#undef ARM_ATAN2_P3
+#undef ARM_ATAN2_TINY
+#undef ARM_ATAN2_HUGE
+#undef ARM_ATAN2_2_100
+#undef ARM_ATAN2_2_M100
+#undef ARM_ATAN2_2_M49
+
+/**
+  @} end of atan2 group
+ */
@@ -0,0 +1,337 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_f32.c
+ * Description:  Floating-point numerically controlled oscillator
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup NCO Numerically Controlled Oscillator
+
+  Generates the samples <code>sin(phi[n])</code> and <code>cos(phi[n])</code> of a complex oscillator,
+  as used to mix a signal to or from baseband, with <code>phi[n] = phi[0] + 2 * pi * f * n</code>.
+
+  @par           Algorithm
+                   The phase is kept in a 32-bit accumulator, in units of <code>2^-32</code> turn, so that it wraps
+                   exactly and never drifts. The samples are generated by the recursive rotation of a phasor:
+  <pre>
+      c[n+1] = c[n] * cos(w) - s[n] * sin(w)
+      s[n+1] = s[n] * cos(w) + c[n] * sin(w)
+  </pre>
+                   which costs two multiplications and one multiply-add per output. Several phasors are run side
+                   by side, one sample per lane with Neon or x86 SIMD and 4 samples with loop unrolling, each rotated
+                   by the phase increment over all of them. Rounding errors make the phasors grow or shrink and drift
+                   in phase, so that they are renormalized every 8 rotations: they are computed again from the phase
+                   accumulator, with the polynomials of arm_vsincos_f32() and an exact reduction of the integer phase.
+  @par           Accuracy
+                   The error is below <code>1e-6</code>, where the table functions arm_sin_f32() and arm_cos_f32()
+                   are accurate to about <code>2e-5</code>, and does not grow with the number of samples.
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+#define ARM_NCO_STEPS 8U                         /* Rotations of each phasor between two renormalizations */
+#define ARM_NCO_TURN  1.46291807926715968e-9f    /* 2*pi / 2^32 */
+#define ARM_NCO_S0   -1.9515295891e-4f
+#define ARM_NCO_S1    8.3321608736e-3f
+#define ARM_NCO_S2   -1.6666654611e-1f
+#define ARM_NCO_C0    2.443315711809948e-5f
+#define ARM_NCO_C1   -1.388731625493765e-3f
+#define ARM_NCO_C2    4.166664568298827e-2f
+
+/*
+ * The phase plus 1/8 turn has the quadrant in its two high bits,
+ * and the remainder in [-1/8, 1/8) turn in its low bits.
+ */
+__STATIC_FORCEINLINE void arm_nco_sincos_f32(
+  uint32_t phase,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+  union { float32_t f; uint32_t u; } s, c;
+  float32_t r, z;
+  uint32_t u, swap;
+
+  u = phase + 0x20000000U;
+  r = (float32_t) ((int32_t) (u & 0x3FFFFFFFU) - 0x20000000) * ARM_NCO_TURN;
+
+  z = r * r;
+  s.f = ((ARM_NCO_S0 * z + ARM_NCO_S1) * z + ARM_NCO_S2) * z;
+  s.f = s.f * r + r;
+  c.f = ((ARM_NCO_C0 * z + ARM_NCO_C1) * z + ARM_NCO_C2) * (z * z);
+  c.f = c.f - 0.5f * z + 1.0f;
+
+  /* Swap in odd quadrants, then negate */
+  swap = (s.u ^ c.u) & (0U - ((u >> 30) & 1U));
+  s.u ^= swap;
+  c.u ^= swap;
+  s.u ^= u & 0x80000000U;
+  c.u ^= (u + 0x40000000U) & 0x80000000U;
+
+  *pSin = s.f;
+  *pCos = c.f;
+}
+
+/**
+  @brief         Processing function for the floating-point numerically controlled oscillator.
+  @param[in,out] S          points to an instance of the floating-point NCO structure
+  @param[out]    pSin       points to the block of sines
+  @param[out]    pCos       points to the block of cosines
+  @param[in]     blockSize  number of samples to generate
+  @return        none
+
+  @par           Details
+                   Consecutive calls generate consecutive samples, so that the block can be of any size.
+                   The frequency can be changed between two blocks by setting <code>phaseInc</code> in the instance,
+                   without a discontinuity of the phase.
+ */
+
+void arm_nco_f32(
+  arm_nco_instance_f32 * S,
+  float32_t * pSin,
+  float32_t * pCos,
+  uint32_t blockSize)
+{
+  uint32_t phase = S->phase;                     /* Phase of the next sample */
+  uint32_t phaseInc = S->phaseInc;               /* Phase increment per sample */
+  float32_t ws, wc;                              /* Rotation by the phase increment of the phasors */
+  float32_t s, c, t;                             /* Phasor */
+  uint32_t cnt, n;                               /* Loop counters */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t sV, cV, tV, rV, zV, wsV, wcV;
+  uint32x4_t uV, rampV, swapV;
+  uint32_t pRamp[4];                             /* Phase offsets of the lanes, plus 1/8 turn */
+
+  for (n = 0U; n < 4U; n++)
+  {
+    pRamp[n] = n * phaseInc + 0x20000000U;
+  }
+
+  rampV = vld1q_u32(pRamp);
+
+  arm_nco_sincos_f32(4U * phaseInc, &ws, &wc);
+  wsV = vdupq_n_f32(ws);
+  wcV = vdupq_n_f32(wc);
+
+  while (blockSize >= 4U)
+  {
+    cnt = (blockSize < 4U * ARM_NCO_STEPS) ? (blockSize & ~3U) : (4U * ARM_NCO_STEPS);
+
+    /* Phasors of the next 4 samples, computed from the phase accumulator */
+    uV = vaddq_u32(vdupq_n_u32(phase), rampV);
+    rV = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vandq_u32(uV, vdupq_n_u32(0x3FFFFFFFU))), vdupq_n_s32(0x20000000)));
+    rV = vmulq_n_f32(rV, ARM_NCO_TURN);
+
+    zV = vmulq_f32(rV, rV);
+    sV = vmlaq_f32(vdupq_n_f32(ARM_NCO_S1), vdupq_n_f32(ARM_NCO_S0), zV);
+    sV = vmlaq_f32(vdupq_n_f32(ARM_NCO_S2), sV, zV);
+    sV = vmlaq_f32(rV, vmulq_f32(sV, zV), rV);
+    cV = vmlaq_f32(vdupq_n_f32(ARM_NCO_C1), vdupq_n_f32(ARM_NCO_C0), zV);
+    cV = vmlaq_f32(vdupq_n_f32(ARM_NCO_C2), cV, zV);
+    cV = vmlaq_f32(vmlsq_f32(vdupq_n_f32(1.0f), zV, vdupq_n_f32(0.5f)), cV, vmulq_f32(zV, zV));
+
+    swapV = vtstq_u32(uV, vdupq_n_u32(0x40000000U));
+    tV = vbslq_f32(swapV, sV, cV);
+    sV = vbslq_f32(swapV, cV, sV);
+    sV = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(sV), vandq_u32(uV, vdupq_n_u32(0x80000000U))));
+    cV = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(tV),
+                                         vandq_u32(vaddq_u32(uV, vdupq_n_u32(0x40000000U)), vdupq_n_u32(0x80000000U))));
+
+    for (n = 0U; n < cnt; n += 4U)
+    {
+      vst1q_f32(pSin + n, sV);
+      vst1q_f32(pCos + n, cV);
+
+      tV = vmlsq_f32(vmulq_f32(cV, wcV), sV, wsV);
+      sV = vmlaq_f32(vmulq_f32(sV, wcV), cV, wsV);
+      cV = tV;
+    }
+
+    phase += cnt * phaseInc;
+    pSin += cnt;
+    pCos += cnt;
+    blockSize -= cnt;
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t sV, cV, tV, rV, zV, wsV, wcV, swapV;
+  arm_x86_s32_t uV, rampV;
+
+  /* Phase offsets of the lanes, plus 1/8 turn */
+  union { float32_t f[ARM_X86_F32_LANES]; uint32_t u[ARM_X86_F32_LANES]; } ramp;
+
+  for (n = 0U; n < ARM_X86_F32_LANES; n++)
+  {
+    ramp.u[n] = n * phaseInc + 0x20000000U;
+  }
+
+  rampV = __arm_x86_as_s32_f32(__arm_x86_ld_f32(ramp.f));
+
+  arm_nco_sincos_f32(ARM_X86_F32_LANES * phaseInc, &ws, &wc);
+  wsV = __arm_x86_dup_f32(ws);
+  wcV = __arm_x86_dup_f32(wc);
+
+  while (blockSize >= ARM_X86_F32_LANES)
+  {
+    cnt = (blockSize < ARM_X86_F32_LANES * ARM_NCO_STEPS) ? (blockSize - blockSize % ARM_X86_F32_LANES)
+                                                          : (ARM_X86_F32_LANES * ARM_NCO_STEPS);
+
+    /* Phasors of the next samples, computed from the phase accumulator */
+    uV = __arm_x86_add_s32(__arm_x86_dup_s32((int32_t) phase), rampV);
+    rV = __arm_x86_cvt_f32_s32(__arm_x86_sub_s32(__arm_x86_and_s32(uV, __arm_x86_dup_s32(0x3FFFFFFF)), __arm_x86_dup_s32(0x20000000)));
+    rV = __arm_x86_mul_f32(rV, __arm_x86_dup_f32(ARM_NCO_TURN));
+
+    zV = __arm_x86_mul_f32(rV, rV);
+    sV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_NCO_S1), __arm_x86_dup_f32(ARM_NCO_S0), zV);
+    sV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_NCO_S2), sV, zV);
+    sV = __arm_x86_fma_f32(rV, __arm_x86_mul_f32(sV, zV), rV);
+    cV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_NCO_C1), __arm_x86_dup_f32(ARM_NCO_C0), zV);
+    cV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_NCO_C2), cV, zV);
+    cV = __arm_x86_fma_f32(__arm_x86_fma_f32(__arm_x86_dup_f32(1.0f), zV, __arm_x86_dup_f32(-0.5f)),
+                           cV, __arm_x86_mul_f32(zV, zV));
+
+    swapV = __arm_x86_as_f32_s32(__ARM_X86_SRAI_S32(__ARM_X86_SLLI_S32(uV, 1), 31));
+    tV = __arm_x86_select_f32(swapV, sV, cV);
+    sV = __arm_x86_select_f32(swapV, cV, sV);
+    sV = __arm_x86_xor_f32(sV, __arm_x86_as_f32_s32(__arm_x86_and_s32(uV, __arm_x86_dup_s32(INT32_MIN))));
+    cV = __arm_x86_xor_f32(tV, __arm_x86_as_f32_s32(
+                             __arm_x86_and_s32(__arm_x86_add_s32(uV, __arm_x86_dup_s32(0x40000000)), __arm_x86_dup_s32(INT32_MIN))));
+
+    for (n = 0U; n < cnt; n += ARM_X86_F32_LANES)
+    {
+      __arm_x86_st_f32(pSin + n, sV);
+      __arm_x86_st_f32(pCos + n, cV);
+
+      tV = __arm_x86_fma_f32(__arm_x86_mul_f32(cV, wcV), sV, __arm_x86_neg_f32(wsV));
+      sV = __arm_x86_fma_f32(__arm_x86_mul_f32(sV, wcV), cV, wsV);
+      cV = tV;
+    }
+
+    phase += cnt * phaseInc;
+    pSin += cnt;
+    pCos += cnt;
+    blockSize -= cnt;
+  }
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+
+  float32_t s1, c1, s2, c2, s3, c3;
+
+  arm_nco_sincos_f32(4U * phaseInc, &ws, &wc);
+
+  /* Loop unrolling: Rotate 4 independent phasors, one sample apart */
+  while (blockSize >= 4U)
+  {
+    cnt = (blockSize < 4U * ARM_NCO_STEPS) ? (blockSize & ~3U) : (4U * ARM_NCO_STEPS);
+
+    arm_nco_sincos_f32(phase, &s, &c);
+    arm_nco_sincos_f32(phase + phaseInc, &s1, &c1);
+    arm_nco_sincos_f32(phase + 2U * phaseInc, &s2, &c2);
+    arm_nco_sincos_f32(phase + 3U * phaseInc, &s3, &c3);
+
+    for (n = 0U; n < cnt; n += 4U)
+    {
+      pSin[n] = s;
+      pCos[n] = c;
+      pSin[n + 1U] = s1;
+      pCos[n + 1U] = c1;
+      pSin[n + 2U] = s2;
+      pCos[n + 2U] = c2;
+      pSin[n + 3U] = s3;
+      pCos[n + 3U] = c3;
+
+      t = c * wc - s * ws;
+      s = s * wc + c * ws;
+      c = t;
+      t = c1 * wc - s1 * ws;
+      s1 = s1 * wc + c1 * ws;
+      c1 = t;
+      t = c2 * wc - s2 * ws;
+      s2 = s2 * wc + c2 * ws;
+      c2 = t;
+      t = c3 * wc - s3 * ws;
+      s3 = s3 * wc + c3 * ws;
+      c3 = t;
+    }
+
+    phase += cnt * phaseInc;
+    pSin += cnt;
+    pCos += cnt;
+    blockSize -= cnt;
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  arm_nco_sincos_f32(phaseInc, &ws, &wc);
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_NCO_STEPS) ? blockSize : ARM_NCO_STEPS;
+
+    arm_nco_sincos_f32(phase, &s, &c);
+
+    for (n = 0U; n < cnt; n++)
+    {
+      pSin[n] = s;
+      pCos[n] = c;
+
+      t = c * wc - s * ws;
+      s = s * wc + c * ws;
+      c = t;
+    }
+
+    phase += cnt * phaseInc;
+    pSin += cnt;
+    pCos += cnt;
+    blockSize -= cnt;
+  }
+
+  S->phase = phase;
+}
+
+#undef ARM_NCO_STEPS
+#undef ARM_NCO_TURN
+#undef ARM_NCO_S0
+#undef ARM_NCO_S1
+#undef ARM_NCO_S2
+#undef ARM_NCO_C0
+#undef ARM_NCO_C1
+#undef ARM_NCO_C2
+
+/**
+  @} end of NCO group
+ */
@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_nco_init_f32.c
+ * Description:  Floating-point numerically controlled oscillator initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup NCO
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point numerically controlled oscillator.
+  @param[in,out] S          points to an instance of the floating-point NCO structure
+  @param[in]     freq       frequency, as a fraction of the sampling frequency
+  @param[in]     phase      phase of the first sample, in radians
+  @return        none
+
+  @par           Details
+                   The frequency is rounded to a multiple of <code>2^-32</code> of the sampling frequency, in
+                   <code>phaseInc</code>. Negative frequencies, or frequencies above one half, give the same samples
+                   as their aliases between 0 and 1.
+ */
+
+void arm_nco_init_f32(
+  arm_nco_instance_f32 * S,
+  float32_t freq,
+  float32_t phase)
+{
+  float64_t f;
+
+  /* Fractions of a turn, rounded to 32 bits modulo one turn */
+  f = (float64_t) freq;
+  f = f - floor(f);
+  S->phaseInc = (uint32_t) (uint64_t) (f * 4294967296.0 + 0.5);
+
+  f = (float64_t) phase / 6.283185307179586476925;
+  f = f - floor(f);
+  S->phase = (uint32_t) (uint64_t) (f * 4294967296.0 + 0.5);
+}
+
+/**
+  @} end of NCO group
+ */
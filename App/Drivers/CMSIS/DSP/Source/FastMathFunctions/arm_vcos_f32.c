@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vcos_f32.c
+ * Description:  Floating-point vector cosine
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vsincos
+  @{
+ */
+
+#define ARM_VCOS_BLOCK 32U                       /* Samples per call of arm_vsincos_f32() */
+
+/**
+  @brief         Floating-point vector cosine.
+  @param[in]     pSrc       points to the input vector of angles in radians
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   Computed by arm_vsincos_f32() on blocks of the input, with the same accuracy.
+                   <code>pDst</code> may be equal to <code>pSrc</code>.
+ */
+
+void arm_vcos_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t pTmp[ARM_VCOS_BLOCK];                /* Unused sines */
+  uint32_t cnt;                                  /* Samples in the block */
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_VCOS_BLOCK) ? blockSize : ARM_VCOS_BLOCK;
+
+    arm_vsincos_f32(pSrc, pTmp, pDst, cnt);
+
+    pSrc += cnt;
+    pDst += cnt;
+    blockSize -= cnt;
+  }
+}
+
+#undef ARM_VCOS_BLOCK
+
+/**
+  @} end of vsincos group
+ */
@@ -0,0 +1,245 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_f32.c
+ * Description:  Floating-point vector exponential
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vexp Vector Exponential
+
+  Computes the exponential of each element of a vector.
+
+  @par           Algorithm
+                   The input is split as <code>x = n * ln(2) + r</code>, with <code>n</code> the integer nearest
+                   to <code>x / ln(2)</code> and <code>|r| <= ln(2)/2</code>, computed with <code>ln(2)</code>
+                   in two parts so that <code>r</code> is exact. Then
+  <pre>
+      exp(x) = 2^n * exp(r)
+  </pre>
+                   where <code>exp(r)</code> is a degree 7 polynomial and <code>2^n</code> is built in the exponent
+                   field of the result. Every step is a multiply-add, a comparison or an integer operation on the
+                   bits of the floats, so that the same kernel runs on the lanes of Neon and x86 SIMD vectors.
+  @par           Accuracy
+                   The maximum error is 1 ULP (unit in the last place) over the whole range.
+                   Inputs above <code>88.72283</code> give <code>+Inf</code>, and inputs below <code>-87.33654</code>,
+                   whose exponential is below the smallest normal float, give 0. NaN inputs give NaN.
+
+  The Q31 and Q15 functions take inputs in 5.26 and 4.11 formats respectively, such as the outputs
+  of arm_vlog_q31() and arm_vlog_q15(), and compute the exponential with integer arithmetic only.
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
+#define ARM_VEXP_HI     88.72283935546875f    /* Largest input with a finite output */
+#define ARM_VEXP_LO    -87.33654022216797f    /* Smallest input with a normal output */
+#define ARM_VEXP_LOG2E  1.44269504088896341f
+#define ARM_VEXP_LN2_HI 0.693359375f          /* ln(2) in two parts: 9 bits ... */
+#define ARM_VEXP_LN2_LO -2.12194440e-4f       /* ... and the remainder */
+#define ARM_VEXP_ROUND  12582912.0f           /* 1.5 * 2^23: adding it rounds to an integer in the low bits */
+#define ARM_VEXP_P0     1.9875691500e-4f
+#define ARM_VEXP_P1     1.3981999507e-3f
+#define ARM_VEXP_P2     8.3334519073e-3f
+#define ARM_VEXP_P3     4.1665795894e-2f
+#define ARM_VEXP_P4     1.6666665459e-1f
+#define ARM_VEXP_P5     5.0000001201e-1f
+
+/*
+ * 2^n is applied as 2^(n/2) * 2^(n-n/2), as n goes up to 128 at the top of the range,
+ * beyond the exponent of a float.
+ */
+__STATIC_FORCEINLINE float32_t arm_vexp_one_f32(
+  float32_t x)
+{
+  union { float32_t f; int32_t i; } t, s1, s2;
+  float32_t xc, n, r, p;
+  int32_t k, k1;
+
+  /* Comparisons which let NaN through */
+  xc = (x > ARM_VEXP_HI) ? ARM_VEXP_HI : x;
+  xc = (xc < ARM_VEXP_LO) ? ARM_VEXP_LO : xc;
+
+  /* n = round(x / ln(2)), as a float and in the low bits of t */
+  t.f = xc * ARM_VEXP_LOG2E + ARM_VEXP_ROUND;
+  n = t.f - ARM_VEXP_ROUND;
+  k = t.i - 0x4B400000;
+
+  r = xc - n * ARM_VEXP_LN2_HI;
+  r = r - n * ARM_VEXP_LN2_LO;
+
+  p = ((((ARM_VEXP_P0 * r + ARM_VEXP_P1) * r + ARM_VEXP_P2) * r + ARM_VEXP_P3) * r + ARM_VEXP_P4) * r + ARM_VEXP_P5;
+  p = p * (r * r) + r + 1.0f;
+
+  k1 = k >> 1;
+  s1.i = (int32_t) ((uint32_t) (k1 + 127) << 23);
+  s2.i = (int32_t) ((uint32_t) (k - k1 + 127) << 23);
+  p = (p * s1.f) * s2.f;
+
+  p = (x > ARM_VEXP_HI) ? INFINITY : p;
+  p = (x < ARM_VEXP_LO) ? 0.0f : p;
+
+  return (p);
+}
+
+/**
+  @brief         Floating-point vector exponential.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void arm_vexp_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t xV, xcV, tV, nV, rV, pV;
+  int32x4_t kV, k1V;
+
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vld1q_f32(pSrc);
+
+    xcV = vmaxq_f32(vminq_f32(xV, vdupq_n_f32(ARM_VEXP_HI)), vdupq_n_f32(ARM_VEXP_LO));
+
+    tV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_ROUND), xcV, vdupq_n_f32(ARM_VEXP_LOG2E));
+    nV = vsubq_f32(tV, vdupq_n_f32(ARM_VEXP_ROUND));
+    kV = vsubq_s32(vreinterpretq_s32_f32(tV), vdupq_n_s32(0x4B400000));
+
+    rV = vmlsq_f32(xcV, nV, vdupq_n_f32(ARM_VEXP_LN2_HI));
+    rV = vmlsq_f32(rV, nV, vdupq_n_f32(ARM_VEXP_LN2_LO));
+
+    pV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P1), vdupq_n_f32(ARM_VEXP_P0), rV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P2), pV, rV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P3), pV, rV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P4), pV, rV);
+    pV = vmlaq_f32(vdupq_n_f32(ARM_VEXP_P5), pV, rV);
+    pV = vmlaq_f32(vaddq_f32(rV, vdupq_n_f32(1.0f)), pV, vmulq_f32(rV, rV));
+
+    k1V = vshrq_n_s32(kV, 1);
+    pV = vmulq_f32(pV, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(k1V, vdupq_n_s32(127)), 23)));
+    pV = vmulq_f32(pV, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vsubq_s32(kV, k1V), vdupq_n_s32(127)), 23)));
+
+    pV = vbslq_f32(vcgtq_f32(xV, vdupq_n_f32(ARM_VEXP_HI)), vdupq_n_f32(INFINITY), pV);
+    pV = vbslq_f32(vcltq_f32(xV, vdupq_n_f32(ARM_VEXP_LO)), vdupq_n_f32(0.0f), pV);
+
+    vst1q_f32(pDst, pV);
+
+    pSrc += 4;
+    pDst += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t xV, xcV, tV, nV, rV, pV;
+  arm_x86_s32_t kV, k1V;
+
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    xV = __arm_x86_ld_f32(pSrc);
+
+    /* min and max return their second operand when one is NaN */
+    xcV = __arm_x86_max_f32(__arm_x86_dup_f32(ARM_VEXP_LO), __arm_x86_min_f32(__arm_x86_dup_f32(ARM_VEXP_HI), xV));
+
+    tV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_ROUND), xcV, __arm_x86_dup_f32(ARM_VEXP_LOG2E));
+    nV = __arm_x86_sub_f32(tV, __arm_x86_dup_f32(ARM_VEXP_ROUND));
+    kV = __arm_x86_sub_s32(__arm_x86_as_s32_f32(tV), __arm_x86_dup_s32(0x4B400000));
+
+    rV = __arm_x86_fma_f32(xcV, nV, __arm_x86_dup_f32(-ARM_VEXP_LN2_HI));
+    rV = __arm_x86_fma_f32(rV, nV, __arm_x86_dup_f32(-ARM_VEXP_LN2_LO));
+
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_P1), __arm_x86_dup_f32(ARM_VEXP_P0), rV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_P2), pV, rV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_P3), pV, rV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_P4), pV, rV);
+    pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VEXP_P5), pV, rV);
+    pV = __arm_x86_fma_f32(__arm_x86_add_f32(rV, __arm_x86_dup_f32(1.0f)), pV, __arm_x86_mul_f32(rV, rV));
+
+    k1V = __ARM_X86_SRAI_S32(kV, 1);
+    pV = __arm_x86_mul_f32(pV, __arm_x86_as_f32_s32(__ARM_X86_SLLI_S32(__arm_x86_add_s32(k1V, __arm_x86_dup_s32(127)), 23)));
+    pV = __arm_x86_mul_f32(pV, __arm_x86_as_f32_s32(__ARM_X86_SLLI_S32(__arm_x86_add_s32(__arm_x86_sub_s32(kV, k1V), __arm_x86_dup_s32(127)), 23)));
+
+    pV = __arm_x86_select_f32(__arm_x86_cmplt_f32(__arm_x86_dup_f32(ARM_VEXP_HI), xV), __arm_x86_dup_f32(INFINITY), pV);
+    pV = __arm_x86_select_f32(__arm_x86_cmplt_f32(xV, __arm_x86_dup_f32(ARM_VEXP_LO)), __arm_x86_dup_f32(0.0f), pV);
+
+    __arm_x86_st_f32(pDst, pV);
+
+    pSrc += ARM_X86_F32_LANES;
+    pDst += ARM_X86_F32_LANES;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_vexp_one_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_VEXP_HI
+#undef ARM_VEXP_LO
+#undef ARM_VEXP_LOG2E
+#undef ARM_VEXP_LN2_HI
+#undef ARM_VEXP_LN2_LO
+#undef ARM_VEXP_ROUND
+#undef ARM_VEXP_P0
+#undef ARM_VEXP_P1
+#undef ARM_VEXP_P2
+#undef ARM_VEXP_P3
+#undef ARM_VEXP_P4
+#undef ARM_VEXP_P5
+
+/**
+  @} end of vexp group
+ */
@@ -0,0 +1,89 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_q15.c
+ * Description:  Q15 vector exponential
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
+#define ARM_VEXP_BLOCK 32U                       /* Exponentials computed per call of arm_vexp_q31() */
+
+/**
+  @brief         Q15 vector exponential.
+  @param[in]     pSrc       points to the input vector in 4.11 format
+  @param[out]    pDst       points to the output vector in 1.15 format
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The exponentials are computed by arm_vexp_q31() on blocks of the input, and rounded to
+                   1.15 format. The output is within 1/2 LSB of the exact exponential for negative inputs.
+                   Inputs which are zero or positive saturate to <code>0x7FFF</code>.
+ */
+
+void arm_vexp_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  q31_t pExp[ARM_VEXP_BLOCK];                    /* Inputs in 5.26 format, then exponentials */
+  uint32_t cnt, i;                               /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_VEXP_BLOCK) ? blockSize : ARM_VEXP_BLOCK;
+
+    for (i = 0U; i < cnt; i++)
+    {
+      pExp[i] = (q31_t) pSrc[i] << 15;
+    }
+
+    arm_vexp_q31(pExp, pExp, cnt);
+
+    for (i = 0U; i < cnt; i++)
+    {
+      pDst[i] = (q15_t) __SSAT((q31_t) (((q63_t) pExp[i] + 0x8000) >> 16), 16);
+    }
+
+    pSrc += cnt;
+    pDst += cnt;
+    blockSize -= cnt;
+  }
+}
+
+#undef ARM_VEXP_BLOCK
+
+/**
+  @} end of vexp group
+ */
@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vexp_q31.c
+ * Description:  Q31 vector exponential
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vexp
+  @{
+ */
+
+/* 2^(i/32) for the 32 intervals of [0, 1), in 1.31 format as unsigned values in [1, 2) */
+static const uint32_t arm_vexp_table_q31[32] = {
+  0x80000000, 0x82CD8699, 0x85AAC368, 0x88980E81,
+  0x8B95C1E4, 0x8EA4398B, 0x91C3D374, 0x94F4EFA9,
+  0x9837F052, 0x9B8D39BA, 0x9EF53261, 0xA2704303,
+  0xA5FED6AA, 0xA9A15AB5, 0xAD583EEA, 0xB123F582,
+  0xB504F334, 0xB8FBAF47, 0xBD08A39F, 0xC12C4CCA,
+  0xC5672A11, 0xC9B9BD86, 0xCE248C15, 0xD2A81D92,
+  0xD744FCCB, 0xDBFBB798, 0xE0CCDEEC, 0xE5B906E7,
+  0xEAC0C6E8, 0xEFE4B99C, 0xF5257D15, 0xFA83B2DB
+};
+
+#define ARM_VEXP_LOG2E_HI 0x5C551D94LL        /* log2(e) in 2.62 format: upper 32 bits ... */
+#define ARM_VEXP_LOG2E_LO 0xAE0BF800LL        /* ... and lower 32 bits */
+#define ARM_VEXP_LN2_Q32  0xB17217F8ULL       /* ln(2) in 0.32 format */
+
+/**
+  @brief         Q31 vector exponential.
+  @param[in]     pSrc       points to the input vector in 5.26 format
+  @param[out]    pDst       points to the output vector in 1.31 format
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The input is converted to <code>y = x * log2(e)</code>, split into its integer part
+                   <code>k</code>, the interval <code>i</code> of its fraction among 32 and the remainder
+                   <code>g</code> below <code>1/32</code>, and
+  <pre>
+      exp(x) = 2^k * 2^(i/32) * exp(g * ln(2))
+  </pre>
+                   where <code>exp(g * ln(2))</code> is a degree 4 series. All the steps use integer arithmetic,
+                   with 64-bit products.
+  @par
+                   The output is within 3 LSB of the exact exponential for negative inputs. Inputs which are zero
+                   or positive, whose exponential is not below 1, saturate to <code>0x7FFFFFFF</code>.
+ */
+
+void arm_vexp_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  q31_t x;                                       /* Input */
+  q63_t y;                                       /* x * log2(e) in 32.32 format */
+  uint64_t t, t2, t3, t4, e;                     /* Powers of g * ln(2), and its exponential, in 0.32 and 1.31 formats */
+  uint32_t f, g, i, shift;                       /* Fraction of y, remainder, interval and output shift */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    if (x >= 0)
+    {
+      *pDst++ = 0x7FFFFFFF;
+    }
+    else
+    {
+      /* y = x * log2(e), from 5.26 x 2.62 to 32.32 format */
+      y = ((q63_t) x * ARM_VEXP_LOG2E_HI + (((q63_t) x * ARM_VEXP_LOG2E_LO) >> 32)) >> 24;
+
+      /* y = k + (i + g) / 32 with k <= -1 */
+      shift = (uint32_t) (31 - (int32_t) (y >> 32));
+      f = (uint32_t) y;
+      i = f >> 27U;
+      g = f & 0x07FFFFFFU;
+
+      /* exp(t) = 1 + t + t^2/2 + t^3/6 + t^4/24, with t = g * ln(2) below 1/46 */
+      t = ((uint64_t) g * ARM_VEXP_LN2_Q32) >> 32;
+      t2 = (t * t) >> 32;
+      t3 = (t2 * t) >> 32;
+      t4 = (t2 * t2) >> 32;
+      e = 0x80000000ULL + ((t + (t2 >> 1) + t3 / 6U + t4 / 24U + 1U) >> 1);
+
+      /* 2^k * 2^(i/32) * exp(t), from 2.62 to 1.31 format */
+      if (shift >= 64U)
+      {
+        *pDst++ = 0;
+      }
+      else
+      {
+        e = ((e * arm_vexp_table_q31[i]) + ((1ULL << shift) >> 1)) >> shift;
+        *pDst++ = (e > 0x7FFFFFFFULL) ? 0x7FFFFFFF : (q31_t) e;
+      }
+    }
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_VEXP_LOG2E_HI
+#undef ARM_VEXP_LOG2E_LO
+#undef ARM_VEXP_LN2_Q32
+
+/**
+  @} end of vexp group
+ */
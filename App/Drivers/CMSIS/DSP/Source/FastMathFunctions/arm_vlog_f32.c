@@ -0,0 +1,274 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_f32.c
+ * Description:  Floating-point vector natural logarithm
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vlog Vector Logarithm
+
+  Computes the natural logarithm of each element of a vector.
+
+  @par           Algorithm
+                   The input is split from its bits as <code>x = 2^e * m</code>, with the mantissa <code>m</code>
+                   in <code>[sqrt(2)/2, sqrt(2))</code>. Then
+  <pre>
+      log(x) = e * ln(2) + log(1 + f)      with f = m - 1
+  </pre>
+                   where <code>log(1 + f)</code> is <code>f - f^2/2</code> plus a degree 11 polynomial, and
+                   <code>e * ln(2)</code> is added in two parts. Subnormal inputs are scaled by <code>2^23</code> first.
+                   The same kernel runs on the lanes of Neon and x86 SIMD vectors. As Armv7 Neon flushes
+                   subnormals to zero, the Neon kernel instead converts their bits, <code>x * 2^149</code>, to a
+                   float, and tests the inputs for zero and for their sign on the bits.
+  @par           Accuracy
+                   The maximum error is 1 ULP (unit in the last place) for all positive inputs.
+                   0 gives <code>-Inf</code>, <code>+Inf</code> gives <code>+Inf</code>, and negative inputs and NaN give NaN.
+
+  The Q31 and Q15 functions take inputs in <code>(0, 1)</code> and compute the logarithm with integer
+  arithmetic only, in 5.26 and 4.11 formats respectively.
+ */
+
+/**
+  @addtogroup vlog
+  @{
+ */
+
+#define ARM_VLOG_SQRTHF   0.707106781186547524f
+#define ARM_VLOG_LN2_HI   0.693359375f          /* ln(2) in two parts: 9 bits ... */
+#define ARM_VLOG_LN2_LO  -2.12194440e-4f        /* ... and the remainder */
+#define ARM_VLOG_P0       7.0376836292e-2f
+#define ARM_VLOG_P1      -1.1514610310e-1f
+#define ARM_VLOG_P2       1.1676998740e-1f
+#define ARM_VLOG_P3      -1.2420140846e-1f
+#define ARM_VLOG_P4       1.4249322787e-1f
+#define ARM_VLOG_P5      -1.6668057665e-1f
+#define ARM_VLOG_P6       2.0000714765e-1f
+#define ARM_VLOG_P7      -2.4999993993e-1f
+#define ARM_VLOG_P8       3.3333331174e-1f
+
+__STATIC_FORCEINLINE float32_t arm_vlog_one_f32(
+  float32_t x)
+{
+  union { float32_t f; int32_t i; } u;
+  float32_t e, f, z, y;
+
+  if (!(x > 0.0f) || (x == INFINITY))
+  {
+    /* 0, negative, infinite and NaN inputs */
+    return ((x == 0.0f) ? -INFINITY : ((x > 0.0f) ? x : NAN));
+  }
+
+  /* Exponent and mantissa in [0.5, 1), of the input scaled to a normal float */
+  e = -126.0f;
+  if (x < FLT_MIN)
+  {
+    x = x * 8388608.0f;
+    e = -149.0f;
+  }
+
+  u.f = x;
+  e = e + (float32_t) (u.i >> 23);
+  u.i = (u.i & 0x007FFFFF) | 0x3F000000;
+
+  /* Mantissa brought to [sqrt(2)/2, sqrt(2)) */
+  if (u.f < ARM_VLOG_SQRTHF)
+  {
+    e = e - 1.0f;
+    f = u.f + u.f - 1.0f;
+  }
+  else
+  {
+    f = u.f - 1.0f;
+  }
+
+  z = f * f;
+  y = ((((((((ARM_VLOG_P0 * f + ARM_VLOG_P1) * f + ARM_VLOG_P2) * f + ARM_VLOG_P3) * f + ARM_VLOG_P4) * f
+          + ARM_VLOG_P5) * f + ARM_VLOG_P6) * f + ARM_VLOG_P7) * f + ARM_VLOG_P8) * f * z;
+
+  y = y + e * ARM_VLOG_LN2_LO;
+  y = y - 0.5f * z;
+
+  return ((f + y) + e * ARM_VLOG_LN2_HI);
+}
+
+/**
+  @brief         Floating-point vector natural logarithm.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+ */
+
+void arm_vlog_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t xV, mV, eV, fV, zV, yV;
+  uint32x4_t subV, lowV;
+  int32x4_t bV, iV;
+
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vld1q_f32(pSrc);
+    bV = vreinterpretq_s32_f32(xV);
+
+    /* Subnormals scaled by 2^149, from their bits */
+    subV = vcltq_s32(bV, vdupq_n_s32(0x00800000));
+    mV = vbslq_f32(subV, vcvtq_f32_s32(bV), xV);
+    eV = vbslq_f32(subV, vdupq_n_f32(-275.0f), vdupq_n_f32(-126.0f));
+
+    iV = vreinterpretq_s32_f32(mV);
+    eV = vaddq_f32(eV, vcvtq_f32_s32(vshrq_n_s32(iV, 23)));
+    mV = vreinterpretq_f32_s32(vorrq_s32(vandq_s32(iV, vdupq_n_s32(0x007FFFFF)), vdupq_n_s32(0x3F000000)));
+
+    lowV = vcltq_f32(mV, vdupq_n_f32(ARM_VLOG_SQRTHF));
+    eV = vsubq_f32(eV, vreinterpretq_f32_u32(vandq_u32(lowV, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+    fV = vaddq_f32(vsubq_f32(mV, vdupq_n_f32(1.0f)), vreinterpretq_f32_u32(vandq_u32(lowV, vreinterpretq_u32_f32(mV))));
+
+    zV = vmulq_f32(fV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P1), vdupq_n_f32(ARM_VLOG_P0), fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P2), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P3), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P4), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P5), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P6), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P7), yV, fV);
+    yV = vmlaq_f32(vdupq_n_f32(ARM_VLOG_P8), yV, fV);
+    yV = vmulq_f32(vmulq_f32(yV, fV), zV);
+
+    yV = vmlaq_f32(yV, eV, vdupq_n_f32(ARM_VLOG_LN2_LO));
+    yV = vmlsq_f32(yV, zV, vdupq_n_f32(0.5f));
+    yV = vmlaq_f32(vaddq_f32(fV, yV), eV, vdupq_n_f32(ARM_VLOG_LN2_HI));
+
+    /* +Inf, negative and NaN inputs, then 0 of either sign */
+    yV = vbslq_f32(vceqq_f32(xV, vdupq_n_f32(INFINITY)), xV, yV);
+    yV = vbslq_f32(vorrq_u32(vcltq_s32(bV, vdupq_n_s32(0)), vmvnq_u32(vceqq_f32(xV, xV))), vdupq_n_f32(NAN), yV);
+    yV = vbslq_f32(vceqq_s32(vshlq_n_s32(bV, 1), vdupq_n_s32(0)), vdupq_n_f32(-INFINITY), yV);
+
+    vst1q_f32(pDst, yV);
+
+    pSrc += 4;
+    pDst += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t xV, mV, eV, fV, zV, yV, subV, lowV;
+  arm_x86_s32_t iV;
+
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    xV = __arm_x86_ld_f32(pSrc);
+
+    /* Subnormals scaled by 2^23 */
+    subV = __arm_x86_cmplt_f32(xV, __arm_x86_dup_f32(FLT_MIN));
+    mV = __arm_x86_select_f32(subV, __arm_x86_mul_f32(xV, __arm_x86_dup_f32(8388608.0f)), xV);
+    eV = __arm_x86_select_f32(subV, __arm_x86_dup_f32(-149.0f), __arm_x86_dup_f32(-126.0f));
+
+    iV = __arm_x86_as_s32_f32(mV);
+    eV = __arm_x86_add_f32(eV, __arm_x86_cvt_f32_s32(__ARM_X86_SRAI_S32(iV, 23)));
+    mV = __arm_x86_as_f32_s32(__arm_x86_or_s32(__arm_x86_and_s32(iV, __arm_x86_dup_s32(0x007FFFFF)), __arm_x86_dup_s32(0x3F000000)));
+
+    lowV = __arm_x86_cmplt_f32(mV, __arm_x86_dup_f32(ARM_VLOG_SQRTHF));
+    eV = __arm_x86_sub_f32(eV, __arm_x86_and_f32(lowV, __arm_x86_dup_f32(1.0f)));
+    fV = __arm_x86_add_f32(__arm_x86_sub_f32(mV, __arm_x86_dup_f32(1.0f)), __arm_x86_and_f32(lowV, mV));
+
+    zV = __arm_x86_mul_f32(fV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P1), __arm_x86_dup_f32(ARM_VLOG_P0), fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P2), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P3), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P4), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P5), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P6), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P7), yV, fV);
+    yV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VLOG_P8), yV, fV);
+    yV = __arm_x86_mul_f32(__arm_x86_mul_f32(yV, fV), zV);
+
+    yV = __arm_x86_fma_f32(yV, eV, __arm_x86_dup_f32(ARM_VLOG_LN2_LO));
+    yV = __arm_x86_fma_f32(yV, zV, __arm_x86_dup_f32(-0.5f));
+    yV = __arm_x86_fma_f32(__arm_x86_add_f32(fV, yV), eV, __arm_x86_dup_f32(ARM_VLOG_LN2_HI));
+
+    /* +Inf, 0, then negative and NaN inputs */
+    yV = __arm_x86_select_f32(__arm_x86_cmpeq_f32(xV, __arm_x86_dup_f32(INFINITY)), xV, yV);
+    yV = __arm_x86_select_f32(__arm_x86_cmpeq_f32(xV, __arm_x86_dup_f32(0.0f)), __arm_x86_dup_f32(-INFINITY), yV);
+    yV = __arm_x86_select_f32(__arm_x86_cmpnge_f32(xV, __arm_x86_dup_f32(0.0f)), __arm_x86_dup_f32(NAN), yV);
+
+    __arm_x86_st_f32(pDst, yV);
+
+    pSrc += ARM_X86_F32_LANES;
+    pDst += ARM_X86_F32_LANES;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    *pDst++ = arm_vlog_one_f32(*pSrc++);
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_VLOG_SQRTHF
+#undef ARM_VLOG_LN2_HI
+#undef ARM_VLOG_LN2_LO
+#undef ARM_VLOG_P0
+#undef ARM_VLOG_P1
+#undef ARM_VLOG_P2
+#undef ARM_VLOG_P3
+#undef ARM_VLOG_P4
+#undef ARM_VLOG_P5
+#undef ARM_VLOG_P6
+#undef ARM_VLOG_P7
+#undef ARM_VLOG_P8
+
+/**
+  @} end of vlog group
+ */
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q15.c
+ * Description:  Q15 vector natural logarithm
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vlog
+  @{
+ */
+
+#define ARM_VLOG_BLOCK 32U                       /* Logarithms computed per call of arm_vlog_q31() */
+
+/**
+  @brief         Q15 vector natural logarithm.
+  @param[in]     pSrc       points to the input vector in 1.15 format
+  @param[out]    pDst       points to the output vector in 4.11 format
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The logarithms are computed by arm_vlog_q31() on blocks of the input, and rounded to
+                   4.11 format. The output is within 1/2 LSB of the exact logarithm for inputs in <code>(0, 1)</code>,
+                   whose logarithms are in <code>[-10.4, 0)</code>. Inputs which are zero or negative give
+                   <code>0x8000</code>, the most negative 4.11 value.
+ */
+
+void arm_vlog_q15(
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+  q31_t pLog[ARM_VLOG_BLOCK];                    /* Inputs, then logarithms in 5.26 format */
+  uint32_t cnt, i;                               /* Loop counters */
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_VLOG_BLOCK) ? blockSize : ARM_VLOG_BLOCK;
+
+    for (i = 0U; i < cnt; i++)
+    {
+      pLog[i] = (q31_t) pSrc[i] << 16;
+    }
+
+    arm_vlog_q31(pLog, pLog, cnt);
+
+    for (i = 0U; i < cnt; i++)
+    {
+      pDst[i] = (pSrc[i] > 0) ? (q15_t) ((pLog[i] + (1 << 14)) >> 15) : (q15_t) 0x8000;
+    }
+
+    pSrc += cnt;
+    pDst += cnt;
+    blockSize -= cnt;
+  }
+}
+
+#undef ARM_VLOG_BLOCK
+
+/**
+  @} end of vlog group
+ */
@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vlog_q31.c
+ * Description:  Q31 vector natural logarithm
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup vlog
+  @{
+ */
+
+/* Reciprocals 1/c of the centres c = 1 + (i + 0.5)/32 of the 32 intervals of [1, 2), in 1.31 format */
+static const q31_t arm_vlog_recip_q31[32] = {
+  0x7E07E07E, 0x7A44C6B0, 0x76B981DB, 0x73615A24,
+  0x70381C0E, 0x6D3A06D4, 0x6A63BD82, 0x67B23A54,
+  0x6522C3F3, 0x62B2E43E, 0x60606060, 0x5E293206,
+  0x5C0B8170, 0x5A05A05A, 0x58160581, 0x563B48C2,
+  0x54741FAC, 0x52BF5A81, 0x511BE196, 0x4F88B2F4,
+  0x4E04E04E, 0x4C8F8D29, 0x4B27ED36, 0x49CD42E2,
+  0x487EDE05, 0x473C1AB7, 0x46046046, 0x44D72045,
+  0x43B3D5B0, 0x429A042A, 0x4189374C, 0x40810204
+};
+
+/* -log of the rounded reciprocals above, in 1.31 format */
+static const q31_t arm_vlog_table_q31[32] = {
+  0x01FC0A8B, 0x05DD163D, 0x09A0EBCB, 0x0D49369D,
+  0x10D77E7D, 0x144D2B6C, 0x17AB8902, 0x1AF3C94F,
+  0x1E27076F, 0x214649C4, 0x245283F8, 0x274C98AB,
+  0x2A355B0F, 0x2D0D903D, 0x2FD5F078, 0x328F2838,
+  0x3539D935, 0x37D69B3C, 0x3A65FCFB, 0x3CE884C3,
+  0x3F5EB11F, 0x41C8F970, 0x4427CE79, 0x467B9AD2,
+  0x48C4C35E, 0x4B03A7B4, 0x4D38A276, 0x4F6409A9,
+  0x51862F08, 0x539F6046, 0x55AFE756, 0x57B80AA5
+};
+
+#define ARM_VLOG_LN2_Q40  762123384786LL      /* ln(2) in 24.40 format */
+#define ARM_VLOG_THIRD    0x2AAAAAAB          /* 1/3 in 1.31 format */
+
+/**
+  @brief         Q31 vector natural logarithm.
+  @param[in]     pSrc       points to the input vector in 1.31 format
+  @param[out]    pDst       points to the output vector in 5.26 format
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   The input is normalized to <code>2^-n * (1 + u)</code> with <code>u</code> in <code>[0, 1)</code>.
+                   The 5 upper bits of <code>u</code> select the closest of 32 centres <code>c</code>, and
+  <pre>
+      log(x) = log((1 + u) / c) + log(c) - n * ln(2)
+  </pre>
+                   where <code>(1 + u) / c</code> is within <code>1/64</code> of 1 and its logarithm is a degree 4
+                   series. All the steps use integer arithmetic, with 64-bit products.
+  @par
+                   The output is within 1 LSB of the exact logarithm for inputs in <code>(0, 1)</code>, whose
+                   logarithms are in <code>[-21.5, 0)</code>. Inputs which are zero or negative give
+                   <code>0x80000000</code>, the most negative 5.26 value.
+ */
+
+void arm_vlog_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+  q31_t x;                                       /* Input */
+  q31_t v, v2, v3, v4;                           /* Powers of the offset from 1 */
+  q63_t acc;                                     /* Logarithm in 1.31 format */
+  uint32_t n, u, i;                              /* Normalization shift, mantissa and interval */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  blkCnt = blockSize;
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    if (x <= 0)
+    {
+      *pDst++ = (q31_t) 0x80000000;
+    }
+    else
+    {
+      /* x = 2^-n * (1 + u), with u in 0.32 format */
+      n = __CLZ((uint32_t) x);
+      u = (uint32_t) x << n;
+      u = u << 1U;
+      i = u >> 27U;
+
+      /* v = (1 + u) / c - 1 in 1.31 format */
+      v = (q31_t) ((((q63_t) ((u >> 1U) | 0x80000000U) * arm_vlog_recip_q31[i]) >> 31) - 0x80000000LL);
+
+      /* log(1 + v) = v - v^2/2 + v^3/3 - v^4/4 */
+      v2 = (q31_t) (((q63_t) v * v) >> 31);
+      v3 = (q31_t) (((q63_t) v2 * v) >> 31);
+      v4 = (q31_t) (((q63_t) v2 * v2) >> 31);
+      acc = (q63_t) v - (v2 >> 1) + (((q63_t) v3 * ARM_VLOG_THIRD) >> 31) - (v4 >> 2);
+
+      acc += arm_vlog_table_q31[i];
+      acc -= ((q63_t) n * ARM_VLOG_LN2_Q40 + 256) >> 9;
+
+      /* Rounded to 5.26 format */
+      *pDst++ = (q31_t) ((acc + 16) >> 5);
+    }
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_VLOG_LN2_Q40
+#undef ARM_VLOG_THIRD
+
+/**
+  @} end of vlog group
+ */
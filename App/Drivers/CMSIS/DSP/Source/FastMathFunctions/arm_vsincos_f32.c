@@ -0,0 +1,289 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsincos_f32.c
+ * Description:  Floating-point vector sine and cosine
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vsincos Vector Sine and Cosine
+
+  Computes the sine and the cosine of each element of a vector, as used to generate or mix
+  blocks of oscillator samples.
+
+  @par           Algorithm
+                   The input is split as <code>x = n * pi/2 + r</code>, with <code>n</code> the integer nearest
+                   to <code>x * 2/pi</code> and <code>|r| <= pi/4</code>, computed with <code>pi/2</code> in three
+                   parts (Cody and Waite) so that <code>r</code> keeps its accuracy for large <code>n</code>. Then
+                   <code>sin(r)</code> is <code>r</code> plus an odd polynomial of degree 7 and <code>cos(r)</code>
+                   an even polynomial of degree 8, and the two low bits of <code>n</code> select and negate them:
+  <pre>
+      n mod 4       0          1          2          3
+      sin(x)     sin(r)     cos(r)    -sin(r)    -cos(r)
+      cos(x)     cos(r)    -sin(r)    -cos(r)     sin(r)
+  </pre>
+                   Unlike arm_sin_f32() and arm_cos_f32(), there is no table lookup, so that the same kernel
+                   runs on the lanes of Neon and x86 SIMD vectors, and on 4 independent samples at a time
+                   with loop unrolling.
+  @par           Accuracy
+                   For <code>|x| <= 8192</code>, the error is below <code>2^-23</code>, and below 2 ULP (unit in the
+                   last place) for outputs of magnitude above <code>0.5</code>. The table functions are accurate to
+                   about <code>2e-5</code>. Beyond, the error grows with the rounding of <code>n * pi/2</code>, less
+                   so with fused multiply-adds. Infinite and NaN inputs give NaN.
+ */
+
+/**
+  @addtogroup vsincos
+  @{
+ */
+
+#define ARM_VSINCOS_2_PI   0.636619772367581343f /* 2/pi */
+#define ARM_VSINCOS_ROUND  12582912.0f           /* 1.5 * 2^23: adding it rounds to an integer in the low bits */
+#define ARM_VSINCOS_DP1    1.5703125f            /* pi/2 in three parts: 8 bits ... */
+#define ARM_VSINCOS_DP2    4.837512969970703125e-4f
+#define ARM_VSINCOS_DP3    7.54978995489188216e-8f
+#define ARM_VSINCOS_S0    -1.9515295891e-4f
+#define ARM_VSINCOS_S1     8.3321608736e-3f
+#define ARM_VSINCOS_S2    -1.6666654611e-1f
+#define ARM_VSINCOS_C0     2.443315711809948e-5f
+#define ARM_VSINCOS_C1    -1.388731625493765e-3f
+#define ARM_VSINCOS_C2     4.166664568298827e-2f
+
+/*
+ * The selection and the signs only use integer operations on the bits of the results,
+ * so that unrolled calls do not depend on branches.
+ */
+__STATIC_FORCEINLINE void arm_vsincos_one_f32(
+  float32_t x,
+  float32_t * pSin,
+  float32_t * pCos)
+{
+  union { float32_t f; uint32_t u; } t, s, c;
+  float32_t n, r, z, sp, cp;
+  uint32_t swap;
+
+  /* n = round(x * 2/pi), as a float and in the low bits of t */
+  t.f = x * ARM_VSINCOS_2_PI + ARM_VSINCOS_ROUND;
+  n = t.f - ARM_VSINCOS_ROUND;
+
+  r = x - n * ARM_VSINCOS_DP1;
+  r = r - n * ARM_VSINCOS_DP2;
+  r = r - n * ARM_VSINCOS_DP3;
+
+  z = r * r;
+  sp = ((ARM_VSINCOS_S0 * z + ARM_VSINCOS_S1) * z + ARM_VSINCOS_S2) * z;
+  sp = sp * r + r;
+  cp = ((ARM_VSINCOS_C0 * z + ARM_VSINCOS_C1) * z + ARM_VSINCOS_C2) * (z * z);
+  cp = cp - 0.5f * z + 1.0f;
+
+  /* Swap in odd quadrants, then negate */
+  s.f = sp;
+  c.f = cp;
+  swap = (s.u ^ c.u) & (0U - (t.u & 1U));
+  s.u ^= swap;
+  c.u ^= swap;
+  s.u ^= (t.u << 30) & 0x80000000U;
+  c.u ^= ((t.u + 1U) << 30) & 0x80000000U;
+
+  *pSin = s.f;
+  *pCos = c.f;
+}
+
+/**
+  @brief         Floating-point vector sine and cosine.
+  @param[in]     pSrc       points to the input vector of angles in radians
+  @param[out]    pSin       points to the output vector of sines
+  @param[out]    pCos       points to the output vector of cosines
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   <code>pSin</code> or <code>pCos</code> may be equal to <code>pSrc</code>.
+ */
+
+void arm_vsincos_f32(
+  const float32_t * pSrc,
+        float32_t * pSin,
+        float32_t * pCos,
+        uint32_t blockSize)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t xV, tV, nV, rV, zV, sV, cV, spV, cpV;
+  uint32x4_t qV, swapV;
+
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vld1q_f32(pSrc);
+
+    tV = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_ROUND), xV, vdupq_n_f32(ARM_VSINCOS_2_PI));
+    nV = vsubq_f32(tV, vdupq_n_f32(ARM_VSINCOS_ROUND));
+    qV = vreinterpretq_u32_f32(tV);
+
+    rV = vmlsq_f32(xV, nV, vdupq_n_f32(ARM_VSINCOS_DP1));
+    rV = vmlsq_f32(rV, nV, vdupq_n_f32(ARM_VSINCOS_DP2));
+    rV = vmlsq_f32(rV, nV, vdupq_n_f32(ARM_VSINCOS_DP3));
+
+    zV = vmulq_f32(rV, rV);
+    spV = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_S1), vdupq_n_f32(ARM_VSINCOS_S0), zV);
+    spV = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_S2), spV, zV);
+    spV = vmlaq_f32(rV, vmulq_f32(spV, zV), rV);
+    cpV = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_C1), vdupq_n_f32(ARM_VSINCOS_C0), zV);
+    cpV = vmlaq_f32(vdupq_n_f32(ARM_VSINCOS_C2), cpV, zV);
+    cpV = vmlaq_f32(vmlsq_f32(vdupq_n_f32(1.0f), zV, vdupq_n_f32(0.5f)), cpV, vmulq_f32(zV, zV));
+
+    /* Swap in odd quadrants, then negate */
+    swapV = vtstq_u32(qV, vdupq_n_u32(1U));
+    sV = vbslq_f32(swapV, cpV, spV);
+    cV = vbslq_f32(swapV, spV, cpV);
+    sV = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(sV), vshlq_n_u32(vandq_u32(qV, vdupq_n_u32(2U)), 30)));
+    cV = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(cV),
+                                         vshlq_n_u32(vandq_u32(vaddq_u32(qV, vdupq_n_u32(1U)), vdupq_n_u32(2U)), 30)));
+
+    vst1q_f32(pSin, sV);
+    vst1q_f32(pCos, cV);
+
+    pSrc += 4;
+    pSin += 4;
+    pCos += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t xV, tV, nV, rV, zV, sV, cV, spV, cpV, swapV;
+  arm_x86_s32_t qV;
+
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    xV = __arm_x86_ld_f32(pSrc);
+
+    tV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VSINCOS_ROUND), xV, __arm_x86_dup_f32(ARM_VSINCOS_2_PI));
+    nV = __arm_x86_sub_f32(tV, __arm_x86_dup_f32(ARM_VSINCOS_ROUND));
+    qV = __arm_x86_as_s32_f32(tV);
+
+    rV = __arm_x86_fma_f32(xV, nV, __arm_x86_dup_f32(-ARM_VSINCOS_DP1));
+    rV = __arm_x86_fma_f32(rV, nV, __arm_x86_dup_f32(-ARM_VSINCOS_DP2));
+    rV = __arm_x86_fma_f32(rV, nV, __arm_x86_dup_f32(-ARM_VSINCOS_DP3));
+
+    zV = __arm_x86_mul_f32(rV, rV);
+    spV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VSINCOS_S1), __arm_x86_dup_f32(ARM_VSINCOS_S0), zV);
+    spV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VSINCOS_S2), spV, zV);
+    spV = __arm_x86_fma_f32(rV, __arm_x86_mul_f32(spV, zV), rV);
+    cpV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VSINCOS_C1), __arm_x86_dup_f32(ARM_VSINCOS_C0), zV);
+    cpV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VSINCOS_C2), cpV, zV);
+    cpV = __arm_x86_fma_f32(__arm_x86_fma_f32(__arm_x86_dup_f32(1.0f), zV, __arm_x86_dup_f32(-0.5f)),
+                            cpV, __arm_x86_mul_f32(zV, zV));
+
+    /* Swap in odd quadrants, then negate */
+    swapV = __arm_x86_as_f32_s32(__ARM_X86_SRAI_S32(__ARM_X86_SLLI_S32(qV, 31), 31));
+    sV = __arm_x86_select_f32(swapV, cpV, spV);
+    cV = __arm_x86_select_f32(swapV, spV, cpV);
+    sV = __arm_x86_xor_f32(sV, __arm_x86_as_f32_s32(__ARM_X86_SLLI_S32(__arm_x86_and_s32(qV, __arm_x86_dup_s32(2)), 30)));
+    cV = __arm_x86_xor_f32(cV, __arm_x86_as_f32_s32(__ARM_X86_SLLI_S32(
+                             __arm_x86_and_s32(__arm_x86_add_s32(qV, __arm_x86_dup_s32(1)), __arm_x86_dup_s32(2)), 30)));
+
+    __arm_x86_st_f32(pSin, sV);
+    __arm_x86_st_f32(pCos, cV);
+
+    pSrc += ARM_X86_F32_LANES;
+    pSin += ARM_X86_F32_LANES;
+    pCos += ARM_X86_F32_LANES;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+#elif defined (ARM_MATH_LOOPUNROLL)
+
+  float32_t x0, x1, x2, x3;
+
+  /* Loop unrolling: Compute 4 independent outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Inputs read first, as the outputs may overwrite them */
+    x0 = pSrc[0];
+    x1 = pSrc[1];
+    x2 = pSrc[2];
+    x3 = pSrc[3];
+
+    arm_vsincos_one_f32(x0, pSin, pCos);
+    arm_vsincos_one_f32(x1, pSin + 1, pCos + 1);
+    arm_vsincos_one_f32(x2, pSin + 2, pCos + 2);
+    arm_vsincos_one_f32(x3, pSin + 3, pCos + 3);
+
+    pSrc += 4;
+    pSin += 4;
+    pCos += 4;
+    blkCnt--;
+  }
+
+  blkCnt = blockSize & 3U;
+
+#else
+
+  blkCnt = blockSize;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    arm_vsincos_one_f32(*pSrc++, pSin++, pCos++);
+
+    blkCnt--;
+  }
+}
+
+#undef ARM_VSINCOS_2_PI
+#undef ARM_VSINCOS_ROUND
+#undef ARM_VSINCOS_DP1
+#undef ARM_VSINCOS_DP2
+#undef ARM_VSINCOS_DP3
+#undef ARM_VSINCOS_S0
+#undef ARM_VSINCOS_S1
+#undef ARM_VSINCOS_S2
+#undef ARM_VSINCOS_C0
+#undef ARM_VSINCOS_C1
+#undef ARM_VSINCOS_C2
+
+/**
+  @} end of vsincos group
+ */
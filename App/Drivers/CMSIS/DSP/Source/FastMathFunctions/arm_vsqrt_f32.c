@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_f32.c
+ * Description:  Floating-point vector square root
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Floating-point vector square root.
+  @param[in]     pIn        points to the input vector
+  @param[out]    pOut       points to the output vector
+  @param[in]     len        number of samples in each vector
+  @return        none
+
+  @par           Details
+                   Negative inputs give 0, as with arm_sqrt_f32().
+                   The result is correctly rounded, from the square root instructions of the FPU, of
+                   AArch64 Neon and of x86 SIMD. With Armv7 Neon, it is computed from the reciprocal square
+                   root estimate refined twice, with a maximum error of 2 ULP (unit in the last place).
+                   As Armv7 Neon flushes subnormals to zero, the roots of subnormal inputs are computed there
+                   from their bits <code>b</code> as <code>sqrt(2 * b) * 2^-75</code>.
+ */
+
+void arm_vsqrt_f32(
+  float32_t * pIn,
+  float32_t * pOut,
+  uint16_t len)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t xV;
+#if !defined(__aarch64__)
+  float32x4_t sV;
+  int32x4_t bV;
+  uint32x4_t subV;
+#endif
+
+  blkCnt = (uint32_t) len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Negative and NaN inputs give 0 */
+    xV = vld1q_f32(pIn);
+    xV = vbslq_f32(vcgeq_f32(xV, vdupq_n_f32(0.0f)), xV, vdupq_n_f32(0.0f));
+#if defined(__aarch64__)
+    vst1q_f32(pOut, vsqrtq_f32(xV));
+#else
+    /* Subnormals, which Armv7 Neon flushes to zero, from their bits b: sqrt(2 * b) * 2^-75 */
+    bV = vreinterpretq_s32_f32(xV);
+    subV = vandq_u32(vcgtq_s32(bV, vdupq_n_s32(0)), vcltq_s32(bV, vdupq_n_s32(0x00800000)));
+    sV = vmulq_f32(__arm_vec_sqrt_f32_neon(vcvtq_f32_s32(vshlq_n_s32(bV, 1))), vdupq_n_f32(2.64697796e-23f));
+    vst1q_f32(pOut, vbslq_f32(subV, sV, __arm_vec_sqrt_f32_neon(xV)));
+#endif
+
+    pIn += 4;
+    pOut += 4;
+    blkCnt--;
+  }
+
+  blkCnt = (uint32_t) len & 3U;
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t xV;
+
+  blkCnt = (uint32_t) len / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* max returns its second operand, 0, for NaN */
+    xV = __arm_x86_max_f32(__arm_x86_ld_f32(pIn), __arm_x86_dup_f32(0.0f));
+    __arm_x86_st_f32(pOut, __arm_x86_sqrt_f32(xV));
+
+    pIn += ARM_X86_F32_LANES;
+    pOut += ARM_X86_F32_LANES;
+    blkCnt--;
+  }
+
+  blkCnt = (uint32_t) len % ARM_X86_F32_LANES;
+
+#else
+
+  blkCnt = len;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    (void) arm_sqrt_f32(*pIn++, pOut++);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SQRT group
+ */
@@ -0,0 +1,94 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_q15.c
+ * Description:  Q15 vector square root
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Q15 vector square root.
+  @param[in]     pIn        points to the input vector
+  @param[out]    pOut       points to the output vector
+  @param[in]     len        number of samples in each vector
+  @return        none
+
+  @par           Details
+                   Each element is computed as by arm_sqrt_q15(), and negative inputs give 0.
+                   With Neon, the elements are converted to floating-point for the square root, and the
+                   truncated result is within 1 LSB of the exact root, where arm_sqrt_q15() can be 6 LSB away.
+ */
+
+void arm_vsqrt_q15(
+  q15_t * pIn,
+  q15_t * pOut,
+  uint16_t len)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  int16x8_t xV;
+
+  blkCnt = (uint32_t) len >> 3U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vmaxq_s16(vld1q_s16(pIn), vdupq_n_s16(0));
+    vst1q_s16(pOut, __arm_vec_sqrt_q15_neon(xV));
+
+    pIn += 8;
+    pOut += 8;
+    blkCnt--;
+  }
+
+  blkCnt = (uint32_t) len & 7U;
+
+#else
+
+  blkCnt = len;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    (void) arm_sqrt_q15(*pIn++, pOut++);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SQRT group
+ */
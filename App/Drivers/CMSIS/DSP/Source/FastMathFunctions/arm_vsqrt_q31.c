@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vsqrt_q31.c
+ * Description:  Q31 vector square root
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @addtogroup SQRT
+  @{
+ */
+
+/**
+  @brief         Q31 vector square root.
+  @param[in]     pIn        points to the input vector
+  @param[out]    pOut       points to the output vector
+  @param[in]     len        number of samples in each vector
+  @return        none
+
+  @par           Details
+                   Each element is computed as by arm_sqrt_q31(), and negative inputs give 0.
+                   With Neon, the root is estimated in floating-point and then refined by one
+                   fixed-point Newton step, which brings it back to within a few LSB of the exact root.
+ */
+
+void arm_vsqrt_q31(
+  q31_t * pIn,
+  q31_t * pOut,
+  uint16_t len)
+{
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  int32x4_t xV, yV;
+  int64x2_t rLoV, rHiV;
+  float32x4_t yF, invF, dF;
+
+  blkCnt = (uint32_t) len >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    xV = vmaxq_s32(vld1q_s32(pIn), vdupq_n_s32(0));
+    yV = __arm_vec_sqrt_q31_neon(xV);
+
+    /* The float root only has 24 bits: add (x - y^2) / 2y, with the residual taken in 64 bits */
+    rLoV = vsubq_s64(vshll_n_s32(vget_low_s32(xV), 31), vmull_s32(vget_low_s32(yV), vget_low_s32(yV)));
+    rHiV = vsubq_s64(vshll_n_s32(vget_high_s32(xV), 31), vmull_s32(vget_high_s32(yV), vget_high_s32(yV)));
+
+    yF = vmaxq_f32(vcvtq_n_f32_s32(yV, 31), vdupq_n_f32(FLT_MIN));
+    invF = vrecpeq_f32(yF);
+    invF = vmulq_f32(vrecpsq_f32(yF, invF), invF);
+    invF = vmulq_f32(vrecpsq_f32(yF, invF), invF);
+
+    /* The residual is scaled by 2^-16 to fit 32 bits, 2y by 2^-31 */
+    dF = vcvtq_f32_s32(vcombine_s32(vshrn_n_s64(rLoV, 16), vshrn_n_s64(rHiV, 16)));
+    dF = vmulq_f32(vmulq_n_f32(dF, 1.0f / 65536.0f), invF);
+
+    vst1q_s32(pOut, vqaddq_s32(yV, vcvtq_s32_f32(dF)));
+
+    pIn += 4;
+    pOut += 4;
+    blkCnt--;
+  }
+
+  blkCnt = (uint32_t) len & 3U;
+
+#else
+
+  blkCnt = len;
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  while (blkCnt > 0U)
+  {
+    (void) arm_sqrt_q31(*pIn++, pOut++);
+
+    blkCnt--;
+  }
+}
+
+/**
+  @} end of SQRT group
+ */
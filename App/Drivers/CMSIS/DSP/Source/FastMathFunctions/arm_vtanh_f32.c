@@ -0,0 +1,209 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_vtanh_f32.c
+ * Description:  Floating-point vector hyperbolic tangent
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFastMath
+ */
+
+/**
+  @defgroup vtanh Vector Hyperbolic Tangent
+
+  Computes the hyperbolic tangent of each element of a vector, as used by activation layers.
+
+  @par           Algorithm
+                   For <code>|x| >= 0.625</code>:
+  <pre>
+      tanh(x) = sign(x) * (1 - 2 / (exp(2 * |x|) + 1))
+  </pre>
+                   with the exponentials computed by arm_vexp_f32() on blocks of the input. Below, where the
+                   subtraction would cancel, <code>tanh(x)</code> is <code>x</code> plus an odd polynomial of degree 11.
+  @par           Accuracy
+                   The maximum error is 2 ULP (unit in the last place) over the whole range.
+                   The output is <code>+/-1</code> for <code>|x| > 9.1</code> and for infinite inputs. NaN inputs give NaN.
+ */
+
+/**
+  @addtogroup vtanh
+  @{
+ */
+
+#define ARM_VTANH_BLOCK 32U                      /* Exponentials computed per call of arm_vexp_f32() */
+#define ARM_VTANH_SMALL 0.625f                   /* Largest input of the polynomial */
+#define ARM_VTANH_P0   -5.70498872745e-3f
+#define ARM_VTANH_P1    2.06390887954e-2f
+#define ARM_VTANH_P2   -5.37397155531e-2f
+#define ARM_VTANH_P3    1.33314422036e-1f
+#define ARM_VTANH_P4   -3.33332819422e-1f
+
+/**
+  @brief         Floating-point vector hyperbolic tangent.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     blockSize  number of samples in each vector
+  @return        none
+
+  @par           Details
+                   <code>pDst</code> may be equal to <code>pSrc</code>.
+ */
+
+void arm_vtanh_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  float32_t pExp[ARM_VTANH_BLOCK];               /* Exponentials of 2 * |x| */
+  float32_t x, a, z, p;                          /* Temporary variables */
+  uint32_t cnt, i;                               /* Loop counters */
+
+#if defined(ARM_MATH_NEON)
+  float32x4_t xV, aV, zV, pV, eV, dV, rV;
+  uint32x4_t signV;
+  uint32_t blkCnt;
+#elif defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t xV, aV, zV, pV, eV;
+  uint32_t blkCnt;
+#endif
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_VTANH_BLOCK) ? blockSize : ARM_VTANH_BLOCK;
+
+    for (i = 0U; i < cnt; i++)
+    {
+      pExp[i] = 2.0f * fabsf(pSrc[i]);
+    }
+
+    arm_vexp_f32(pExp, pExp, cnt);
+
+    i = 0U;
+
+#if defined(ARM_MATH_NEON)
+
+    blkCnt = cnt >> 2U;
+
+    while (blkCnt > 0U)
+    {
+      xV = vld1q_f32(pSrc + i);
+      aV = vabsq_f32(xV);
+      signV = vandq_u32(vreinterpretq_u32_f32(xV), vdupq_n_u32(0x80000000U));
+
+      /* 2 / (exp(2|x|) + 1), with the reciprocal refined twice */
+      dV = vaddq_f32(vld1q_f32(pExp + i), vdupq_n_f32(1.0f));
+      rV = vrecpeq_f32(dV);
+      rV = vmulq_f32(vrecpsq_f32(dV, rV), rV);
+      rV = vmulq_f32(vrecpsq_f32(dV, rV), rV);
+      eV = vmlsq_f32(vdupq_n_f32(1.0f), rV, vdupq_n_f32(2.0f));
+
+      zV = vmulq_f32(aV, aV);
+      pV = vmlaq_f32(vdupq_n_f32(ARM_VTANH_P1), vdupq_n_f32(ARM_VTANH_P0), zV);
+      pV = vmlaq_f32(vdupq_n_f32(ARM_VTANH_P2), pV, zV);
+      pV = vmlaq_f32(vdupq_n_f32(ARM_VTANH_P3), pV, zV);
+      pV = vmlaq_f32(vdupq_n_f32(ARM_VTANH_P4), pV, zV);
+      pV = vmlaq_f32(aV, vmulq_f32(pV, zV), aV);
+
+      /* An infinite exponential gives a reciprocal of 0, hence 1 */
+      pV = vbslq_f32(vcltq_f32(aV, vdupq_n_f32(ARM_VTANH_SMALL)), pV, eV);
+
+      /* Subnormals are their own tanh, and Armv7 Neon would flush them to zero */
+      pV = vbslq_f32(vtstq_u32(vreinterpretq_u32_f32(aV), vdupq_n_u32(0x7F800000U)), pV, aV);
+      pV = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(pV), signV));
+
+      vst1q_f32(pDst + i, pV);
+
+      i += 4U;
+      blkCnt--;
+    }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+    blkCnt = cnt / ARM_X86_F32_LANES;
+
+    while (blkCnt > 0U)
+    {
+      xV = __arm_x86_ld_f32(pSrc + i);
+      aV = __arm_x86_abs_f32(xV);
+
+      eV = __arm_x86_add_f32(__arm_x86_ld_f32(pExp + i), __arm_x86_dup_f32(1.0f));
+      eV = __arm_x86_sub_f32(__arm_x86_dup_f32(1.0f), __arm_x86_div_f32(__arm_x86_dup_f32(2.0f), eV));
+
+      zV = __arm_x86_mul_f32(aV, aV);
+      pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VTANH_P1), __arm_x86_dup_f32(ARM_VTANH_P0), zV);
+      pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VTANH_P2), pV, zV);
+      pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VTANH_P3), pV, zV);
+      pV = __arm_x86_fma_f32(__arm_x86_dup_f32(ARM_VTANH_P4), pV, zV);
+      pV = __arm_x86_fma_f32(aV, __arm_x86_mul_f32(pV, zV), aV);
+
+      pV = __arm_x86_select_f32(__arm_x86_cmplt_f32(aV, __arm_x86_dup_f32(ARM_VTANH_SMALL)), pV, eV);
+      pV = __arm_x86_or_f32(pV, __arm_x86_and_f32(xV, __arm_x86_dup_f32(-0.0f)));
+
+      __arm_x86_st_f32(pDst + i, pV);
+
+      i += ARM_X86_F32_LANES;
+      blkCnt--;
+    }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+    for (; i < cnt; i++)
+    {
+      x = pSrc[i];
+      a = fabsf(x);
+
+      if (a < ARM_VTANH_SMALL)
+      {
+        z = a * a;
+        p = (((ARM_VTANH_P0 * z + ARM_VTANH_P1) * z + ARM_VTANH_P2) * z + ARM_VTANH_P3) * z + ARM_VTANH_P4;
+        p = a + (p * z) * a;
+      }
+      else
+      {
+        p = 1.0f - 2.0f / (pExp[i] + 1.0f);
+      }
+
+      pDst[i] = (x < 0.0f) ? -p : p;
+    }
+
+    pSrc += cnt;
+    pDst += cnt;
+    blockSize -= cnt;
+  }
+}
+
+#undef ARM_VTANH_BLOCK
+#undef ARM_VTANH_SMALL
+#undef ARM_VTANH_P0
+#undef ARM_VTANH_P1
+#undef ARM_VTANH_P2
+#undef ARM_VTANH_P3
+#undef ARM_VTANH_P4
+
+/**
+  @} end of vtanh group
+ */
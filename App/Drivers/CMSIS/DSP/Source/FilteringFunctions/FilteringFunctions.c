@@ -43,6 +43,7 @@
 #include "arm_biquad_cascade_stereo_df2T_f32.c"
 #include "arm_biquad_cascade_stereo_df2T_init_f32.c"
 #include "arm_conv_f32.c"
+#include "arm_conv_fft_f32.c"
 #include "arm_conv_fast_opt_q15.c"
 #include "arm_conv_fast_q15.c"
 #include "arm_conv_fast_q31.c"
@@ -61,6 +62,7 @@
 #include "arm_conv_q31.c"
 #include "arm_conv_q7.c"
 #include "arm_correlate_f32.c"
+#include "arm_correlate_fft_f32.c"
 #include "arm_correlate_fast_opt_q15.c"
 #include "arm_correlate_fast_q15.c"
 #include "arm_correlate_fast_q31.c"
@@ -69,6 +71,14 @@
 #include "arm_correlate_q15.c"
 #include "arm_correlate_q31.c"
 #include "arm_correlate_q7.c"
+#include "arm_fir_circ_f32.c"
+#include "arm_fir_circ_init_f32.c"
+#include "arm_fir_circ_init_q15.c"
+#include "arm_fir_circ_init_q31.c"
+#include "arm_fir_circ_init_q7.c"
+#include "arm_fir_circ_q15.c"
+#include "arm_fir_circ_q31.c"
+#include "arm_fir_circ_q7.c"
 #include "arm_fir_decimate_f32.c"
 #include "arm_fir_decimate_fast_q15.c"
 #include "arm_fir_decimate_fast_q31.c"
@@ -80,6 +90,8 @@
 #include "arm_fir_f32.c"
 #include "arm_fir_fast_q15.c"
 #include "arm_fir_fast_q31.c"
+#include "arm_fir_fft_f32.c"
+#include "arm_fir_fft_init_f32.c"
 #include "arm_fir_init_f32.c"
 #include "arm_fir_init_q15.c"
 #include "arm_fir_init_q31.c"
@@ -96,9 +108,21 @@
 #include "arm_fir_lattice_init_q31.c"
 #include "arm_fir_lattice_q15.c"
 #include "arm_fir_lattice_q31.c"
+#include "arm_fir_multichannel_f32.c"
+#include "arm_fir_multichannel_init_f32.c"
+#include "arm_fir_multichannel_init_q15.c"
+#include "arm_fir_multichannel_init_q31.c"
+#include "arm_fir_multichannel_q15.c"
+#include "arm_fir_multichannel_q31.c"
 #include "arm_fir_q15.c"
 #include "arm_fir_q31.c"
 #include "arm_fir_q7.c"
+#include "arm_fir_resample_f32.c"
+#include "arm_fir_resample_init_f32.c"
+#include "arm_fir_resample_init_q15.c"
+#include "arm_fir_resample_init_q31.c"
+#include "arm_fir_resample_q15.c"
+#include "arm_fir_resample_q31.c"
 #include "arm_fir_sparse_f32.c"
 #include "arm_fir_sparse_init_f32.c"
 #include "arm_fir_sparse_init_q15.c"
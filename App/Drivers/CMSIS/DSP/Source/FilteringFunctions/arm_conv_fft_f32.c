@@ -0,0 +1,442 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_conv_fft_f32.c
+ * Description:  FFT-based convolution of floating-point sequences
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup ConvFFT FFT Convolution
+
+  Computes the same result as arm_conv_f32() with fast convolution in the
+  frequency domain. For long sequences the cost grows with
+  <code>(srcALen + srcBLen) * log2(N)</code> instead of <code>srcALen * srcBLen</code>.
+
+  @par           Algorithm
+                   The shorter sequence is the kernel and the longer one the signal.
+                   The output is computed by overlap-save in blocks of <code>B</code> samples with
+                   real FFTs of length <code>N</code> computed by arm_rfft_fast_f32(). Each block transforms
+                   the last <code>N</code> samples of the signal which end with the block, multiplies the
+                   spectrum with the one of the kernel and keeps the last <code>B</code> samples of the
+                   inverse transform, which are free of circular aliasing.
+  @par
+                   For kernels of up to 2048 taps, <code>N</code> is the power of two up to 4096 which
+                   minimizes the number of operations per output sample and <code>B = N - kernelLen + 1</code>.
+                   Longer kernels are split into partitions of 2048 taps, transformed with
+                   <code>N = 4096</code>. The spectra of the last blocks of the signal are kept in a
+                   frequency-domain delay line and each block of output accumulates the products of
+                   the partitions with the spectra of the matching blocks before a single inverse transform.
+
+  @par           Scratch Buffer
+                   All the working memory is provided by the caller in <code>pScratch</code>.
+                   The number of words required for given lengths is returned by
+                   arm_conv_fft_scratch_size_f32(): <code>2 * (P + 1) * N</code>
+                   for <code>P</code> kernel partitions.
+
+  @par           Choosing between direct and FFT convolution
+                   The FFT path has a fixed cost per block and rounding errors spread over the whole
+                   output, of the order of the machine precision times the energy of the block.
+                   arm_conv_auto_f32() estimates the cost of both methods from the lengths and calls
+                   arm_conv_f32() or arm_conv_fft_f32(). With the benchmark of the library the FFT
+                   is faster from about 64 kernel taps for long signals.
+ */
+
+/**
+  @addtogroup ConvFFT
+  @{
+ */
+
+/* Largest length supported by arm_rfft_fast_f32() */
+#define ARM_CONV_FFT_MAX_LEN      4096U
+
+/* Length of the partitions of kernels which do not fit in the largest transform */
+#define ARM_CONV_FFT_PART_LEN     (ARM_CONV_FFT_MAX_LEN / 2U)
+
+/* Kernels shorter than this are always convolved directly */
+#define ARM_CONV_FFT_MIN_KER_LEN  32U
+
+/* Cost of one unit of the FFT estimate relative to one MAC of the direct convolution */
+#define ARM_CONV_FFT_COST_SCALE   2U
+
+typedef struct
+{
+  uint32_t fftLen;          /* Transform length N */
+  uint32_t blockLen;        /* Output samples per block B */
+  uint32_t partLen;         /* Kernel taps per partition */
+  uint32_t numParts;        /* Number of kernel partitions P */
+  uint64_t cost;            /* Estimated number of operations */
+} arm_conv_fft_plan_f32;
+
+/*
+ * Choose the transform and block lengths for a kernel of kerLen taps and
+ * outLen output samples.
+ */
+static arm_status arm_conv_fft_plan(
+  uint32_t kerLen,
+  uint32_t outLen,
+  arm_conv_fft_plan_f32 * pPlan)
+{
+  arm_rfft_fast_instance_f32 S;
+  arm_status status = ARM_MATH_ARGUMENT_ERROR;
+  uint32_t fftLen, log2Len, blockLen, numBlocks;
+  uint64_t cost;
+
+  if (kerLen > ARM_CONV_FFT_PART_LEN)
+  {
+    /* Uniformly partitioned kernel in the largest transform */
+    if (arm_rfft_fast_init_f32(&S, ARM_CONV_FFT_MAX_LEN) == ARM_MATH_SUCCESS)
+    {
+      pPlan->fftLen = ARM_CONV_FFT_MAX_LEN;
+      pPlan->blockLen = ARM_CONV_FFT_PART_LEN;
+      pPlan->partLen = ARM_CONV_FFT_PART_LEN;
+      pPlan->numParts = (kerLen + ARM_CONV_FFT_PART_LEN - 1U) / ARM_CONV_FFT_PART_LEN;
+
+      /* Two transforms and one product per partition for each block, log2(4096) = 12 */
+      numBlocks = (outLen + ARM_CONV_FFT_PART_LEN - 1U) / ARM_CONV_FFT_PART_LEN;
+      pPlan->cost = (uint64_t) numBlocks * ARM_CONV_FFT_MAX_LEN * ((2U * 12U) + pPlan->numParts);
+
+      status = ARM_MATH_SUCCESS;
+    }
+
+    return (status);
+  }
+
+  pPlan->cost = UINT64_MAX;
+
+  /* Smallest total cost among the supported lengths of at least twice the kernel */
+  for (fftLen = 32U, log2Len = 5U; fftLen <= ARM_CONV_FFT_MAX_LEN; fftLen <<= 1U, log2Len++)
+  {
+    if ((fftLen < 2U * kerLen) || (arm_rfft_fast_init_f32(&S, fftLen) != ARM_MATH_SUCCESS))
+    {
+      continue;
+    }
+
+    blockLen = fftLen - kerLen + 1U;
+    numBlocks = (outLen + blockLen - 1U) / blockLen;
+    cost = (uint64_t) numBlocks * fftLen * (2U * log2Len + 1U);
+
+    if (cost < pPlan->cost)
+    {
+      pPlan->fftLen = fftLen;
+      pPlan->blockLen = blockLen;
+      pPlan->partLen = kerLen;
+      pPlan->numParts = 1U;
+      pPlan->cost = cost;
+
+      status = ARM_MATH_SUCCESS;
+    }
+  }
+
+  return (status);
+}
+
+/*
+ * Read count samples of a sequence starting at index start into pWin, with
+ * zeros outside of the sequence, then pad pWin with zeros up to winLen samples.
+ * When reverse is set, the sequence is read backwards.
+ */
+static void arm_conv_fft_window(
+  const float32_t * pSrc,
+        uint32_t srcLen,
+        uint8_t reverse,
+        int32_t start,
+        float32_t * pWin,
+        uint32_t count,
+        uint32_t winLen)
+{
+  uint32_t lead, avail, idx, k;
+
+  /* Zeros before the sequence */
+  lead = (start < 0) ? (uint32_t) -start : 0U;
+  lead = (lead < count) ? lead : count;
+  arm_fill_f32(0.0f, pWin, lead);
+
+  /* Samples of the sequence */
+  idx = (uint32_t) (start + (int32_t) lead);
+  avail = (idx < srcLen) ? (srcLen - idx) : 0U;
+  avail = (avail < count - lead) ? avail : (count - lead);
+
+  if (reverse == 0U)
+  {
+    arm_copy_f32(pSrc + idx, pWin + lead, avail);
+  }
+  else
+  {
+    for (k = 0U; k < avail; k++)
+    {
+      pWin[lead + k] = pSrc[srcLen - 1U - idx - k];
+    }
+  }
+
+  /* Zeros after the sequence and padding */
+  arm_fill_f32(0.0f, pWin + lead + avail, winLen - lead - avail);
+}
+
+/*
+ * Accumulate the product of two spectra packed as by arm_rfft_fast_f32().
+ * Also used by arm_fir_fft_f32().
+ */
+void arm_conv_fft_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pH,
+        float32_t * pAcc,
+        uint32_t fftLen)
+{
+  float32_t xr, xi, hr, hi;
+  uint32_t blkCnt;
+
+  /* The DC and Nyquist bins are real and share the first pair */
+  pAcc[0] += pX[0] * pH[0];
+  pAcc[1] += pX[1] * pH[1];
+  pX += 2;
+  pH += 2;
+  pAcc += 2;
+
+  for (blkCnt = (fftLen >> 1U) - 1U; blkCnt > 0U; blkCnt--)
+  {
+    xr = *pX++;
+    xi = *pX++;
+    hr = *pH++;
+    hi = *pH++;
+
+    *pAcc++ += (xr * hr) - (xi * hi);
+    *pAcc++ += (xr * hi) + (xi * hr);
+  }
+}
+
+/*
+ * Overlap-save convolution of a signal with a kernel, either of which may be
+ * read backwards. This is the core of arm_conv_fft_f32() and arm_correlate_fft_f32().
+ */
+arm_status arm_conv_fft_ols_f32(
+  const float32_t * pSig,
+        uint32_t sigLen,
+        uint8_t sigReverse,
+  const float32_t * pKer,
+        uint32_t kerLen,
+        uint8_t kerReverse,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  arm_rfft_fast_instance_f32 S;
+  arm_conv_fft_plan_f32 plan;
+  float32_t *pSpec;                                  /* Kernel spectra */
+  float32_t *pFdl;                                   /* Frequency-domain delay line */
+  float32_t *pWin;                                   /* Time-domain block */
+  float32_t *pAcc;                                   /* Accumulated spectrum */
+  uint32_t fftLen, blockLen, numParts;
+  uint32_t outLen, n0, j, p, terms, count;
+  arm_status status;
+
+  if ((sigLen == 0U) || (kerLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  outLen = sigLen + kerLen - 1U;
+
+  status = arm_conv_fft_plan(kerLen, outLen, &plan);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  fftLen = plan.fftLen;
+  blockLen = plan.blockLen;
+  numParts = plan.numParts;
+
+  arm_rfft_fast_init_f32(&S, fftLen);
+
+  pSpec = pScratch;
+  pFdl = pSpec + (numParts * fftLen);
+  pWin = pFdl + (numParts * fftLen);
+  pAcc = pWin + fftLen;
+
+  /* Spectra of the kernel partitions. The inverse transform scales by 1/N */
+  for (p = 0U; p < numParts; p++)
+  {
+    arm_conv_fft_window(pKer, kerLen, kerReverse, (int32_t) (p * plan.partLen),
+                        pWin, plan.partLen, fftLen);
+    arm_rfft_fast_f32(&S, pWin, pSpec + (p * fftLen), 0U);
+  }
+
+  for (j = 0U, n0 = 0U; n0 < outLen; j++, n0 += blockLen)
+  {
+    /* Last N samples of the signal ending with the block. The transform
+       overwrites its input, so the window is rebuilt for every block */
+    arm_conv_fft_window(pSig, sigLen, sigReverse, (int32_t) n0 - (int32_t) (fftLen - blockLen),
+                        pWin, fftLen, fftLen);
+    arm_rfft_fast_f32(&S, pWin, pFdl + ((j % numParts) * fftLen), 0U);
+
+    /* Partition p applies to the block received p blocks earlier */
+    arm_fill_f32(0.0f, pAcc, fftLen);
+    terms = (j < numParts) ? (j + 1U) : numParts;
+    for (p = 0U; p < terms; p++)
+    {
+      arm_conv_fft_cmac_f32(pFdl + (((j - p) % numParts) * fftLen), pSpec + (p * fftLen), pAcc, fftLen);
+    }
+
+    arm_rfft_fast_f32(&S, pAcc, pWin, 1U);
+
+    /* Only the last B samples are free of circular aliasing */
+    count = outLen - n0;
+    count = (count < blockLen) ? count : blockLen;
+    arm_copy_f32(pWin + (fftLen - blockLen), pDst + n0, count);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/*
+ * Return 1 when FFT convolution of a signal and a kernel is estimated to be
+ * faster than direct convolution.
+ */
+uint8_t arm_conv_fft_preferred_f32(
+  uint32_t sigLen,
+  uint32_t kerLen)
+{
+  arm_conv_fft_plan_f32 plan;
+
+  if ((kerLen < ARM_CONV_FFT_MIN_KER_LEN) ||
+      (arm_conv_fft_plan(kerLen, sigLen + kerLen - 1U, &plan) != ARM_MATH_SUCCESS))
+  {
+    return (0U);
+  }
+
+  return ((uint64_t) sigLen * kerLen > plan.cost * ARM_CONV_FFT_COST_SCALE) ? 1U : 0U;
+}
+
+/**
+  @brief         Size of the scratch buffer of FFT convolution and correlation.
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @return        number of float32_t words required in <code>pScratch</code> by arm_conv_fft_f32(),
+                 arm_correlate_fft_f32() and the automatic versions, or 0 when the lengths are not supported
+ */
+uint32_t arm_conv_fft_scratch_size_f32(
+  uint32_t srcALen,
+  uint32_t srcBLen)
+{
+  arm_conv_fft_plan_f32 plan;
+  uint32_t kerLen = (srcALen < srcBLen) ? srcALen : srcBLen;
+
+  if ((kerLen == 0U) ||
+      (arm_conv_fft_plan(kerLen, srcALen + srcBLen - 1U, &plan) != ARM_MATH_SUCCESS))
+  {
+    return (0U);
+  }
+
+  return (2U * (plan.numParts + 1U) * plan.fftLen);
+}
+
+/**
+  @brief         FFT convolution of floating-point sequences.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the location where the output result is written.  Length srcALen+srcBLen-1.
+  @param[in]     pScratch   points to a scratch buffer of arm_conv_fft_scratch_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : one of the sequences is empty
+ */
+arm_status arm_conv_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  /* Convolution is commutative, the shorter sequence is the kernel */
+  if (srcALen >= srcBLen)
+  {
+    return (arm_conv_fft_ols_f32(pSrcA, srcALen, 0U, pSrcB, srcBLen, 0U, pDst, pScratch));
+  }
+  else
+  {
+    return (arm_conv_fft_ols_f32(pSrcB, srcBLen, 0U, pSrcA, srcALen, 0U, pDst, pScratch));
+  }
+}
+
+/**
+  @brief         Convolution of floating-point sequences, direct or with FFTs.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the location where the output result is written.  Length srcALen+srcBLen-1.
+  @param[in]     pScratch   points to a scratch buffer of arm_conv_fft_scratch_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : one of the sequences is empty
+
+  @par           Details
+                   Calls arm_conv_f32() or arm_conv_fft_f32(), whichever is estimated to be faster.
+                   The scratch buffer is not used by arm_conv_f32().
+ */
+arm_status arm_conv_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  uint8_t useFFT;
+
+  if ((srcALen == 0U) || (srcBLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (srcALen >= srcBLen)
+  {
+    useFFT = arm_conv_fft_preferred_f32(srcALen, srcBLen);
+  }
+  else
+  {
+    useFFT = arm_conv_fft_preferred_f32(srcBLen, srcALen);
+  }
+
+  if (useFFT != 0U)
+  {
+    return (arm_conv_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch));
+  }
+
+  arm_conv_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of ConvFFT group
+ */
@@ -0,0 +1,166 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_correlate_fft_f32.c
+ * Description:  FFT-based correlation of floating-point sequences
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern arm_status arm_conv_fft_ols_f32(
+  const float32_t * pSig,
+        uint32_t sigLen,
+        uint8_t sigReverse,
+  const float32_t * pKer,
+        uint32_t kerLen,
+        uint8_t kerReverse,
+        float32_t * pDst,
+        float32_t * pScratch);
+
+extern uint8_t arm_conv_fft_preferred_f32(
+  uint32_t sigLen,
+  uint32_t kerLen);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup CorrFFT FFT Correlation
+
+  Computes the same result as arm_correlate_f32() as the FFT convolution of
+  one sequence with the other one reversed in time, with the overlap-save
+  algorithm described in \ref ConvFFT. The scratch buffer has the same size,
+  given by arm_conv_fft_scratch_size_f32().
+
+  @par
+                   Unlike arm_correlate_f32(), all the <code>2 * max(srcALen, srcBLen) - 1</code>
+                   output samples are written, including the zeros, so that <code>pDst</code>
+                   need not be initialized.
+ */
+
+/**
+  @addtogroup CorrFFT
+  @{
+ */
+
+/**
+  @brief         FFT correlation of floating-point sequences.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+  @param[in]     pScratch   points to a scratch buffer of arm_conv_fft_scratch_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : one of the sequences is empty
+ */
+arm_status arm_correlate_fft_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  arm_status status;
+
+  if ((srcALen == 0U) || (srcBLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (srcALen >= srcBLen)
+  {
+    /* a[n] * b[-n], preceded by srcALen - srcBLen zeros */
+    arm_fill_f32(0.0f, pDst, srcALen - srcBLen);
+    status = arm_conv_fft_ols_f32(pSrcA, srcALen, 0U, pSrcB, srcBLen, 1U,
+                                  pDst + (srcALen - srcBLen), pScratch);
+  }
+  else
+  {
+    /* The same with b[-n] as the signal, followed by srcBLen - srcALen zeros */
+    status = arm_conv_fft_ols_f32(pSrcB, srcBLen, 1U, pSrcA, srcALen, 0U,
+                                  pDst, pScratch);
+    arm_fill_f32(0.0f, pDst + (srcALen + srcBLen - 1U), srcBLen - srcALen);
+  }
+
+  return (status);
+}
+
+/**
+  @brief         Correlation of floating-point sequences, direct or with FFTs.
+  @param[in]     pSrcA      points to the first input sequence
+  @param[in]     srcALen    length of the first input sequence
+  @param[in]     pSrcB      points to the second input sequence
+  @param[in]     srcBLen    length of the second input sequence
+  @param[out]    pDst       points to the block of output data  Length 2 * max(srcALen, srcBLen) - 1.
+  @param[in]     pScratch   points to a scratch buffer of arm_conv_fft_scratch_size_f32() words
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : one of the sequences is empty
+
+  @par           Details
+                   Calls arm_correlate_f32() or arm_correlate_fft_f32(), whichever is estimated to be faster.
+                   The scratch buffer is not used by arm_correlate_f32(), and as for that function
+                   <code>pDst</code> should then be initialized to all zeros.
+ */
+arm_status arm_correlate_auto_f32(
+  const float32_t * pSrcA,
+        uint32_t srcALen,
+  const float32_t * pSrcB,
+        uint32_t srcBLen,
+        float32_t * pDst,
+        float32_t * pScratch)
+{
+  uint8_t useFFT;
+
+  if ((srcALen == 0U) || (srcBLen == 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  if (srcALen >= srcBLen)
+  {
+    useFFT = arm_conv_fft_preferred_f32(srcALen, srcBLen);
+  }
+  else
+  {
+    useFFT = arm_conv_fft_preferred_f32(srcBLen, srcALen);
+  }
+
+  if (useFFT != 0U)
+  {
+    return (arm_correlate_fft_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst, pScratch));
+  }
+
+  arm_correlate_f32(pSrcA, srcALen, pSrcB, srcBLen, pDst);
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of CorrFFT group
+ */
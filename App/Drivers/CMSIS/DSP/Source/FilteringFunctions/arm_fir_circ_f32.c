@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_f32.c
+ * Description:  Floating-point FIR filter processing function with circular state
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_fir_block_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Circ Finite Impulse Response (FIR) Filters with Circular State
+
+  These functions implement the same filters as the \ref FIR functions, with the same
+  coefficients and bit-identical outputs, but keep the state in a circular buffer.
+  The \ref FIR functions copy the last <code>numTaps-1</code> samples of the state to
+  its start at the end of each call. With long filters and short blocks this copy
+  costs as much as the filtering itself. These functions avoid it.
+
+  @par           Algorithm
+                   The state buffer holds a circular buffer of <code>stateLength = numTaps+blockSize-1</code>
+                   samples, stored twice: each sample is written at index <code>i</code> and at index
+                   <code>i+stateLength</code>. Whatever the position in the circular buffer, the
+                   <code>numTaps+blockSize-1</code> samples needed by a block are then contiguous, and the block
+                   is filtered by the same code as the \ref FIR functions. After each block only the
+                   <code>blockSize</code> new samples are copied to their second image, instead of
+                   <code>numTaps-1</code> samples.
+  @par
+                   The cost is a state buffer of twice the size, <code>2*(numTaps+blockSize-1)</code> samples.
+                   The saving is significant when <code>blockSize</code> is much smaller than <code>numTaps</code>,
+                   down to one sample per call.
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>,
+                   stored in time reversed order as for the \ref FIR functions.
+  @par
+                   Each call may process any number of samples up to the <code>blockSize</code>
+                   given to the initialization function.
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point FIR filter with circular state.
+  @param[in,out] S          points to an instance of the floating-point FIR filter structure with circular state
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to arm_fir_circ_init_f32()
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The outputs are the same as those of arm_fir_f32().
+ */
+
+void arm_fir_circ_f32(
+        arm_fir_circ_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+        arm_fir_instance_f32 window;                   /* Linear view of the samples used by the block */
+        uint32_t length = S->stateLength;              /* Length of the circular buffer */
+        uint32_t first;                                /* Index of the first new sample */
+        uint32_t lowCnt;                               /* Number of new samples in the first image */
+
+  /* The samples needed by the block are contiguous from stateIndex */
+  window.numTaps = S->numTaps;
+  window.pState = pState + S->stateIndex;
+  window.pCoeffs = S->pCoeffs;
+
+  arm_fir_block_f32(&window, pSrc, pDst, blockSize);
+
+  /* The new samples were written in the window, after the numTaps - 1 previous samples.
+     Copy them to their other image: below stateLength to the second one, above it to the first one */
+  first = S->stateIndex + (uint32_t) S->numTaps - 1U;
+  lowCnt = (first < length) ? (length - first) : 0U;
+  lowCnt = (lowCnt < blockSize) ? lowCnt : blockSize;
+
+  arm_copy_f32(pState + first, pState + first + length, lowCnt);
+  arm_copy_f32(pState + first + lowCnt, pState + first + lowCnt - length, blockSize - lowCnt);
+
+  /* The next block starts blockSize samples later in the circular buffer */
+  S->stateIndex += blockSize;
+  if (S->stateIndex >= length)
+  {
+    S->stateIndex -= length;
+  }
+}
+
+/**
+  @} end of FIR_Circ group
+ */
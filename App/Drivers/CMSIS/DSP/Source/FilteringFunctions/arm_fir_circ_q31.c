@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_circ_q31.c
+ * Description:  Q31 FIR filter processing function with circular state
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_fir_block_q31(
+  const arm_fir_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Circ
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 FIR filter with circular state.
+  @param[in,out] S          points to an instance of the Q31 FIR filter structure with circular state
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, at most the <code>blockSize</code> given to arm_fir_circ_init_q31()
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The outputs are the same as those of arm_fir_q31().
+ */
+
+void arm_fir_circ_q31(
+        arm_fir_circ_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                     /* State pointer */
+        arm_fir_instance_q31 window;                   /* Linear view of the samples used by the block */
+        uint32_t length = S->stateLength;              /* Length of the circular buffer */
+        uint32_t first;                                /* Index of the first new sample */
+        uint32_t lowCnt;                               /* Number of new samples in the first image */
+
+  /* The samples needed by the block are contiguous from stateIndex */
+  window.numTaps = S->numTaps;
+  window.pState = pState + S->stateIndex;
+  window.pCoeffs = S->pCoeffs;
+
+  arm_fir_block_q31(&window, pSrc, pDst, blockSize);
+
+  /* The new samples were written in the window, after the numTaps - 1 previous samples.
+     Copy them to their other image: below stateLength to the second one, above it to the first one */
+  first = S->stateIndex + (uint32_t) S->numTaps - 1U;
+  lowCnt = (first < length) ? (length - first) : 0U;
+  lowCnt = (lowCnt < blockSize) ? lowCnt : blockSize;
+
+  arm_copy_q31(pState + first, pState + first + length, lowCnt);
+  arm_copy_q31(pState + first + lowCnt, pState + first + lowCnt - length, blockSize - lowCnt);
+
+  /* The next block starts blockSize samples later in the circular buffer */
+  S->stateIndex += blockSize;
+  if (S->stateIndex >= length)
+  {
+    S->stateIndex -= length;
+  }
+}
+
+/**
+  @} end of FIR_Circ group
+ */
@@ -108,17 +108,14 @@
   @{
  */
 
-/**
-  @brief         Processing function for floating-point FIR filter.
-  @param[in]     S          points to an instance of the floating-point FIR filter structure
-  @param[in]     pSrc       points to the block of input data
-  @param[out]    pDst       points to the block of output data
-  @param[in]     blockSize  number of samples to process
-  @return        none
+/*
+ * Filters a block through the state window at S->pState, without the copy of the
+ * last numTaps - 1 samples to the start of the state buffer.
+ * Shared by arm_fir_f32() and arm_fir_circ_f32().
  */
 #if defined(ARM_MATH_NEON)
 
-void arm_fir_f32(
+void arm_fir_block_f32(
 const arm_fir_instance_f32 * S,
 const float32_t * pSrc,
 float32_t * pDst,
@@ -316,29 +313,106 @@ uint32_t blockSize)
 
       blkCnt--;
    }
+}
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_fir_block_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, blkCnt;                            /* Loop counters */
+        arm_x86_f32_t accV;
 
-   /* Processing is complete.
-   ** Now copy the last numTaps - 1 samples to the starting of the state buffer.
-   ** This prepares the state buffer for the next function call. */
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = &(S->pState[(numTaps - 1U)]);
 
-   /* Points to the start of the state buffer */
-   pStateCurnt = S->pState;
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
 
-   /* Copy numTaps number of values */
-   tapCnt = numTaps - 1U;
+  while (blkCnt > 0U)
+  {
+    *pStateCurnt++ = *pSrc++;
 
-   /* Copy data */
-   while (tapCnt > 0U)
-   {
-      *pStateCurnt++ = *pState++;
+    /* Decrement loop counter */
+    blkCnt--;
+  }
 
-      /* Decrement the loop counter */
-      tapCnt--;
-   }
+  /* Compute ARM_X86_F32_LANES consecutive outputs at a time: each tap scales
+     ARM_X86_F32_LANES consecutive state samples */
+  blkCnt = blockSize / ARM_X86_F32_LANES;
 
+  while (blkCnt > 0U)
+  {
+    /* Set the accumulators to zero */
+    accV = __arm_x86_dup_f32(0.0f);
+
+    px = pState;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      /* acc =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + b[numTaps-3] * x[n-numTaps-3] +...+ b[0] * x[0] */
+      accV = __arm_x86_fma_f32(accV, __arm_x86_ld_f32(px++), __arm_x86_dup_f32(*pb++));
+
+      i--;
+    } while (i > 0U);
+
+    /* Store results in destination buffer. */
+    __arm_x86_st_f32(pDst, accV);
+    pDst += ARM_X86_F32_LANES;
+
+    /* Advance state pointer for the next outputs */
+    pState = pState + ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* Set the accumulator to zero */
+    acc0 = 0.0f;
+
+    px = pState;
+    pb = pCoeffs;
+
+    i = numTaps;
+
+    /* Perform the multiply-accumulates */
+    do
+    {
+      acc0 += *px++ * *pb++;
+
+      i--;
+    } while (i > 0U);
+
+    /* Store result in destination buffer. */
+    *pDst++ = acc0;
+
+    /* Advance state pointer by 1 for the next sample */
+    pState = pState + 1U;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
 }
 #else
-void arm_fir_f32(
+void arm_fir_block_f32(
   const arm_fir_instance_f32 * S,
   const float32_t * pSrc,
         float32_t * pDst,
@@ -351,12 +425,13 @@ void arm_fir_f32(
   const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
         float32_t acc0;                                /* Accumulator */
         uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
-        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+        uint32_t i, blkCnt;                            /* Loop counters */
 
 #if defined (ARM_MATH_LOOPUNROLL)
         float32_t acc1, acc2, acc3, acc4, acc5, acc6, acc7;     /* Accumulators */
         float32_t x0, x1, x2, x3, x4, x5, x6, x7;               /* Temporary variables to hold state values */
         float32_t c0;                                           /* Temporary variable to hold coefficient value */
+        uint32_t tapCnt;                               /* Loop counter */
 #endif
 
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
@@ -663,6 +738,31 @@ void arm_fir_f32(
     /* Decrement loop counter */
     blkCnt--;
   }
+}
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @brief         Processing function for floating-point FIR filter.
+  @param[in]     S          points to an instance of the floating-point FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState + blockSize;     /* Last numTaps - 1 samples of the state */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  arm_fir_block_f32(S, pSrc, pDst, blockSize);
 
   /* Processing is complete.
      Now copy the last numTaps - 1 samples to the start of the state buffer.
@@ -709,7 +809,6 @@ void arm_fir_f32(
 
 }
 
-#endif /* #if defined(ARM_MATH_NEON) */
 /**
 * @} end of FIR group
 */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_f32.c
+ * Description:  Floating-point partitioned FFT FIR filter processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_conv_fft_cmac_f32(
+  const float32_t * pX,
+  const float32_t * pH,
+        float32_t * pAcc,
+        uint32_t fftLen);
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_FFT Partitioned FFT FIR Filters
+
+  Computes the same output as arm_fir_f32() with a uniformly partitioned
+  convolution in the frequency domain, for filters with thousands of taps
+  that must run with short blocks.
+
+  @par           Algorithm
+                   The <code>numTaps</code> coefficients are split into <code>numParts</code>
+                   partitions of <code>blockSize</code> taps, and the spectrum of each partition is
+                   computed once by the initialization function with a real FFT of length
+                   <code>N = 2*blockSize</code>.
+  @par
+                   For every block of <code>blockSize</code> input samples, the last <code>N</code>
+                   samples of input are transformed and stored in a ring of the <code>numParts</code>
+                   latest input spectra. The spectrum of the output block is the sum of the products
+                   of partition <code>p</code> with the input spectrum of <code>p</code> blocks earlier.
+                   Its inverse transform gives <code>N</code> samples of which the last <code>blockSize</code>
+                   are the output block (overlap-save).
+  @par
+                   Each block costs two FFTs of length <code>N</code> and <code>numParts</code> complex
+                   products of <code>blockSize + 1</code> bins, against <code>numTaps * blockSize</code>
+                   multiply-accumulates for arm_fir_f32(). The output is not delayed: the latency is the
+                   block length, as for arm_fir_f32().
+
+  @par           State Buffer
+                   The state buffer of <code>(4*numParts+5)*blockSize</code> words holds, in order:
+                   - the <code>numParts</code> spectra of the filter partitions, of <code>N</code> words each
+                   - the ring of the <code>numParts</code> latest input spectra, of <code>N</code> words each
+                   - the previous block of input, of <code>blockSize</code> words
+                   - two work buffers of <code>N</code> words
+  @par
+                   State buffers cannot be shared between instances.
+
+  @par           Instance Structure
+                   The instance structure holds the sizes, the position in the ring of input spectra,
+                   the state pointer and the real FFT instance. It must be initialized with
+                   arm_fir_fft_init_f32(). The supported block sizes are the powers of two from 16 to 2048.
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process, a multiple of the block size of the instance
+  @return        none
+
+  @par           Details
+                   The samples are processed in blocks of <code>S->blockSize</code>. When <code>blockSize</code>
+                   is not a multiple of it, the remaining samples are not processed.
+                   <code>pSrc</code> and <code>pDst</code> may be the same buffer.
+ */
+
+void arm_fir_fft_f32(
+        arm_fir_fft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+  uint32_t partLen = S->blockSize;                   /* Samples per block */
+  uint32_t fftLen = 2U * partLen;                    /* Transform length */
+  uint32_t numParts = S->numParts;                   /* Number of partitions */
+  uint32_t slot = S->partIndex;                      /* Ring slot of the current block */
+  float32_t *pSpec = S->pState;                      /* Spectra of the partitions */
+  float32_t *pFdl = pSpec + (numParts * fftLen);     /* Ring of input spectra */
+  float32_t *pPrev = pFdl + (numParts * fftLen);     /* Previous block of input */
+  float32_t *pTmp = pPrev + partLen;                 /* Time-domain block */
+  float32_t *pAcc = pTmp + fftLen;                   /* Accumulated spectrum */
+  uint32_t blkCnt, p, idx;
+
+  for (blkCnt = blockSize / partLen; blkCnt > 0U; blkCnt--)
+  {
+    /* The previous and current blocks of input. The transform overwrites its input,
+       and pDst may overwrite pSrc, so the current block is saved first */
+    arm_copy_f32(pPrev, pTmp, partLen);
+    arm_copy_f32(pSrc, pTmp + partLen, partLen);
+    arm_copy_f32(pSrc, pPrev, partLen);
+
+    arm_rfft_fast_f32(&S->rfft, pTmp, pFdl + (slot * fftLen), 0U);
+
+    /* Partition p applies to the input spectrum of p blocks earlier */
+    arm_fill_f32(0.0f, pAcc, fftLen);
+    idx = slot;
+    for (p = 0U; p < numParts; p++)
+    {
+      arm_conv_fft_cmac_f32(pFdl + (idx * fftLen), pSpec + (p * fftLen), pAcc, fftLen);
+
+      idx = (idx == 0U) ? (numParts - 1U) : (idx - 1U);
+    }
+
+    /* Only the last partLen samples are free of circular aliasing */
+    arm_rfft_fast_f32(&S->rfft, pAcc, pTmp, 1U);
+    arm_copy_f32(pTmp + partLen, pDst, partLen);
+
+    slot = (slot + 1U == numParts) ? 0U : (slot + 1U);
+
+    pSrc += partLen;
+    pDst += partLen;
+  }
+
+  S->partIndex = slot;
+}
+
+/**
+  @} end of FIR_FFT group
+ */
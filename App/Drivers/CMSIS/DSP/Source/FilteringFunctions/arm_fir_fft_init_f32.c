@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_fft_init_f32.c
+ * Description:  Floating-point partitioned FFT FIR filter initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_FFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point partitioned FFT FIR filter.
+  @param[in,out] S          points to an instance of the floating-point partitioned FFT FIR filter structure
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficients buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  length of the partitions of the filter, a power of two from 16 to 2048
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>numTaps</code> is 0 or <code>blockSize</code> is not supported
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order, as for arm_fir_f32():
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   Their spectra are computed here and stored in the state buffer, so the coefficient
+                   array is not used after initialization.
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>(4*numParts+5)*blockSize</code> words,
+                   where <code>numParts = ceil(numTaps/blockSize)</code>.
+ */
+
+arm_status arm_fir_fft_init_f32(
+        arm_fir_fft_instance_f32 * S,
+        uint32_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  uint32_t fftLen = 2U * blockSize;                  /* Transform length */
+  uint32_t numParts, p, k, taps;
+  float32_t *pSpec;                                  /* Spectra of the partitions */
+  float32_t *pTmp;                                   /* Time-domain block */
+
+  if ((numTaps == 0U) || (blockSize < 16U) || ((blockSize & (blockSize - 1U)) != 0U) ||
+      (arm_rfft_fast_init_f32(&S->rfft, (uint16_t) fftLen) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  numParts = (numTaps + blockSize - 1U) / blockSize;
+
+  /* Assign filter taps and partitions */
+  S->numTaps = numTaps;
+  S->blockSize = blockSize;
+  S->numParts = numParts;
+
+  /* Ring of input spectra starts at the first slot */
+  S->partIndex = 0U;
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  /* Clear the ring of input spectra, the previous input block and the work buffers */
+  arm_fill_f32(0.0f, pState + (numParts * fftLen), (2U * numParts + 5U) * blockSize);
+
+  /* Spectrum of each partition of blockSize taps, zero padded to the transform length.
+     The coefficients are stored in time reversed order */
+  pSpec = pState;
+  pTmp = pState + (2U * numParts * fftLen) + blockSize;
+
+  for (p = 0U; p < numParts; p++)
+  {
+    taps = numTaps - (p * blockSize);
+    taps = (taps < blockSize) ? taps : blockSize;
+
+    for (k = 0U; k < taps; k++)
+    {
+      pTmp[k] = pCoeffs[numTaps - 1U - (p * blockSize) - k];
+    }
+    arm_fill_f32(0.0f, pTmp + taps, fftLen - taps);
+
+    arm_rfft_fast_f32(&S->rfft, pTmp, pSpec + (p * fftLen), 0U);
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of FIR_FFT group
+ */
@@ -0,0 +1,594 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multichannel_f32.c
+ * Description:  Floating-point FIR filter processing function. N channels
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/*
+ * Filters one channel. Used for the channels left over by the groups.
+ */
+static void arm_fir_multichannel_x1_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const float32_t *pState = S->pState + ch;            /* State pointer */
+        float32_t *pOut = pDst + (ch * chStride);      /* Destination pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0;                                /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Set the accumulator to zero */
+    acc0 = 0.0f;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    /* Perform the multiply-accumulates */
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      acc0 += *px * *pb++;
+      px += numCh;
+    }
+
+    /* Store result in destination buffer. */
+    *pOut = acc0;
+
+    /* Advance the state pointer by one sample of all channels to process the next sample */
+    pOut += smpStride;
+    pState += numCh;
+  }
+}
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+/*
+ * Filters 4 channels at a time. Each coefficient is loaded once for the 4 channels
+ * and 2 consecutive outputs, and each sample of the state is loaded once for the
+ * 2 outputs.
+ */
+static void arm_fir_multichannel_x4_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const float32_t *pState = S->pState + ch;            /* State pointer */
+        float32_t *pOut = pDst + (ch * chStride);      /* Destination pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t acc0[4], acc1[4];                    /* Accumulators of the 2 outputs */
+        float32_t x0[4], x1[4];                        /* Samples of the 2 outputs */
+        float32_t c0;                                  /* Temporary variable to hold coefficient value */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  /* Compute 2 outputs at a time */
+  blkCnt = blockSize >> 1U;
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    for (i = 0U; i < 4U; i++)
+    {
+      /* Set all accumulators to zero */
+      acc0[i] = 0.0f;
+      acc1[i] = 0.0f;
+
+      /* The samples of the 2 outputs slide by one sample for each coefficient */
+      x0[i] = px[i];
+    }
+
+    px += numCh;
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      /* Read the coefficient once for the 4 channels and the 2 outputs */
+      c0 = *pb++;
+
+      x1[0] = px[0U];
+      x1[1] = px[1U];
+      x1[2] = px[2U];
+      x1[3] = px[3U];
+
+      acc0[0] += x0[0] * c0;
+      acc0[1] += x0[1] * c0;
+      acc0[2] += x0[2] * c0;
+      acc0[3] += x0[3] * c0;
+
+      acc1[0] += x1[0] * c0;
+      acc1[1] += x1[1] * c0;
+      acc1[2] += x1[2] * c0;
+      acc1[3] += x1[3] * c0;
+
+      x0[0] = x1[0];
+      x0[1] = x1[1];
+      x0[2] = x1[2];
+      x0[3] = x1[3];
+
+      px += numCh;
+    }
+
+    /* Store the results in the destination buffer. */
+    for (i = 0U; i < 4U; i++)
+    {
+      pOut[i * chStride] = acc0[i];
+      pOut[i * chStride + smpStride] = acc1[i];
+    }
+
+    /* Advance the state pointer by 2 samples of all channels to process the next outputs */
+    pOut += 2U * smpStride;
+    pState += 2U * numCh;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Compute the remaining output */
+  if ((blockSize & 0x1U) != 0U)
+  {
+    px = pState;
+    pb = S->pCoeffs;
+
+    for (i = 0U; i < 4U; i++)
+    {
+      acc0[i] = 0.0f;
+    }
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      c0 = *pb++;
+
+      acc0[0] += px[0U] * c0;
+      acc0[1] += px[1U] * c0;
+      acc0[2] += px[2U] * c0;
+      acc0[3] += px[3U] * c0;
+
+      px += numCh;
+    }
+
+    for (i = 0U; i < 4U; i++)
+    {
+      pOut[i * chStride] = acc0[i];
+    }
+  }
+}
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+#if defined(ARM_MATH_NEON)
+
+/*
+ * Filters 4 channels at a time, one channel per lane. Each coefficient is
+ * loaded once for the channels of the vector and for 4 consecutive outputs.
+ */
+static void arm_fir_multichannel_neon_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const float32_t *pState = S->pState + ch;            /* State pointer */
+        float32_t *pOut = pDst + (ch * chStride);      /* Destination pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t lanes[4U];                           /* Outputs of the lanes, for planar data */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  float32x4_t acc0V, acc1V, acc2V, acc3V;
+  float32x4_t x0V, x1V, x2V, x3V, cV;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Set all accumulators to zero */
+    acc0V = vdupq_n_f32(0.0f);
+    acc1V = vdupq_n_f32(0.0f);
+    acc2V = vdupq_n_f32(0.0f);
+    acc3V = vdupq_n_f32(0.0f);
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    /* The samples of the 4 outputs slide by one sample for each coefficient */
+    x0V = vld1q_f32(px);
+    x1V = vld1q_f32(px + numCh);
+    x2V = vld1q_f32(px + 2U * numCh);
+    px += 3U * numCh;
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      x3V = vld1q_f32(px);
+      cV = vdupq_n_f32(*pb++);
+
+      acc0V = vmlaq_f32(acc0V, cV, x0V);
+      acc1V = vmlaq_f32(acc1V, cV, x1V);
+      acc2V = vmlaq_f32(acc2V, cV, x2V);
+      acc3V = vmlaq_f32(acc3V, cV, x3V);
+
+      x0V = x1V;
+      x1V = x2V;
+      x2V = x3V;
+      px += numCh;
+    }
+
+    /* Store the results in the destination buffer. */
+    if (chStride == 1U)
+    {
+      vst1q_f32(pOut, acc0V);
+      vst1q_f32(pOut + smpStride, acc1V);
+      vst1q_f32(pOut + 2U * smpStride, acc2V);
+      vst1q_f32(pOut + 3U * smpStride, acc3V);
+    }
+    else
+    {
+      vst1q_f32(lanes, acc0V);
+      for (i = 0U; i < 4U; i++)
+      {
+        pOut[i * chStride] = lanes[i];
+      }
+      vst1q_f32(lanes, acc1V);
+      for (i = 0U; i < 4U; i++)
+      {
+        pOut[i * chStride + smpStride] = lanes[i];
+      }
+      vst1q_f32(lanes, acc2V);
+      for (i = 0U; i < 4U; i++)
+      {
+        pOut[i * chStride + 2U * smpStride] = lanes[i];
+      }
+      vst1q_f32(lanes, acc3V);
+      for (i = 0U; i < 4U; i++)
+      {
+        pOut[i * chStride + 3U * smpStride] = lanes[i];
+      }
+    }
+
+    /* Advance the state pointer by 4 samples of all channels to process the next group of outputs */
+    pOut += 4U * smpStride;
+    pState += 4U * numCh;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    acc0V = vdupq_n_f32(0.0f);
+    px = pState;
+    pb = S->pCoeffs;
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      acc0V = vmlaq_f32(acc0V, vdupq_n_f32(*pb++), vld1q_f32(px));
+      px += numCh;
+    }
+
+    vst1q_f32(lanes, acc0V);
+    for (i = 0U; i < 4U; i++)
+    {
+      pOut[i * chStride] = lanes[i];
+    }
+
+    pOut += smpStride;
+    pState += numCh;
+
+    blkCnt--;
+  }
+}
+
+#define ARM_FIR_MULTICHANNEL_LANES 4U
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+/*
+ * Filters ARM_X86_F32_LANES channels at a time, one channel per lane. Each coefficient is
+ * loaded once for the channels of the vector and for 4 consecutive outputs.
+ */
+static void arm_fir_multichannel_x86_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const float32_t *pState = S->pState + ch;            /* State pointer */
+        float32_t *pOut = pDst + (ch * chStride);      /* Destination pointer */
+  const float32_t *px;                                 /* Temporary pointer for state buffer */
+  const float32_t *pb;                                 /* Temporary pointer for coefficient buffer */
+        float32_t lanes[ARM_X86_F32_LANES];            /* Outputs of the lanes, for planar data */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+
+  arm_x86_f32_t acc0V, acc1V, acc2V, acc3V;
+  arm_x86_f32_t x0V, x1V, x2V, x3V, cV;
+
+  /* Compute 4 outputs at a time */
+  blkCnt = blockSize >> 2U;
+
+  while (blkCnt > 0U)
+  {
+    /* Set all accumulators to zero */
+    acc0V = __arm_x86_dup_f32(0.0f);
+    acc1V = __arm_x86_dup_f32(0.0f);
+    acc2V = __arm_x86_dup_f32(0.0f);
+    acc3V = __arm_x86_dup_f32(0.0f);
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    /* The samples of the 4 outputs slide by one sample for each coefficient */
+    x0V = __arm_x86_ld_f32(px);
+    x1V = __arm_x86_ld_f32(px + numCh);
+    x2V = __arm_x86_ld_f32(px + 2U * numCh);
+    px += 3U * numCh;
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      x3V = __arm_x86_ld_f32(px);
+      cV = __arm_x86_dup_f32(*pb++);
+
+      acc0V = __arm_x86_fma_f32(acc0V, cV, x0V);
+      acc1V = __arm_x86_fma_f32(acc1V, cV, x1V);
+      acc2V = __arm_x86_fma_f32(acc2V, cV, x2V);
+      acc3V = __arm_x86_fma_f32(acc3V, cV, x3V);
+
+      x0V = x1V;
+      x1V = x2V;
+      x2V = x3V;
+      px += numCh;
+    }
+
+    /* Store the results in the destination buffer. */
+    if (chStride == 1U)
+    {
+      __arm_x86_st_f32(pOut, acc0V);
+      __arm_x86_st_f32(pOut + smpStride, acc1V);
+      __arm_x86_st_f32(pOut + 2U * smpStride, acc2V);
+      __arm_x86_st_f32(pOut + 3U * smpStride, acc3V);
+    }
+    else
+    {
+      __arm_x86_st_f32(lanes, acc0V);
+      for (i = 0U; i < ARM_X86_F32_LANES; i++)
+      {
+        pOut[i * chStride] = lanes[i];
+      }
+      __arm_x86_st_f32(lanes, acc1V);
+      for (i = 0U; i < ARM_X86_F32_LANES; i++)
+      {
+        pOut[i * chStride + smpStride] = lanes[i];
+      }
+      __arm_x86_st_f32(lanes, acc2V);
+      for (i = 0U; i < ARM_X86_F32_LANES; i++)
+      {
+        pOut[i * chStride + 2U * smpStride] = lanes[i];
+      }
+      __arm_x86_st_f32(lanes, acc3V);
+      for (i = 0U; i < ARM_X86_F32_LANES; i++)
+      {
+        pOut[i * chStride + 3U * smpStride] = lanes[i];
+      }
+    }
+
+    /* Advance the state pointer by 4 samples of all channels to process the next group of outputs */
+    pOut += 4U * smpStride;
+    pState += 4U * numCh;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Loop unrolling: Compute remaining outputs */
+  blkCnt = blockSize % 0x4U;
+
+  while (blkCnt > 0U)
+  {
+    acc0V = __arm_x86_dup_f32(0.0f);
+    px = pState;
+    pb = S->pCoeffs;
+
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      acc0V = __arm_x86_fma_f32(acc0V, __arm_x86_dup_f32(*pb++), __arm_x86_ld_f32(px));
+      px += numCh;
+    }
+
+    __arm_x86_st_f32(lanes, acc0V);
+    for (i = 0U; i < ARM_X86_F32_LANES; i++)
+    {
+      pOut[i * chStride] = lanes[i];
+    }
+
+    pOut += smpStride;
+    pState += numCh;
+
+    blkCnt--;
+  }
+}
+
+#define ARM_FIR_MULTICHANNEL_LANES ARM_X86_F32_LANES
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @brief         Processing function for the floating-point FIR filter. N channels
+  @param[in]     S          points to an instance of the floating-point FIR filter structure for N channels
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Data Layout
+                   The block holds <code>blockSize</code> samples of each of the <code>numChannels</code> channels,
+                   <code>blockSize*numChannels</code> values in total. They are either interleaved, with sample
+                   <code>n</code> of channel <code>c</code> at index <code>n*numChannels+c</code>, or planar,
+                   with the samples of channel <code>c</code> from index <code>c*blockSize</code>.
+                   The output has the same layout as the input. <code>pSrc</code> and <code>pDst</code> may be the same buffer.
+
+  @par           Algorithm
+                   All the channels are filtered with the same coefficients. The state holds the samples of all
+                   the channels interleaved, so that the channels of a sample are contiguous. The channels are filtered
+                   in groups, several channels per vector with Neon or x86 SIMD, and 4 channels at a time
+                   when loop unrolling is enabled. Each coefficient is loaded once for all the channels of a group instead of
+                   once per channel. The remaining channels are filtered one at a time.
+ */
+void arm_fir_multichannel_f32(
+  const arm_fir_multichannel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+        float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+        uint32_t numCh = S->numChannels;               /* Number of channels */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t ch = 0U;                              /* First channel of the group */
+        uint32_t c, n, tapCnt;                         /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples of each channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + ((numTaps - 1U) * numCh);
+
+  /* Copy the new samples of all the channels into the state buffer, interleaved */
+  if (S->interleaved != 0U)
+  {
+    arm_copy_f32(pSrc, pStateCurnt, blockSize * numCh);
+  }
+  else
+  {
+    for (c = 0U; c < numCh; c++)
+    {
+      for (n = 0U; n < blockSize; n++)
+      {
+        pStateCurnt[(n * numCh) + c] = pSrc[(c * blockSize) + n];
+      }
+    }
+  }
+
+#if defined(ARM_FIR_MULTICHANNEL_LANES)
+
+  /* One channel per lane */
+  for (; (ch + ARM_FIR_MULTICHANNEL_LANES) <= numCh; ch += ARM_FIR_MULTICHANNEL_LANES)
+  {
+#if defined(ARM_MATH_NEON)
+    arm_fir_multichannel_neon_f32(S, pDst, blockSize, ch);
+#else
+    arm_fir_multichannel_x86_f32(S, pDst, blockSize, ch);
+#endif
+  }
+
+#endif /* #if defined(ARM_FIR_MULTICHANNEL_LANES) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Filter 4 channels at a time */
+  for (; (ch + 4U) <= numCh; ch += 4U)
+  {
+    arm_fir_multichannel_x4_f32(S, pDst, blockSize, ch);
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining channels */
+  for (; ch < numCh; ch++)
+  {
+    arm_fir_multichannel_x1_f32(S, pDst, blockSize, ch);
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples of each channel to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* The last numTaps - 1 samples of each channel start blockSize samples later */
+  pState += blockSize * numCh;
+
+  tapCnt = (numTaps - 1U) * numCh;
+
+  /* Copy remaining data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+}
+
+#undef ARM_FIR_MULTICHANNEL_LANES
+
+/**
+  @} end of FIR group
+ */
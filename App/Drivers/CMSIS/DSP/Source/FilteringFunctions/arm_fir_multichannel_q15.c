@@ -0,0 +1,255 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_multichannel_q15.c
+ * Description:  Q15 FIR filter processing function. N channels
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR
+  @{
+ */
+
+/*
+ * Filters one channel. Used for the channels left over by the groups.
+ */
+static void arm_fir_multichannel_x1_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+        q15_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const q15_t *pState = S->pState + ch;                /* State pointer */
+        q15_t *pOut = pDst + (ch * chStride);          /* Destination pointer */
+  const q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q63_t acc0;                                    /* Accumulator */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Set the accumulator to zero */
+    acc0 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    /* Perform the multiply-accumulates */
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      acc0 += (q31_t) *px * *pb++;
+      px += numCh;
+    }
+
+    /* Store result in destination buffer. */
+    *pOut = (q15_t) (__SSAT((acc0 >> 15), 16));
+
+    /* Advance the state pointer by one sample of all channels to process the next sample */
+    pOut += smpStride;
+    pState += numCh;
+  }
+}
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+/*
+ * Filters 4 channels at a time. Each coefficient is loaded once for the 4 channels.
+ */
+static void arm_fir_multichannel_x4_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+        q15_t * pDst,
+        uint32_t blockSize,
+        uint32_t ch)
+{
+        uint32_t numCh = S->numChannels;               /* Number of channels, and distance between two samples in the state */
+        uint32_t chStride = (S->interleaved != 0U) ? 1U : blockSize;  /* Distance between two output channels */
+        uint32_t smpStride = (S->interleaved != 0U) ? numCh : 1U;     /* Distance between two output samples of a channel */
+  const q15_t *pState = S->pState + ch;                /* State pointer */
+        q15_t *pOut = pDst + (ch * chStride);          /* Destination pointer */
+  const q15_t *px;                                     /* Temporary pointer for state buffer */
+  const q15_t *pb;                                     /* Temporary pointer for coefficient buffer */
+        q63_t acc0, acc1, acc2, acc3;                  /* Accumulators */
+        q15_t c0;                                      /* Temporary variable to hold coefficient value */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt, blkCnt;                       /* Loop counters */
+
+  for (blkCnt = blockSize; blkCnt > 0U; blkCnt--)
+  {
+    /* Set all accumulators to zero */
+    acc0 = 0;
+    acc1 = 0;
+    acc2 = 0;
+    acc3 = 0;
+
+    /* Initialize state pointer */
+    px = pState;
+
+    /* Initialize Coefficient pointer */
+    pb = S->pCoeffs;
+
+    /* Perform the multiply-accumulates */
+    for (tapCnt = numTaps; tapCnt > 0U; tapCnt--)
+    {
+      /* Read the coefficient once for the 4 channels */
+      c0 = *pb++;
+
+      acc0 += (q31_t) px[0U] * c0;
+      acc1 += (q31_t) px[1U] * c0;
+      acc2 += (q31_t) px[2U] * c0;
+      acc3 += (q31_t) px[3U] * c0;
+
+      px += numCh;
+    }
+
+    /* Store the results in the destination buffer. */
+    pOut[0U] = (q15_t) (__SSAT((acc0 >> 15), 16));
+    pOut[chStride] = (q15_t) (__SSAT((acc1 >> 15), 16));
+    pOut[2U * chStride] = (q15_t) (__SSAT((acc2 >> 15), 16));
+    pOut[3U * chStride] = (q15_t) (__SSAT((acc3 >> 15), 16));
+
+    /* Advance the state pointer by one sample of all channels to process the next sample */
+    pOut += smpStride;
+    pState += numCh;
+  }
+}
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+/**
+  @brief         Processing function for the Q15 FIR filter. N channels
+  @param[in]     S          points to an instance of the Q15 FIR filter structure for N channels
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process per channel
+  @return        none
+
+  @par           Data Layout
+                   The block holds <code>blockSize</code> samples of each of the <code>numChannels</code> channels,
+                   <code>blockSize*numChannels</code> values in total. They are either interleaved, with sample
+                   <code>n</code> of channel <code>c</code> at index <code>n*numChannels+c</code>, or planar,
+                   with the samples of channel <code>c</code> from index <code>c*blockSize</code>.
+                   The output has the same layout as the input. <code>pSrc</code> and <code>pDst</code> may be the same buffer.
+
+  @par           Algorithm
+                   All the channels are filtered with the same coefficients. The state holds the samples of all
+                   the channels interleaved, so that the channels of a sample are contiguous. The channels are filtered
+                   in groups, 4 channels at a time when loop unrolling is enabled. Each coefficient is loaded once for all the channels of a group instead of
+                   once per channel. The remaining channels are filtered one at a time.
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+                   The outputs are the same as those of arm_fir_q15() applied to each channel.
+ */
+void arm_fir_multichannel_q15(
+  const arm_fir_multichannel_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState;                     /* State pointer */
+        q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+        uint32_t numCh = S->numChannels;               /* Number of channels */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t ch = 0U;                              /* First channel of the group */
+        uint32_t c, n, tapCnt;                         /* Loop counters */
+
+  /* S->pState points to state array which contains previous frame (numTaps - 1) samples of each channel */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = pState + ((numTaps - 1U) * numCh);
+
+  /* Copy the new samples of all the channels into the state buffer, interleaved */
+  if (S->interleaved != 0U)
+  {
+    arm_copy_q15(pSrc, pStateCurnt, blockSize * numCh);
+  }
+  else
+  {
+    for (c = 0U; c < numCh; c++)
+    {
+      for (n = 0U; n < blockSize; n++)
+      {
+        pStateCurnt[(n * numCh) + c] = pSrc[(c * blockSize) + n];
+      }
+    }
+  }
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Filter 4 channels at a time */
+  for (; (ch + 4U) <= numCh; ch += 4U)
+  {
+    arm_fir_multichannel_x4_q15(S, pDst, blockSize, ch);
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  /* Remaining channels */
+  for (; ch < numCh; ch++)
+  {
+    arm_fir_multichannel_x1_q15(S, pDst, blockSize, ch);
+  }
+
+  /* Processing is complete.
+     Now copy the last numTaps - 1 samples of each channel to the start of the state buffer.
+     This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  /* The last numTaps - 1 samples of each channel start blockSize samples later */
+  pState += blockSize * numCh;
+
+  tapCnt = (numTaps - 1U) * numCh;
+
+  /* Copy remaining data */
+  while (tapCnt > 0U)
+  {
+    *pStateCurnt++ = *pState++;
+
+    /* Decrement loop counter */
+    tapCnt--;
+  }
+}
+
+/**
+  @} end of FIR group
+ */
@@ -37,27 +37,13 @@
   @{
  */
 
-/**
-  @brief         Processing function for the Q15 FIR filter.
-  @param[in]     S          points to an instance of the Q15 FIR filter structure
-  @param[in]     pSrc       points to the block of input data
-  @param[out]    pDst       points to the block of output data
-  @param[in]     blockSize  number of samples to process
-  @return        none
-
-  @par           Scaling and Overflow Behavior
-                   The function is implemented using a 64-bit internal accumulator.
-                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
-                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
-                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
-                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
-                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
-
-  @remark
-                   Refer to \ref arm_fir_fast_q15() for a faster but less precise implementation of this function.
+/*
+ * Filters a block through the state window at S->pState, without the copy of the
+ * last numTaps - 1 samples to the start of the state buffer.
+ * Shared by arm_fir_q15() and arm_fir_circ_q15().
  */
 
-void arm_fir_q15(
+void arm_fir_block_q15(
   const arm_fir_instance_q15 * S,
   const q15_t * pSrc,
         q15_t * pDst,
@@ -281,6 +267,40 @@ void arm_fir_q15(
     /* Decrement loop counter */
     blkCnt--;
   }
+}
+
+/**
+  @brief         Processing function for the Q15 FIR filter.
+  @param[in]     S          points to an instance of the Q15 FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 64-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   After all additions have been performed, the accumulator is truncated to 34.15 format by discarding low 15 bits.
+                   Lastly, the accumulator is saturated to yield a result in 1.15 format.
+
+  @remark
+                   Refer to \ref arm_fir_fast_q15() for a faster but less precise implementation of this function.
+ */
+
+void arm_fir_q15(
+  const arm_fir_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        q15_t *pState = S->pState + blockSize;         /* Last numTaps - 1 samples of the state */
+        q15_t *pStateCurnt;                            /* Points to the current sample of the state */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  arm_fir_block_q15(S, pSrc, pDst, blockSize);
 
   /* Processing is complete.
      Now copy the last numTaps - 1 samples to the start of the state buffer.
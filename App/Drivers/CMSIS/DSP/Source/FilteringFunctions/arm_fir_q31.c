@@ -37,26 +37,13 @@
   @{
  */
 
-/**
-  @brief         Processing function for Q31 FIR filter.
-  @param[in]     S          points to an instance of the Q31 FIR filter structure
-  @param[in]     pSrc       points to the block of input data
-  @param[out]    pDst       points to the block of output data
-  @param[in]     blockSize  number of samples to process
-  @return        none
-
-  @par           Scaling and Overflow Behavior
-                   The function is implemented using an internal 64-bit accumulator.
-                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
-                   Thus, if the accumulator result overflows it wraps around rather than clip.
-                   In order to avoid overflows completely the input signal must be scaled down by log2(numTaps) bits.
-                   After all multiply-accumulates are performed, the 2.62 accumulator is right shifted by 31 bits and saturated to 1.31 format to yield the final result.
-
- @remark
-                   Refer to \ref arm_fir_fast_q31() for a faster but less precise implementation of this filter.
+/*
+ * Filters a block through the state window at S->pState, without the copy of the
+ * last numTaps - 1 samples to the start of the state buffer.
+ * Shared by arm_fir_q31() and arm_fir_circ_q31().
  */
 
-void arm_fir_q31(
+void arm_fir_block_q31(
   const arm_fir_instance_q31 * S,
   const q31_t * pSrc,
         q31_t * pDst,
@@ -69,12 +56,13 @@ void arm_fir_q31(
   const q31_t *pb;                                     /* Temporary pointer for coefficient buffer */
         q63_t acc0;                                    /* Accumulator */
         uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
-        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+        uint32_t i, blkCnt;                            /* Loop counters */
 
 #if defined (ARM_MATH_LOOPUNROLL)
         q63_t acc1, acc2;                              /* Accumulators */
         q31_t x0, x1, x2;                              /* Temporary variables to hold state values */
         q31_t c0;                                      /* Temporary variable to hold coefficient value */
+        uint32_t tapCnt;                               /* Loop counter */
 #endif
 
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
@@ -237,6 +225,39 @@ void arm_fir_q31(
     /* Decrement loop counter */
     blkCnt--;
   }
+}
+
+/**
+  @brief         Processing function for Q31 FIR filter.
+  @param[in]     S          points to an instance of the Q31 FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by log2(numTaps) bits.
+                   After all multiply-accumulates are performed, the 2.62 accumulator is right shifted by 31 bits and saturated to 1.31 format to yield the final result.
+
+ @remark
+                   Refer to \ref arm_fir_fast_q31() for a faster but less precise implementation of this filter.
+ */
+
+void arm_fir_q31(
+  const arm_fir_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState + blockSize;         /* Last numTaps - 1 samples of the state */
+        q31_t *pStateCurnt;                            /* Points to the current sample of the state */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  arm_fir_block_q31(S, pSrc, pDst, blockSize);
 
   /* Processing is complete.
      Now copy the last numTaps - 1 samples to the start of the state buffer.
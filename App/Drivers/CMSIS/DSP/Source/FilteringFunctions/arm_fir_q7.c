@@ -37,24 +37,13 @@
   @{
  */
 
-/**
-  @brief         Processing function for Q7 FIR filter.
-  @param[in]     S          points to an instance of the Q7 FIR filter structure
-  @param[in]     pSrc       points to the block of input data
-  @param[out]    pDst       points to the block of output data
-  @param[in]     blockSize  number of samples to process
-  @return        none
-
-  @par           Scaling and Overflow Behavior
-                   The function is implemented using a 32-bit internal accumulator.
-                   Both coefficients and state variables are represented in 1.7 format and multiplications yield a 2.14 result.
-                   The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
-                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
-                   The accumulator is converted to 18.7 format by discarding the low 7 bits.
-                   Finally, the result is truncated to 1.7 format.
+/*
+ * Filters a block through the state window at S->pState, without the copy of the
+ * last numTaps - 1 samples to the start of the state buffer.
+ * Shared by arm_fir_q7() and arm_fir_circ_q7().
  */
 
-void arm_fir_q7(
+void arm_fir_block_q7(
   const arm_fir_instance_q7 * S,
   const q7_t * pSrc,
         q7_t * pDst,
@@ -67,11 +56,12 @@ void arm_fir_q7(
   const q7_t *pb;                                      /* Temporary pointer for coefficient buffer */
         q31_t acc0;                                    /* Accumulators */
         uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
-        uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+        uint32_t i, blkCnt;                            /* Loop counters */
 
 #if defined (ARM_MATH_LOOPUNROLL)
         q31_t acc1, acc2, acc3;                        /* Accumulators */
         q7_t x0, x1, x2, x3, c0;                       /* Temporary variables to hold state */
+        uint32_t tapCnt;                               /* Loop counter */
 #endif
 
   /* S->pState points to state array which contains previous frame (numTaps - 1) samples */
@@ -272,6 +262,37 @@ void arm_fir_q7(
     /* Decrement loop counter */
     blkCnt--;
   }
+}
+
+/**
+  @brief         Processing function for Q7 FIR filter.
+  @param[in]     S          points to an instance of the Q7 FIR filter structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of samples to process
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using a 32-bit internal accumulator.
+                   Both coefficients and state variables are represented in 1.7 format and multiplications yield a 2.14 result.
+                   The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+                   There is no risk of internal overflow with this approach and the full precision of intermediate multiplications is preserved.
+                   The accumulator is converted to 18.7 format by discarding the low 7 bits.
+                   Finally, the result is truncated to 1.7 format.
+ */
+
+void arm_fir_q7(
+  const arm_fir_instance_q7 * S,
+  const q7_t * pSrc,
+        q7_t * pDst,
+        uint32_t blockSize)
+{
+        q7_t *pState = S->pState + blockSize;          /* Last numTaps - 1 samples of the state */
+        q7_t *pStateCurnt;                             /* Points to the current sample of the state */
+        uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  arm_fir_block_q7(S, pSrc, pDst, blockSize);
 
   /* Processing is complete.
      Now copy the last numTaps - 1 samples to the start of the state buffer.
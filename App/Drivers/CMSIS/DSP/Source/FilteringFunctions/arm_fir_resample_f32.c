@@ -0,0 +1,225 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_f32.c
+ * Description:  Floating-point FIR rational and arbitrary-ratio resampler
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @defgroup FIR_Resample Finite Impulse Response (FIR) Resampler
+
+  These functions change the sample rate by a ratio <code>L/M</code>, which is
+  equivalent to an FIR interpolator by <code>L</code> followed by keeping one
+  sample every <code>M</code>. Only the outputs which are kept are computed, so each
+  output costs <code>phaseLength</code> multiply-accumulates whatever <code>L</code>
+  and <code>M</code>, and no intermediate signal at <code>L</code> times the input rate is stored.
+  For instance 44.1 kHz is converted to 48 kHz with <code>L = 160</code> and <code>M = 147</code>.
+
+  The functions also resample by an arbitrary ratio, given as a step between outputs
+  of <code>M + stepFrac/2^32</code> polyphase components. An output which falls between
+  two components is interpolated linearly between them. With enough components, for
+  instance <code>L = 64</code> or more, the error of the linear interpolation is below
+  the stop-band attenuation of usual filters. The step may be changed between two calls,
+  to track a drifting clock for instance, but must stay at least one component.
+
+  The number of output samples of each call varies with the position of the outputs,
+  and is returned by the processing function. It is at most
+  <code>(blockSize*L)/(M + stepFrac/2^32) + 1</code>, so at most <code>(blockSize*L)/M + 1</code>.
+
+  @par           Algorithm
+                   The filter is split into <code>L</code> polyphase components of
+                   <code>phaseLength = numTaps/L</code> coefficients, as for the \ref FIR_Interpolate functions.
+                   Output <code>m</code> is at position <code>t = m*(M + stepFrac/2^32)</code> in units of
+                   components, where component <code>t mod L</code> is applied to the last <code>phaseLength</code> input
+                   samples up to <code>x[floor(t/L)]</code>:
+  <pre>
+      y[m] = b[p] * x[n] + b[L+p] * x[n-1] + ... + b[L*(phaseLength-1)+p] * x[n-phaseLength+1]
+  </pre>
+                   with <code>n = floor(t/L)</code> and <code>p = t mod L</code>.
+                   With <code>stepFrac = 0</code> the output is the output of arm_fir_interpolate_f32() with the same
+                   coefficients, decimated by <code>M</code>. The filter should be a lowpass filter with a normalized
+                   cutoff frequency of <code>1/max(L, M)</code> and a gain of <code>L</code>.
+  @par
+                   <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, a multiple of <code>L</code>.
+                   Coefficients are stored in time reversed order, as for the FIR interpolator:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+  </pre>
+  @par
+                   <code>pState</code> points to a state array of size <code>phaseLength + blockSize</code>.
+                   Samples in the state buffer are stored in the order:
+  <pre>
+     {x[n-phaseLength], x[n-phaseLength+1], ..., x[n-1], x[n], x[n+1], ..., x[n+blockSize-1]}
+  </pre>
+                   The state keeps one more past sample than the FIR interpolator, because an output
+                   interpolated between the last component of one input and the first component of the
+                   next one needs both windows.
+
+  @par           Instance Structure
+                   The coefficients and state variables for a resampler are stored together in an instance data structure,
+                   with the position of the next output. A separate instance structure must be defined for each resampler.
+                   Coefficient arrays may be shared among several instances while state variable arrays cannot be shared.
+
+  @par           Initialization Functions
+                   The initialization function sets the fields of the instance, places the first output on the first
+                   input sample and zeros out the state buffer.
+                   It checks that the length of the filter is a multiple of <code>L</code>, that the step is at least one
+                   component and that <code>blockSize*L</code> fits in a signed 32-bit integer.
+
+  @par           Fixed-Point Behavior
+                   Care must be taken when using the fixed-point versions of the FIR resampler functions.
+                   In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+                   Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/*
+ * Output of the polyphase component at position pos, in components from the
+ * first new input sample. pos is at least -1.
+ */
+static float32_t arm_fir_resample_component_f32(
+  const float32_t * pState,
+  const float32_t * pCoeffs,
+        uint32_t L,
+        uint32_t phaseLen,
+        int32_t pos)
+{
+  const float32_t *px;                                 /* Input window pointer */
+  const float32_t *pb;                                 /* Coefficient pointer */
+        float32_t sum0 = 0.0f;                         /* Accumulator */
+        uint32_t u = (uint32_t) (pos + (int32_t) L);   /* Position from the last previous input sample */
+        uint32_t tapCnt;                               /* Loop counter */
+
+  /* The window ends with input floor(pos/L), which is at index floor(pos/L) + phaseLen of the state */
+  px = pState + (u / L);
+  pb = pCoeffs + (L - 1U - (u % L));
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 taps at a time */
+  for (tapCnt = phaseLen >> 2U; tapCnt > 0U; tapCnt--)
+  {
+    sum0 += px[0] * pb[0];
+    sum0 += px[1] * pb[L];
+    sum0 += px[2] * pb[2U * L];
+    sum0 += px[3] * pb[3U * L];
+
+    px += 4U;
+    pb += 4U * L;
+  }
+
+  /* Loop unrolling: Compute remaining taps */
+  tapCnt = phaseLen & 0x3U;
+
+#else
+
+  tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (tapCnt > 0U)
+  {
+    sum0 += *px++ * *pb;
+    pb += L;
+
+    tapCnt--;
+  }
+
+  return (sum0);
+}
+
+/**
+  @brief         Processing function for the floating-point FIR resampler.
+  @param[in,out] S          points to an instance of the floating-point FIR resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> given to the initialization function
+  @return        number of output samples written to <code>pDst</code>, at most <code>(blockSize*L)/(M + stepFrac/2^32) + 1</code>
+ */
+
+uint32_t arm_fir_resample_f32(
+        arm_fir_resample_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        float32_t *pState = S->pState;                 /* State pointer */
+  const float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+        uint32_t L = S->L;                             /* Number of polyphase components */
+        uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+        int32_t end = (int32_t) (blockSize * L);       /* Position of the first input sample of the next block */
+        int32_t pos = S->phase;                        /* Position of the next output */
+        uint32_t frac = S->phaseFrac;                  /* Fractional part of the position */
+        uint32_t carry;                                /* Carry of the fractional part */
+        uint32_t outCnt = 0U;                          /* Number of outputs */
+        float32_t acc0, acc1;                          /* Outputs of two adjacent components */
+
+  /* The phaseLen previous input samples are at the start of the state buffer */
+  arm_copy_f32(pSrc, pState + phaseLen, blockSize);
+
+  /* An output between two components also needs the input of the second one */
+  while ((pos + ((frac != 0U) ? 1 : 0)) < end)
+  {
+    acc0 = arm_fir_resample_component_f32(pState, pCoeffs, L, phaseLen, pos);
+
+    if (frac != 0U)
+    {
+      acc1 = arm_fir_resample_component_f32(pState, pCoeffs, L, phaseLen, pos + 1);
+
+      /* Linear interpolation with a weight of frac / 2^32 */
+      acc0 += (acc1 - acc0) * ((float32_t) frac * 2.3283064365386963e-10f);
+    }
+
+    *pDst++ = acc0;
+    outCnt++;
+
+    /* Advance by the step, with the carry of the fractional part */
+    carry = ((frac + S->stepFrac) < frac) ? 1U : 0U;
+    frac += S->stepFrac;
+    pos += (int32_t) (S->M + carry);
+  }
+
+  /* Position of the next output relative to the next block */
+  S->phase = pos - end;
+  S->phaseFrac = frac;
+
+  /* Keep the last phaseLen input samples for the next call */
+  memmove(pState, pState + blockSize, phaseLen * sizeof(float32_t));
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
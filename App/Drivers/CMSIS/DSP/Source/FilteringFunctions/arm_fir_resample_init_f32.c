@@ -0,0 +1,131 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_init_f32.c
+ * Description:  Floating-point FIR resampler initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point FIR resampler.
+  @param[in,out] S          points to an instance of the floating-point FIR resampler structure
+  @param[in]     L          upsample factor, number of polyphase components
+  @param[in]     M          downsample factor, integer part of the step between outputs in polyphase components
+  @param[in]     stepFrac   fractional part of the step, in units of 2^-32 of a polyphase component, 0 for a ratio of L/M
+  @param[in]     numTaps    number of filter coefficients in the filter
+  @param[in]     pCoeffs    points to the filter coefficient buffer
+  @param[in]     pState     points to the state buffer
+  @param[in]     blockSize  number of input samples to process per call
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_LENGTH_ERROR   : filter length <code>numTaps</code> is not a multiple of <code>L</code>,
+                                                    or <code>blockSize*L</code> is above <code>INT32_MAX</code>
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>L</code> is zero or the step is below one component (<code>M</code> is zero)
+
+  @par           Details
+                   <code>pCoeffs</code> points to the array of filter coefficients stored in time reversed order:
+  <pre>
+      {b[numTaps-1], b[numTaps-2], b[numTaps-3], ..., b[1], b[0]}
+  </pre>
+  @par
+                   The length of the filter <code>numTaps</code> must be a multiple of the upsample factor <code>L</code>.
+  @par
+                   For a resampling ratio <code>r = Fout/Fin</code>, the step is <code>L/r</code> components:
+                   <code>M</code> is its integer part and <code>stepFrac</code> its fractional part multiplied by 2^32.
+                   The step must be at least one component, so that <code>M</code> is at least 1: a call then gives at
+                   most <code>(blockSize*L)/(M + stepFrac/2^32) + 1</code> outputs, which is at most
+                   <code>(blockSize*L)/M + 1</code>. For a larger ratio, increase <code>L</code>.
+  @par
+                   <code>pState</code> points to the array of state variables.
+                   <code>pState</code> is of length <code>(numTaps/L)+blockSize</code> words
+                   where <code>blockSize</code> is the number of input samples processed by each call to <code>arm_fir_resample_f32()</code>.
+ */
+
+arm_status arm_fir_resample_init_f32(
+        arm_fir_resample_instance_f32 * S,
+        uint16_t L,
+        uint32_t M,
+        uint32_t stepFrac,
+        uint16_t numTaps,
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        uint32_t blockSize)
+{
+  arm_status status;
+
+  /* A step below one component would give more outputs than the bound on the output buffer */
+  if ((L == 0U) || (M == 0U))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  /* The filter length must be a multiple of the upsample factor, and the
+     positions of the outputs in a block must fit in a signed 32-bit integer */
+  else if (((numTaps % L) != 0U) || (((uint64_t) blockSize * L) > (uint64_t) INT32_MAX))
+  {
+    /* Set status as ARM_MATH_LENGTH_ERROR */
+    status = ARM_MATH_LENGTH_ERROR;
+  }
+  else
+  {
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Assign upsample factor and polyPhaseLength */
+    S->L = L;
+    S->phaseLength = numTaps / L;
+
+    /* Assign step between outputs */
+    S->M = M;
+    S->stepFrac = stepFrac;
+
+    /* The first output is on the first input sample */
+    S->phase = 0;
+    S->phaseFrac = 0U;
+
+    /* Clear state buffer and size of buffer is always phaseLength + blockSize */
+    memset(pState, 0, (blockSize + (uint32_t) S->phaseLength) * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
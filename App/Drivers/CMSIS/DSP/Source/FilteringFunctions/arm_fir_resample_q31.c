@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fir_resample_q31.c
+ * Description:  Q31 FIR rational and arbitrary-ratio resampler
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupFilters
+ */
+
+/**
+  @addtogroup FIR_Resample
+  @{
+ */
+
+/*
+ * Output of the polyphase component at position pos, in components from the
+ * first new input sample. pos is at least -1.
+ */
+static q31_t arm_fir_resample_component_q31(
+  const q31_t * pState,
+  const q31_t * pCoeffs,
+        uint32_t L,
+        uint32_t phaseLen,
+        int32_t pos)
+{
+  const q31_t *px;                                         /* Input window pointer */
+  const q31_t *pb;                                         /* Coefficient pointer */
+        q63_t sum0 = 0;                                    /* Accumulator */
+        uint32_t u = (uint32_t) (pos + (int32_t) L);       /* Position from the last previous input sample */
+        uint32_t tapCnt;                                   /* Loop counter */
+
+  /* The window ends with input floor(pos/L), which is at index floor(pos/L) + phaseLen of the state */
+  px = pState + (u / L);
+  pb = pCoeffs + (L - 1U - (u % L));
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Compute 4 taps at a time */
+  for (tapCnt = phaseLen >> 2U; tapCnt > 0U; tapCnt--)
+  {
+    sum0 += (q63_t) px[0] * pb[0];
+    sum0 += (q63_t) px[1] * pb[L];
+    sum0 += (q63_t) px[2] * pb[2U * L];
+    sum0 += (q63_t) px[3] * pb[3U * L];
+
+    px += 4U;
+    pb += 4U * L;
+  }
+
+  /* Loop unrolling: Compute remaining taps */
+  tapCnt = phaseLen & 0x3U;
+
+#else
+
+  tapCnt = phaseLen;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  while (tapCnt > 0U)
+  {
+    sum0 += (q63_t) *px++ * *pb;
+    pb += L;
+
+    tapCnt--;
+  }
+
+  /* Convert the result from 2.62 to 1.31 format */
+  return ((q31_t) (sum0 >> 31));
+}
+
+/**
+  @brief         Processing function for the Q31 FIR resampler.
+  @param[in,out] S          points to an instance of the Q31 FIR resampler structure
+  @param[in]     pSrc       points to the block of input data
+  @param[out]    pDst       points to the block of output data
+  @param[in]     blockSize  number of input samples to process, at most the <code>blockSize</code> given to the initialization function
+  @return        number of output samples written to <code>pDst</code>, at most <code>(blockSize*L)/(M + stepFrac/2^32) + 1</code>
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate multiplication results but provides only a single guard bit.
+                   Thus, if the accumulator result overflows it wraps around rather than clip.
+                   In order to avoid overflows completely the input signal must be scaled down by log2(phaseLength) bits,
+                   as for arm_fir_interpolate_q31().
+                   After all multiply-accumulates are performed, the 2.62 accumulator is truncated to 1.31 format.
+                   Outputs between two components are interpolated from the two 1.31 results with a 1.31 weight.
+ */
+
+uint32_t arm_fir_resample_q31(
+        arm_fir_resample_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        q31_t *pState = S->pState;                         /* State pointer */
+  const q31_t *pCoeffs = S->pCoeffs;                       /* Coefficient pointer */
+        uint32_t L = S->L;                                 /* Number of polyphase components */
+        uint32_t phaseLen = S->phaseLength;                /* Length of each polyphase filter component */
+        int32_t end = (int32_t) (blockSize * L);           /* Position of the first input sample of the next block */
+        int32_t pos = S->phase;                            /* Position of the next output */
+        uint32_t frac = S->phaseFrac;                      /* Fractional part of the position */
+        uint32_t carry;                                    /* Carry of the fractional part */
+        uint32_t outCnt = 0U;                              /* Number of outputs */
+        q31_t acc0, acc1;                                  /* Outputs of two adjacent components */
+
+  /* The phaseLen previous input samples are at the start of the state buffer */
+  arm_copy_q31(pSrc, pState + phaseLen, blockSize);
+
+  /* An output between two components also needs the input of the second one */
+  while ((pos + ((frac != 0U) ? 1 : 0)) < end)
+  {
+    acc0 = arm_fir_resample_component_q31(pState, pCoeffs, L, phaseLen, pos);
+
+    if (frac != 0U)
+    {
+      acc1 = arm_fir_resample_component_q31(pState, pCoeffs, L, phaseLen, pos + 1);
+
+      /* Linear interpolation with a weight of frac / 2^32 in 1.31 format */
+      acc0 += (q31_t) ((((q63_t) acc1 - acc0) * (q31_t) (frac >> 1U)) >> 31);
+    }
+
+    *pDst++ = acc0;
+    outCnt++;
+
+    /* Advance by the step, with the carry of the fractional part */
+    carry = ((frac + S->stepFrac) < frac) ? 1U : 0U;
+    frac += S->stepFrac;
+    pos += (int32_t) (S->M + carry);
+  }
+
+  /* Position of the next output relative to the next block */
+  S->phase = pos - end;
+  S->phaseFrac = frac;
+
+  /* Keep the last phaseLen input samples for the next call */
+  memmove(pState, pState + blockSize, phaseLen * sizeof(q31_t));
+
+  return (outCnt);
+}
+
+/**
+  @} end of FIR_Resample group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_f32.c
+ * Description:  Floating-point Cholesky decomposition
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixChol Cholesky Decomposition
+
+  Computes the Cholesky decomposition <code>A = L * L'</code> of a symmetric
+  positive definite matrix, where <code>L</code> is lower triangular with a
+  positive diagonal, and solves <code>A * X = B</code> with it.
+
+  Solving through the decomposition takes about a third of the operations of
+  arm_mat_inverse_f32() followed by a multiplication, and is more accurate.
+
+  @par Algorithm
+  The Cholesky-Banachiewicz method computes <code>L</code> one row at a time,
+  so that every inner product runs over two contiguous rows. Only the lower
+  triangle of the input is read. If a diagonal term is not positive the matrix
+  is not positive definite and the function returns
+  <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+
+  @par In-place operation
+  The output may be the same matrix instance as the input, in which case
+  <code>A</code> is overwritten by <code>L</code> and no second matrix is needed.
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+  @param[in]     pSrc      points to the instance of the input matrix
+  @param[out]    pDst      points to the instance of the output matrix, which receives the lower triangular factor
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS               : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH         : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : Input matrix is not positive definite
+
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pSrc</code>.
+                   The upper triangle of the output is set to zero.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  const float32_t *pRowI, *pRowJ;                /* rows of the output matrix */
+  float32_t sum;                                 /* accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pOut + i * n;
+
+      for (j = 0U; j <= i; j++)
+      {
+        pRowJ = pOut + j * n;
+
+        /* L(i,j) = (A(i,j) - sum(L(i,k) * L(j,k), k < j)) / L(j,j).
+           A(i,j) is read before L(i,j) is written, so pIn may alias pOut */
+        sum = pIn[i * n + j];
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+
+        if (j < i)
+        {
+          pOut[i * n + j] = sum / pRowJ[j];
+        }
+        else if (sum > 0.0f)
+        {
+          pOut[i * n + i] = sqrtf(sum);
+        }
+        else
+        {
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1U; j < n; j++)
+      {
+        pOut[i * n + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
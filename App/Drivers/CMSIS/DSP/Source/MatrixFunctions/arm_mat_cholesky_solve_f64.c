@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_cholesky_solve_f64.c
+ * Description:  Floating-point solve using a Cholesky decomposition
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixChol
+  @{
+ */
+
+/**
+  @brief         Floating-point (64 bit) solve of <code>A * X = B</code> from the Cholesky factor of <code>A</code>.
+  @param[in]     pL        points to the instance of the factor computed by arm_mat_cholesky_f64()
+  @param[in]     pB        points to the instance of the right-hand side matrix
+  @param[out]    pDst      points to the instance of the output matrix, of the same size as <code>pB</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : The factor has a zero diagonal term
+
+  @par           Details
+                   Solves <code>L * Y = B</code> by forward substitution, then
+                   <code>L' * X = Y</code> by back substitution reading <code>L</code>
+                   by columns, so the transpose is never formed.
+                   Only the lower triangle of <code>pL</code> is read.
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pB</code>.
+ */
+
+arm_status arm_mat_cholesky_solve_f64(
+  const arm_matrix_instance_f64 * pL,
+  const arm_matrix_instance_f64 * pB,
+        arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pLData = pL->pData;           /* factor data pointer */
+  float64_t *pX = pDst->pData;                   /* solution data pointer */
+  float64_t *pRowI;                              /* row of the solution being computed */
+  const float64_t *pRowK;                        /* row of the solution already computed */
+  float64_t coef;                                /* factor term */
+  uint32_t n = pL->numRows;                      /* size of the factor */
+  uint32_t m = pB->numCols;                      /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pL->numRows != pL->numCols) ||
+      (pB->numRows != pL->numRows) ||
+      (pDst->numRows != pB->numRows) ||
+      (pDst->numCols != pB->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pLData[i * n + i] == 0.0)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+      if (pX != pB->pData)
+      {
+        memcpy(pX, pB->pData, n * m * sizeof(float64_t));
+      }
+
+      /* Forward substitution, L * Y = B */
+      for (i = 0U; i < n; i++)
+      {
+        pRowI = pX + i * m;
+        for (k = 0U; k < i; k++)
+        {
+          coef = pLData[i * n + k];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+
+        coef = 1.0 / pLData[i * n + i];
+        for (c = 0U; c < m; c++)
+        {
+          pRowI[c] *= coef;
+        }
+      }
+
+      /* Back substitution, L' * X = Y, with L'(i,k) = L(k,i) */
+      for (i = n; i > 0U; i--)
+      {
+        pRowI = pX + (i - 1U) * m;
+        for (k = i; k < n; k++)
+        {
+          coef = pLData[k * n + (i - 1U)];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+
+        coef = 1.0 / pLData[(i - 1U) * n + (i - 1U)];
+        for (c = 0U; c < m; c++)
+        {
+          pRowI[c] *= coef;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixChol group
+ */
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_f64.c
+ * Description:  Floating-point LDLT decomposition
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLDLT
+  @{
+ */
+
+/**
+  @brief         Floating-point (64 bit) LDLT decomposition of a symmetric matrix.
+  @param[in]     pSrc      points to the instance of the input matrix
+  @param[out]    pDst      points to the instance of the output matrix, which receives <code>L</code> and <code>D</code> packed
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS               : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH         : Matrix size check failed
+                   - \ref ARM_MATH_DECOMPOSITION_FAILURE : A term of <code>D</code> is zero
+
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pSrc</code>.
+ */
+
+arm_status arm_mat_ldlt_f64(
+  const arm_matrix_instance_f64 * pSrc,
+        arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pIn = pSrc->pData;            /* input data matrix pointer */
+  float64_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float64_t *pRowI;                              /* row of the output being computed */
+  const float64_t *pRowJ;                        /* row of the output already computed */
+  float64_t sum;                                 /* accumulator */
+  float64_t d;                                   /* diagonal term */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pOut + i * n;
+
+      /* First pass: the row is built as U(i,j) = L(i,j) * D(j), so that
+         U(i,j) = A(i,j) - sum(U(i,k) * L(j,k), k < j) needs no division */
+      for (j = 0U; j < i; j++)
+      {
+        pRowJ = pOut + j * n;
+        sum = pIn[i * n + j];
+        for (k = 0U; k < j; k++)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+        }
+        pRowI[j] = sum;
+      }
+
+      /* Second pass: D(i) = A(i,i) - sum(U(i,k) * L(i,k)), L(i,k) = U(i,k) / D(k) */
+      sum = pIn[i * n + i];
+      for (k = 0U; k < i; k++)
+      {
+        d = pOut[k * n + k];
+        pRowI[k] = pRowI[k] / d;
+        sum -= pRowI[k] * pRowI[k] * d;
+      }
+
+      if (sum == 0.0)
+      {
+        status = ARM_MATH_DECOMPOSITION_FAILURE;
+      }
+      pRowI[i] = sum;
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1U; j < n; j++)
+      {
+        pRowI[j] = 0.0;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLDLT group
+ */
@@ -0,0 +1,155 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_ldlt_solve_f64.c
+ * Description:  Floating-point solve using an LDLT decomposition
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLDLT
+  @{
+ */
+
+/**
+  @brief         Floating-point (64 bit) solve of <code>A * X = B</code> from the LDLT decomposition of <code>A</code>.
+  @param[in]     pLD       points to the instance of the packed factors computed by arm_mat_ldlt_f64()
+  @param[in]     pB        points to the instance of the right-hand side matrix
+  @param[out]    pDst      points to the instance of the output matrix, of the same size as <code>pB</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : A term of <code>D</code> is zero
+
+  @par           Details
+                   Solves <code>L * Z = B</code>, scales by the inverse of <code>D</code>,
+                   then solves <code>L' * X = D^-1 * Z</code>, reading <code>L</code> by
+                   columns for the last step.
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pB</code>.
+ */
+
+arm_status arm_mat_ldlt_solve_f64(
+  const arm_matrix_instance_f64 * pLD,
+  const arm_matrix_instance_f64 * pB,
+        arm_matrix_instance_f64 * pDst)
+{
+  const float64_t *pLData = pLD->pData;          /* factor data pointer */
+  float64_t *pX = pDst->pData;                   /* solution data pointer */
+  float64_t *pRowI;                              /* row of the solution being computed */
+  const float64_t *pRowK;                        /* row of the solution already computed */
+  float64_t coef;                                /* factor term */
+  uint32_t n = pLD->numRows;                     /* size of the factor */
+  uint32_t m = pB->numCols;                      /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLD->numRows != pLD->numCols) ||
+      (pB->numRows != pLD->numRows) ||
+      (pDst->numRows != pB->numRows) ||
+      (pDst->numCols != pB->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pLData[i * n + i] == 0.0)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+      if (pX != pB->pData)
+      {
+        memcpy(pX, pB->pData, n * m * sizeof(float64_t));
+      }
+
+      /* Forward substitution with the unit lower factor, L * Z = B */
+      for (i = 1U; i < n; i++)
+      {
+        pRowI = pX + i * m;
+        for (k = 0U; k < i; k++)
+        {
+          coef = pLData[i * n + k];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+      }
+
+      /* Diagonal scaling, Y = D^-1 * Z */
+      for (i = 0U; i < n; i++)
+      {
+        pRowI = pX + i * m;
+        coef = 1.0 / pLData[i * n + i];
+        for (c = 0U; c < m; c++)
+        {
+          pRowI[c] *= coef;
+        }
+      }
+
+      /* Back substitution with the transposed factor, L' * X = Y */
+      for (i = n; i > 0U; i--)
+      {
+        pRowI = pX + (i - 1U) * m;
+        for (k = i; k < n; k++)
+        {
+          coef = pLData[k * n + (i - 1U)];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLDLT group
+ */
@@ -0,0 +1,172 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_f32.c
+ * Description:  Floating-point LU decomposition with partial pivoting
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixLU LU Decomposition
+
+  Computes the decomposition <code>P * A = L * U</code> of a square matrix, with
+  partial (row) pivoting, where <code>L</code> is unit lower triangular and
+  <code>U</code> is upper triangular, and solves <code>A * X = B</code> with it.
+
+  @par Storage
+  The result is packed into one matrix: the strict lower triangle holds
+  <code>L</code> (whose unit diagonal is not stored) and the diagonal and
+  upper triangle hold <code>U</code>.
+  The permutation is returned as a list of row exchanges: at step k, row k
+  was exchanged with row <code>pPivots[k]</code> (which is never less than k).
+
+  @par Algorithm
+  Gaussian elimination by rows. At each step the row with the largest
+  magnitude in the pivot column is moved to the pivot position. If the whole
+  column is zero the matrix is singular and the function returns
+  <code>ARM_MATH_SINGULAR</code>.
+
+  @par In-place operation
+  The output may be the same matrix instance as the input, in which case
+  <code>A</code> is overwritten by the packed factors.
+ */
+
+/**
+  @addtogroup MatrixLU
+  @{
+ */
+
+/**
+  @brief         Floating-point LU decomposition with partial pivoting.
+  @param[in]     pSrc      points to the instance of the input matrix
+  @param[out]    pDst      points to the instance of the output matrix, which receives <code>L</code> and <code>U</code> packed
+  @param[out]    pPivots   points to an array of <code>numRows</code> values which receives the row exchanges
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : Input matrix is found to be singular
+
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pSrc</code>.
+ */
+
+arm_status arm_mat_lu_f32(
+  const arm_matrix_instance_f32 * pSrc,
+        arm_matrix_instance_f32 * pDst,
+        uint16_t * pPivots)
+{
+  float32_t *pOut = pDst->pData;                 /* output data matrix pointer */
+  float32_t *pRowK, *pRowI;                      /* pivot row and row being eliminated */
+  float32_t maxC, in;                            /* largest magnitude in the column, temporary value */
+  float32_t l;                                   /* multiplier */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, p;                           /* loop counters, pivot row */
+  arm_status status;                             /* status of the decomposition */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrc->numRows != pSrc->numCols) ||
+      (pDst->numRows != pDst->numCols) ||
+      (pSrc->numRows != pDst->numRows)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    if (pOut != pSrc->pData)
+    {
+      memcpy(pOut, pSrc->pData, n * n * sizeof(float32_t));
+    }
+
+    for (k = 0U; (k < n) && (status == ARM_MATH_SUCCESS); k++)
+    {
+      /* Find the row with the largest magnitude in column k */
+      p = k;
+      maxC = fabsf(pOut[k * n + k]);
+      for (i = k + 1U; i < n; i++)
+      {
+        in = fabsf(pOut[i * n + k]);
+        if (in > maxC)
+        {
+          maxC = in;
+          p = i;
+        }
+      }
+
+      pPivots[k] = (uint16_t) p;
+
+      if (maxC == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+      else
+      {
+        pRowK = pOut + k * n;
+
+        /* Exchange the whole rows, so that L is permuted as well */
+        if (p != k)
+        {
+          pRowI = pOut + p * n;
+          for (j = 0U; j < n; j++)
+          {
+            in = pRowK[j];
+            pRowK[j] = pRowI[j];
+            pRowI[j] = in;
+          }
+        }
+
+        /* Eliminate column k below the pivot and keep the multipliers in place */
+        for (i = k + 1U; i < n; i++)
+        {
+          pRowI = pOut + i * n;
+          l = pRowI[k] / pRowK[k];
+          pRowI[k] = l;
+          for (j = k + 1U; j < n; j++)
+          {
+            pRowI[j] -= l * pRowK[j];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLU group
+ */
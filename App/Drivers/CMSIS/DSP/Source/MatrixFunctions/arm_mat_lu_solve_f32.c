@@ -0,0 +1,167 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_lu_solve_f32.c
+ * Description:  Floating-point solve using an LU decomposition
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixLU
+  @{
+ */
+
+/**
+  @brief         Floating-point solve of <code>A * X = B</code> from the LU decomposition of <code>A</code>.
+  @param[in]     pLU       points to the instance of the packed factors computed by arm_mat_lu_f32()
+  @param[in]     pPivots   points to the row exchanges computed by arm_mat_lu_f32()
+  @param[in]     pB        points to the instance of the right-hand side matrix
+  @param[out]    pDst      points to the instance of the output matrix, of the same size as <code>pB</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : <code>U</code> has a zero diagonal term
+
+  @par           Details
+                   Applies the row exchanges to <code>B</code>, then solves
+                   <code>L * Y = P * B</code> and <code>U * X = Y</code>.
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pB</code>.
+ */
+
+arm_status arm_mat_lu_solve_f32(
+  const arm_matrix_instance_f32 * pLU,
+  const uint16_t * pPivots,
+  const arm_matrix_instance_f32 * pB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pLData = pLU->pData;          /* factor data pointer */
+  float32_t *pX = pDst->pData;                   /* solution data pointer */
+  float32_t *pRowI, *pRowK;                      /* rows of the solution */
+  float32_t coef;                                /* factor term */
+  float32_t in;                                  /* temporary value */
+  uint32_t n = pLU->numRows;                     /* size of the factor */
+  uint32_t m = pB->numCols;                      /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pLU->numRows != pLU->numCols) ||
+      (pB->numRows != pLU->numRows) ||
+      (pDst->numRows != pB->numRows) ||
+      (pDst->numCols != pB->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pLData[i * n + i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+      if (pX != pB->pData)
+      {
+        memcpy(pX, pB->pData, n * m * sizeof(float32_t));
+      }
+
+      /* Row exchanges, in the order they were made */
+      for (i = 0U; i < n; i++)
+      {
+        if (pPivots[i] != i)
+        {
+          pRowI = pX + i * m;
+          pRowK = pX + (uint32_t) pPivots[i] * m;
+          for (c = 0U; c < m; c++)
+          {
+            in = pRowI[c];
+            pRowI[c] = pRowK[c];
+            pRowK[c] = in;
+          }
+        }
+      }
+
+      /* Forward substitution with the unit lower factor, L * Y = P * B */
+      for (i = 1U; i < n; i++)
+      {
+        pRowI = pX + i * m;
+        for (k = 0U; k < i; k++)
+        {
+          coef = pLData[i * n + k];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+      }
+
+      /* Back substitution with the upper factor, U * X = Y */
+      for (i = n; i > 0U; i--)
+      {
+        pRowI = pX + (i - 1U) * m;
+        for (k = i; k < n; k++)
+        {
+          coef = pLData[(i - 1U) * n + k];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+
+        coef = 1.0f / pLData[(i - 1U) * n + (i - 1U)];
+        for (c = 0U; c < m; c++)
+        {
+          pRowI[c] *= coef;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixLU group
+ */
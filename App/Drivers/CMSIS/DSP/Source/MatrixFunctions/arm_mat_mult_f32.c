@@ -49,6 +49,239 @@
  */
 
 
+#if !defined(ARM_MATH_NEON)
+
+/*
+ * Blocked multiplication used for large matrices. The naive loops read a
+ * column of B with a stride of numColsB for every output, so once B no
+ * longer fits in cache every multiply-accumulate misses. Here:
+ *  - KC rows by NR columns of B are packed into a contiguous panel on the
+ *    stack, which stays in L1 while it is used by every row of A,
+ *  - MC rows by KC columns of A are processed against one panel after
+ *    another, so this block of A stays in L2,
+ *  - MR x NR outputs are accumulated in registers by the micro-kernel.
+ */
+#define MAT_MULT_F32_KC 128U                     /* Depth of a block */
+#define MAT_MULT_F32_MC 64U                      /* Rows of A in a block */
+#define MAT_MULT_F32_MR 4U                       /* Rows of a micro-tile */
+#if defined(ARM_MATH_X86_SIMD)
+#define MAT_MULT_F32_NR (2U * ARM_X86_F32_LANES) /* Columns of a micro-tile */
+#else
+#define MAT_MULT_F32_NR 4U                       /* Columns of a micro-tile */
+#endif
+
+/* The blocked path is used when every dimension is at least this large */
+#define MAT_MULT_F32_BLOCKED_MIN 32U
+
+/*
+ * C[MR][NR] += A[MR][kc] * panel[kc][NR]. A has a row stride of lda and C of
+ * ldc; the panel is packed with NR values per row.
+ */
+static void arm_mat_mult_f32_kernel(
+  const float32_t * pA,
+        uint32_t lda,
+  const float32_t * pPanel,
+        uint32_t kc,
+        float32_t * pC,
+        uint32_t ldc)
+{
+  const float32_t *pA0 = pA;
+  const float32_t *pA1 = pA0 + lda;
+  const float32_t *pA2 = pA1 + lda;
+  const float32_t *pA3 = pA2 + lda;
+        uint32_t k;                              /* Loop counter */
+
+#if defined(ARM_MATH_X86_SIMD)
+  arm_x86_f32_t c00, c01, c10, c11, c20, c21, c30, c31;
+  arm_x86_f32_t b0, b1, a;
+
+  c00 = c01 = c10 = c11 = c20 = c21 = c30 = c31 = __arm_x86_dup_f32(0.0f);
+
+  for (k = 0U; k < kc; k++)
+  {
+    b0 = __arm_x86_ld_f32(pPanel);
+    b1 = __arm_x86_ld_f32(pPanel + ARM_X86_F32_LANES);
+    pPanel += MAT_MULT_F32_NR;
+
+    a = __arm_x86_dup_f32(pA0[k]);
+    c00 = __arm_x86_fma_f32(c00, a, b0);
+    c01 = __arm_x86_fma_f32(c01, a, b1);
+    a = __arm_x86_dup_f32(pA1[k]);
+    c10 = __arm_x86_fma_f32(c10, a, b0);
+    c11 = __arm_x86_fma_f32(c11, a, b1);
+    a = __arm_x86_dup_f32(pA2[k]);
+    c20 = __arm_x86_fma_f32(c20, a, b0);
+    c21 = __arm_x86_fma_f32(c21, a, b1);
+    a = __arm_x86_dup_f32(pA3[k]);
+    c30 = __arm_x86_fma_f32(c30, a, b0);
+    c31 = __arm_x86_fma_f32(c31, a, b1);
+  }
+
+  __arm_x86_st_f32(pC, __arm_x86_add_f32(__arm_x86_ld_f32(pC), c00));
+  __arm_x86_st_f32(pC + ARM_X86_F32_LANES, __arm_x86_add_f32(__arm_x86_ld_f32(pC + ARM_X86_F32_LANES), c01));
+  pC += ldc;
+  __arm_x86_st_f32(pC, __arm_x86_add_f32(__arm_x86_ld_f32(pC), c10));
+  __arm_x86_st_f32(pC + ARM_X86_F32_LANES, __arm_x86_add_f32(__arm_x86_ld_f32(pC + ARM_X86_F32_LANES), c11));
+  pC += ldc;
+  __arm_x86_st_f32(pC, __arm_x86_add_f32(__arm_x86_ld_f32(pC), c20));
+  __arm_x86_st_f32(pC + ARM_X86_F32_LANES, __arm_x86_add_f32(__arm_x86_ld_f32(pC + ARM_X86_F32_LANES), c21));
+  pC += ldc;
+  __arm_x86_st_f32(pC, __arm_x86_add_f32(__arm_x86_ld_f32(pC), c30));
+  __arm_x86_st_f32(pC + ARM_X86_F32_LANES, __arm_x86_add_f32(__arm_x86_ld_f32(pC + ARM_X86_F32_LANES), c31));
+#else
+  float32_t c00 = 0.0f, c01 = 0.0f, c02 = 0.0f, c03 = 0.0f;
+  float32_t c10 = 0.0f, c11 = 0.0f, c12 = 0.0f, c13 = 0.0f;
+  float32_t c20 = 0.0f, c21 = 0.0f, c22 = 0.0f, c23 = 0.0f;
+  float32_t c30 = 0.0f, c31 = 0.0f, c32 = 0.0f, c33 = 0.0f;
+  float32_t b0, b1, b2, b3, a;
+
+  for (k = 0U; k < kc; k++)
+  {
+    b0 = pPanel[0];
+    b1 = pPanel[1];
+    b2 = pPanel[2];
+    b3 = pPanel[3];
+    pPanel += MAT_MULT_F32_NR;
+
+    a = pA0[k];
+    c00 += a * b0;
+    c01 += a * b1;
+    c02 += a * b2;
+    c03 += a * b3;
+    a = pA1[k];
+    c10 += a * b0;
+    c11 += a * b1;
+    c12 += a * b2;
+    c13 += a * b3;
+    a = pA2[k];
+    c20 += a * b0;
+    c21 += a * b1;
+    c22 += a * b2;
+    c23 += a * b3;
+    a = pA3[k];
+    c30 += a * b0;
+    c31 += a * b1;
+    c32 += a * b2;
+    c33 += a * b3;
+  }
+
+  pC[0] += c00;
+  pC[1] += c01;
+  pC[2] += c02;
+  pC[3] += c03;
+  pC += ldc;
+  pC[0] += c10;
+  pC[1] += c11;
+  pC[2] += c12;
+  pC[3] += c13;
+  pC += ldc;
+  pC[0] += c20;
+  pC[1] += c21;
+  pC[2] += c22;
+  pC[3] += c23;
+  pC += ldc;
+  pC[0] += c30;
+  pC[1] += c31;
+  pC[2] += c32;
+  pC[3] += c33;
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+}
+
+/* Partial micro-tile at the bottom or right edge: mr rows by nr columns */
+static void arm_mat_mult_f32_kernel_edge(
+  const float32_t * pA,
+        uint32_t lda,
+  const float32_t * pPanel,
+        uint32_t kc,
+        float32_t * pC,
+        uint32_t ldc,
+        uint32_t mr,
+        uint32_t nr)
+{
+  float32_t sum;                                 /* Accumulator */
+  uint32_t i, j, k;                              /* Loop counters */
+
+  for (i = 0U; i < mr; i++)
+  {
+    for (j = 0U; j < nr; j++)
+    {
+      sum = 0.0f;
+      for (k = 0U; k < kc; k++)
+      {
+        sum += pA[i * lda + k] * pPanel[k * MAT_MULT_F32_NR + j];
+      }
+      pC[i * ldc + j] += sum;
+    }
+  }
+}
+
+static void arm_mat_mult_f32_blocked(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t panel[MAT_MULT_F32_KC * MAT_MULT_F32_NR]; /* Packed block of B */
+  const float32_t *pA = pSrcA->pData;
+  const float32_t *pB = pSrcB->pData;
+  float32_t *pC = pDst->pData;
+  uint32_t M = pSrcA->numRows;
+  uint32_t K = pSrcA->numCols;
+  uint32_t N = pSrcB->numCols;
+  uint32_t k0, i0, j0, i, j, k;                  /* Loop counters */
+  uint32_t kc, mc, nr, iEnd;                     /* Sizes of the current blocks */
+
+  for (i = 0U; i < M * N; i++)
+  {
+    pC[i] = 0.0f;
+  }
+
+  for (k0 = 0U; k0 < K; k0 += kc)
+  {
+    kc = ((K - k0) < MAT_MULT_F32_KC) ? (K - k0) : MAT_MULT_F32_KC;
+
+    for (i0 = 0U; i0 < M; i0 += mc)
+    {
+      mc = ((M - i0) < MAT_MULT_F32_MC) ? (M - i0) : MAT_MULT_F32_MC;
+      iEnd = i0 + mc - (mc % MAT_MULT_F32_MR);
+
+      for (j0 = 0U; j0 < N; j0 += MAT_MULT_F32_NR)
+      {
+        nr = ((N - j0) < MAT_MULT_F32_NR) ? (N - j0) : MAT_MULT_F32_NR;
+
+        /* Pack B[k0 .. k0+kc-1][j0 .. j0+nr-1], padding the columns with zeros */
+        for (k = 0U; k < kc; k++)
+        {
+          for (j = 0U; j < MAT_MULT_F32_NR; j++)
+          {
+            panel[k * MAT_MULT_F32_NR + j] = (j < nr) ? pB[(k0 + k) * N + j0 + j] : 0.0f;
+          }
+        }
+
+        for (i = i0; i < iEnd; i += MAT_MULT_F32_MR)
+        {
+          if (nr == MAT_MULT_F32_NR)
+          {
+            arm_mat_mult_f32_kernel(pA + i * K + k0, K, panel, kc, pC + i * N + j0, N);
+          }
+          else
+          {
+            arm_mat_mult_f32_kernel_edge(pA + i * K + k0, K, panel, kc, pC + i * N + j0, N,
+                                         MAT_MULT_F32_MR, nr);
+          }
+        }
+
+        if (iEnd < (i0 + mc))
+        {
+          arm_mat_mult_f32_kernel_edge(pA + iEnd * K + k0, K, panel, kc, pC + iEnd * N + j0, N,
+                                       i0 + mc - iEnd, nr);
+        }
+      }
+    }
+  }
+}
+
+#endif /* #if !defined(ARM_MATH_NEON) */
+
 /**
  * @addtogroup MatrixMult
  * @{
@@ -394,6 +627,94 @@ arm_status arm_mat_mult_f32(
   /* Return to application */
   return (status);
 }
+#elif defined(ARM_MATH_X86_SIMD)
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+        arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA = pSrcA->pData;                /* Input data matrix pointer A */
+  float32_t *pInB;                               /* Input data matrix pointer B */
+  float32_t *pOut = pDst->pData;                 /* Output data matrix pointer */
+  float32_t a;                                   /* Element of A scaling a row of B */
+  uint16_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint16_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t row, k, col;                          /* Loop counters */
+  uint32_t numVecCols;                           /* Columns of B covered by whole vectors */
+  arm_x86_f32_t aV;
+  arm_status status;                             /* Status of matrix multiplication */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+      (pSrcA->numRows != pDst->numRows)  ||
+      (pSrcB->numCols != pDst->numCols)    )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  if ((numRowsA >= MAT_MULT_F32_BLOCKED_MIN) &&
+      (numColsA >= MAT_MULT_F32_BLOCKED_MIN) &&
+      (numColsB >= MAT_MULT_F32_BLOCKED_MIN))
+  {
+    arm_mat_mult_f32_blocked(pSrcA, pSrcB, pDst);
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+  else
+  {
+    /* Each row of the output is built as a sum of rows of pSrcB scaled by
+     * the elements of the matching row of pSrcA, so B is read along its rows
+     * and the output row stays in cache while it is accumulated. */
+    numVecCols = numColsB - (numColsB % ARM_X86_F32_LANES);
+
+    for (row = 0U; row < numRowsA; row++)
+    {
+      for (col = 0U; col < numColsB; col++)
+      {
+        pOut[col] = 0.0f;
+      }
+
+      pInB = pSrcB->pData;
+
+      for (k = 0U; k < numColsA; k++)
+      {
+        a = pInA[k];
+        aV = __arm_x86_dup_f32(a);
+
+        for (col = 0U; col < numVecCols; col += ARM_X86_F32_LANES)
+        {
+          __arm_x86_st_f32(pOut + col,
+                           __arm_x86_fma_f32(__arm_x86_ld_f32(pOut + col), aV, __arm_x86_ld_f32(pInB + col)));
+        }
+
+        for (; col < numColsB; col++)
+        {
+          pOut[col] += a * pInB[col];
+        }
+
+        pInB += numColsB;
+      }
+
+      /* Update the pointers to the next row of A and of the output */
+      pInA += numColsA;
+      pOut += numColsB;
+    }
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
 #else
 arm_status arm_mat_mult_f32(
   const arm_matrix_instance_f32 * pSrcA,
@@ -427,6 +748,16 @@ arm_status arm_mat_mult_f32(
 
 #endif /* #ifdef ARM_MATH_MATRIX_CHECK */
 
+  if ((numRowsA >= MAT_MULT_F32_BLOCKED_MIN) &&
+      (numColsA >= MAT_MULT_F32_BLOCKED_MIN) &&
+      (numColsB >= MAT_MULT_F32_BLOCKED_MIN))
+  {
+    arm_mat_mult_f32_blocked(pSrcA, pSrcB, pDst);
+
+    /* Set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+  else
   {
     /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
     /* row loop */
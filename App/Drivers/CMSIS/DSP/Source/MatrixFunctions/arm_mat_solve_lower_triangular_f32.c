@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_solve_lower_triangular_f32.c
+ * Description:  Floating-point lower triangular solve
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixTriSolve Triangular Solve
+
+  Solves <code>T * X = B</code> by forward substitution when <code>T</code> is
+  lower triangular, or by back substitution when it is upper triangular.
+  <code>B</code> and <code>X</code> have as many rows as <code>T</code> and
+  any number of columns, so several right-hand sides are solved at once.
+
+  Only the relevant triangle of <code>T</code> is read, so the factors packed
+  by the decomposition functions can be passed directly.
+  If a diagonal term of <code>T</code> is zero the function returns
+  <code>ARM_MATH_SINGULAR</code>.
+
+  @par In-place operation
+  The output may be the same matrix instance as <code>B</code>, in which case
+  <code>B</code> is overwritten by the solution.
+ */
+
+/**
+  @addtogroup MatrixTriSolve
+  @{
+ */
+
+/**
+  @brief         Floating-point solve of <code>T * X = B</code> with <code>T</code> lower triangular.
+  @param[in]     pT        points to the instance of the lower triangular matrix
+  @param[in]     pB        points to the instance of the right-hand side matrix
+  @param[out]    pDst      points to the instance of the output matrix, of the same size as <code>pB</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS       : Operation successful
+                   - \ref ARM_MATH_SIZE_MISMATCH : Matrix size check failed
+                   - \ref ARM_MATH_SINGULAR      : <code>T</code> has a zero diagonal term
+
+  @par           In-place operation
+                   <code>pDst</code> may be the same as <code>pB</code>.
+ */
+
+arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * pT,
+  const arm_matrix_instance_f32 * pB,
+        arm_matrix_instance_f32 * pDst)
+{
+  const float32_t *pTData = pT->pData;           /* triangular matrix data pointer */
+  float32_t *pX = pDst->pData;                   /* solution data pointer */
+  float32_t *pRowI;                              /* row of the solution being computed */
+  const float32_t *pRowK;                        /* row of the solution already computed */
+  float32_t coef;                                /* matrix term */
+  uint32_t n = pT->numRows;                      /* size of the triangular matrix */
+  uint32_t m = pB->numCols;                      /* number of right-hand sides */
+  uint32_t i, k, c;                              /* loop counters */
+  arm_status status;                             /* status of the solve */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pT->numRows != pT->numCols) ||
+      (pB->numRows != pT->numRows) ||
+      (pDst->numRows != pB->numRows) ||
+      (pDst->numCols != pB->numCols)   )
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    for (i = 0U; i < n; i++)
+    {
+      if (pTData[i * n + i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+      }
+    }
+
+    if (status == ARM_MATH_SUCCESS)
+    {
+      if (pX != pB->pData)
+      {
+        memcpy(pX, pB->pData, n * m * sizeof(float32_t));
+      }
+
+      /* Forward substitution, row i uses the rows above it */
+      for (i = 0U; i < n; i++)
+      {
+        pRowI = pX + i * m;
+        for (k = 0U; k < i; k++)
+        {
+          coef = pTData[i * n + k];
+          pRowK = pX + k * m;
+          for (c = 0U; c < m; c++)
+          {
+            pRowI[c] -= coef * pRowK[c];
+          }
+        }
+
+        coef = 1.0f / pTData[i * n + i];
+        for (c = 0U; c < m; c++)
+        {
+          pRowI[c] *= coef;
+        }
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+  @} end of MatrixTriSolve group
+ */
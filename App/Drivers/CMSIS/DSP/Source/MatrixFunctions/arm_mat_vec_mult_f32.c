@@ -0,0 +1,336 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f32.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @defgroup MatrixVectMult Matrix Vector Multiplication
+
+  Multiplies a matrix and a vector.
+
+  The vector has as many elements as the matrix has columns and the result
+  has as many elements as the matrix has rows. Unlike arm_mat_mult_f32() with
+  a one-column matrix, there is no size check and no column striding.
+
+  @par Algorithm
+  Four rows of the matrix are processed per pass, so that every element of the
+  vector which is loaded is used four times. The remaining rows are processed
+  one at a time.
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Floating-point matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector, of <code>numCols</code> values
+  @param[out]    pDst     points to the output vector, of <code>numRows</code> values
+  @return        none
+ */
+#if defined(ARM_MATH_NEON)
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const float32_t *pRow0, *pRow1, *pRow2, *pRow3;  /* Rows of the matrix */
+  float32_t sum0, sum1, sum2, sum3;              /* Accumulators */
+  float32_t x;                                   /* Vector element */
+  uint32_t row, col, colCnt;                     /* Loop counters */
+
+  float32x4_t xV;
+  float32x4_t acc0, acc1, acc2, acc3;
+  float32x2_t accum;
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    acc0 = vdupq_n_f32(0.0f);
+    acc1 = vdupq_n_f32(0.0f);
+    acc2 = vdupq_n_f32(0.0f);
+    acc3 = vdupq_n_f32(0.0f);
+
+    /* Compute 4 MACs per row simultaneously */
+    col = 0U;
+    for (colCnt = numCols >> 2U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_f32(pVec + col);
+      acc0 = vmlaq_f32(acc0, vld1q_f32(pRow0 + col), xV);
+      acc1 = vmlaq_f32(acc1, vld1q_f32(pRow1 + col), xV);
+      acc2 = vmlaq_f32(acc2, vld1q_f32(pRow2 + col), xV);
+      acc3 = vmlaq_f32(acc3, vld1q_f32(pRow3 + col), xV);
+      col += 4U;
+    }
+
+    accum = vpadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+    sum0 = vget_lane_f32(accum, 0) + vget_lane_f32(accum, 1);
+    accum = vpadd_f32(vget_low_f32(acc1), vget_high_f32(acc1));
+    sum1 = vget_lane_f32(accum, 0) + vget_lane_f32(accum, 1);
+    accum = vpadd_f32(vget_low_f32(acc2), vget_high_f32(acc2));
+    sum2 = vget_lane_f32(accum, 0) + vget_lane_f32(accum, 1);
+    accum = vpadd_f32(vget_low_f32(acc3), vget_high_f32(acc3));
+    sum3 = vget_lane_f32(accum, 0) + vget_lane_f32(accum, 1);
+
+    /* Remaining columns */
+    for (; col < numCols; col++)
+    {
+      x = pVec[col];
+      sum0 += pRow0[col] * x;
+      sum1 += pRow1[col] * x;
+      sum2 += pRow2[col] * x;
+      sum3 += pRow3[col] * x;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    acc0 = vdupq_n_f32(0.0f);
+
+    col = 0U;
+    for (colCnt = numCols >> 2U; colCnt > 0U; colCnt--)
+    {
+      acc0 = vmlaq_f32(acc0, vld1q_f32(pRow0 + col), vld1q_f32(pVec + col));
+      col += 4U;
+    }
+
+    accum = vpadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+    sum0 = vget_lane_f32(accum, 0) + vget_lane_f32(accum, 1);
+
+    for (; col < numCols; col++)
+    {
+      sum0 += pRow0[col] * pVec[col];
+    }
+
+    *pDst++ = sum0;
+
+    pRow0 += numCols;
+  }
+}
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  uint32_t numVecCols;                           /* Columns covered by whole vectors */
+  const float32_t *pRow0, *pRow1, *pRow2, *pRow3;  /* Rows of the matrix */
+  float32_t sum0, sum1, sum2, sum3;              /* Accumulators */
+  float32_t x;                                   /* Vector element */
+  uint32_t row, col;                             /* Loop counters */
+  arm_x86_f32_t xV;
+  arm_x86_f32_t acc0, acc1, acc2, acc3;
+
+  numVecCols = numCols - (numCols % ARM_X86_F32_LANES);
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    acc0 = __arm_x86_dup_f32(0.0f);
+    acc1 = __arm_x86_dup_f32(0.0f);
+    acc2 = __arm_x86_dup_f32(0.0f);
+    acc3 = __arm_x86_dup_f32(0.0f);
+
+    for (col = 0U; col < numVecCols; col += ARM_X86_F32_LANES)
+    {
+      xV = __arm_x86_ld_f32(pVec + col);
+      acc0 = __arm_x86_fma_f32(acc0, __arm_x86_ld_f32(pRow0 + col), xV);
+      acc1 = __arm_x86_fma_f32(acc1, __arm_x86_ld_f32(pRow1 + col), xV);
+      acc2 = __arm_x86_fma_f32(acc2, __arm_x86_ld_f32(pRow2 + col), xV);
+      acc3 = __arm_x86_fma_f32(acc3, __arm_x86_ld_f32(pRow3 + col), xV);
+    }
+
+    sum0 = __arm_x86_hsum_f32(acc0);
+    sum1 = __arm_x86_hsum_f32(acc1);
+    sum2 = __arm_x86_hsum_f32(acc2);
+    sum3 = __arm_x86_hsum_f32(acc3);
+
+    /* Remaining columns */
+    for (; col < numCols; col++)
+    {
+      x = pVec[col];
+      sum0 += pRow0[col] * x;
+      sum1 += pRow1[col] * x;
+      sum2 += pRow2[col] * x;
+      sum3 += pRow3[col] * x;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    acc0 = __arm_x86_dup_f32(0.0f);
+
+    for (col = 0U; col < numVecCols; col += ARM_X86_F32_LANES)
+    {
+      acc0 = __arm_x86_fma_f32(acc0, __arm_x86_ld_f32(pRow0 + col), __arm_x86_ld_f32(pVec + col));
+    }
+
+    sum0 = __arm_x86_hsum_f32(acc0);
+
+    for (; col < numCols; col++)
+    {
+      sum0 += pRow0[col] * pVec[col];
+    }
+
+    *pDst++ = sum0;
+
+    pRow0 += numCols;
+  }
+}
+#else
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const float32_t *pRow0, *pRow1, *pRow2, *pRow3;  /* Rows of the matrix */
+  const float32_t *pX;                           /* Vector pointer */
+  float32_t sum0, sum1, sum2, sum3;              /* Accumulators */
+  float32_t x;                                   /* Vector element */
+  uint32_t row, colCnt;                          /* Loop counters */
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    pX = pVec;
+
+    sum0 = 0.0f;
+    sum1 = 0.0f;
+    sum2 = 0.0f;
+    sum3 = 0.0f;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 MACs per row at a time */
+    for (colCnt = numCols >> 1U; colCnt > 0U; colCnt--)
+    {
+      x = *pX++;
+      sum0 += *pRow0++ * x;
+      sum1 += *pRow1++ * x;
+      sum2 += *pRow2++ * x;
+      sum3 += *pRow3++ * x;
+
+      x = *pX++;
+      sum0 += *pRow0++ * x;
+      sum1 += *pRow1++ * x;
+      sum2 += *pRow2++ * x;
+      sum3 += *pRow3++ * x;
+    }
+
+    /* Loop unrolling: Compute remaining MACs */
+    colCnt = numCols & 1U;
+
+#else
+
+    colCnt = numCols;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (colCnt > 0U)
+    {
+      x = *pX++;
+      sum0 += *pRow0++ * x;
+      sum1 += *pRow1++ * x;
+      sum2 += *pRow2++ * x;
+      sum3 += *pRow3++ * x;
+
+      colCnt--;
+    }
+
+    *pDst++ = sum0;
+    *pDst++ = sum1;
+    *pDst++ = sum2;
+    *pDst++ = sum3;
+
+    /* pRow3 now points to the start of the next group of rows */
+    pRow0 = pRow3;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    pX = pVec;
+    sum0 = 0.0f;
+
+    for (colCnt = numCols; colCnt > 0U; colCnt--)
+    {
+      sum0 += *pRow0++ * *pX++;
+    }
+
+    *pDst++ = sum0;
+  }
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @} end of MatrixVectMult group
+ */
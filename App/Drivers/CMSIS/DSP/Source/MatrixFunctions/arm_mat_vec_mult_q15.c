@@ -0,0 +1,253 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q15.c
+ * Description:  Q15 matrix and vector multiplication
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q15 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector, of <code>numCols</code> values
+  @param[out]    pDst     points to the output vector, of <code>numRows</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator. The inputs to the
+                   multiplications are in 1.15 format and multiplications yield a 2.30 result.
+                   The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+                   This approach provides 33 guard bits and there is no risk of overflow.
+                   The 34.30 result is then truncated to 34.15 format by discarding the low 15 bits
+                   and then saturated to 1.15 format, as in arm_mat_mult_q15().
+ */
+#if defined(ARM_MATH_NEON)
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q15_t *pRow0, *pRow1, *pRow2, *pRow3;    /* Rows of the matrix */
+  q63_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q15_t x;                                       /* Vector element */
+  uint32_t row, col, colCnt;                     /* Loop counters */
+
+  int16x8_t xV, aV;
+  int64x2_t acc0, acc1, acc2, acc3;
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    acc0 = vdupq_n_s64(0);
+    acc1 = vdupq_n_s64(0);
+    acc2 = vdupq_n_s64(0);
+    acc3 = vdupq_n_s64(0);
+
+    /* Compute 8 MACs per row simultaneously. The 2.30 products are
+       widened pairwise into 64-bit lanes so the accumulation cannot overflow */
+    col = 0U;
+    for (colCnt = numCols >> 3U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s16(pVec + col);
+
+      aV = vld1q_s16(pRow0 + col);
+      acc0 = vpadalq_s32(acc0, vmull_s16(vget_low_s16(aV), vget_low_s16(xV)));
+      acc0 = vpadalq_s32(acc0, vmull_s16(vget_high_s16(aV), vget_high_s16(xV)));
+      aV = vld1q_s16(pRow1 + col);
+      acc1 = vpadalq_s32(acc1, vmull_s16(vget_low_s16(aV), vget_low_s16(xV)));
+      acc1 = vpadalq_s32(acc1, vmull_s16(vget_high_s16(aV), vget_high_s16(xV)));
+      aV = vld1q_s16(pRow2 + col);
+      acc2 = vpadalq_s32(acc2, vmull_s16(vget_low_s16(aV), vget_low_s16(xV)));
+      acc2 = vpadalq_s32(acc2, vmull_s16(vget_high_s16(aV), vget_high_s16(xV)));
+      aV = vld1q_s16(pRow3 + col);
+      acc3 = vpadalq_s32(acc3, vmull_s16(vget_low_s16(aV), vget_low_s16(xV)));
+      acc3 = vpadalq_s32(acc3, vmull_s16(vget_high_s16(aV), vget_high_s16(xV)));
+
+      col += 8U;
+    }
+
+    sum0 = vgetq_lane_s64(acc0, 0) + vgetq_lane_s64(acc0, 1);
+    sum1 = vgetq_lane_s64(acc1, 0) + vgetq_lane_s64(acc1, 1);
+    sum2 = vgetq_lane_s64(acc2, 0) + vgetq_lane_s64(acc2, 1);
+    sum3 = vgetq_lane_s64(acc3, 0) + vgetq_lane_s64(acc3, 1);
+
+    /* Remaining columns */
+    for (; col < numCols; col++)
+    {
+      x = pVec[col];
+      sum0 += (q31_t) pRow0[col] * x;
+      sum1 += (q31_t) pRow1[col] * x;
+      sum2 += (q31_t) pRow2[col] * x;
+      sum3 += (q31_t) pRow3[col] * x;
+    }
+
+    /* Saturate and store result in destination buffer */
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum1 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum3 >> 15), 16);
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    acc0 = vdupq_n_s64(0);
+
+    col = 0U;
+    for (colCnt = numCols >> 3U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s16(pVec + col);
+      aV = vld1q_s16(pRow0 + col);
+      acc0 = vpadalq_s32(acc0, vmull_s16(vget_low_s16(aV), vget_low_s16(xV)));
+      acc0 = vpadalq_s32(acc0, vmull_s16(vget_high_s16(aV), vget_high_s16(xV)));
+      col += 8U;
+    }
+
+    sum0 = vgetq_lane_s64(acc0, 0) + vgetq_lane_s64(acc0, 1);
+
+    for (; col < numCols; col++)
+    {
+      sum0 += (q31_t) pRow0[col] * pVec[col];
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+
+    pRow0 += numCols;
+  }
+}
+#else
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  const q15_t * pVec,
+        q15_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q15_t *pRow0, *pRow1, *pRow2, *pRow3;    /* Rows of the matrix */
+  const q15_t *pX;                               /* Vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q15_t x;                                       /* Vector element */
+  uint32_t row, colCnt;                          /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  q31_t xV;                                      /* Two vector elements */
+#endif
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Compute 2 MACs per row at a time, reusing each pair of vector elements for the four rows */
+    for (colCnt = numCols >> 1U; colCnt > 0U; colCnt--)
+    {
+      xV = read_q15x2_ia ((q15_t **) &pX);
+
+      sum0 = __SMLALD(read_q15x2_ia ((q15_t **) &pRow0), xV, sum0);
+      sum1 = __SMLALD(read_q15x2_ia ((q15_t **) &pRow1), xV, sum1);
+      sum2 = __SMLALD(read_q15x2_ia ((q15_t **) &pRow2), xV, sum2);
+      sum3 = __SMLALD(read_q15x2_ia ((q15_t **) &pRow3), xV, sum3);
+    }
+
+    /* Compute remaining MACs */
+    colCnt = numCols & 1U;
+
+#else
+
+    colCnt = numCols;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (colCnt > 0U)
+    {
+      x = *pX++;
+      sum0 += (q31_t) *pRow0++ * x;
+      sum1 += (q31_t) *pRow1++ * x;
+      sum2 += (q31_t) *pRow2++ * x;
+      sum3 += (q31_t) *pRow3++ * x;
+
+      colCnt--;
+    }
+
+    /* Saturate and store result in destination buffer */
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum1 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum3 >> 15), 16);
+
+    /* pRow3 now points to the start of the next group of rows */
+    pRow0 = pRow3;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    pX = pVec;
+    sum0 = 0;
+
+    for (colCnt = numCols; colCnt > 0U; colCnt--)
+    {
+      sum0 += (q31_t) *pRow0++ * *pX++;
+    }
+
+    *pDst++ = (q15_t) __SSAT((sum0 >> 15), 16);
+  }
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q31.c
+ * Description:  Q31 matrix and vector multiplication
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q31 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector, of <code>numCols</code> values
+  @param[out]    pDst     points to the output vector, of <code>numRows</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 64-bit accumulator.
+                   The accumulator has a 2.62 format and maintains full precision of the intermediate
+                   multiplication results but provides only a single guard bit. There is no saturation
+                   on intermediate additions. Thus, if the accumulator overflows it wraps around and
+                   distorts the result. The input signals should be scaled down by log2(numCols) bits
+                   to avoid overflows. The 2.62 accumulator is right shifted by 31 bits to yield the
+                   1.31 result, as in arm_mat_mult_q31().
+ */
+#if defined(ARM_MATH_NEON)
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q31_t *pRow0, *pRow1, *pRow2, *pRow3;    /* Rows of the matrix */
+  q63_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q31_t x;                                       /* Vector element */
+  uint32_t row, col, colCnt;                     /* Loop counters */
+
+  int32x4_t xV, aV;
+  int64x2_t acc0, acc1, acc2, acc3;
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    acc0 = vdupq_n_s64(0);
+    acc1 = vdupq_n_s64(0);
+    acc2 = vdupq_n_s64(0);
+    acc3 = vdupq_n_s64(0);
+
+    /* Compute 4 MACs per row simultaneously, in two 64-bit lanes */
+    col = 0U;
+    for (colCnt = numCols >> 2U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s32(pVec + col);
+
+      aV = vld1q_s32(pRow0 + col);
+      acc0 = vmlal_s32(acc0, vget_low_s32(aV), vget_low_s32(xV));
+      acc0 = vmlal_s32(acc0, vget_high_s32(aV), vget_high_s32(xV));
+      aV = vld1q_s32(pRow1 + col);
+      acc1 = vmlal_s32(acc1, vget_low_s32(aV), vget_low_s32(xV));
+      acc1 = vmlal_s32(acc1, vget_high_s32(aV), vget_high_s32(xV));
+      aV = vld1q_s32(pRow2 + col);
+      acc2 = vmlal_s32(acc2, vget_low_s32(aV), vget_low_s32(xV));
+      acc2 = vmlal_s32(acc2, vget_high_s32(aV), vget_high_s32(xV));
+      aV = vld1q_s32(pRow3 + col);
+      acc3 = vmlal_s32(acc3, vget_low_s32(aV), vget_low_s32(xV));
+      acc3 = vmlal_s32(acc3, vget_high_s32(aV), vget_high_s32(xV));
+
+      col += 4U;
+    }
+
+    sum0 = vgetq_lane_s64(acc0, 0) + vgetq_lane_s64(acc0, 1);
+    sum1 = vgetq_lane_s64(acc1, 0) + vgetq_lane_s64(acc1, 1);
+    sum2 = vgetq_lane_s64(acc2, 0) + vgetq_lane_s64(acc2, 1);
+    sum3 = vgetq_lane_s64(acc3, 0) + vgetq_lane_s64(acc3, 1);
+
+    /* Remaining columns */
+    for (; col < numCols; col++)
+    {
+      x = pVec[col];
+      sum0 += (q63_t) pRow0[col] * x;
+      sum1 += (q63_t) pRow1[col] * x;
+      sum2 += (q63_t) pRow2[col] * x;
+      sum3 += (q63_t) pRow3[col] * x;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
+    *pDst++ = (q31_t) (sum0 >> 31);
+    *pDst++ = (q31_t) (sum1 >> 31);
+    *pDst++ = (q31_t) (sum2 >> 31);
+    *pDst++ = (q31_t) (sum3 >> 31);
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    acc0 = vdupq_n_s64(0);
+
+    col = 0U;
+    for (colCnt = numCols >> 2U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s32(pVec + col);
+      aV = vld1q_s32(pRow0 + col);
+      acc0 = vmlal_s32(acc0, vget_low_s32(aV), vget_low_s32(xV));
+      acc0 = vmlal_s32(acc0, vget_high_s32(aV), vget_high_s32(xV));
+      col += 4U;
+    }
+
+    sum0 = vgetq_lane_s64(acc0, 0) + vgetq_lane_s64(acc0, 1);
+
+    for (; col < numCols; col++)
+    {
+      sum0 += (q63_t) pRow0[col] * pVec[col];
+    }
+
+    *pDst++ = (q31_t) (sum0 >> 31);
+
+    pRow0 += numCols;
+  }
+}
+#else
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  const q31_t * pVec,
+        q31_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q31_t *pRow0, *pRow1, *pRow2, *pRow3;    /* Rows of the matrix */
+  const q31_t *pX;                               /* Vector pointer */
+  q63_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q31_t x;                                       /* Vector element */
+  uint32_t row, colCnt;                          /* Loop counters */
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+    /* Loop unrolling: Compute 2 MACs per row at a time */
+    for (colCnt = numCols >> 1U; colCnt > 0U; colCnt--)
+    {
+      x = *pX++;
+      sum0 += (q63_t) *pRow0++ * x;
+      sum1 += (q63_t) *pRow1++ * x;
+      sum2 += (q63_t) *pRow2++ * x;
+      sum3 += (q63_t) *pRow3++ * x;
+
+      x = *pX++;
+      sum0 += (q63_t) *pRow0++ * x;
+      sum1 += (q63_t) *pRow1++ * x;
+      sum2 += (q63_t) *pRow2++ * x;
+      sum3 += (q63_t) *pRow3++ * x;
+    }
+
+    /* Loop unrolling: Compute remaining MACs */
+    colCnt = numCols & 1U;
+
+#else
+
+    colCnt = numCols;
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+    while (colCnt > 0U)
+    {
+      x = *pX++;
+      sum0 += (q63_t) *pRow0++ * x;
+      sum1 += (q63_t) *pRow1++ * x;
+      sum2 += (q63_t) *pRow2++ * x;
+      sum3 += (q63_t) *pRow3++ * x;
+
+      colCnt--;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format and store in destination buffer */
+    *pDst++ = (q31_t) (sum0 >> 31);
+    *pDst++ = (q31_t) (sum1 >> 31);
+    *pDst++ = (q31_t) (sum2 >> 31);
+    *pDst++ = (q31_t) (sum3 >> 31);
+
+    /* pRow3 now points to the start of the next group of rows */
+    pRow0 = pRow3;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    pX = pVec;
+    sum0 = 0;
+
+    for (colCnt = numCols; colCnt > 0U; colCnt--)
+    {
+      sum0 += (q63_t) *pRow0++ * *pX++;
+    }
+
+    *pDst++ = (q31_t) (sum0 >> 31);
+  }
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -0,0 +1,265 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q7.c
+ * Description:  Q7 matrix and vector multiplication
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupMatrix
+ */
+
+/**
+  @addtogroup MatrixVectMult
+  @{
+ */
+
+/**
+  @brief         Q7 matrix and vector multiplication.
+  @param[in]     pSrcMat  points to the input matrix structure
+  @param[in]     pVec     points to the input vector, of <code>numCols</code> values
+  @param[out]    pDst     points to the output vector, of <code>numRows</code> values
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The function is implemented using an internal 32-bit accumulator. The inputs to the
+                   multiplications are in 1.7 format and multiplications yield a 2.14 result.
+                   The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+                   This approach provides 17 guard bits and there is no risk of overflow as long as
+                   <code>numCols</code> is less than 2^17.
+                   The 18.14 result is then truncated to 18.7 format by discarding the low 7 bits
+                   and then saturated to 1.7 format.
+ */
+#if defined(ARM_MATH_NEON)
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  const q7_t * pVec,
+        q7_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q7_t *pRow0, *pRow1, *pRow2, *pRow3;     /* Rows of the matrix */
+  q31_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q7_t x;                                        /* Vector element */
+  uint32_t row, col, colCnt;                     /* Loop counters */
+
+  int8x16_t xV, aV;
+  int32x4_t acc0, acc1, acc2, acc3;
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+
+    acc0 = vdupq_n_s32(0);
+    acc1 = vdupq_n_s32(0);
+    acc2 = vdupq_n_s32(0);
+    acc3 = vdupq_n_s32(0);
+
+    /* Compute 16 MACs per row simultaneously. The 2.14 products are
+       widened pairwise into 32-bit lanes */
+    col = 0U;
+    for (colCnt = numCols >> 4U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s8(pVec + col);
+
+      aV = vld1q_s8(pRow0 + col);
+      acc0 = vpadalq_s16(acc0, vmull_s8(vget_low_s8(aV), vget_low_s8(xV)));
+      acc0 = vpadalq_s16(acc0, vmull_s8(vget_high_s8(aV), vget_high_s8(xV)));
+      aV = vld1q_s8(pRow1 + col);
+      acc1 = vpadalq_s16(acc1, vmull_s8(vget_low_s8(aV), vget_low_s8(xV)));
+      acc1 = vpadalq_s16(acc1, vmull_s8(vget_high_s8(aV), vget_high_s8(xV)));
+      aV = vld1q_s8(pRow2 + col);
+      acc2 = vpadalq_s16(acc2, vmull_s8(vget_low_s8(aV), vget_low_s8(xV)));
+      acc2 = vpadalq_s16(acc2, vmull_s8(vget_high_s8(aV), vget_high_s8(xV)));
+      aV = vld1q_s8(pRow3 + col);
+      acc3 = vpadalq_s16(acc3, vmull_s8(vget_low_s8(aV), vget_low_s8(xV)));
+      acc3 = vpadalq_s16(acc3, vmull_s8(vget_high_s8(aV), vget_high_s8(xV)));
+
+      col += 16U;
+    }
+
+    sum0 = vgetq_lane_s32(acc0, 0) + vgetq_lane_s32(acc0, 1) + vgetq_lane_s32(acc0, 2) + vgetq_lane_s32(acc0, 3);
+    sum1 = vgetq_lane_s32(acc1, 0) + vgetq_lane_s32(acc1, 1) + vgetq_lane_s32(acc1, 2) + vgetq_lane_s32(acc1, 3);
+    sum2 = vgetq_lane_s32(acc2, 0) + vgetq_lane_s32(acc2, 1) + vgetq_lane_s32(acc2, 2) + vgetq_lane_s32(acc2, 3);
+    sum3 = vgetq_lane_s32(acc3, 0) + vgetq_lane_s32(acc3, 1) + vgetq_lane_s32(acc3, 2) + vgetq_lane_s32(acc3, 3);
+
+    /* Remaining columns */
+    for (; col < numCols; col++)
+    {
+      x = pVec[col];
+      sum0 += (q15_t) pRow0[col] * x;
+      sum1 += (q15_t) pRow1[col] * x;
+      sum2 += (q15_t) pRow2[col] * x;
+      sum3 += (q15_t) pRow3[col] * x;
+    }
+
+    /* Saturate and store result in destination buffer */
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum1 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum2 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum3 >> 7), 8);
+
+    pRow0 = pRow3 + numCols;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    acc0 = vdupq_n_s32(0);
+
+    col = 0U;
+    for (colCnt = numCols >> 4U; colCnt > 0U; colCnt--)
+    {
+      xV = vld1q_s8(pVec + col);
+      aV = vld1q_s8(pRow0 + col);
+      acc0 = vpadalq_s16(acc0, vmull_s8(vget_low_s8(aV), vget_low_s8(xV)));
+      acc0 = vpadalq_s16(acc0, vmull_s8(vget_high_s8(aV), vget_high_s8(xV)));
+      col += 16U;
+    }
+
+    sum0 = vgetq_lane_s32(acc0, 0) + vgetq_lane_s32(acc0, 1) + vgetq_lane_s32(acc0, 2) + vgetq_lane_s32(acc0, 3);
+
+    for (; col < numCols; col++)
+    {
+      sum0 += (q15_t) pRow0[col] * pVec[col];
+    }
+
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+
+    pRow0 += numCols;
+  }
+}
+#else
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  const q7_t * pVec,
+        q7_t * pDst)
+{
+  uint32_t numRows = pSrcMat->numRows;           /* Number of rows of the matrix */
+  uint32_t numCols = pSrcMat->numCols;           /* Number of columns of the matrix */
+  const q7_t *pRow0, *pRow1, *pRow2, *pRow3;     /* Rows of the matrix */
+  const q7_t *pX;                                /* Vector pointer */
+  q31_t sum0, sum1, sum2, sum3;                  /* Accumulators */
+  q7_t x;                                        /* Vector element */
+  uint32_t row, colCnt;                          /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  q31_t xV, x13, x02;                            /* Four vector elements, unpacked by pairs */
+  q31_t aV;                                      /* Four matrix elements */
+#endif
+
+  pRow0 = pSrcMat->pData;
+
+  /* Four rows per pass */
+  for (row = numRows >> 2U; row > 0U; row--)
+  {
+    pRow1 = pRow0 + numCols;
+    pRow2 = pRow1 + numCols;
+    pRow3 = pRow2 + numCols;
+    pX = pVec;
+
+    sum0 = 0;
+    sum1 = 0;
+    sum2 = 0;
+    sum3 = 0;
+
+#if defined (ARM_MATH_DSP)
+
+    /* Compute 4 MACs per row at a time, unpacking the vector elements once for the four rows */
+    for (colCnt = numCols >> 2U; colCnt > 0U; colCnt--)
+    {
+      xV = read_q7x4_ia ((q7_t **) &pX);
+      x13 = __SXTB16(__ROR(xV, 8));
+      x02 = __SXTB16(xV);
+
+      aV = read_q7x4_ia ((q7_t **) &pRow0);
+      sum0 = __SMLAD(__SXTB16(__ROR(aV, 8)), x13, sum0);
+      sum0 = __SMLAD(__SXTB16(aV), x02, sum0);
+      aV = read_q7x4_ia ((q7_t **) &pRow1);
+      sum1 = __SMLAD(__SXTB16(__ROR(aV, 8)), x13, sum1);
+      sum1 = __SMLAD(__SXTB16(aV), x02, sum1);
+      aV = read_q7x4_ia ((q7_t **) &pRow2);
+      sum2 = __SMLAD(__SXTB16(__ROR(aV, 8)), x13, sum2);
+      sum2 = __SMLAD(__SXTB16(aV), x02, sum2);
+      aV = read_q7x4_ia ((q7_t **) &pRow3);
+      sum3 = __SMLAD(__SXTB16(__ROR(aV, 8)), x13, sum3);
+      sum3 = __SMLAD(__SXTB16(aV), x02, sum3);
+    }
+
+    /* Compute remaining MACs */
+    colCnt = numCols & 3U;
+
+#else
+
+    colCnt = numCols;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (colCnt > 0U)
+    {
+      x = *pX++;
+      sum0 += (q15_t) *pRow0++ * x;
+      sum1 += (q15_t) *pRow1++ * x;
+      sum2 += (q15_t) *pRow2++ * x;
+      sum3 += (q15_t) *pRow3++ * x;
+
+      colCnt--;
+    }
+
+    /* Saturate and store result in destination buffer */
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum1 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum2 >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum3 >> 7), 8);
+
+    /* pRow3 now points to the start of the next group of rows */
+    pRow0 = pRow3;
+  }
+
+  /* Remaining rows */
+  for (row = numRows & 3U; row > 0U; row--)
+  {
+    pX = pVec;
+    sum0 = 0;
+
+    for (colCnt = numCols; colCnt > 0U; colCnt--)
+    {
+      sum0 += (q15_t) *pRow0++ * *pX++;
+    }
+
+    *pDst++ = (q7_t) __SSAT((sum0 >> 7), 8);
+  }
+}
+#endif /* #if defined(ARM_MATH_NEON) */
+
+/**
+  @} end of MatrixVectMult group
+ */
@@ -34,10 +34,23 @@
 #include "arm_mean_q15.c"
 #include "arm_mean_q31.c"
 #include "arm_mean_q7.c"
+#include "arm_median_f32.c"
+#include "arm_median_filter_f32.c"
+#include "arm_median_filter_init_f32.c"
+#include "arm_median_filter_init_q15.c"
+#include "arm_median_filter_q15.c"
 #include "arm_min_f32.c"
 #include "arm_min_q15.c"
 #include "arm_min_q31.c"
 #include "arm_min_q7.c"
+#include "arm_moving_minmax_f32.c"
+#include "arm_moving_minmax_init_f32.c"
+#include "arm_moving_minmax_init_q31.c"
+#include "arm_moving_minmax_q31.c"
+#include "arm_moving_stats_f32.c"
+#include "arm_moving_stats_init_f32.c"
+#include "arm_moving_stats_init_q31.c"
+#include "arm_moving_stats_q31.c"
 #include "arm_power_f32.c"
 #include "arm_power_q15.c"
 #include "arm_power_q31.c"
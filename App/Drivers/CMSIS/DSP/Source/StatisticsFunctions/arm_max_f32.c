@@ -167,6 +167,96 @@ void arm_max_f32(
   *pResult = out;
   *pIndex = outIndex;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_max_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+        float32_t maxVal, out;                         /* Temporary variables to store the output value. */
+        uint32_t blkCnt, outIndex;                     /* Loop counter */
+        uint32_t numVec;                               /* Number of whole vectors */
+        arm_x86_f32_t maxV;
+        arm_x86_f32_t outV;
+        int mask;
+
+  /* Initialise index value to zero. */
+  outIndex = 0U;
+
+  numVec = blockSize / ARM_X86_F32_LANES;
+
+  if (numVec == 0U)
+  {
+    /* Load first input value that act as reference value for comparision */
+    out = *pSrc++;
+    blkCnt = blockSize - 1U;
+  }
+  else
+  {
+    /* Maximum of each lane over the whole vectors */
+    outV = __arm_x86_ld_f32(pSrc);
+
+    for (blkCnt = 1U; blkCnt < numVec; blkCnt++)
+    {
+      outV = __arm_x86_max_f32(outV, __arm_x86_ld_f32(pSrc + (blkCnt * ARM_X86_F32_LANES)));
+    }
+
+    out = __arm_x86_hmax_f32(outV);
+
+    /* Locate the first occurrence of the maximum value, which is missing only if the input holds a NaN */
+    maxV = __arm_x86_dup_f32(out);
+    mask = 0;
+
+    while ((mask == 0) && (outIndex < (numVec * ARM_X86_F32_LANES)))
+    {
+      mask = __arm_x86_cmpeq_mask_f32(__arm_x86_ld_f32(pSrc + outIndex), maxV);
+      outIndex += ARM_X86_F32_LANES;
+    }
+
+    if (mask == 0)
+    {
+      /* Compare the values one by one, as the other versions do */
+      outIndex = 0U;
+      out = *pSrc++;
+      blkCnt = blockSize - 1U;
+    }
+    else
+    {
+      outIndex -= ARM_X86_F32_LANES;
+
+      while ((mask & 1) == 0)
+      {
+        mask >>= 1;
+        outIndex++;
+      }
+
+      pSrc += numVec * ARM_X86_F32_LANES;
+      blkCnt = blockSize % ARM_X86_F32_LANES;
+    }
+  }
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize maxVal to the next consecutive values one by one */
+    maxVal = *pSrc++;
+
+    /* compare for the maximum value */
+    if (out < maxVal)
+    {
+      /* Update the maximum value and it's index */
+      out = maxVal;
+      outIndex = blockSize - blkCnt;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store the maximum value and it's index into destination pointers */
+  *pResult = out;
+  *pIndex = outIndex;
+}
 #else
 void arm_max_f32(
   const float32_t * pSrc,
@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_f32.c
+ * Description:  Floating-point median
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup median Median
+
+  Calculates the median of the input vector: the middle sample of the sorted vector for an
+  odd number of samples, or the mean of the two middle samples for an even number.
+
+  @par           Algorithm
+                   The samples are copied to a scratch buffer, where the middle one is selected by
+                   quickselect, in <code>O(blockSize)</code> operations on average: the buffer is partitioned
+                   around the median of its first, middle and last samples, and only the part which
+                   contains the middle position is partitioned again. Sorting the vector would cost
+                   <code>O(blockSize*log2(blockSize))</code>.
+  @par
+                   The result is unspecified when the input contains NaN values.
+ */
+
+/**
+  @addtogroup median
+  @{
+ */
+
+/**
+  @brief         Median of the elements of a floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[in]     blockSize  number of samples in the input vector
+  @param[in]     pScratch   points to the scratch buffer, of length <code>blockSize</code>
+  @param[out]    pResult    median value returned here
+  @return        none
+ */
+
+void arm_median_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pScratch,
+        float32_t * pResult)
+{
+        float32_t *p = pScratch;                       /* Samples being partitioned */
+        int32_t lo, hi, mid, i, j;                     /* Part which contains the middle position, scan positions */
+        int32_t k;                                     /* Middle position */
+        float32_t pivot, tmp, upper;
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  memcpy(p, pSrc, blockSize * sizeof(float32_t));
+
+  k = (int32_t) ((blockSize - 1U) >> 1U);
+  lo = 0;
+  hi = (int32_t) blockSize - 1;
+
+  while (lo < hi)
+  {
+    /* Median of three as pivot, which also stops the first scans */
+    mid = lo + ((hi - lo) >> 1);
+    if (p[mid] < p[lo])
+    {
+      tmp = p[lo]; p[lo] = p[mid]; p[mid] = tmp;
+    }
+    if (p[hi] < p[mid])
+    {
+      tmp = p[mid]; p[mid] = p[hi]; p[hi] = tmp;
+      if (p[mid] < p[lo])
+      {
+        tmp = p[lo]; p[lo] = p[mid]; p[mid] = tmp;
+      }
+    }
+    pivot = p[mid];
+
+    /* Samples up to j are at most the pivot, samples from i at least the pivot */
+    i = lo;
+    j = hi;
+    while (i <= j)
+    {
+      while (p[i] < pivot)
+      {
+        i++;
+      }
+      while (pivot < p[j])
+      {
+        j--;
+      }
+      if (i <= j)
+      {
+        tmp = p[i]; p[i] = p[j]; p[j] = tmp;
+        i++;
+        j--;
+      }
+    }
+
+    if (k <= j)
+    {
+      hi = j;
+    }
+    else if (k >= i)
+    {
+      lo = i;
+    }
+    else
+    {
+      /* Between j and i, the samples are equal to the pivot */
+      break;
+    }
+  }
+
+  if ((blockSize & 1U) != 0U)
+  {
+    *pResult = p[k];
+  }
+  else
+  {
+    /* Other middle sample: the smallest of the samples after the middle position */
+    upper = p[k + 1];
+    for (i = k + 2; i < (int32_t) blockSize; i++)
+    {
+      upper = (p[i] < upper) ? p[i] : upper;
+    }
+
+    *pResult = 0.5f * (p[k] + upper);
+  }
+}
+
+/**
+  @} end of median group
+ */
@@ -0,0 +1,88 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_init_f32.c
+ * Description:  Floating-point sliding window median filter initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding window median filter.
+  @param[in,out] S          points to an instance of the floating-point sliding window median filter structure
+  @param[in]     windowLen  number of samples in the window
+  @param[in]     pState     points to the state buffer, of length <code>windowLen</code>
+  @param[in]     pIndex     points to the index buffer, of length <code>2*windowLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowLen</code> is 0
+
+  @par           Details
+                   The window is filled with zeros.
+ */
+
+arm_status arm_median_filter_init_f32(
+  arm_median_filter_instance_f32 * S,
+  uint32_t windowLen,
+  float32_t * pState,
+  uint32_t * pIndex)
+{
+  uint32_t i;
+
+  if (windowLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  S->windowLen = windowLen;
+  S->head = 0U;
+
+  /* Clear the window, whose samples are in the heaps in their order */
+  memset(pState, 0, windowLen * sizeof(float32_t));
+
+  for (i = 0U; i < windowLen; i++)
+  {
+    pIndex[i] = i;
+    pIndex[windowLen + i] = i;
+  }
+
+  S->pState = pState;
+  S->pIndex = pIndex;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of MedianFilter group
+ */
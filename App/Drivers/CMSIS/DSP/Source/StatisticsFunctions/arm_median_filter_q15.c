@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_filter_q15.c
+ * Description:  Q15 sliding window median filter
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MedianFilter
+  @{
+ */
+
+/*
+ * Moves the sample at position pos of a heap of length len, at position base in pHeap, up or
+ * down to its place. The samples of the lower heap are above their children when they are
+ * larger, those of the upper heap when they are smaller.
+ */
+static void arm_median_filter_sift_q15(
+  const q15_t * pVal,
+        uint32_t * pHeap,
+        uint32_t * pSlot,
+        uint32_t base,
+        uint32_t len,
+        uint32_t pos,
+        uint32_t lower)
+{
+        uint32_t *pH = pHeap + base;                   /* Heap of the sample */
+        uint32_t idx = pH[pos];                        /* Position of the sample in the window */
+        q15_t x = pVal[idx];
+        uint32_t parent, child;
+
+#define ARM_MEDIAN_ABOVE(a, b)  ((lower != 0U) ? ((a) > (b)) : ((a) < (b)))
+
+  /* Up while above its parent */
+  while (pos > 0U)
+  {
+    parent = (pos - 1U) >> 1U;
+    if (!ARM_MEDIAN_ABOVE(x, pVal[pH[parent]]))
+    {
+      break;
+    }
+    pH[pos] = pH[parent];
+    pSlot[pH[pos]] = base + pos;
+    pos = parent;
+  }
+
+  /* Down while below one of its children */
+  while ((child = 2U * pos + 1U) < len)
+  {
+    if (((child + 1U) < len) && ARM_MEDIAN_ABOVE(pVal[pH[child + 1U]], pVal[pH[child]]))
+    {
+      child++;
+    }
+    if (!ARM_MEDIAN_ABOVE(pVal[pH[child]], x))
+    {
+      break;
+    }
+    pH[pos] = pH[child];
+    pSlot[pH[pos]] = base + pos;
+    pos = child;
+  }
+
+#undef ARM_MEDIAN_ABOVE
+
+  pH[pos] = idx;
+  pSlot[idx] = base + pos;
+}
+
+/**
+  @brief         Processing function for the Q15 sliding window median filter.
+  @param[in,out] S          points to an instance of the Q15 sliding window median filter structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the block of output samples
+  @param[in]     blockSize  number of samples to process
+  @return        none
+ */
+
+void arm_median_filter_q15(
+        arm_median_filter_instance_q15 * S,
+  const q15_t * pSrc,
+        q15_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+        uint32_t lowLen = (windowLen + 1U) >> 1U;      /* Length of the lower heap */
+        uint32_t highLen = windowLen >> 1U;            /* Length of the upper heap */
+        q15_t *pVal = S->pState;                       /* Samples of the window */
+        uint32_t *pHeap = S->pIndex;                   /* Lower heap then upper heap */
+        uint32_t *pSlot = S->pIndex + windowLen;       /* Position in the heaps of each sample */
+        uint32_t head = S->head;                       /* Position of the oldest sample */
+        uint32_t pos, tmp;
+
+  while (blockSize > 0U)
+  {
+    /* The new sample replaces the oldest one in its heap */
+    pVal[head] = *pSrc++;
+    pos = pSlot[head];
+
+    if (pos < lowLen)
+    {
+      arm_median_filter_sift_q15(pVal, pHeap, pSlot, 0U, lowLen, pos, 1U);
+    }
+    else
+    {
+      arm_median_filter_sift_q15(pVal, pHeap, pSlot, lowLen, highLen, pos - lowLen, 0U);
+    }
+
+    /* Exchange of the tops when the new sample went past the other heap */
+    if ((highLen > 0U) && (pVal[pHeap[lowLen]] < pVal[pHeap[0]]))
+    {
+      tmp = pHeap[0];
+      pHeap[0] = pHeap[lowLen];
+      pHeap[lowLen] = tmp;
+      pSlot[pHeap[0]] = 0U;
+      pSlot[pHeap[lowLen]] = lowLen;
+
+      arm_median_filter_sift_q15(pVal, pHeap, pSlot, 0U, lowLen, 0U, 1U);
+      arm_median_filter_sift_q15(pVal, pHeap, pSlot, lowLen, highLen, 0U, 0U);
+    }
+
+    if ((windowLen & 1U) != 0U)
+    {
+      *pDst++ = pVal[pHeap[0]];
+    }
+    else
+    {
+      /* Mean of the tops, rounded down */
+      *pDst++ = (q15_t) (((q31_t) pVal[pHeap[0]] + pVal[pHeap[lowLen]]) >> 1);
+    }
+
+    head = (head + 1U == windowLen) ? 0U : head + 1U;
+
+    blockSize--;
+  }
+
+  S->head = head;
+}
+
+/**
+  @} end of MedianFilter group
+ */
@@ -163,6 +163,96 @@ void arm_min_f32(
   *pResult = out;
   *pIndex = outIndex;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_min_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult,
+        uint32_t * pIndex)
+{
+        float32_t minVal, out;                         /* Temporary variables to store the output value. */
+        uint32_t blkCnt, outIndex;                     /* Loop counter */
+        uint32_t numVec;                               /* Number of whole vectors */
+        arm_x86_f32_t minV;
+        arm_x86_f32_t outV;
+        int mask;
+
+  /* Initialise index value to zero. */
+  outIndex = 0U;
+
+  numVec = blockSize / ARM_X86_F32_LANES;
+
+  if (numVec == 0U)
+  {
+    /* Load first input value that act as reference value for comparision */
+    out = *pSrc++;
+    blkCnt = blockSize - 1U;
+  }
+  else
+  {
+    /* Minimum of each lane over the whole vectors */
+    outV = __arm_x86_ld_f32(pSrc);
+
+    for (blkCnt = 1U; blkCnt < numVec; blkCnt++)
+    {
+      outV = __arm_x86_min_f32(outV, __arm_x86_ld_f32(pSrc + (blkCnt * ARM_X86_F32_LANES)));
+    }
+
+    out = __arm_x86_hmin_f32(outV);
+
+    /* Locate the first occurrence of the minimum value, which is missing only if the input holds a NaN */
+    minV = __arm_x86_dup_f32(out);
+    mask = 0;
+
+    while ((mask == 0) && (outIndex < (numVec * ARM_X86_F32_LANES)))
+    {
+      mask = __arm_x86_cmpeq_mask_f32(__arm_x86_ld_f32(pSrc + outIndex), minV);
+      outIndex += ARM_X86_F32_LANES;
+    }
+
+    if (mask == 0)
+    {
+      /* Compare the values one by one, as the other versions do */
+      outIndex = 0U;
+      out = *pSrc++;
+      blkCnt = blockSize - 1U;
+    }
+    else
+    {
+      outIndex -= ARM_X86_F32_LANES;
+
+      while ((mask & 1) == 0)
+      {
+        mask >>= 1;
+        outIndex++;
+      }
+
+      pSrc += numVec * ARM_X86_F32_LANES;
+      blkCnt = blockSize % ARM_X86_F32_LANES;
+    }
+  }
+
+  while (blkCnt > 0U)
+  {
+    /* Initialize minVal to the next consecutive values one by one */
+    minVal = *pSrc++;
+
+    /* compare for the minimum value */
+    if (out > minVal)
+    {
+      /* Update the minimum value and it's index */
+      out = minVal;
+      outIndex = blockSize - blkCnt;
+    }
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store the minimum value and it's index into destination pointers */
+  *pResult = out;
+  *pIndex = outIndex;
+}
 #else
 void arm_min_f32(
   const float32_t * pSrc,
@@ -0,0 +1,186 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_minmax_q31.c
+ * Description:  Q31 sliding window minimum and maximum
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingMinMax
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding window minimum and maximum.
+  @param[in,out] S          points to an instance of the Q31 sliding window minimum and maximum structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input samples
+  @return        none
+ */
+
+void arm_moving_minmax_q31(
+        arm_moving_minmax_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+        q31_t *pMaxVal = S->pState;                    /* Values of the maximum list */
+        q31_t *pMinVal = S->pState + windowLen;        /* Values of the minimum list */
+        uint32_t *pMaxPos = S->pPos;                   /* Positions in the stream of the maximum list */
+        uint32_t *pMinPos = S->pPos + windowLen;       /* Positions in the stream of the minimum list */
+        uint32_t maxHead = S->maxHead, maxLen = S->maxLen;
+        uint32_t minHead = S->minHead, minLen = S->minLen;
+        uint32_t pos = S->pos;                         /* Position of the next sample in the stream */
+        uint32_t count = S->count;                     /* Number of samples in the window */
+        uint32_t k;
+        q31_t x;
+
+  while (blockSize > 0U)
+  {
+    x = *pSrc++;
+
+    /* Samples which leave the window, at most one per list */
+    if ((maxLen > 0U) && ((uint32_t) (pos - pMaxPos[maxHead]) >= windowLen))
+    {
+      maxHead = (maxHead + 1U == windowLen) ? 0U : maxHead + 1U;
+      maxLen--;
+    }
+
+    if ((minLen > 0U) && ((uint32_t) (pos - pMinPos[minHead]) >= windowLen))
+    {
+      minHead = (minHead + 1U == windowLen) ? 0U : minHead + 1U;
+      minLen--;
+    }
+
+    /* Samples exceeded by the new one */
+    while (maxLen > 0U)
+    {
+      k = maxHead + maxLen - 1U;
+      k = (k >= windowLen) ? k - windowLen : k;
+      if (pMaxVal[k] >= x)
+      {
+        break;
+      }
+      maxLen--;
+    }
+
+    while (minLen > 0U)
+    {
+      k = minHead + minLen - 1U;
+      k = (k >= windowLen) ? k - windowLen : k;
+      if (pMinVal[k] <= x)
+      {
+        break;
+      }
+      minLen--;
+    }
+
+    /* Append the new sample to both lists */
+    k = maxHead + maxLen;
+    k = (k >= windowLen) ? k - windowLen : k;
+    pMaxVal[k] = x;
+    pMaxPos[k] = pos;
+    maxLen++;
+
+    k = minHead + minLen;
+    k = (k >= windowLen) ? k - windowLen : k;
+    pMinVal[k] = x;
+    pMinPos[k] = pos;
+    minLen++;
+
+    if (count < windowLen)
+    {
+      count++;
+    }
+
+    pos++;
+    blockSize--;
+  }
+
+  S->maxHead = maxHead;
+  S->maxLen = maxLen;
+  S->minHead = minHead;
+  S->minLen = minLen;
+  S->pos = pos;
+  S->count = count;
+}
+
+/**
+  @brief         Maximum of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window minimum and maximum structure
+  @param[out]    pResult    maximum value returned here
+  @param[out]    pIndex     index of the maximum value in the window returned here, 0 for the oldest sample
+  @return        none
+ */
+
+void arm_moving_max_q31(
+  const arm_moving_minmax_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->maxLen == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->maxHead];
+  *pIndex = S->pPos[S->maxHead] - (S->pos - S->count);
+}
+
+/**
+  @brief         Minimum of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window minimum and maximum structure
+  @param[out]    pResult    minimum value returned here
+  @param[out]    pIndex     index of the minimum value in the window returned here, 0 for the oldest sample
+  @return        none
+ */
+
+void arm_moving_min_q31(
+  const arm_moving_minmax_instance_q31 * S,
+        q31_t * pResult,
+        uint32_t * pIndex)
+{
+  if (S->minLen == 0U)
+  {
+    *pResult = 0;
+    *pIndex = 0U;
+    return;
+  }
+
+  *pResult = S->pState[S->windowLen + S->minHead];
+  *pIndex = S->pPos[S->windowLen + S->minHead] - (S->pos - S->count);
+}
+
+/**
+  @} end of MovingMinMax group
+ */
@@ -0,0 +1,235 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_f32.c
+ * Description:  Floating-point sliding window mean, variance and RMS
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @defgroup MovingStats Sliding Window Statistics
+
+  Computes the mean, variance, standard deviation and RMS value of the last
+  <code>windowLen</code> samples of a stream, updated sample by sample, so that a block
+  of samples costs <code>O(blockSize)</code> operations where the functions arm_mean_f32(),
+  arm_var_f32(), arm_std_f32() and arm_rms_f32() on the window cost <code>O(windowLen)</code>.
+  The statistics are those of these functions on the samples of the window, which are all
+  the samples processed until <code>windowLen</code> samples have been processed.
+
+  @par           Algorithm
+                   The floating-point version updates the mean and the sum of the squared deviations from
+                   the mean with the recurrence of Welford, when a sample <code>x</code> enters the window:
+  <pre>
+      n = n + 1
+      mean' = mean + (x - mean) / n
+      m2 = m2 + (x - mean) * (x - mean')
+  </pre>
+                   and when, the window being full, a sample <code>x</code> replaces the oldest one <code>y</code>:
+  <pre>
+      mean' = mean + (x - y) / windowLen
+      m2 = m2 + (x - y) * ((x - mean') + (y - mean))
+  </pre>
+                   The rounding errors of these updates would add up over the stream, so the mean and
+                   <code>m2</code> are computed again from the window each time the state buffer wraps,
+                   which costs <code>O(1)</code> operations per sample on average.
+  @par
+                   The Q31 version keeps the sums of the samples and of their squares computed by arm_mean_q31(),
+                   arm_var_q31() and arm_rms_q31(), which are exact and give the same results as these functions.
+                   The same scaling of the inputs is required to avoid the overflows of the sums.
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Processing function for the floating-point sliding window statistics.
+  @param[in,out] S          points to an instance of the floating-point sliding window statistics structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input samples
+  @return        none
+ */
+
+void arm_moving_stats_f32(
+        arm_moving_stats_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+        float32_t *pState = S->pState;                 /* Last samples of the stream */
+        float32_t invLen = 1.0f / (float32_t) windowLen;
+        float32_t mean = S->mean;                      /* Mean of the window */
+        float32_t m2 = S->m2;                          /* Sum of the squared deviations from the mean */
+        float32_t x, y, d, newMean, var;
+        uint32_t index = S->index;                     /* Position of the oldest sample */
+        uint32_t blkCnt;                               /* Loop counter */
+
+  while (blockSize > 0U)
+  {
+    if (S->count < windowLen)
+    {
+      /* Window being filled: one more sample */
+      x = *pSrc++;
+      blockSize--;
+
+      S->count++;
+      d = x - mean;
+      mean += d / (float32_t) S->count;
+      m2 += d * (x - mean);
+
+      pState[index++] = x;
+    }
+    else
+    {
+      /* Full window: the samples replace the oldest ones, up to the end of the buffer */
+      blkCnt = windowLen - index;
+      blkCnt = (blkCnt < blockSize) ? blkCnt : blockSize;
+      blockSize -= blkCnt;
+
+      while (blkCnt > 0U)
+      {
+        x = *pSrc++;
+        y = pState[index];
+        pState[index++] = x;
+
+        d = x - y;
+        newMean = mean + d * invLen;
+        m2 += d * ((x - newMean) + (y - mean));
+        mean = newMean;
+
+        blkCnt--;
+      }
+    }
+
+    if (index == windowLen)
+    {
+      index = 0U;
+
+      /* The buffer holds the window: clear the accumulated rounding errors */
+      arm_mean_f32(pState, windowLen, &mean);
+      arm_var_f32(pState, windowLen, &var);
+      m2 = var * (float32_t) (windowLen - 1U);
+    }
+  }
+
+  S->index = index;
+  S->mean = mean;
+  S->m2 = m2;
+}
+
+/**
+  @brief         Mean of the window.
+  @param[in]     S          points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult    mean value returned here
+  @return        none
+ */
+
+void arm_moving_mean_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  *pResult = S->mean;
+}
+
+/**
+  @brief         Variance of the window.
+  @param[in]     S          points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult    variance value returned here
+  @return        none
+
+  @par           Details
+                   As arm_var_f32(), the sum of the squared deviations from the mean is divided by
+                   the number of samples of the window minus one.
+ */
+
+void arm_moving_var_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  if ((S->count <= 1U) || (S->m2 <= 0.0f))
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  *pResult = S->m2 / (float32_t) (S->count - 1U);
+}
+
+/**
+  @brief         Standard deviation of the window.
+  @param[in]     S          points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult    standard deviation value returned here
+  @return        none
+ */
+
+void arm_moving_std_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t var;
+
+  arm_moving_var_f32(S, &var);
+  arm_sqrt_f32(var, pResult);
+}
+
+/**
+  @brief         Root Mean Square of the window.
+  @param[in]     S          points to an instance of the floating-point sliding window statistics structure
+  @param[out]    pResult    RMS value returned here
+  @return        none
+
+  @par           Details
+                   The mean of the squares is the square of the mean plus the sum of the squared
+                   deviations from the mean divided by the number of samples of the window.
+ */
+
+void arm_moving_rms_f32(
+  const arm_moving_stats_instance_f32 * S,
+        float32_t * pResult)
+{
+  float32_t meanOfSquares = 0.0f;
+
+  if (S->count > 0U)
+  {
+    meanOfSquares = S->mean * S->mean;
+
+    if (S->m2 > 0.0f)
+    {
+      meanOfSquares += S->m2 / (float32_t) S->count;
+    }
+  }
+
+  arm_sqrt_f32(meanOfSquares, pResult);
+}
+
+/**
+  @} end of MovingStats group
+ */
@@ -0,0 +1,201 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_moving_stats_q31.c
+ * Description:  Q31 sliding window mean, variance and RMS
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupStats
+ */
+
+/**
+  @addtogroup MovingStats
+  @{
+ */
+
+/**
+  @brief         Processing function for the Q31 sliding window statistics.
+  @param[in,out] S          points to an instance of the Q31 sliding window statistics structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[in]     blockSize  number of input samples
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The sums are those of arm_mean_q31(), arm_var_q31() and arm_rms_q31() on the window,
+                   with the same 64-bit accumulators, which wrap around on overflow.
+ */
+
+void arm_moving_stats_q31(
+        arm_moving_stats_instance_q31 * S,
+  const q31_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t windowLen = S->windowLen;             /* Number of samples in the window */
+        q31_t *pState = S->pState;                     /* Last samples of the stream */
+        q63_t sum = S->sum;                            /* Sum of the samples */
+        q63_t sumIn = S->sumIn;                        /* Sum of the samples in 1.23 format */
+        q63_t sumOfSquaresIn = S->sumOfSquaresIn;      /* Sum of the squares of the samples in 1.23 format */
+        uint64_t sumOfSquares = S->sumOfSquares;       /* Sum of the squares of the samples */
+        uint32_t index = S->index;                     /* Position of the oldest sample */
+        uint32_t count = S->count;                     /* Number of samples in the window */
+        q31_t x, in;
+
+  while (blockSize > 0U)
+  {
+    x = *pSrc++;
+
+    if (count < windowLen)
+    {
+      count++;
+    }
+    else
+    {
+      /* Remove the oldest sample */
+      sum -= pState[index];
+      sumOfSquares -= (q63_t) pState[index] * pState[index];
+      in = pState[index] >> 8U;
+      sumIn -= in;
+      sumOfSquaresIn -= (q63_t) in * in;
+    }
+
+    pState[index] = x;
+
+    sum += x;
+    sumOfSquares += (q63_t) x * x;
+    in = x >> 8U;
+    sumIn += in;
+    sumOfSquaresIn += (q63_t) in * in;
+
+    index++;
+    if (index == windowLen)
+    {
+      index = 0U;
+    }
+
+    blockSize--;
+  }
+
+  S->index = index;
+  S->count = count;
+  S->sum = sum;
+  S->sumIn = sumIn;
+  S->sumOfSquaresIn = sumOfSquaresIn;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+  @brief         Mean of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult    mean value returned here
+  @return        none
+ */
+
+void arm_moving_mean_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  *pResult = (q31_t) (S->sum / S->count);
+}
+
+/**
+  @brief         Variance of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult    variance value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   As arm_var_q31(): the 18.46 result is right shifted by 15 bits to yield a 1.31 format value.
+ */
+
+void arm_moving_var_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  q63_t meanOfSquares, squareOfMean;
+
+  if (S->count <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  meanOfSquares = (S->sumOfSquaresIn / (q63_t) (S->count - 1U));
+  squareOfMean = (S->sumIn * S->sumIn / (q63_t) (S->count * (S->count - 1U)));
+
+  *pResult = (meanOfSquares - squareOfMean) >> 15U;
+}
+
+/**
+  @brief         Standard deviation of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult    standard deviation value returned here
+  @return        none
+ */
+
+void arm_moving_std_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  q31_t var;
+
+  arm_moving_var_q31(S, &var);
+  arm_sqrt_q31(var, pResult);
+}
+
+/**
+  @brief         Root Mean Square of the window.
+  @param[in]     S          points to an instance of the Q31 sliding window statistics structure
+  @param[out]    pResult    RMS value returned here
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   As arm_rms_q31(): the 2.62 mean of the squares is converted to 1.31 format and saturated.
+ */
+
+void arm_moving_rms_q31(
+  const arm_moving_stats_instance_q31 * S,
+        q31_t * pResult)
+{
+  if (S->count == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  arm_sqrt_q31(clip_q63_to_q31((S->sumOfSquares / (q63_t) S->count) >> 31), pResult);
+}
+
+/**
+  @} end of MovingStats group
+ */
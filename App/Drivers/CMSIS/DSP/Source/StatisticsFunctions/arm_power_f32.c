@@ -107,6 +107,50 @@ void arm_power_f32(
   /* Store the result to the destination */
   *pResult = sum;
 }
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_power_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t sum = 0.0f;                          /* Temporary result storage */
+        float32_t in;                                  /* Temporary variable to store input value */
+        arm_x86_f32_t inV;
+        arm_x86_f32_t sumV = __arm_x86_dup_f32(0.0f);
+
+  /* Compute ARM_X86_F32_LANES outputs at a time */
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    inV = __arm_x86_ld_f32(pSrc);
+    sumV = __arm_x86_fma_f32(sumV, inV, inV);
+    pSrc += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  sum = __arm_x86_hsum_f32(sumV);
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    /* C = A[0] * A[0] + A[1] * A[1] + ... + A[blockSize-1] * A[blockSize-1] */
+    in = *pSrc++;
+    sum += in * in;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Store result to destination */
+  *pResult = sum;
+}
 #else
 void arm_power_f32(
   const float32_t * pSrc,
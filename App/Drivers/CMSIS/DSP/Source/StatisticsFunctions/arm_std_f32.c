@@ -60,7 +60,7 @@
   @param[out]    pResult    standard deviation value returned here
   @return        none
  */
-#if defined(ARM_MATH_NEON_EXPERIMENTAL)
+#if defined(ARM_MATH_NEON_EXPERIMENTAL) || defined(ARM_MATH_X86_SIMD)
 void arm_std_f32(
   const float32_t * pSrc,
         uint32_t blockSize,
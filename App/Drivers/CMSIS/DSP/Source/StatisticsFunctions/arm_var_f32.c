@@ -120,6 +120,59 @@ void arm_var_f32(
 
 }
 
+#elif defined(ARM_MATH_X86_SIMD)
+void arm_var_f32(
+  const float32_t * pSrc,
+        uint32_t blockSize,
+        float32_t * pResult)
+{
+        uint32_t blkCnt;                               /* Loop counter */
+        float32_t fSum = 0.0f;
+        float32_t fMean, fValue;
+  const float32_t * pInput = pSrc;
+        arm_x86_f32_t meanV, inV;
+        arm_x86_f32_t sumV = __arm_x86_dup_f32(0.0f);
+
+  if (blockSize <= 1U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* C = (A[0] + A[1] + A[2] + ... + A[blockSize-1]) / blockSize  */
+  arm_mean_f32(pSrc, blockSize, &fMean);
+  meanV = __arm_x86_dup_f32(fMean);
+
+  /* Compute ARM_X86_F32_LANES outputs at a time */
+  blkCnt = blockSize / ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    inV = __arm_x86_sub_f32(__arm_x86_ld_f32(pInput), meanV);
+    sumV = __arm_x86_fma_f32(sumV, inV, inV);
+    pInput += ARM_X86_F32_LANES;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  fSum = __arm_x86_hsum_f32(sumV);
+
+  /* Compute remaining outputs */
+  blkCnt = blockSize % ARM_X86_F32_LANES;
+
+  while (blkCnt > 0U)
+  {
+    fValue = *pInput++ - fMean;
+    fSum += fValue * fValue;
+
+    /* Decrement loop counter */
+    blkCnt--;
+  }
+
+  /* Variance */
+  *pResult = fSum / (float32_t)(blockSize - 1.0f);
+}
 #else
 void arm_var_f32(
   const float32_t * pSrc,
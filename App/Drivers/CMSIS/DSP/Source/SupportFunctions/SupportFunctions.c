@@ -46,3 +46,6 @@
 #include "arm_q7_to_float.c"
 #include "arm_q7_to_q15.c"
 #include "arm_q7_to_q31.c"
+#include "arm_sort_f32.c"
+#include "arm_sort_q15.c"
+#include "arm_sort_q31.c"
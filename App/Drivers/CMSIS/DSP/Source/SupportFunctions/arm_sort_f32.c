@@ -0,0 +1,270 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_f32.c
+ * Description:  Floating-point vector sorting
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @defgroup Sorting Vector Sorting
+
+  Sorts the elements of a vector in ascending order.
+
+  <pre>
+      pDst[0] <= pDst[1] <= ... <= pDst[blockSize-1]
+  </pre>
+
+  The functions replace generic sorts such as <code>qsort</code>, without their call per comparison.
+  There are separate functions for floating-point, Q31 and Q15 data types.
+
+  @par           Algorithm
+                   The vector is cut into runs of 8 samples, which are each sorted by a sorting network of
+                   19 compare-exchange steps without branches. The runs are then merged two by two, in
+                   <code>log2(blockSize/8)</code> passes between the destination and a scratch buffer.
+  @par
+                   With x86 SIMD, the network sorts one run per lane, on tiles of 8 vectors, and the sorted
+                   runs are transposed to memory. The fixed-point functions sort the large vectors with a
+                   radix sort instead, in one pass per byte of the samples, which does not compare them.
+  @par
+                   The floating-point functions give an unspecified order when the input contains NaN values.
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/* Number of samples in the runs sorted by the network */
+#define ARM_SORT_RUN_LEN      8U
+
+/* Compare-exchange of two samples, without branches */
+#define ARM_SORT_CE(a, b)                         \
+  {                                               \
+    float32_t lo = ((b) < (a)) ? (b) : (a);       \
+    (b) = ((b) < (a)) ? (a) : (b);                \
+    (a) = lo;                                     \
+  }
+
+/* Optimal sorting network of 8 samples */
+#define ARM_SORT_NETWORK8(CE, v)                                    \
+  {                                                                 \
+    CE(v[0], v[2]); CE(v[1], v[3]); CE(v[4], v[6]); CE(v[5], v[7]); \
+    CE(v[0], v[4]); CE(v[1], v[5]); CE(v[2], v[6]); CE(v[3], v[7]); \
+    CE(v[0], v[1]); CE(v[2], v[3]); CE(v[4], v[5]); CE(v[6], v[7]); \
+    CE(v[2], v[4]); CE(v[3], v[5]);                                 \
+    CE(v[1], v[4]); CE(v[3], v[6]);                                 \
+    CE(v[1], v[2]); CE(v[3], v[4]); CE(v[5], v[6]);                 \
+  }
+
+#if defined(ARM_MATH_X86_SIMD)
+
+/* Compare-exchange of two vectors, lane by lane */
+#define ARM_SORT_CE_X86(a, b)                     \
+  {                                               \
+    arm_x86_f32_t lo = __arm_x86_min_f32(a, b);   \
+    (b) = __arm_x86_max_f32(a, b);                \
+    (a) = lo;                                     \
+  }
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+/*
+ * Merges the sorted runs pA and pB into pOut, which must not overlap them.
+ */
+static void arm_sort_merge_f32(
+  const float32_t * pA,
+        uint32_t lenA,
+  const float32_t * pB,
+        uint32_t lenB,
+        float32_t * pOut)
+{
+  const float32_t *pEndA = pA + lenA;
+  const float32_t *pEndB = pB + lenB;
+
+  /* Nothing to compare when the runs are already in order, as in partly sorted inputs */
+  if ((lenA > 0U) && (lenB > 0U) && (*pB < pEndA[-1]))
+  {
+    while ((pA < pEndA) && (pB < pEndB))
+    {
+      if (*pB < *pA)
+      {
+        *pOut++ = *pB++;
+      }
+      else
+      {
+        *pOut++ = *pA++;
+      }
+    }
+  }
+
+  while (pA < pEndA)
+  {
+    *pOut++ = *pA++;
+  }
+
+  while (pB < pEndB)
+  {
+    *pOut++ = *pB++;
+  }
+}
+
+/**
+  @brief         Sorts the elements of a floating-point vector.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     pScratch   points to the scratch buffer, of length <code>blockSize</code>
+  @param[in]     blockSize  number of samples in the vector
+  @return        none
+
+  @par           Details
+                   <code>pDst</code> can be equal to <code>pSrc</code>, for an in-place sort. The scratch buffer
+                   is not used when <code>blockSize</code> is at most 8, and can then be <code>NULL</code>.
+ */
+
+void arm_sort_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        float32_t * pScratch,
+        uint32_t blockSize)
+{
+        float32_t *pIn, *pOut, *pTmp;                  /* Buffers of the merge passes */
+        float32_t v[ARM_SORT_RUN_LEN];                     /* Run sorted by the network */
+        uint32_t width, numPasses;                     /* Length of the merged runs, number of passes */
+        uint32_t n = 0U, i, len, lenB;
+
+  /* The runs are sorted into the buffer from which the last merge pass ends in pDst */
+  numPasses = 0U;
+  for (width = ARM_SORT_RUN_LEN; width < blockSize; width <<= 1U)
+  {
+    numPasses++;
+  }
+
+  pOut = ((numPasses & 1U) != 0U) ? pScratch : pDst;
+
+#if defined(ARM_MATH_X86_SIMD)
+
+  {
+    arm_x86_f32_t r[ARM_SORT_RUN_LEN];                             /* Tile of 8 vectors */
+    float32_t tile[ARM_SORT_RUN_LEN * ARM_X86_F32_LANES];          /* Tile stored for the transpose */
+    uint32_t c;
+
+    /* One run per lane, whose samples are ARM_X86_F32_LANES apart in the tile */
+    for (; (n + ARM_SORT_RUN_LEN * ARM_X86_F32_LANES) <= blockSize; n += ARM_SORT_RUN_LEN * ARM_X86_F32_LANES)
+    {
+      for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+      {
+        r[i] = __arm_x86_ld_f32(pSrc + n + i * ARM_X86_F32_LANES);
+      }
+
+      ARM_SORT_NETWORK8(ARM_SORT_CE_X86, r);
+
+      for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+      {
+        __arm_x86_st_f32(tile + i * ARM_X86_F32_LANES, r[i]);
+      }
+
+      /* Contiguous runs */
+      for (c = 0U; c < ARM_X86_F32_LANES; c++)
+      {
+        for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+        {
+          pOut[n + c * ARM_SORT_RUN_LEN + i] = tile[i * ARM_X86_F32_LANES + c];
+        }
+      }
+    }
+  }
+
+#endif /* #if defined(ARM_MATH_X86_SIMD) */
+
+  for (; (n + ARM_SORT_RUN_LEN) <= blockSize; n += ARM_SORT_RUN_LEN)
+  {
+    for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+    {
+      v[i] = pSrc[n + i];
+    }
+
+    ARM_SORT_NETWORK8(ARM_SORT_CE, v);
+
+    for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+    {
+      pOut[n + i] = v[i];
+    }
+  }
+
+  /* Last run, shorter than the network, by insertion */
+  len = blockSize - n;
+  for (i = 0U; i < len; i++)
+  {
+    float32_t x = pSrc[n + i];
+    uint32_t k = i;
+
+    while ((k > 0U) && (x < v[k - 1U]))
+    {
+      v[k] = v[k - 1U];
+      k--;
+    }
+    v[k] = x;
+  }
+
+  for (i = 0U; i < len; i++)
+  {
+    pOut[n + i] = v[i];
+  }
+
+  /* Merge passes, ending in pDst */
+  pIn = pOut;
+  pOut = (pIn == pDst) ? pScratch : pDst;
+
+  for (width = ARM_SORT_RUN_LEN; width < blockSize; width <<= 1U)
+  {
+    for (n = 0U; n < blockSize; n += 2U * width)
+    {
+      len = (width < blockSize - n) ? width : blockSize - n;
+      lenB = blockSize - n - len;
+      lenB = (width < lenB) ? width : lenB;
+
+      arm_sort_merge_f32(pIn + n, len, pIn + n + len, lenB, pOut + n);
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+}
+
+#undef ARM_SORT_RUN_LEN
+#undef ARM_SORT_CE
+#undef ARM_SORT_NETWORK8
+#undef ARM_SORT_CE_X86
+
+/**
+  @} end of Sorting group
+ */
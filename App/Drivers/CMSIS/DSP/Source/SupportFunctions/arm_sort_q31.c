@@ -0,0 +1,254 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q31.c
+ * Description:  Q31 vector sorting
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupSupport
+ */
+
+/**
+  @addtogroup Sorting
+  @{
+ */
+
+/* Number of samples in the runs sorted by the network */
+#define ARM_SORT_RUN_LEN      8U
+
+/* Number of samples from which the radix sort is used */
+#define ARM_SORT_RADIX_MIN    1024U
+
+/* Compare-exchange of two samples, without branches */
+#define ARM_SORT_CE(a, b)                         \
+  {                                               \
+    q31_t lo = ((b) < (a)) ? (b) : (a);           \
+    (b) = ((b) < (a)) ? (a) : (b);                \
+    (a) = lo;                                     \
+  }
+
+/* Optimal sorting network of 8 samples */
+#define ARM_SORT_NETWORK8(CE, v)                                    \
+  {                                                                 \
+    CE(v[0], v[2]); CE(v[1], v[3]); CE(v[4], v[6]); CE(v[5], v[7]); \
+    CE(v[0], v[4]); CE(v[1], v[5]); CE(v[2], v[6]); CE(v[3], v[7]); \
+    CE(v[0], v[1]); CE(v[2], v[3]); CE(v[4], v[5]); CE(v[6], v[7]); \
+    CE(v[2], v[4]); CE(v[3], v[5]);                                 \
+    CE(v[1], v[4]); CE(v[3], v[6]);                                 \
+    CE(v[1], v[2]); CE(v[3], v[4]); CE(v[5], v[6]);                 \
+  }
+
+/*
+ * Merges the sorted runs pA and pB into pOut, which must not overlap them.
+ */
+static void arm_sort_merge_q31(
+  const q31_t * pA,
+        uint32_t lenA,
+  const q31_t * pB,
+        uint32_t lenB,
+        q31_t * pOut)
+{
+  const q31_t *pEndA = pA + lenA;
+  const q31_t *pEndB = pB + lenB;
+
+  /* Nothing to compare when the runs are already in order, as in partly sorted inputs */
+  if ((lenA > 0U) && (lenB > 0U) && (*pB < pEndA[-1]))
+  {
+    while ((pA < pEndA) && (pB < pEndB))
+    {
+      if (*pB < *pA)
+      {
+        *pOut++ = *pB++;
+      }
+      else
+      {
+        *pOut++ = *pA++;
+      }
+    }
+  }
+
+  while (pA < pEndA)
+  {
+    *pOut++ = *pA++;
+  }
+
+  while (pB < pEndB)
+  {
+    *pOut++ = *pB++;
+  }
+}
+
+/*
+ * Radix sort of blockSize samples, in 4 passes of 8 bits from the least significant byte,
+ * from pSrc to pScratch and back to pDst. Each pass keeps the order of the samples with the
+ * same byte, and the sign bit is flipped so that the negative samples come first.
+ */
+static void arm_sort_radix_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pScratch,
+        uint32_t blockSize)
+{
+        uint32_t count[256];                           /* Number of samples, then first position, of each byte */
+  const q31_t *pIn = pSrc;
+        q31_t *pOut = pScratch;
+        uint32_t shift, n, d, sum, tmp;
+
+  for (shift = 0U; shift < 32U; shift += 8U)
+  {
+    memset(count, 0, sizeof(count));
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      count[((uint32_t) (pIn[n] ^ 0x80000000U) >> shift) & 0xFFU]++;
+    }
+
+    sum = 0U;
+    for (d = 0U; d < 256U; d++)
+    {
+      tmp = count[d];
+      count[d] = sum;
+      sum += tmp;
+    }
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      d = ((uint32_t) (pIn[n] ^ 0x80000000U) >> shift) & 0xFFU;
+      pOut[count[d]++] = pIn[n];
+    }
+
+    /* An even number of passes ends in pDst */
+    pIn = pOut;
+    pOut = (pOut == pScratch) ? pDst : pScratch;
+  }
+}
+
+/**
+  @brief         Sorts the elements of a Q31 vector.
+  @param[in]     pSrc       points to the input vector
+  @param[out]    pDst       points to the output vector
+  @param[in]     pScratch   points to the scratch buffer, of length <code>blockSize</code>
+  @param[in]     blockSize  number of samples in the vector
+  @return        none
+
+  @par           Details
+                   <code>pDst</code> can be equal to <code>pSrc</code>, for an in-place sort. The scratch buffer
+                   is not used when <code>blockSize</code> is at most 8, and can then be <code>NULL</code>.
+                   From 1024 samples, the vector is sorted by 4 radix passes of 8 bits.
+ */
+
+void arm_sort_q31(
+  const q31_t * pSrc,
+        q31_t * pDst,
+        q31_t * pScratch,
+        uint32_t blockSize)
+{
+        q31_t *pIn, *pOut, *pTmp;                      /* Buffers of the merge passes */
+        q31_t v[ARM_SORT_RUN_LEN];                         /* Run sorted by the network */
+        uint32_t width, numPasses;                     /* Length of the merged runs, number of passes */
+        uint32_t n = 0U, i, len, lenB;
+
+  if (blockSize >= ARM_SORT_RADIX_MIN)
+  {
+    arm_sort_radix_q31(pSrc, pDst, pScratch, blockSize);
+    return;
+  }
+
+  /* The runs are sorted into the buffer from which the last merge pass ends in pDst */
+  numPasses = 0U;
+  for (width = ARM_SORT_RUN_LEN; width < blockSize; width <<= 1U)
+  {
+    numPasses++;
+  }
+
+  pOut = ((numPasses & 1U) != 0U) ? pScratch : pDst;
+
+  for (; (n + ARM_SORT_RUN_LEN) <= blockSize; n += ARM_SORT_RUN_LEN)
+  {
+    for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+    {
+      v[i] = pSrc[n + i];
+    }
+
+    ARM_SORT_NETWORK8(ARM_SORT_CE, v);
+
+    for (i = 0U; i < ARM_SORT_RUN_LEN; i++)
+    {
+      pOut[n + i] = v[i];
+    }
+  }
+
+  /* Last run, shorter than the network, by insertion */
+  len = blockSize - n;
+  for (i = 0U; i < len; i++)
+  {
+    q31_t x = pSrc[n + i];
+    uint32_t k = i;
+
+    while ((k > 0U) && (x < v[k - 1U]))
+    {
+      v[k] = v[k - 1U];
+      k--;
+    }
+    v[k] = x;
+  }
+
+  for (i = 0U; i < len; i++)
+  {
+    pOut[n + i] = v[i];
+  }
+
+  /* Merge passes, ending in pDst */
+  pIn = pOut;
+  pOut = (pIn == pDst) ? pScratch : pDst;
+
+  for (width = ARM_SORT_RUN_LEN; width < blockSize; width <<= 1U)
+  {
+    for (n = 0U; n < blockSize; n += 2U * width)
+    {
+      len = (width < blockSize - n) ? width : blockSize - n;
+      lenB = blockSize - n - len;
+      lenB = (width < lenB) ? width : lenB;
+
+      arm_sort_merge_q31(pIn + n, len, pIn + n + len, lenB, pOut + n);
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+}
+
+#undef ARM_SORT_RUN_LEN
+#undef ARM_SORT_RADIX_MIN
+#undef ARM_SORT_CE
+#undef ARM_SORT_NETWORK8
+
+/**
+  @} end of Sorting group
+ */
@@ -29,6 +29,12 @@
 #include "arm_bitreversal.c"
 #include "arm_bitreversal2.c"
 #include "arm_cfft_f32.c"
+#include "arm_cfft_batch_f32.c"
+#include "arm_cfft_init_ram_f32.c"
+#include "arm_cfft_large_f32.c"
+#include "arm_cfft_large_init_f32.c"
+#include "arm_cfft_mixed_f32.c"
+#include "arm_cfft_mixed_init_f32.c"
 #include "arm_cfft_q15.c"
 #include "arm_cfft_q31.c"
 #include "arm_cfft_radix2_f32.c"
@@ -50,11 +56,23 @@
 #include "arm_dct4_init_q31.c"
 #include "arm_dct4_q15.c"
 #include "arm_dct4_q31.c"
+#include "arm_goertzel_f32.c"
+#include "arm_goertzel_init_f32.c"
+#include "arm_goertzel_init_q31.c"
+#include "arm_goertzel_q31.c"
 #include "arm_rfft_f32.c"
 #include "arm_rfft_fast_f32.c"
+#include "arm_rfft_fast_batch_f32.c"
 #include "arm_rfft_fast_init_f32.c"
+#include "arm_rfft_fast_init_ram_f32.c"
 #include "arm_rfft_init_f32.c"
 #include "arm_rfft_init_q15.c"
 #include "arm_rfft_init_q31.c"
 #include "arm_rfft_q15.c"
 #include "arm_rfft_q31.c"
+#include "arm_sdft_f32.c"
+#include "arm_sdft_init_f32.c"
+#include "arm_sdft_init_q31.c"
+#include "arm_sdft_q31.c"
+#include "arm_stft_f32.c"
+#include "arm_stft_init_f32.c"
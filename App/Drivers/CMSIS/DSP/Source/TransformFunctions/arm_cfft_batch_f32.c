@@ -0,0 +1,538 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_batch_f32.c
+ * Description:  Multi-frame floating-point CFFT sharing twiddle and bit reversal table loads
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Frames transformed together; their working set must stay in cache */
+#define ARM_CFFT_BATCH_FRAMES 4U
+
+/*
+ * Radix-8 butterfly of arm_radix8_butterfly_f32() on points i1, i1+n2, ...,
+ * i1+7*n2 with unit twiddle factors.
+ */
+__STATIC_FORCEINLINE void arm_cfft_batch_bfly8_f32(
+  float32_t * pSrc,
+  uint32_t i1,
+  uint32_t n2)
+{
+  uint32_t i2, i3, i4, i5, i6, i7, i8;
+  float32_t r1, r2, r3, r4, r5, r6, r7, r8;
+  float32_t t1, t2;
+  float32_t s3, s5, s6, s7, s8;
+  const float32_t C81 = 0.70710678118f;
+
+  i2 = i1 + n2;
+  i3 = i2 + n2;
+  i4 = i3 + n2;
+  i5 = i4 + n2;
+  i6 = i5 + n2;
+  i7 = i6 + n2;
+  i8 = i7 + n2;
+  r1 = pSrc[2 * i1] + pSrc[2 * i5];
+  r5 = pSrc[2 * i1] - pSrc[2 * i5];
+  r2 = pSrc[2 * i2] + pSrc[2 * i6];
+  r6 = pSrc[2 * i2] - pSrc[2 * i6];
+  r3 = pSrc[2 * i3] + pSrc[2 * i7];
+  r7 = pSrc[2 * i3] - pSrc[2 * i7];
+  r4 = pSrc[2 * i4] + pSrc[2 * i8];
+  r8 = pSrc[2 * i4] - pSrc[2 * i8];
+  t1 = r1 - r3;
+  r1 = r1 + r3;
+  r3 = r2 - r4;
+  r2 = r2 + r4;
+  pSrc[2 * i1] = r1 + r2;
+  pSrc[2 * i5] = r1 - r2;
+  r1 = pSrc[2 * i1 + 1] + pSrc[2 * i5 + 1];
+  s5 = pSrc[2 * i1 + 1] - pSrc[2 * i5 + 1];
+  r2 = pSrc[2 * i2 + 1] + pSrc[2 * i6 + 1];
+  s6 = pSrc[2 * i2 + 1] - pSrc[2 * i6 + 1];
+  s3 = pSrc[2 * i3 + 1] + pSrc[2 * i7 + 1];
+  s7 = pSrc[2 * i3 + 1] - pSrc[2 * i7 + 1];
+  r4 = pSrc[2 * i4 + 1] + pSrc[2 * i8 + 1];
+  s8 = pSrc[2 * i4 + 1] - pSrc[2 * i8 + 1];
+  t2 = r1 - s3;
+  r1 = r1 + s3;
+  s3 = r2 - r4;
+  r2 = r2 + r4;
+  pSrc[2 * i1 + 1] = r1 + r2;
+  pSrc[2 * i5 + 1] = r1 - r2;
+  pSrc[2 * i3]     = t1 + s3;
+  pSrc[2 * i7]     = t1 - s3;
+  pSrc[2 * i3 + 1] = t2 - r3;
+  pSrc[2 * i7 + 1] = t2 + r3;
+  r1 = (r6 - r8) * C81;
+  r6 = (r6 + r8) * C81;
+  r2 = (s6 - s8) * C81;
+  s6 = (s6 + s8) * C81;
+  t1 = r5 - r1;
+  r5 = r5 + r1;
+  r8 = r7 - r6;
+  r7 = r7 + r6;
+  t2 = s5 - r2;
+  s5 = s5 + r2;
+  s8 = s7 - s6;
+  s7 = s7 + s6;
+  pSrc[2 * i2]     = r5 + s7;
+  pSrc[2 * i8]     = r5 - s7;
+  pSrc[2 * i6]     = t1 + s8;
+  pSrc[2 * i4]     = t1 - s8;
+  pSrc[2 * i2 + 1] = s5 - r7;
+  pSrc[2 * i8 + 1] = s5 + r7;
+  pSrc[2 * i6 + 1] = t2 - r8;
+  pSrc[2 * i4 + 1] = t2 + r8;
+}
+
+/*
+ * Radix-8 butterfly of arm_radix8_butterfly_f32() followed by the twiddle
+ * factors pTw = {co2, si2, co3, si3, ..., co8, si8}.
+ */
+__STATIC_FORCEINLINE void arm_cfft_batch_bfly8_tw_f32(
+        float32_t * pSrc,
+        uint32_t i1,
+        uint32_t n2,
+  const float32_t * pTw)
+{
+  uint32_t i2, i3, i4, i5, i6, i7, i8;
+  float32_t r1, r2, r3, r4, r5, r6, r7, r8;
+  float32_t t1, t2;
+  float32_t s1, s2, s3, s4, s5, s6, s7, s8;
+  float32_t p1, p2, p3, p4;
+  const float32_t C81 = 0.70710678118f;
+
+  i2 = i1 + n2;
+  i3 = i2 + n2;
+  i4 = i3 + n2;
+  i5 = i4 + n2;
+  i6 = i5 + n2;
+  i7 = i6 + n2;
+  i8 = i7 + n2;
+  r1 = pSrc[2 * i1] + pSrc[2 * i5];
+  r5 = pSrc[2 * i1] - pSrc[2 * i5];
+  r2 = pSrc[2 * i2] + pSrc[2 * i6];
+  r6 = pSrc[2 * i2] - pSrc[2 * i6];
+  r3 = pSrc[2 * i3] + pSrc[2 * i7];
+  r7 = pSrc[2 * i3] - pSrc[2 * i7];
+  r4 = pSrc[2 * i4] + pSrc[2 * i8];
+  r8 = pSrc[2 * i4] - pSrc[2 * i8];
+  t1 = r1 - r3;
+  r1 = r1 + r3;
+  r3 = r2 - r4;
+  r2 = r2 + r4;
+  pSrc[2 * i1] = r1 + r2;
+  r2 = r1 - r2;
+  s1 = pSrc[2 * i1 + 1] + pSrc[2 * i5 + 1];
+  s5 = pSrc[2 * i1 + 1] - pSrc[2 * i5 + 1];
+  s2 = pSrc[2 * i2 + 1] + pSrc[2 * i6 + 1];
+  s6 = pSrc[2 * i2 + 1] - pSrc[2 * i6 + 1];
+  s3 = pSrc[2 * i3 + 1] + pSrc[2 * i7 + 1];
+  s7 = pSrc[2 * i3 + 1] - pSrc[2 * i7 + 1];
+  s4 = pSrc[2 * i4 + 1] + pSrc[2 * i8 + 1];
+  s8 = pSrc[2 * i4 + 1] - pSrc[2 * i8 + 1];
+  t2 = s1 - s3;
+  s1 = s1 + s3;
+  s3 = s2 - s4;
+  s2 = s2 + s4;
+  r1 = t1 + s3;
+  t1 = t1 - s3;
+  pSrc[2 * i1 + 1] = s1 + s2;
+  s2 = s1 - s2;
+  s1 = t2 - r3;
+  t2 = t2 + r3;
+  p1 = pTw[6] * r2;
+  p2 = pTw[7] * s2;
+  p3 = pTw[6] * s2;
+  p4 = pTw[7] * r2;
+  pSrc[2 * i5]     = p1 + p2;
+  pSrc[2 * i5 + 1] = p3 - p4;
+  p1 = pTw[2] * r1;
+  p2 = pTw[3] * s1;
+  p3 = pTw[2] * s1;
+  p4 = pTw[3] * r1;
+  pSrc[2 * i3]     = p1 + p2;
+  pSrc[2 * i3 + 1] = p3 - p4;
+  p1 = pTw[10] * t1;
+  p2 = pTw[11] * t2;
+  p3 = pTw[10] * t2;
+  p4 = pTw[11] * t1;
+  pSrc[2 * i7]     = p1 + p2;
+  pSrc[2 * i7 + 1] = p3 - p4;
+  r1 = (r6 - r8) * C81;
+  r6 = (r6 + r8) * C81;
+  s1 = (s6 - s8) * C81;
+  s6 = (s6 + s8) * C81;
+  t1 = r5 - r1;
+  r5 = r5 + r1;
+  r8 = r7 - r6;
+  r7 = r7 + r6;
+  t2 = s5 - s1;
+  s5 = s5 + s1;
+  s8 = s7 - s6;
+  s7 = s7 + s6;
+  r1 = r5 + s7;
+  r5 = r5 - s7;
+  r6 = t1 + s8;
+  t1 = t1 - s8;
+  s1 = s5 - r7;
+  s5 = s5 + r7;
+  s6 = t2 - r8;
+  t2 = t2 + r8;
+  p1 = pTw[0] * r1;
+  p2 = pTw[1] * s1;
+  p3 = pTw[0] * s1;
+  p4 = pTw[1] * r1;
+  pSrc[2 * i2]     = p1 + p2;
+  pSrc[2 * i2 + 1] = p3 - p4;
+  p1 = pTw[12] * r5;
+  p2 = pTw[13] * s5;
+  p3 = pTw[12] * s5;
+  p4 = pTw[13] * r5;
+  pSrc[2 * i8]     = p1 + p2;
+  pSrc[2 * i8 + 1] = p3 - p4;
+  p1 = pTw[8] * r6;
+  p2 = pTw[9] * s6;
+  p3 = pTw[8] * s6;
+  p4 = pTw[9] * r6;
+  pSrc[2 * i6]     = p1 + p2;
+  pSrc[2 * i6 + 1] = p3 - p4;
+  p1 = pTw[4] * t1;
+  p2 = pTw[5] * t2;
+  p3 = pTw[4] * t2;
+  p4 = pTw[5] * t1;
+  pSrc[2 * i4]     = p1 + p2;
+  pSrc[2 * i4 + 1] = p3 - p4;
+}
+
+/*
+ * arm_radix8_butterfly_f32() over numFrames frames: each group of twiddle
+ * factors is read once and used by the butterflies of every frame.
+ */
+static void arm_cfft_batch_radix8_f32(
+        float32_t * pSrc,
+        uint32_t fftLen,
+  const float32_t * pCoef,
+        uint32_t twidCoefModifier,
+        uint32_t numFrames,
+        uint32_t frameStride)
+{
+  float32_t tw[14];
+  uint32_t ia, id;
+  uint32_t n1, n2, i1, j, k, f;
+
+  n2 = fftLen;
+
+  do
+  {
+    n1 = n2;
+    n2 = n2 >> 3;
+
+    for (i1 = 0U; i1 < fftLen; i1 += n1)
+    {
+      for (f = 0U; f < numFrames; f++)
+      {
+        arm_cfft_batch_bfly8_f32(pSrc + f * frameStride, i1, n2);
+      }
+    }
+
+    if (n2 < 8U)
+      break;
+
+    ia = 0U;
+
+    for (j = 1U; j < n2; j++)
+    {
+      /* Twiddle factors W^(k*ia), k = 1..7 */
+      id = ia + twidCoefModifier;
+      ia = id;
+      for (k = 0U; k < 7U; k++)
+      {
+        tw[2U * k]      = pCoef[2U * (k + 1U) * id];
+        tw[2U * k + 1U] = pCoef[2U * (k + 1U) * id + 1U];
+      }
+
+      for (i1 = j; i1 < fftLen; i1 += n1)
+      {
+        for (f = 0U; f < numFrames; f++)
+        {
+          arm_cfft_batch_bfly8_tw_f32(pSrc + f * frameStride, i1, n2, tw);
+        }
+      }
+    }
+
+    twidCoefModifier <<= 3;
+  } while (n2 > 7U);
+}
+
+/*
+ * First stage of arm_cfft_radix8by2_f32(): a radix-2 decimation in frequency
+ * stage, then the two halves go through the radix-8 stages.
+ */
+static void arm_cfft_batch_radix8by2_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint32_t numFrames,
+        uint32_t frameStride)
+{
+        uint32_t L = S->fftLen >> 1;
+  const float32_t *tw = S->pTwiddle;
+        float32_t *pA, *pB;
+        float32_t twR, twI, dR, dI;
+        uint32_t i, f;
+
+  for (i = 0U; i < L; i++)
+  {
+    twR = tw[2U * i];
+    twI = tw[2U * i + 1U];
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      pA = p1 + f * frameStride + 2U * i;
+      pB = pA + 2U * L;
+
+      dR = pA[0] - pB[0];
+      dI = pA[1] - pB[1];
+      pA[0] = pA[0] + pB[0];
+      pA[1] = pA[1] + pB[1];
+
+      /* (a - b) * conj(W^i) */
+      pB[0] = dR * twR + dI * twI;
+      pB[1] = dI * twR - dR * twI;
+    }
+  }
+
+  arm_cfft_batch_radix8_f32(p1, L, S->pTwiddle, 2U, numFrames, frameStride);
+  arm_cfft_batch_radix8_f32(p1 + 2U * L, L, S->pTwiddle, 2U, numFrames, frameStride);
+}
+
+/*
+ * First stage of arm_cfft_radix8by4_f32(): a radix-4 decimation in frequency
+ * stage, then the four quarters go through the radix-8 stages.
+ */
+static void arm_cfft_batch_radix8by4_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint32_t numFrames,
+        uint32_t frameStride)
+{
+        uint32_t L = S->fftLen >> 2;
+  const float32_t *tw = S->pTwiddle;
+        float32_t *pA, *pB, *pC, *pD;
+        float32_t w1R, w1I, w2R, w2I, w3R, w3I;
+        float32_t apcR, apcI, amcR, amcI, bpdR, bpdI, bmdR, bmdI;
+        float32_t yR, yI;
+        uint32_t i, f;
+
+  for (i = 0U; i < L; i++)
+  {
+    w1R = tw[2U * i];
+    w1I = tw[2U * i + 1U];
+    w2R = tw[4U * i];
+    w2I = tw[4U * i + 1U];
+    w3R = tw[6U * i];
+    w3I = tw[6U * i + 1U];
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      pA = p1 + f * frameStride + 2U * i;
+      pB = pA + 2U * L;
+      pC = pB + 2U * L;
+      pD = pC + 2U * L;
+
+      apcR = pA[0] + pC[0];
+      apcI = pA[1] + pC[1];
+      amcR = pA[0] - pC[0];
+      amcI = pA[1] - pC[1];
+      bpdR = pB[0] + pD[0];
+      bpdI = pB[1] + pD[1];
+      bmdR = pB[0] - pD[0];
+      bmdI = pB[1] - pD[1];
+
+      /* col 1 */
+      pA[0] = apcR + bpdR;
+      pA[1] = apcI + bpdI;
+
+      /* col 2: (a - jb - c + jd) * conj(W^i) */
+      yR = amcR + bmdI;
+      yI = amcI - bmdR;
+      pB[0] = yR * w1R + yI * w1I;
+      pB[1] = yI * w1R - yR * w1I;
+
+      /* col 3: (a - b + c - d) * conj(W^2i) */
+      yR = apcR - bpdR;
+      yI = apcI - bpdI;
+      pC[0] = yR * w2R + yI * w2I;
+      pC[1] = yI * w2R - yR * w2I;
+
+      /* col 4: (a + jb - c - jd) * conj(W^3i) */
+      yR = amcR - bmdI;
+      yI = amcI + bmdR;
+      pD[0] = yR * w3R + yI * w3I;
+      pD[1] = yI * w3R - yR * w3I;
+    }
+  }
+
+  arm_cfft_batch_radix8_f32(p1, L, S->pTwiddle, 4U, numFrames, frameStride);
+  arm_cfft_batch_radix8_f32(p1 + 2U * L, L, S->pTwiddle, 4U, numFrames, frameStride);
+  arm_cfft_batch_radix8_f32(p1 + 4U * L, L, S->pTwiddle, 4U, numFrames, frameStride);
+  arm_cfft_batch_radix8_f32(p1 + 6U * L, L, S->pTwiddle, 4U, numFrames, frameStride);
+}
+
+/* arm_bitreversal_32() over numFrames frames, reading the table once */
+static void arm_cfft_batch_bitreversal_f32(
+        float32_t * p1,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTab,
+        uint32_t numFrames,
+        uint32_t frameStride)
+{
+  uint32_t *pSrc;
+  uint32_t a, b, i, f, tmp;
+
+  for (i = 0U; i < bitRevLen; i += 2U)
+  {
+    a = pBitRevTab[i    ] >> 2;
+    b = pBitRevTab[i + 1] >> 2;
+
+    for (f = 0U; f < numFrames; f++)
+    {
+      pSrc = (uint32_t *) (p1 + f * frameStride);
+
+      tmp = pSrc[a];
+      pSrc[a] = pSrc[b];
+      pSrc[b] = tmp;
+
+      tmp = pSrc[a + 1];
+      pSrc[a + 1] = pSrc[b + 1];
+      pSrc[b + 1] = tmp;
+    }
+  }
+}
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for several frames of the floating-point complex FFT.
+  @param[in]     S              points to an instance of the floating-point CFFT structure
+  @param[in,out] p1             points to the first frame. Processing occurs in-place
+  @param[in]     numFrames      number of frames to transform
+  @param[in]     frameStride    distance, in float32_t values, from the start of one frame to the next (at least <code>2*fftLen</code>)
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @param[in]     bitReverseFlag flag that enables / disables bit reversal of output
+                   - value = 0: disables bit reversal of output
+                   - value = 1: enables bit reversal of output
+  @return        none
+
+  @par           Details
+                   Gives the same results as calling arm_cfft_f32() on each frame in turn.
+                   The frames are processed a few at a time and every butterfly stage runs over
+                   all the frames of a group before moving on, so each twiddle factor and each
+                   bit reversal table entry is loaded once per group instead of once per frame.
+ */
+
+void arm_cfft_batch_f32(
+  const arm_cfft_instance_f32 * S,
+        float32_t * p1,
+        uint32_t numFrames,
+        uint32_t frameStride,
+        uint8_t ifftFlag,
+        uint8_t bitReverseFlag)
+{
+  uint32_t L = S->fftLen, l;
+  uint32_t f0, f, n;                             /* Frame counters */
+  float32_t invL, * pSrc;
+
+  for (f0 = 0U; f0 < numFrames; f0 += n)
+  {
+    n = numFrames - f0;
+    if (n > ARM_CFFT_BATCH_FRAMES)
+    {
+      n = ARM_CFFT_BATCH_FRAMES;
+    }
+
+    if (ifftFlag == 1U)
+    {
+      /* Conjugate input data */
+      for (f = 0U; f < n; f++)
+      {
+        pSrc = p1 + (f0 + f) * frameStride + 1;
+        for (l = 0; l < L; l++)
+        {
+          *pSrc = -*pSrc;
+          pSrc += 2;
+        }
+      }
+    }
+
+    switch (L)
+    {
+    case 16:
+    case 128:
+    case 1024:
+      arm_cfft_batch_radix8by2_f32(S, p1 + f0 * frameStride, n, frameStride);
+      break;
+    case 32:
+    case 256:
+    case 2048:
+      arm_cfft_batch_radix8by4_f32(S, p1 + f0 * frameStride, n, frameStride);
+      break;
+    case 64:
+    case 512:
+    case 4096:
+      arm_cfft_batch_radix8_f32(p1 + f0 * frameStride, L, S->pTwiddle, 1U, n, frameStride);
+      break;
+    }
+
+    if (bitReverseFlag)
+      arm_cfft_batch_bitreversal_f32(p1 + f0 * frameStride, S->bitRevLength, S->pBitRevTable, n, frameStride);
+
+    if (ifftFlag == 1U)
+    {
+      invL = 1.0f / (float32_t)L;
+
+      /* Conjugate and scale output data */
+      for (f = 0U; f < n; f++)
+      {
+        pSrc = p1 + (f0 + f) * frameStride;
+        for (l = 0; l < L; l++)
+        {
+          *pSrc++ *=   invL ;
+          *pSrc    = -(*pSrc) * invL;
+          pSrc++;
+        }
+      }
+    }
+  }
+}
+
+/**
+  @} end of ComplexFFT group
+ */
@@ -0,0 +1,202 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_init_ram_f32.c
+ * Description:  Floating-point CFFT initialization function with tables computed in RAM
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup ComplexFFT
+  @{
+ */
+
+/**
+  @brief         Twiddle factor <code>exp(j*2*pi*k/len)</code> as a {cos, sin} pair.
+  @param[in]     k          index of the twiddle factor
+  @param[in]     len        number of twiddle factors per turn, a multiple of 4
+  @param[out]    pTwiddle   points to the pair of values
+  @return        none
+
+  @par           Details
+                   The angle is reduced to its quadrant with integers, so that the values at multiples of
+                   a quarter turn are exact and the quadrants are symmetric. The cosine and sine of the
+                   remainder are computed in double precision and rounded, as the constant tables.
+ */
+
+void arm_cfft_twiddle_f32(
+  uint32_t k,
+  uint32_t len,
+  float32_t * pTwiddle)
+{
+  uint32_t q = (4U * k) / len;                   /* Quadrant */
+  float64_t a, c, s, t;
+
+  a = (6.28318530717958647692 * (float64_t) (4U * k - q * len)) / (4.0 * (float64_t) len);
+  c = cos(a);
+  s = sin(a);
+
+  switch (q & 3U)
+  {
+  case 1U:
+    t = c; c = -s; s = t;
+    break;
+  case 2U:
+    c = -c; s = -s;
+    break;
+  case 3U:
+    t = c; c = s; s = -t;
+    break;
+  default:
+    break;
+  }
+
+  /* Adding 0 turns the negated zeros into positive ones */
+  pTwiddle[0] = (float32_t) (c + 0.0);
+  pTwiddle[1] = (float32_t) (s + 0.0);
+}
+
+/*
+ * Index of the sample which arm_cfft_f32() leaves at position n: the digits of n in radix
+ * 8, after a first digit in radix 2 or 4 when log2(fftLen) is not a multiple of 3, in reverse order.
+ */
+static uint32_t arm_cfft_digitrev_f32(
+  uint32_t n,
+  uint32_t log2Len)
+{
+  uint32_t b0 = log2Len % 3U;                    /* Bits of the first digit */
+  uint32_t r;                                    /* Reversed index */
+  uint32_t k;
+
+  r = n & ((1UL << b0) - 1U);
+  n >>= b0;
+
+  for (k = 0U; k < log2Len / 3U; k++)
+  {
+    r = (r << 3U) | (n & 7U);
+    n >>= 3U;
+  }
+
+  return (r);
+}
+
+/**
+  @brief         Initialization function for the floating-point CFFT/CIFFT with tables computed in RAM.
+  @param[in,out] S             points to an instance of the floating-point CFFT structure
+  @param[in]     fftLen        length of the FFT, a power of two from 16 to 4096
+  @param[out]    pTwiddle      points to a buffer of <code>2*fftLen</code> values which receives the twiddle factors
+  @param[out]    pBitRevTable  points to a buffer of <code>2*fftLen</code> values which receives the bit reversal table
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   Gives the same transform as the constant instance <code>arm_cfft_sR_f32_len<fftLen></code>,
+                   without the constant tables, which can then be left out of the build with the table
+                   configuration (<code>CONFIGTABLE</code> without <code>ALLFFT</code> and the <code>CFFT_F32_*</code>
+                   options). The twiddle factors are the same as the constant ones, within 1 ULP (unit in the last
+                   place): they are rounded from double precision where the tables are rounded from 9 decimals.
+  @par
+                   The bit reversal table is the list of swaps which puts the outputs of the radix-8 stages
+                   in order, of the same length as the constant one: one swap per element moved, minus one
+                   per cycle of the permutation. <code>S->bitRevLength</code> gives the number of values
+                   written, below <code>2*fftLen</code>.
+  @par
+                   The buffers must then be left unchanged while the instance is used.
+ */
+
+arm_status arm_cfft_init_ram_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  uint32_t log2Len;                              /* log2(fftLen) */
+  uint32_t n, j, p;                              /* Element indices */
+  uint32_t bitRevLength = 0U;                    /* Values written to the bit reversal table */
+
+  if ((S == NULL) || (pTwiddle == NULL) || (pBitRevTable == NULL) ||
+      (fftLen < 16U) || (fftLen > 4096U) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (log2Len = 0U; (1UL << log2Len) < fftLen; log2Len++)
+  {
+  }
+
+  /* exp(j*2*pi*n/fftLen) for a full turn, as the constant tables */
+  for (n = 0U; n < fftLen; n++)
+  {
+    arm_cfft_twiddle_f32(n, fftLen, pTwiddle + 2U * n);
+  }
+
+  /*
+   * Each cycle of the permutation is walked once, from its smallest element: swapping the
+   * elements at j and p(j) along the cycle brings each of them in place but the last.
+   * The table holds the offsets in bytes of the complex values.
+   */
+  for (n = 0U; n < fftLen; n++)
+  {
+    j = arm_cfft_digitrev_f32(n, log2Len);
+
+    while (j > n)
+    {
+      j = arm_cfft_digitrev_f32(j, log2Len);
+    }
+
+    if (j < n)
+    {
+      continue;
+    }
+
+    j = n;
+    p = arm_cfft_digitrev_f32(j, log2Len);
+
+    while (p != n)
+    {
+      pBitRevTable[bitRevLength++] = (uint16_t) (8U * j);
+      pBitRevTable[bitRevLength++] = (uint16_t) (8U * p);
+      j = p;
+      p = arm_cfft_digitrev_f32(j, log2Len);
+    }
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = (uint16_t) bitRevLength;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of ComplexFFT group
+ */
@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_large_f32.c
+ * Description:  Floating-point large complex FFT by the six-step method
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup LargeCFFT Large Complex FFT Functions
+
+  @par
+                   The constant tables of arm_cfft_f32() stop at 4096 points. The large CFFT
+                   computes power-of-two transforms of up to 16777216 (4096 * 4096) points by
+                   splitting the length as <code>fftLen = N1 * N2</code> and doing N2 transforms of
+                   length N1 followed by N1 transforms of length N2 with arm_cfft_f32(), so the
+                   existing radix-8 kernels do all the butterflies.
+  @par
+                   The data is handled as a matrix of N1 rows of N2 points and the six-step
+                   (Bailey) order is used:
+                   -# transpose into the working buffer, so each column becomes a contiguous row,
+                   -# transform each row with the length N1 CFFT and multiply it by its twiddle
+                      factors <code>W_fftLen^(row*k)</code> while the row is still in cache,
+                   -# transpose back,
+                   -# transform each row with the length N2 CFFT,
+                   -# transpose into the working buffer, which puts the result in natural order,
+                   -# copy the result back.
+  @par
+                   Every transform works on a contiguous row of at most 4096 points and the
+                   transposes are done in tiles, so the working set of each step stays in cache.
+                   The extra memory is the working buffer of <code>2*fftLen</code> values and a
+                   twiddle table of <code>2*(N1+N2)</code> values, both supplied by the caller.
+  @par
+                   The data is in-place from the caller's point of view and uses the same
+                   interleaving as arm_cfft_f32()
+                   <pre>{real[0], imag[0], real[1], imag[1], ...} </pre>
+                   The forward transform is not scaled. The inverse transform includes a scale
+                   of <code>1/fftLen</code>, as arm_cfft_f32() does.
+ */
+
+/**
+  @addtogroup LargeCFFT
+  @{
+ */
+
+/* Side, in complex values, of the tiles moved by the transposes */
+#define ARM_CFFT_LARGE_TILE 16U
+
+/*
+ * Transpose the complex matrix pSrc of rows x cols values into pDst. rows and
+ * cols are powers of two of at least ARM_CFFT_LARGE_TILE.
+ */
+static void arm_cfft_large_transpose_f32(
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t rows,
+        uint32_t cols)
+{
+  const float32_t *pIn;
+        float32_t *pOut;
+        uint32_t r0, c0, r, c;                   /* Loop counters */
+
+  for (r0 = 0U; r0 < rows; r0 += ARM_CFFT_LARGE_TILE)
+  {
+    for (c0 = 0U; c0 < cols; c0 += ARM_CFFT_LARGE_TILE)
+    {
+      for (r = r0; r < (r0 + ARM_CFFT_LARGE_TILE); r++)
+      {
+        pIn = pSrc + 2U * (r * cols + c0);
+        pOut = pDst + 2U * (c0 * rows + r);
+
+        for (c = 0U; c < ARM_CFFT_LARGE_TILE; c++)
+        {
+          pOut[0] = pIn[0];
+          pOut[1] = pIn[1];
+          pIn += 2U;
+          pOut += 2U * rows;
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Multiply point k of row `row` of the first pass by conj(W^(row*k)), with
+ * W = exp(j*2*pi/fftLen). The exponent m = row*k is kept as hi*N1 + lo so that
+ * W^m = W^lo * W_N2^hi comes from the two short tables.
+ */
+static void arm_cfft_large_twiddle_f32(
+        float32_t * pRow,
+        uint32_t n1,
+        uint32_t row,
+  const float32_t * pTwiddle)
+{
+  const float32_t *pHigh = pTwiddle + 2U * n1;   /* W_N2^hi table */
+        uint32_t stepLo = row & (n1 - 1U);       /* Exponent step, low part */
+        uint32_t stepHi = row / n1;              /* Exponent step, high part */
+        uint32_t lo = 0U, hi = 0U;               /* Exponent of the current point */
+        uint32_t k;                              /* Loop counter */
+        float32_t aRe, aIm, bRe, bIm;            /* Table entries */
+        float32_t wRe, wIm;                      /* Twiddle factor */
+        float32_t xRe, xIm;                      /* Data point */
+
+  for (k = 0U; k < n1; k++)
+  {
+    aRe = pTwiddle[2U * lo];
+    aIm = pTwiddle[2U * lo + 1U];
+    bRe = pHigh[2U * hi];
+    bIm = pHigh[2U * hi + 1U];
+
+    wRe = aRe * bRe - aIm * bIm;
+    wIm = aRe * bIm + aIm * bRe;
+
+    xRe = pRow[2U * k];
+    xIm = pRow[2U * k + 1U];
+
+    pRow[2U * k]      = xRe * wRe + xIm * wIm;
+    pRow[2U * k + 1U] = xIm * wRe - xRe * wIm;
+
+    lo += stepLo;
+    hi += stepHi;
+    if (lo >= n1)
+    {
+      lo -= n1;
+      hi++;
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point large complex FFT.
+  @param[in]     S              points to an instance of the floating-point large CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+
+void arm_cfft_large_f32(
+  const arm_cfft_large_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+        uint32_t L = S->fftLen;                  /* Length of the transform */
+        uint32_t n1 = S->pCfft1->fftLen;         /* Rows of the data matrix */
+        uint32_t n2 = S->pCfft2->fftLen;         /* Columns of the data matrix */
+        float32_t *pWork = S->pWork;
+        float32_t invL;
+        uint32_t row, l;                         /* Loop counters */
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    for (l = 0U; l < L; l++)
+    {
+      p1[2U * l + 1U] = -p1[2U * l + 1U];
+    }
+  }
+
+  /* Columns of the N1 x N2 input become the rows of the working buffer */
+  arm_cfft_large_transpose_f32(p1, pWork, n1, n2);
+
+  /* Length N1 transforms, each followed by its twiddle factors */
+  for (row = 0U; row < n2; row++)
+  {
+    arm_cfft_f32(S->pCfft1, pWork + 2U * n1 * row, 0U, 1U);
+
+    if (row != 0U)
+    {
+      arm_cfft_large_twiddle_f32(pWork + 2U * n1 * row, n1, row, S->pTwiddle);
+    }
+  }
+
+  arm_cfft_large_transpose_f32(pWork, p1, n2, n1);
+
+  /* Length N2 transforms */
+  for (row = 0U; row < n1; row++)
+  {
+    arm_cfft_f32(S->pCfft2, p1 + 2U * n2 * row, 0U, 1U);
+  }
+
+  /* Bin k1 + N1*k2 is at row k1, column k2: transpose into natural order */
+  arm_cfft_large_transpose_f32(p1, pWork, n1, n2);
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t) L;
+
+    /* Conjugate and scale output data */
+    for (l = 0U; l < L; l++)
+    {
+      p1[2U * l]      =  pWork[2U * l]      * invL;
+      p1[2U * l + 1U] = -pWork[2U * l + 1U] * invL;
+    }
+  }
+  else
+  {
+    memcpy(p1, pWork, 2U * L * sizeof(float32_t));
+  }
+}
+
+/**
+  @} end of LargeCFFT group
+ */
@@ -0,0 +1,169 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_large_init_f32.c
+ * Description:  Initialization function for the floating-point large CFFT
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup LargeCFFT
+  @{
+ */
+
+/* Constant CFFT instance of a power-of-two length, or NULL when its tables are not built */
+static const arm_cfft_instance_f32 * arm_cfft_large_sub_f32(
+  uint32_t fftLen)
+{
+  switch (fftLen)
+  {
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_16) && defined(ARM_TABLE_BITREVIDX_FLT_16))
+  case 16U:
+    return &arm_cfft_sR_f32_len16;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_32) && defined(ARM_TABLE_BITREVIDX_FLT_32))
+  case 32U:
+    return &arm_cfft_sR_f32_len32;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_64) && defined(ARM_TABLE_BITREVIDX_FLT_64))
+  case 64U:
+    return &arm_cfft_sR_f32_len64;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_128) && defined(ARM_TABLE_BITREVIDX_FLT_128))
+  case 128U:
+    return &arm_cfft_sR_f32_len128;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_256) && defined(ARM_TABLE_BITREVIDX_FLT_256))
+  case 256U:
+    return &arm_cfft_sR_f32_len256;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_512) && defined(ARM_TABLE_BITREVIDX_FLT_512))
+  case 512U:
+    return &arm_cfft_sR_f32_len512;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_1024) && defined(ARM_TABLE_BITREVIDX_FLT_1024))
+  case 1024U:
+    return &arm_cfft_sR_f32_len1024;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_2048) && defined(ARM_TABLE_BITREVIDX_FLT_2048))
+  case 2048U:
+    return &arm_cfft_sR_f32_len2048;
+#endif
+#if !defined(ARM_DSP_CONFIG_TABLES) || defined(ARM_ALL_FFT_TABLES) || (defined(ARM_TABLE_TWIDDLECOEF_F32_4096) && defined(ARM_TABLE_BITREVIDX_FLT_4096))
+  case 4096U:
+    return &arm_cfft_sR_f32_len4096;
+#endif
+  default:
+    return NULL;
+  }
+}
+
+/**
+  @brief         Initialization function for the floating-point large CFFT/CIFFT.
+  @param[in,out] S          points to an instance of the floating-point large CFFT structure
+  @param[in]     fftLen     length of the FFT, a power of two from 256 to 16777216
+  @param[in]     pTwiddle   points to a buffer of <code>2*(N1+N2)</code> values which receives the twiddle factors
+  @param[in]     pWork      points to a working buffer of <code>2*fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   The length is split as <code>fftLen = N1 * N2</code> with N1 the smallest power
+                   of two not below <code>sqrt(fftLen)</code>, so N1 and N2 are both between 16
+                   and 4096 and the two passes use the constant instances arm_cfft_sR_f32_lenN1
+                   and arm_cfft_sR_f32_lenN2.
+  @par
+                   The twiddle table holds <code>W_fftLen^i</code> for i = 0 .. N1-1 followed by
+                   <code>W_N2^i</code> for i = 0 .. N2-1, as {cos, sin} pairs computed here in double
+                   precision. A buffer of <code>2*(2*4096)</code> values is large enough for any length.
+  @par
+                   The working buffer is overwritten by every transform and must not be shared by
+                   transforms that run concurrently.
+ */
+
+arm_status arm_cfft_large_init_f32(
+  arm_cfft_large_instance_f32 * S,
+  uint32_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pWork)
+{
+  uint32_t n1, n2;                               /* Lengths of the two passes */
+  uint32_t k;                                    /* Loop counter */
+  float64_t angle;                               /* Twiddle angle */
+
+  if ((S == NULL) || (pTwiddle == NULL) || (pWork == NULL) ||
+      (fftLen > (4096U * 4096U)) || ((fftLen & (fftLen - 1U)) != 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Smallest power of two whose square is at least fftLen */
+  n1 = 1U;
+  while ((n1 * n1) < fftLen)
+  {
+    n1 <<= 1U;
+  }
+  n2 = fftLen / n1;
+
+  S->pCfft1 = arm_cfft_large_sub_f32(n1);
+  S->pCfft2 = arm_cfft_large_sub_f32(n2);
+
+  if ((S->pCfft1 == NULL) || (S->pCfft2 == NULL))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* W_fftLen^k for the low part of the twiddle exponent */
+  for (k = 0U; k < n1; k++)
+  {
+    angle = (6.28318530717958647692 * (float64_t) k) / (float64_t) fftLen;
+    pTwiddle[2U * k]      = (float32_t) cos(angle);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(angle);
+  }
+
+  /* W_N2^k = W_fftLen^(k*N1) for the high part */
+  for (k = 0U; k < n2; k++)
+  {
+    angle = (6.28318530717958647692 * (float64_t) k) / (float64_t) n2;
+    pTwiddle[2U * (n1 + k)]      = (float32_t) cos(angle);
+    pTwiddle[2U * (n1 + k) + 1U] = (float32_t) sin(angle);
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pWork = pWork;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of LargeCFFT group
+ */
@@ -0,0 +1,448 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_f32.c
+ * Description:  Mixed-radix (2, 3, 4, 5) CFFT Floating point processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup MixedRadixCFFT Mixed-Radix Complex FFT Functions
+
+  @par
+                   arm_cfft_f32() is limited to power-of-two lengths. The mixed-radix CFFT
+                   computes transforms of any length of the form 2^a * 3^b * 5^c
+                   (for example 480, 960 or 1000 points) so that such frames do not have to
+                   be zero-padded to the next power of two.
+  @par
+                   The transform is a Stockham autosort FFT built from radix-4, radix-2,
+                   radix-3 and radix-5 decimation in frequency stages. Each stage reads one
+                   buffer and writes the other, so no bit or digit reversal is needed. The
+                   data is in-place from the caller's point of view: the input and output use
+                   the array passed to arm_cfft_mixed_f32() with the same interleaving as
+                   arm_cfft_f32()
+                   <pre>{real[0], imag[0], real[1], imag[1], ...} </pre>
+                   and the scratch buffer given to arm_cfft_mixed_init_f32() is used for the
+                   intermediate stages.
+  @par
+                   The forward transform is not scaled. The inverse transform includes a scale
+                   of <code>1/fftLen</code>, as arm_cfft_f32() does.
+  @par
+                   The twiddle factor table is computed by arm_cfft_mixed_init_f32() into a
+                   buffer supplied by the caller, since there is no constant table for every
+                   supported length.
+ */
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+/* Sines of the radix-3 and radix-5 butterflies */
+#define CFFT_MIXED_SIN_60   0.866025403784438646764f    /* sin(2*pi/3) */
+#define CFFT_MIXED_COS_72   0.309016994374947424102f    /* cos(2*pi/5) */
+#define CFFT_MIXED_SIN_72   0.951056516295153572116f    /* sin(2*pi/5) */
+#define CFFT_MIXED_COS_144 -0.809016994374947424102f    /* cos(4*pi/5) */
+#define CFFT_MIXED_SIN_144  0.587785252292473129169f    /* sin(4*pi/5) */
+
+/*
+ * One Stockham stage of radix p. With n = m * p the length of the sub-transforms
+ * still to be done and s = N / n their number, output k of butterfly (q, r) is
+ *
+ *   y[r + s*(p*q + k)] = W_n^(q*k) * sum_j x[r + s*(q + j*m)] * W_p^(j*k)
+ *
+ * where W_n^(q*k) = W_N^(q*k*s) is read from the N-entry twiddle table.
+ */
+
+static void arm_cfft_mixed_radix2_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * pTw)
+{
+  const float32_t *pA, *pB;
+        float32_t *pY0, *pY1;
+        float32_t wr, wi, ar, ai, br, bi, tr, ti;
+        uint32_t q, r;
+
+  for (q = 0U; q < m; q++)
+  {
+    wr = pTw[2U * q * s];
+    wi = pTw[2U * q * s + 1U];
+
+    pA  = pIn  + 2U * s * q;
+    pB  = pIn  + 2U * s * (q + m);
+    pY0 = pOut + 2U * s * (2U * q);
+    pY1 = pOut + 2U * s * (2U * q + 1U);
+
+    for (r = 0U; r < s; r++)
+    {
+      ar = *pA++;
+      ai = *pA++;
+      br = *pB++;
+      bi = *pB++;
+
+      *pY0++ = ar + br;
+      *pY0++ = ai + bi;
+
+      /* (a - b) * (wr - j*wi) */
+      tr = ar - br;
+      ti = ai - bi;
+      *pY1++ = tr * wr + ti * wi;
+      *pY1++ = ti * wr - tr * wi;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix3_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * pTw)
+{
+  const float32_t *pA0, *pA1, *pA2;
+        float32_t *pY0, *pY1, *pY2;
+        float32_t w1r, w1i, w2r, w2i;
+        float32_t a0r, a0i, a1r, a1i, a2r, a2i;
+        float32_t tr, ti, mr, mi, dr, di, y1r, y1i, y2r, y2i;
+        uint32_t q, r;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * q * s];
+    w1i = pTw[2U * q * s + 1U];
+    w2r = pTw[4U * q * s];
+    w2i = pTw[4U * q * s + 1U];
+
+    pA0 = pIn  + 2U * s * q;
+    pA1 = pIn  + 2U * s * (q + m);
+    pA2 = pIn  + 2U * s * (q + 2U * m);
+    pY0 = pOut + 2U * s * (3U * q);
+    pY1 = pOut + 2U * s * (3U * q + 1U);
+    pY2 = pOut + 2U * s * (3U * q + 2U);
+
+    for (r = 0U; r < s; r++)
+    {
+      a0r = *pA0++;
+      a0i = *pA0++;
+      a1r = *pA1++;
+      a1i = *pA1++;
+      a2r = *pA2++;
+      a2i = *pA2++;
+
+      tr = a1r + a2r;
+      ti = a1i + a2i;
+
+      *pY0++ = a0r + tr;
+      *pY0++ = a0i + ti;
+
+      /* a0 + a1*W3 + a2*W3^2 = a0 - t/2 - j*sin(2*pi/3)*(a1 - a2) */
+      mr = a0r - 0.5f * tr;
+      mi = a0i - 0.5f * ti;
+      dr = CFFT_MIXED_SIN_60 * (a1i - a2i);
+      di = CFFT_MIXED_SIN_60 * (a1r - a2r);
+
+      y1r = mr + dr;
+      y1i = mi - di;
+      y2r = mr - dr;
+      y2i = mi + di;
+
+      *pY1++ = y1r * w1r + y1i * w1i;
+      *pY1++ = y1i * w1r - y1r * w1i;
+      *pY2++ = y2r * w2r + y2i * w2i;
+      *pY2++ = y2i * w2r - y2r * w2i;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix4_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * pTw)
+{
+  const float32_t *pA0, *pA1, *pA2, *pA3;
+        float32_t *pY0, *pY1, *pY2, *pY3;
+        float32_t w1r, w1i, w2r, w2i, w3r, w3i;
+        float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+        float32_t s02r, s02i, d02r, d02i, s13r, s13i, d13r, d13i;
+        float32_t yr, yi;
+        uint32_t q, r;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * q * s];
+    w1i = pTw[2U * q * s + 1U];
+    w2r = pTw[4U * q * s];
+    w2i = pTw[4U * q * s + 1U];
+    w3r = pTw[6U * q * s];
+    w3i = pTw[6U * q * s + 1U];
+
+    pA0 = pIn  + 2U * s * q;
+    pA1 = pIn  + 2U * s * (q + m);
+    pA2 = pIn  + 2U * s * (q + 2U * m);
+    pA3 = pIn  + 2U * s * (q + 3U * m);
+    pY0 = pOut + 2U * s * (4U * q);
+    pY1 = pOut + 2U * s * (4U * q + 1U);
+    pY2 = pOut + 2U * s * (4U * q + 2U);
+    pY3 = pOut + 2U * s * (4U * q + 3U);
+
+    for (r = 0U; r < s; r++)
+    {
+      a0r = *pA0++;
+      a0i = *pA0++;
+      a1r = *pA1++;
+      a1i = *pA1++;
+      a2r = *pA2++;
+      a2i = *pA2++;
+      a3r = *pA3++;
+      a3i = *pA3++;
+
+      s02r = a0r + a2r;
+      s02i = a0i + a2i;
+      d02r = a0r - a2r;
+      d02i = a0i - a2i;
+      s13r = a1r + a3r;
+      s13i = a1i + a3i;
+      d13r = a1r - a3r;
+      d13i = a1i - a3i;
+
+      /* y0 = a0 + a1 + a2 + a3 */
+      *pY0++ = s02r + s13r;
+      *pY0++ = s02i + s13i;
+
+      /* y1 = a0 - j*a1 - a2 + j*a3 */
+      yr = d02r + d13i;
+      yi = d02i - d13r;
+      *pY1++ = yr * w1r + yi * w1i;
+      *pY1++ = yi * w1r - yr * w1i;
+
+      /* y2 = a0 - a1 + a2 - a3 */
+      yr = s02r - s13r;
+      yi = s02i - s13i;
+      *pY2++ = yr * w2r + yi * w2i;
+      *pY2++ = yi * w2r - yr * w2i;
+
+      /* y3 = a0 + j*a1 - a2 - j*a3 */
+      yr = d02r - d13i;
+      yi = d02i + d13r;
+      *pY3++ = yr * w3r + yi * w3i;
+      *pY3++ = yi * w3r - yr * w3i;
+    }
+  }
+}
+
+static void arm_cfft_mixed_radix5_f32(
+  const float32_t * pIn,
+        float32_t * pOut,
+        uint32_t m,
+        uint32_t s,
+  const float32_t * pTw)
+{
+  const float32_t *pA0, *pA1, *pA2, *pA3, *pA4;
+        float32_t *pY0, *pY1, *pY2, *pY3, *pY4;
+        float32_t w1r, w1i, w2r, w2i, w3r, w3i, w4r, w4i;
+        float32_t a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i, a4r, a4i;
+        float32_t t1r, t1i, t2r, t2i, d1r, d1i, d2r, d2i;
+        float32_t b1r, b1i, b2r, b2i, e1r, e1i, e2r, e2i;
+        float32_t yr, yi;
+        uint32_t q, r;
+
+  for (q = 0U; q < m; q++)
+  {
+    w1r = pTw[2U * q * s];
+    w1i = pTw[2U * q * s + 1U];
+    w2r = pTw[4U * q * s];
+    w2i = pTw[4U * q * s + 1U];
+    w3r = pTw[6U * q * s];
+    w3i = pTw[6U * q * s + 1U];
+    w4r = pTw[8U * q * s];
+    w4i = pTw[8U * q * s + 1U];
+
+    pA0 = pIn  + 2U * s * q;
+    pA1 = pIn  + 2U * s * (q + m);
+    pA2 = pIn  + 2U * s * (q + 2U * m);
+    pA3 = pIn  + 2U * s * (q + 3U * m);
+    pA4 = pIn  + 2U * s * (q + 4U * m);
+    pY0 = pOut + 2U * s * (5U * q);
+    pY1 = pOut + 2U * s * (5U * q + 1U);
+    pY2 = pOut + 2U * s * (5U * q + 2U);
+    pY3 = pOut + 2U * s * (5U * q + 3U);
+    pY4 = pOut + 2U * s * (5U * q + 4U);
+
+    for (r = 0U; r < s; r++)
+    {
+      a0r = *pA0++;
+      a0i = *pA0++;
+      a1r = *pA1++;
+      a1i = *pA1++;
+      a2r = *pA2++;
+      a2i = *pA2++;
+      a3r = *pA3++;
+      a3i = *pA3++;
+      a4r = *pA4++;
+      a4i = *pA4++;
+
+      t1r = a1r + a4r;
+      t1i = a1i + a4i;
+      t2r = a2r + a3r;
+      t2i = a2i + a3i;
+      d1r = a1r - a4r;
+      d1i = a1i - a4i;
+      d2r = a2r - a3r;
+      d2i = a2i - a3i;
+
+      *pY0++ = a0r + t1r + t2r;
+      *pY0++ = a0i + t1i + t2i;
+
+      /* Real and imaginary contributions of the symmetric pairs */
+      b1r = a0r + CFFT_MIXED_COS_72  * t1r + CFFT_MIXED_COS_144 * t2r;
+      b1i = a0i + CFFT_MIXED_COS_72  * t1i + CFFT_MIXED_COS_144 * t2i;
+      b2r = a0r + CFFT_MIXED_COS_144 * t1r + CFFT_MIXED_COS_72  * t2r;
+      b2i = a0i + CFFT_MIXED_COS_144 * t1i + CFFT_MIXED_COS_72  * t2i;
+
+      /* e1 = -j*(sin72*d1 + sin144*d2), e2 = -j*(sin144*d1 - sin72*d2) */
+      e1r =   CFFT_MIXED_SIN_72  * d1i + CFFT_MIXED_SIN_144 * d2i;
+      e1i = -(CFFT_MIXED_SIN_72  * d1r + CFFT_MIXED_SIN_144 * d2r);
+      e2r =   CFFT_MIXED_SIN_144 * d1i - CFFT_MIXED_SIN_72  * d2i;
+      e2i = -(CFFT_MIXED_SIN_144 * d1r - CFFT_MIXED_SIN_72  * d2r);
+
+      yr = b1r + e1r;
+      yi = b1i + e1i;
+      *pY1++ = yr * w1r + yi * w1i;
+      *pY1++ = yi * w1r - yr * w1i;
+
+      yr = b2r + e2r;
+      yi = b2i + e2i;
+      *pY2++ = yr * w2r + yi * w2i;
+      *pY2++ = yi * w2r - yr * w2i;
+
+      yr = b2r - e2r;
+      yi = b2i - e2i;
+      *pY3++ = yr * w3r + yi * w3i;
+      *pY3++ = yi * w3r - yr * w3i;
+
+      yr = b1r - e1r;
+      yi = b1i - e1i;
+      *pY4++ = yr * w4r + yi * w4i;
+      *pY4++ = yi * w4r - yr * w4i;
+    }
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point mixed-radix CFFT/CIFFT.
+  @param[in]     S              points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in,out] p1             points to the complex data buffer of size <code>2*fftLen</code>. Processing occurs in-place
+  @param[in]     ifftFlag       flag that selects transform direction
+                   - value = 0: forward transform
+                   - value = 1: inverse transform
+  @return        none
+ */
+
+void arm_cfft_mixed_f32(
+  const arm_cfft_mixed_instance_f32 * S,
+        float32_t * p1,
+        uint8_t ifftFlag)
+{
+        uint32_t L = S->fftLen, l;
+        uint32_t n = L;                          /* Length of the sub-transforms of the current stage */
+        uint32_t s = 1U;                         /* Number of sub-transforms of the current stage */
+        uint32_t m, stage;
+        float32_t *pIn = p1;
+        float32_t *pOut = S->pScratch;
+        float32_t *pTmp;
+        float32_t invL, *pSrc;
+
+  if (ifftFlag == 1U)
+  {
+    /* Conjugate input data */
+    pSrc = p1 + 1;
+    for (l = 0; l < L; l++)
+    {
+      *pSrc = -*pSrc;
+      pSrc += 2;
+    }
+  }
+
+  for (stage = 0U; stage < S->numStages; stage++)
+  {
+    m = n / S->radix[stage];
+
+    switch (S->radix[stage])
+    {
+    case 2U:
+      arm_cfft_mixed_radix2_f32(pIn, pOut, m, s, S->pTwiddle);
+      break;
+    case 3U:
+      arm_cfft_mixed_radix3_f32(pIn, pOut, m, s, S->pTwiddle);
+      break;
+    case 4U:
+      arm_cfft_mixed_radix4_f32(pIn, pOut, m, s, S->pTwiddle);
+      break;
+    default:
+      arm_cfft_mixed_radix5_f32(pIn, pOut, m, s, S->pTwiddle);
+      break;
+    }
+
+    n = m;
+    s *= S->radix[stage];
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* After an odd number of stages the result is in the scratch buffer */
+  if (pIn != p1)
+  {
+    memcpy(p1, pIn, 2U * L * sizeof(float32_t));
+  }
+
+  if (ifftFlag == 1U)
+  {
+    invL = 1.0f / (float32_t)L;
+
+    /* Conjugate and scale output data */
+    pSrc = p1;
+    for (l= 0; l < L; l++)
+    {
+      *pSrc++ *=   invL ;
+      *pSrc    = -(*pSrc) * invL;
+      pSrc++;
+    }
+  }
+}
+
+/**
+  @} end of MixedRadixCFFT group
+ */
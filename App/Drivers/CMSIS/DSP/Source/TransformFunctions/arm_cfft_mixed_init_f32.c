@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cfft_mixed_init_f32.c
+ * Description:  Initialization function for the floating-point mixed-radix CFFT
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup MixedRadixCFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point mixed-radix CFFT/CIFFT.
+  @param[in,out] S          points to an instance of the floating-point mixed-radix CFFT structure
+  @param[in]     fftLen     length of the FFT, of the form 2^a * 3^b * 5^c
+  @param[in]     pTwiddle   points to a buffer of <code>2*fftLen</code> values which receives the twiddle factors
+  @param[in]     pScratch   points to a scratch buffer of <code>2*fftLen</code> values
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> has a prime factor other than 2, 3 or 5
+
+  @par           Details
+                   The length is factored into radix-4 stages, at most one radix-2 stage,
+                   then radix-3 and radix-5 stages. The twiddle factors
+                   <code>{cos(2*pi*k/fftLen), sin(2*pi*k/fftLen)}</code>, k = 0 .. fftLen-1,
+                   are computed here in double precision.
+  @par
+                   The twiddle buffer is only read by arm_cfft_mixed_f32() and may be shared by
+                   instances of the same length. The scratch buffer is overwritten by every
+                   transform and must not be shared by transforms that run concurrently.
+ */
+
+arm_status arm_cfft_mixed_init_f32(
+  arm_cfft_mixed_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pScratch)
+{
+  uint32_t n = fftLen;                           /* Part of the length still to be factored */
+  uint32_t k;                                    /* Loop counter */
+  uint16_t numStages = 0U;                       /* Number of stages found */
+  float64_t angle;                               /* Twiddle angle */
+
+  if ((S == NULL) || (pTwiddle == NULL) || (pScratch == NULL) || (fftLen == 0U))
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Radix-4 stages first as they need the fewest operations per point */
+  while ((n % 4U) == 0U)
+  {
+    S->radix[numStages++] = 4U;
+    n /= 4U;
+  }
+
+  if ((n % 2U) == 0U)
+  {
+    S->radix[numStages++] = 2U;
+    n /= 2U;
+  }
+
+  while ((n % 3U) == 0U)
+  {
+    S->radix[numStages++] = 3U;
+    n /= 3U;
+  }
+
+  while ((n % 5U) == 0U)
+  {
+    S->radix[numStages++] = 5U;
+    n /= 5U;
+  }
+
+  if (n != 1U)
+  {
+    return ARM_MATH_ARGUMENT_ERROR;
+  }
+
+  /* Twiddle factors W^k = cos(2*pi*k/N) - j*sin(2*pi*k/N), stored as {cos, sin} pairs */
+  for (k = 0U; k < fftLen; k++)
+  {
+    angle = (6.28318530717958647692 * (float64_t) k) / (float64_t) fftLen;
+    pTwiddle[2U * k]      = (float32_t) cos(angle);
+    pTwiddle[2U * k + 1U] = (float32_t) sin(angle);
+  }
+
+  S->fftLen = fftLen;
+  S->numStages = numStages;
+  S->pTwiddle = pTwiddle;
+  S->pScratch = pScratch;
+
+  return ARM_MATH_SUCCESS;
+}
+
+/**
+  @} end of MixedRadixCFFT group
+ */
@@ -0,0 +1,274 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_f32.c
+ * Description:  Floating-point Goertzel filter bank processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup Goertzel Goertzel Filter Bank
+
+  Computes a few bins of the DFT of consecutive frames of a stream of real samples, as used
+  by tone detectors (DTMF, pilot tones, line frequency). Each bin costs three multiply-adds per
+  sample, so that <code>numBins</code> bins cost <code>O(numBins)</code> operations per sample,
+  where a real FFT of the frame costs <code>O(log2(frameLen))</code> operations per sample and
+  computes all the bins.
+
+  @par           Algorithm
+                   Bin <code>k</code> is computed from the output after <code>frameLen</code> samples of the resonator
+  <pre>
+      s[n] = x[n] + 2 * cos(w) * s[n-1] - s[n-2]      with w = 2 * pi * k / frameLen
+  </pre>
+                   followed by one complex step, once per frame:
+  <pre>
+      X[k] = (cos(w) * s[N-1] - s[N-2]) + j * sin(w) * s[N-1]
+  </pre>
+                   which is the DFT bin <code>sum(x[n] * exp(-j*w*n))</code> of the frame, as given by
+                   arm_rfft_fast_f32() when <code>frameLen</code> is one of its lengths. Unlike the FFT, the
+                   frames can be of any length. The resonators are cleared after each frame.
+  @par
+                   Near DC and Nyquist, where <code>cos(w)</code> is close to <code>+1</code> or <code>-1</code>,
+                   this recurrence loses the bin in the rounding errors of <code>s</code>, which grows as
+                   <code>1/sin(w)</code>. The resonators therefore run the equivalent recurrence of Reinsch on
+                   <code>s[n]</code> and <code>u[n] = s[n] - sgn * s[n-1]</code>, with <code>sgn</code> the sign
+                   of <code>cos(w)</code> and <code>h = cos(w) - sgn</code>, which is small where the classic
+                   coefficient is close to <code>sgn</code>:
+  <pre>
+      u[n] = x[n] + 2 * h * s[n-1] + sgn * u[n-1]
+      s[n] = sgn * s[n-1] + u[n]
+      X[k] = (h * s[N-1] + sgn * u[N-1]) + j * sin(w) * s[N-1]
+  </pre>
+  @par
+                   The bins are independent, so several bins are run side by side, one bin per lane with
+                   Neon or x86 SIMD, and 4 bins at a time with independent scalar recursions when loop
+                   unrolling is enabled. Each bin keeps its two state values in registers over the samples
+                   of a frame.
+
+  @par           Outputs
+                   Each frame gives <code>numBins</code> complex bins, real and imaginary parts interleaved,
+                   in the order of <code>pBins</code> given to the initialization function.
+                   arm_cmplx_mag_squared_f32() gives their powers.
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/*
+ * Runs the resonators of all the bins over blockSize samples, in groups of lanes,
+ * then 4 at a time with loop unrolling, then one at a time.
+ */
+static void arm_goertzel_run_f32(
+  const arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+  const float32_t *pH = S->pCoeffs;                    /* Offsets of the cosines from their signs */
+  const float32_t *pSgn = S->pCoeffs + 2U * numBins;   /* Signs of the cosines */
+        float32_t *pS = S->pState;                     /* Last resonator outputs */
+        float32_t *pU = S->pState + numBins;           /* Differences of the last two resonator outputs */
+        uint32_t k = 0U;                               /* First bin of the group */
+        uint32_t n;                                    /* Loop counter */
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t h2V, sgnV, sV, uV;
+
+  for (; (k + 4U) <= numBins; k += 4U)
+  {
+    h2V = vld1q_f32(pH + k);
+    h2V = vaddq_f32(h2V, h2V);
+    sgnV = vld1q_f32(pSgn + k);
+    sV = vld1q_f32(pS + k);
+    uV = vld1q_f32(pU + k);
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* u = x + sgn * u + 2 * h * s, then s = u + sgn * s, for one bin per lane */
+      uV = vmlaq_f32(vmlaq_f32(vdupq_n_f32(pSrc[n]), sgnV, uV), h2V, sV);
+      sV = vmlaq_f32(uV, sgnV, sV);
+    }
+
+    vst1q_f32(pS + k, sV);
+    vst1q_f32(pU + k, uV);
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t h2V, sgnV, sV, uV;
+
+  for (; (k + ARM_X86_F32_LANES) <= numBins; k += ARM_X86_F32_LANES)
+  {
+    h2V = __arm_x86_ld_f32(pH + k);
+    h2V = __arm_x86_add_f32(h2V, h2V);
+    sgnV = __arm_x86_ld_f32(pSgn + k);
+    sV = __arm_x86_ld_f32(pS + k);
+    uV = __arm_x86_ld_f32(pU + k);
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* u = x + sgn * u + 2 * h * s, then s = u + sgn * s, for one bin per lane */
+      uV = __arm_x86_fma_f32(__arm_x86_fma_f32(__arm_x86_dup_f32(pSrc[n]), sgnV, uV), h2V, sV);
+      sV = __arm_x86_fma_f32(uV, sgnV, sV);
+    }
+
+    __arm_x86_st_f32(pS + k, sV);
+    __arm_x86_st_f32(pU + k, uV);
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+#if defined (ARM_MATH_LOOPUNROLL)
+
+  /* Loop unrolling: Run 4 independent resonators at a time */
+  for (; (k + 4U) <= numBins; k += 4U)
+  {
+    float32_t h2a = 2.0f * pH[k],      h2b = 2.0f * pH[k + 1U];
+    float32_t h2c = 2.0f * pH[k + 2U], h2d = 2.0f * pH[k + 3U];
+    float32_t sga = pSgn[k], sgb = pSgn[k + 1U], sgc = pSgn[k + 2U], sgd = pSgn[k + 3U];
+    float32_t sa = pS[k], sb = pS[k + 1U], sc = pS[k + 2U], sd = pS[k + 3U];
+    float32_t ua = pU[k], ub = pU[k + 1U], uc = pU[k + 2U], ud = pU[k + 3U];
+    float32_t x;
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      x = pSrc[n];
+
+      ua = x + sga * ua + h2a * sa;
+      ub = x + sgb * ub + h2b * sb;
+      uc = x + sgc * uc + h2c * sc;
+      ud = x + sgd * ud + h2d * sd;
+
+      sa = ua + sga * sa;
+      sb = ub + sgb * sb;
+      sc = uc + sgc * sc;
+      sd = ud + sgd * sd;
+    }
+
+    pS[k] = sa; pS[k + 1U] = sb; pS[k + 2U] = sc; pS[k + 3U] = sd;
+    pU[k] = ua; pU[k + 1U] = ub; pU[k + 2U] = uc; pU[k + 3U] = ud;
+  }
+
+#endif /* #if defined (ARM_MATH_LOOPUNROLL) */
+
+  for (; k < numBins; k++)
+  {
+    float32_t h2 = 2.0f * pH[k];
+    float32_t s = pS[k];
+    float32_t u = pU[k];
+
+    /* One loop per sign, without the multiplications by the sign */
+    if (pSgn[k] > 0.0f)
+    {
+      for (n = 0U; n < blockSize; n++)
+      {
+        u = (pSrc[n] + u) + h2 * s;
+        s = s + u;
+      }
+    }
+    else
+    {
+      for (n = 0U; n < blockSize; n++)
+      {
+        u = (pSrc[n] - u) + h2 * s;
+        s = u - s;
+      }
+    }
+
+    pS[k] = s;
+    pU[k] = u;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point Goertzel filter bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the bins of the frames completed by the block
+  @param[in]     blockSize  number of input samples
+  @return        number of frames written to <code>pDst</code>
+
+  @par           Details
+                   The block can be of any size. The bins of the frames it completes are written one frame
+                   after the other, <code>2*numBins</code> values per frame. A block of <code>blockSize</code>
+                   samples completes at most <code>(blockSize-1)/frameLen+1</code> frames.
+ */
+
+uint32_t arm_goertzel_f32(
+        arm_goertzel_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+  const float32_t *pH = S->pCoeffs;                    /* Offsets of the cosines from their signs */
+  const float32_t *pSin = S->pCoeffs + numBins;        /* Sines of the bin frequencies */
+  const float32_t *pSgn = S->pCoeffs + 2U * numBins;   /* Signs of the cosines */
+        float32_t *pS = S->pState;                     /* Last resonator outputs */
+        float32_t *pU = S->pState + numBins;           /* Differences of the last two resonator outputs */
+        uint32_t numFrames = 0U;                       /* Number of frames completed */
+        uint32_t cnt, k;
+
+  while (blockSize > 0U)
+  {
+    /* Run the resonators up to the end of the frame or of the block */
+    cnt = (uint32_t) S->frameLen - S->count;
+    cnt = (cnt < blockSize) ? cnt : blockSize;
+
+    arm_goertzel_run_f32(S, pSrc, cnt);
+
+    pSrc += cnt;
+    blockSize -= cnt;
+    S->count += cnt;
+
+    if (S->count == S->frameLen)
+    {
+      /* Complex step of each bin, and restart of the resonators */
+      for (k = 0U; k < numBins; k++)
+      {
+        *pDst++ = pH[k] * pS[k] + pSgn[k] * pU[k];
+        *pDst++ = pSin[k] * pS[k];
+      }
+
+      arm_fill_f32(0.0f, S->pState, 2U * numBins);
+
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of Goertzel group
+ */
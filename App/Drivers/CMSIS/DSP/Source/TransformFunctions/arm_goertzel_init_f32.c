@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_init_f32.c
+ * Description:  Floating-point Goertzel filter bank initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point Goertzel filter bank.
+  @param[in,out] S          points to an instance of the floating-point Goertzel structure
+  @param[in]     numBins    number of bins
+  @param[in]     frameLen   number of samples per frame
+  @param[in]     pBins      points to the indices of the bins, of length <code>numBins</code>
+  @param[out]    pCoeffs    points to the coefficient buffer, of length <code>3*numBins</code>
+  @param[in]     pState     points to the state buffer, of length <code>2*numBins</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>frameLen</code> is 0, or a bin index is not below <code>frameLen</code>
+
+  @par           Details
+                   Bin <code>k</code> is at the frequency <code>k/frameLen</code> of the sampling frequency.
+                   The bins above <code>frameLen/2</code> are the conjugates of those below for real inputs.
+                   The coefficients of the resonators are computed in <code>pCoeffs</code>, which must then be
+                   left unchanged: the offsets <code>h</code> of the cosines of the bin frequencies from their
+                   signs, the sines, and the signs, each of length <code>numBins</code>.
+ */
+
+arm_status arm_goertzel_init_f32(
+        arm_goertzel_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t frameLen,
+  const uint16_t * pBins,
+        float32_t * pCoeffs,
+        float32_t * pState)
+{
+  float64_t w, c, sgn;
+  uint32_t k;
+
+  if (frameLen == 0U)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= frameLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Computed in double precision, so that h keeps its relative accuracy when it is small */
+    w = 6.283185307179586476925 * (float64_t) pBins[k] / (float64_t) frameLen;
+    c = cos(w);
+    sgn = (c >= 0.0) ? 1.0 : -1.0;
+
+    pCoeffs[k] = (float32_t) (c - sgn);
+    pCoeffs[numBins + k] = (float32_t) sin(w);
+    pCoeffs[2U * numBins + k] = (float32_t) sgn;
+  }
+
+  S->numBins = numBins;
+  S->frameLen = frameLen;
+  S->count = 0U;
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the resonators */
+  memset(pState, 0, 2U * numBins * sizeof(float32_t));
+
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of Goertzel group
+ */
@@ -0,0 +1,149 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_goertzel_q31.c
+ * Description:  Q31 Goertzel filter bank processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup Goertzel
+  @{
+ */
+
+/*
+ * Product of a 64-bit value and a Q31 value, shifted right by 31 bits.
+ */
+__STATIC_FORCEINLINE q63_t arm_goertzel_mult_q63(
+  q63_t x,
+  q31_t y)
+{
+  return (((x >> 32) * y) * 2) + ((((q63_t) (uint32_t) x) * y) >> 31);
+}
+
+/**
+  @brief         Processing function for the Q31 Goertzel filter bank.
+  @param[in,out] S          points to an instance of the Q31 Goertzel structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the bins of the frames completed by the block
+  @param[in]     blockSize  number of input samples
+  @return        number of frames written to <code>pDst</code>
+
+  @par           Details
+                   The block can be of any size. The bins of the frames it completes are written one frame
+                   after the other, <code>2*numBins</code> values per frame. The resonators run the recurrence
+                   of Reinsch described for arm_goertzel_f32().
+
+  @par           Scaling and Overflow Behavior
+                   The resonators are 64-bit values in the 1.31 format of the inputs, with 32 bits of headroom
+                   for the gain of the resonators, which is at most <code>frameLen^2/2</code> (for DC). The bins are
+                   divided by <code>2^outShift</code>, where <code>outShift</code> is the smallest shift such
+                   that <code>2^outShift >= frameLen</code>, and saturated to 1.31 format. For frame lengths
+                   which are powers of two the bins are those of the DFT divided by <code>frameLen</code>.
+ */
+
+uint32_t arm_goertzel_q31(
+        arm_goertzel_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+  const q31_t *pH = S->pCoeffs;                        /* Offsets of the cosines from their signs */
+  const q31_t *pSin = S->pCoeffs + numBins;            /* Sines of the bin frequencies */
+  const q31_t *pSgn = S->pCoeffs + 2U * numBins;       /* Signs of the cosines */
+        q63_t *pS = S->pState;                         /* Last resonator outputs */
+        q63_t *pU = S->pState + numBins;               /* Differences of the last two resonator outputs */
+        uint32_t numFrames = 0U;                       /* Number of frames completed */
+        uint32_t cnt, k, n;
+        q63_t s, u, re;
+        q31_t h;
+
+  while (blockSize > 0U)
+  {
+    /* Run the resonators up to the end of the frame or of the block */
+    cnt = (uint32_t) S->frameLen - S->count;
+    cnt = (cnt < blockSize) ? cnt : blockSize;
+
+    for (k = 0U; k < numBins; k++)
+    {
+      h = pH[k];
+      s = pS[k];
+      u = pU[k];
+
+      if (pSgn[k] >= 0)
+      {
+        for (n = 0U; n < cnt; n++)
+        {
+          u = (q63_t) pSrc[n] + (arm_goertzel_mult_q63(s, h) * 2) + u;
+          s = s + u;
+        }
+      }
+      else
+      {
+        for (n = 0U; n < cnt; n++)
+        {
+          u = (q63_t) pSrc[n] + (arm_goertzel_mult_q63(s, h) * 2) - u;
+          s = u - s;
+        }
+      }
+
+      pS[k] = s;
+      pU[k] = u;
+    }
+
+    pSrc += cnt;
+    blockSize -= cnt;
+    S->count += cnt;
+
+    if (S->count == S->frameLen)
+    {
+      /* Complex step of each bin, and restart of the resonators */
+      for (k = 0U; k < numBins; k++)
+      {
+        re = arm_goertzel_mult_q63(pS[k], pH[k]);
+        re = (pSgn[k] >= 0) ? (re + pU[k]) : (re - pU[k]);
+
+        *pDst++ = clip_q63_to_q31(re >> S->outShift);
+        *pDst++ = clip_q63_to_q31(arm_goertzel_mult_q63(pS[k], pSin[k]) >> S->outShift);
+      }
+
+      memset(S->pState, 0, 2U * numBins * sizeof(q63_t));
+
+      S->count = 0U;
+      numFrames++;
+    }
+  }
+
+  return (numFrames);
+}
+
+/**
+  @} end of Goertzel group
+ */
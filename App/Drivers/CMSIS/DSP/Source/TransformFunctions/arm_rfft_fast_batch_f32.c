@@ -0,0 +1,105 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_batch_f32.c
+ * Description:  Multi-frame RFFT & RIFFT Floating point process function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void stage_rfft_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut);
+
+extern void merge_rfft_f32(
+  const arm_rfft_fast_instance_f32 * S,
+        float32_t * p,
+        float32_t * pOut);
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Processing function for several frames of the floating-point real FFT.
+  @param[in]     S            points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     p            points to the first input frame
+  @param[in]     pOut         points to the first output frame
+  @param[in]     numFrames    number of frames to transform
+  @param[in]     frameStride  distance, in float32_t values, from the start of one frame to the next, for both
+                              the input and the output (at least <code>fftLenRFFT</code>)
+  @param[in]     ifftFlag
+                   - value = 0: RFFT
+                   - value = 1: RIFFT
+  @return        none
+
+  @par           Details
+                   Gives the same results as calling arm_rfft_fast_f32() on each frame in turn,
+                   and like it uses the input frames as scratch. The complex FFTs of all the
+                   frames are done by arm_cfft_batch_f32(), which shares the twiddle factor and
+                   bit reversal table loads between frames.
+ */
+
+void arm_rfft_fast_batch_f32(
+  arm_rfft_fast_instance_f32 * S,
+  float32_t * p,
+  float32_t * pOut,
+  uint32_t numFrames,
+  uint32_t frameStride,
+  uint8_t ifftFlag)
+{
+   arm_cfft_instance_f32 * Sint = &(S->Sint);
+   uint32_t f;
+   Sint->fftLen = S->fftLenRFFT / 2;
+
+   /* Calculation of Real FFT */
+   if (ifftFlag)
+   {
+      /*  Real FFT compression */
+      for (f = 0U; f < numFrames; f++)
+      {
+         merge_rfft_f32(S, p + f * frameStride, pOut + f * frameStride);
+      }
+
+      /* Complex radix-4 IFFT process */
+      arm_cfft_batch_f32( Sint, pOut, numFrames, frameStride, ifftFlag, 1);
+   }
+   else
+   {
+      /* Calculation of RFFT of input */
+      arm_cfft_batch_f32( Sint, p, numFrames, frameStride, ifftFlag, 1);
+
+      /*  Real FFT extraction */
+      for (f = 0U; f < numFrames; f++)
+      {
+         stage_rfft_f32(S, p + f * frameStride, pOut + f * frameStride);
+      }
+   }
+}
+
+/**
+* @} end of RealFFT group
+*/
@@ -0,0 +1,102 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_rfft_fast_init_ram_f32.c
+ * Description:  Floating-point real FFT initialization function with tables computed in RAM
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "arm_math.h"
+
+extern void arm_cfft_twiddle_f32(
+  uint32_t k,
+  uint32_t len,
+  float32_t * pTwiddle);
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup RealFFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point real FFT with tables computed in RAM.
+  @param[in,out] S             points to an arm_rfft_fast_instance_f32 structure
+  @param[in]     fftLen        length of the real sequence, a power of two from 32 to 8192
+  @param[out]    pTwiddle      points to a buffer of <code>2*fftLen</code> values which receives the twiddle factors
+  @param[out]    pBitRevTable  points to a buffer of <code>fftLen</code> values which receives the bit reversal table
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length
+
+  @par           Details
+                   Gives the same transform as arm_rfft_fast_init_f32(), without the constant tables. The
+                   twiddle factors of the complex FFT of length <code>fftLen/2</code> are computed by
+                   arm_cfft_init_ram_f32() in the first <code>fftLen</code> values of <code>pTwiddle</code>,
+                   and those of the real stage in the last <code>fftLen</code> values. The buffers must then
+                   be left unchanged while the instance is used.
+  @par
+                   The length 8192 has no constant tables and is only available with this function.
+ */
+
+arm_status arm_rfft_fast_init_ram_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  float32_t *pTwiddleRFFT = pTwiddle + fftLen;   /* Twiddle factors of the real stage */
+  uint32_t k;
+  arm_status status;
+
+  if ((S == NULL) || (fftLen < 32U) || (fftLen > 8192U))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  status = arm_cfft_init_ram_f32(&(S->Sint), fftLen / 2U, pTwiddle, pBitRevTable);
+
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  /* {sin, cos} of 2*pi*k/fftLen for half a turn, that is the {cos, sin} pair at fftLen/4 - k */
+  for (k = 0U; k < fftLen / 2U; k++)
+  {
+    arm_cfft_twiddle_f32((5U * (uint32_t) fftLen / 4U - k) % fftLen, fftLen, pTwiddleRFFT + 2U * k);
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of RealFFT group
+ */
@@ -0,0 +1,230 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_f32.c
+ * Description:  Floating-point sliding DFT processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Number of samples whose differences are computed at a time */
+#define ARM_SDFT_BLOCK 32U
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup SDFT Sliding DFT
+
+  Tracks a few bins of the DFT of the last <code>windowLen</code> samples of a stream of real
+  samples, updated at every sample. Each bin costs one complex rotation per sample, so that
+  <code>numBins</code> bins cost <code>O(numBins)</code> operations per sample, where a real
+  FFT of the window at every sample costs <code>O(windowLen*log2(windowLen))</code>.
+
+  @par           Algorithm
+                   When sample <code>x[n]</code> enters the window and <code>x[n-N]</code> leaves it, bin
+                   <code>k</code> is updated by
+  <pre>
+      X[k] = exp(j*w) * (r * X[k] + x[n] - r^N * x[n-N])      with w = 2 * pi * k / N
+  </pre>
+                   where <code>N</code> is <code>windowLen</code> and <code>r</code> the damping factor.
+                   With <code>r = 1</code>, <code>X[k]</code> is the DFT bin <code>sum(x[n-N+1+m] * exp(-j*w*m))</code>
+                   of the window, oldest sample first, as given by arm_rfft_fast_f32() of the window.
+                   The samples before the first input are zeros.
+  @par
+                   The rounding errors of the updates are never forgotten with <code>r = 1</code>, and grow
+                   slowly with the number of samples. A damping factor slightly below 1, such as 0.9999,
+                   makes them decay, at the cost of weighting the sample <code>m</code> samples old by
+                   <code>r^m</code>.
+  @par
+                   The samples are stored in a delay line of <code>windowLen</code> samples. The differences
+                   <code>x[n] - r^N * x[n-N]</code> are computed 32 samples at a time, then each bin runs over them
+                   with its value in registers. Several bins are run side by side, one bin per lane with Neon or
+                   x86 SIMD.
+
+  @par           Outputs
+                   The function outputs the <code>numBins</code> complex bins after the last sample of each
+                   block, real and imaginary parts interleaved, in the order of <code>pBins</code> given
+                   to the initialization function. Blocks of one sample give the bins at every sample.
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/*
+ * Runs all the bins over the blockSize differences at pDiff.
+ */
+static void arm_sdft_run_f32(
+  const arm_sdft_instance_f32 * S,
+  const float32_t * pDiff,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+  const float32_t *pCos = S->pCoeffs;                  /* Cosines of the bin frequencies */
+  const float32_t *pSin = S->pCoeffs + numBins;        /* Sines of the bin frequencies */
+        float32_t *pRe = S->pState;                    /* Real parts of the bins */
+        float32_t *pIm = S->pState + numBins;          /* Imaginary parts of the bins */
+        float32_t r = S->damping;                      /* Damping factor */
+        uint32_t k = 0U;                               /* First bin of the group */
+        uint32_t n;                                    /* Loop counter */
+        float32_t c, s, re, im, tr, ti;
+
+#if defined(ARM_MATH_NEON)
+
+  float32x4_t cV, sV, rV, reV, imV, trV, tiV;
+
+  rV = vdupq_n_f32(r);
+
+  for (; (k + 4U) <= numBins; k += 4U)
+  {
+    cV = vld1q_f32(pCos + k);
+    sV = vld1q_f32(pSin + k);
+    reV = vld1q_f32(pRe + k);
+    imV = vld1q_f32(pIm + k);
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* t = r * X + d, then X = exp(j*w) * t, for one bin per lane */
+      trV = vmlaq_f32(vdupq_n_f32(pDiff[n]), rV, reV);
+      tiV = vmulq_f32(rV, imV);
+      reV = vmlsq_f32(vmulq_f32(cV, trV), sV, tiV);
+      imV = vmlaq_f32(vmulq_f32(sV, trV), cV, tiV);
+    }
+
+    vst1q_f32(pRe + k, reV);
+    vst1q_f32(pIm + k, imV);
+  }
+
+#elif defined(ARM_MATH_X86_SIMD)
+
+  arm_x86_f32_t cV, sV, rV, reV, imV, trV, tiV;
+
+  rV = __arm_x86_dup_f32(r);
+
+  for (; (k + ARM_X86_F32_LANES) <= numBins; k += ARM_X86_F32_LANES)
+  {
+    cV = __arm_x86_ld_f32(pCos + k);
+    sV = __arm_x86_ld_f32(pSin + k);
+    reV = __arm_x86_ld_f32(pRe + k);
+    imV = __arm_x86_ld_f32(pIm + k);
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* t = r * X + d, then X = exp(j*w) * t, for one bin per lane */
+      trV = __arm_x86_fma_f32(__arm_x86_dup_f32(pDiff[n]), rV, reV);
+      tiV = __arm_x86_mul_f32(rV, imV);
+      reV = __arm_x86_sub_f32(__arm_x86_mul_f32(cV, trV), __arm_x86_mul_f32(sV, tiV));
+      imV = __arm_x86_fma_f32(__arm_x86_mul_f32(sV, trV), cV, tiV);
+    }
+
+    __arm_x86_st_f32(pRe + k, reV);
+    __arm_x86_st_f32(pIm + k, imV);
+  }
+
+#endif /* #if defined(ARM_MATH_NEON) */
+
+  for (; k < numBins; k++)
+  {
+    c = pCos[k];
+    s = pSin[k];
+    re = pRe[k];
+    im = pIm[k];
+
+    for (n = 0U; n < blockSize; n++)
+    {
+      /* t = r * X + d, then X = exp(j*w) * t */
+      tr = r * re + pDiff[n];
+      ti = r * im;
+      re = c * tr - s * ti;
+      im = s * tr + c * ti;
+    }
+
+    pRe[k] = re;
+    pIm[k] = im;
+  }
+}
+
+/**
+  @brief         Processing function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the bins after the last sample of the block, of length <code>2*numBins</code>
+  @param[in]     blockSize  number of input samples
+  @return        none
+ */
+
+void arm_sdft_f32(
+        arm_sdft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t windowLen = S->windowLen;             /* Length of the delay line */
+        uint32_t index = S->delayIndex;                /* Index of the oldest sample in the delay line */
+        float32_t *pDelay = S->pDelay;                 /* Delay line */
+        float32_t rN = S->dampingN;                    /* Weight of the sample leaving the window */
+        float32_t diff[ARM_SDFT_BLOCK];                /* Differences of a block of samples */
+        uint32_t cnt, n, k;
+
+  while (blockSize > 0U)
+  {
+    cnt = (blockSize < ARM_SDFT_BLOCK) ? blockSize : ARM_SDFT_BLOCK;
+
+    /* Each new sample replaces the sample leaving the window in the delay line */
+    for (n = 0U; n < cnt; n++)
+    {
+      diff[n] = pSrc[n] - rN * pDelay[index];
+      pDelay[index] = pSrc[n];
+
+      index++;
+      if (index == windowLen)
+      {
+        index = 0U;
+      }
+    }
+
+    arm_sdft_run_f32(S, diff, cnt);
+
+    pSrc += cnt;
+    blockSize -= cnt;
+  }
+
+  S->delayIndex = index;
+
+  /* Interleave the real and imaginary parts */
+  for (k = 0U; k < S->numBins; k++)
+  {
+    *pDst++ = S->pState[k];
+    *pDst++ = S->pState[S->numBins + k];
+  }
+}
+
+/**
+  @} end of SDFT group
+ */
+
+#undef ARM_SDFT_BLOCK
@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_f32.c
+ * Description:  Floating-point sliding DFT initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point sliding DFT.
+  @param[in,out] S          points to an instance of the floating-point sliding DFT structure
+  @param[in]     numBins    number of bins
+  @param[in]     windowLen  number of samples in the window
+  @param[in]     pBins      points to the indices of the bins, of length <code>numBins</code>
+  @param[in]     damping    damping factor, in <code>(0, 1]</code>
+  @param[out]    pCoeffs    points to the coefficient buffer, of length <code>2*numBins</code>
+  @param[in]     pState     points to the state buffer, of length <code>2*numBins</code>
+  @param[in]     pDelay     points to the delay line, of length <code>windowLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowLen</code> is 0, a bin index is not below
+                                                    <code>windowLen</code>, or <code>damping</code> is out of range
+
+  @par           Details
+                   Bin <code>k</code> is at the frequency <code>k/windowLen</code> of the sampling frequency.
+                   The cosines and sines of the bin frequencies are computed in <code>pCoeffs</code>, which
+                   must then be left unchanged. The bins and the delay line are cleared.
+ */
+
+arm_status arm_sdft_init_f32(
+        arm_sdft_instance_f32 * S,
+        uint16_t numBins,
+        uint16_t windowLen,
+  const uint16_t * pBins,
+        float32_t damping,
+        float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t * pDelay)
+{
+  float64_t w;
+  uint32_t k;
+
+  if ((windowLen == 0U) || !(damping > 0.0f) || (damping > 1.0f))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= windowLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    w = 6.283185307179586476925 * (float64_t) pBins[k] / (float64_t) windowLen;
+    pCoeffs[k] = (float32_t) cos(w);
+    pCoeffs[numBins + k] = (float32_t) sin(w);
+  }
+
+  S->numBins = numBins;
+  S->windowLen = windowLen;
+  S->delayIndex = 0U;
+  S->damping = damping;
+  S->dampingN = (float32_t) pow((float64_t) damping, (float64_t) windowLen);
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the bins and the delay line */
+  memset(pState, 0, 2U * numBins * sizeof(float32_t));
+  memset(pDelay, 0, windowLen * sizeof(float32_t));
+
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of SDFT group
+ */
@@ -0,0 +1,120 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_init_q31.c
+ * Description:  Q31 sliding DFT initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     numBins    number of bins
+  @param[in]     windowLen  number of samples in the window
+  @param[in]     pBins      points to the indices of the bins, of length <code>numBins</code>
+  @param[in]     damping    damping factor in 1.31 format, positive, <code>0x7FFFFFFF</code> for no damping
+  @param[out]    pCoeffs    points to the coefficient buffer, of length <code>2*numBins</code>
+  @param[in]     pState     points to the state buffer, of length <code>2*numBins</code>
+  @param[in]     pDelay     points to the delay line, of length <code>windowLen</code>
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>windowLen</code> is 0, a bin index is not below
+                                                    <code>windowLen</code>, or <code>damping</code> is not positive
+
+  @par           Details
+                   Bin <code>k</code> is at the frequency <code>k/windowLen</code> of the sampling frequency.
+                   The cosines and sines of the bin frequencies are computed in 1.31 format in
+                   <code>pCoeffs</code>, which must then be left unchanged. The bins and the delay line are cleared.
+ */
+
+arm_status arm_sdft_init_q31(
+        arm_sdft_instance_q31 * S,
+        uint16_t numBins,
+        uint16_t windowLen,
+  const uint16_t * pBins,
+        q31_t damping,
+        q31_t * pCoeffs,
+        q63_t * pState,
+        q31_t * pDelay)
+{
+  float64_t w;
+  uint32_t k;
+  uint8_t shift = 0U;
+
+  if ((windowLen == 0U) || (damping <= 0))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0U; k < numBins; k++)
+  {
+    if (pBins[k] >= windowLen)
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+
+    /* Rounded to 1.31 format, with cos(0) saturated below 1 */
+    w = 6.283185307179586476925 * (float64_t) pBins[k] / (float64_t) windowLen;
+    pCoeffs[k] = clip_q63_to_q31((q63_t) floor(cos(w) * 2147483648.0 + 0.5));
+    pCoeffs[numBins + k] = clip_q63_to_q31((q63_t) floor(sin(w) * 2147483648.0 + 0.5));
+  }
+
+  /* Smallest shift which divides the bins by at least windowLen */
+  while ((1UL << shift) < windowLen)
+  {
+    shift++;
+  }
+
+  S->numBins = numBins;
+  S->windowLen = windowLen;
+  S->delayIndex = 0U;
+  S->outShift = shift;
+  S->damping = damping;
+  S->dampingN = clip_q63_to_q31((q63_t) floor(pow((float64_t) damping / 2147483648.0,
+                                                  (float64_t) windowLen) * 2147483648.0 + 0.5));
+  S->pCoeffs = pCoeffs;
+
+  /* Clear the bins and the delay line */
+  memset(pState, 0, 2U * numBins * sizeof(q63_t));
+  memset(pDelay, 0, windowLen * sizeof(q31_t));
+
+  S->pState = pState;
+  S->pDelay = pDelay;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of SDFT group
+ */
@@ -0,0 +1,124 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sdft_q31.c
+ * Description:  Q31 sliding DFT processing function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup SDFT
+  @{
+ */
+
+/*
+ * Product of a 64-bit value and a Q31 value, shifted right by 31 bits with rounding.
+ * The rounding keeps the rotations of the bins from drifting.
+ */
+__STATIC_FORCEINLINE q63_t arm_sdft_mult_q63(
+  q63_t x,
+  q31_t y)
+{
+  return (((x >> 32) * y) * 2) + (((((q63_t) (uint32_t) x) * y) + 0x40000000LL) >> 31);
+}
+
+/**
+  @brief         Processing function for the Q31 sliding DFT.
+  @param[in,out] S          points to an instance of the Q31 sliding DFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the bins after the last sample of the block, of length <code>2*numBins</code>
+  @param[in]     blockSize  number of input samples
+  @return        none
+
+  @par           Scaling and Overflow Behavior
+                   The bins are 64-bit values in the 1.31 format of the inputs, which cannot overflow.
+                   The outputs are divided by <code>2^outShift</code>, where <code>outShift</code> is the
+                   smallest shift such that <code>2^outShift >= windowLen</code>, and saturated to 1.31 format.
+                   For window lengths which are powers of two the outputs are the DFT bins divided by
+                   <code>windowLen</code>.
+ */
+
+void arm_sdft_q31(
+        arm_sdft_instance_q31 * S,
+  const q31_t * pSrc,
+        q31_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t numBins = S->numBins;                 /* Number of bins */
+  const q31_t *pCos = S->pCoeffs;                      /* Cosines of the bin frequencies */
+  const q31_t *pSin = S->pCoeffs + numBins;            /* Sines of the bin frequencies */
+        q63_t *pRe = S->pState;                        /* Real parts of the bins */
+        q63_t *pIm = S->pState + numBins;              /* Imaginary parts of the bins */
+        q31_t *pDelay = S->pDelay;                     /* Delay line */
+        uint32_t index = S->delayIndex;                /* Index of the oldest sample in the delay line */
+        q31_t r = S->damping;                          /* Damping factor */
+        q31_t rN = S->dampingN;                        /* Weight of the sample leaving the window */
+        q63_t diff, re, im, tr, ti;
+        uint32_t k;
+
+  while (blockSize > 0U)
+  {
+    /* The new sample replaces the sample leaving the window in the delay line */
+    diff = (q63_t) *pSrc - arm_sdft_mult_q63((q63_t) pDelay[index], rN);
+    pDelay[index] = *pSrc++;
+
+    index++;
+    if (index == S->windowLen)
+    {
+      index = 0U;
+    }
+
+    for (k = 0U; k < numBins; k++)
+    {
+      /* t = r * X + d, then X = exp(j*w) * t */
+      tr = arm_sdft_mult_q63(pRe[k], r) + diff;
+      ti = arm_sdft_mult_q63(pIm[k], r);
+      re = arm_sdft_mult_q63(tr, pCos[k]) - arm_sdft_mult_q63(ti, pSin[k]);
+      im = arm_sdft_mult_q63(tr, pSin[k]) + arm_sdft_mult_q63(ti, pCos[k]);
+
+      pRe[k] = re;
+      pIm[k] = im;
+    }
+
+    blockSize--;
+  }
+
+  S->delayIndex = index;
+
+  /* Interleave the real and imaginary parts */
+  for (k = 0U; k < numBins; k++)
+  {
+    *pDst++ = clip_q63_to_q31(pRe[k] >> S->outShift);
+    *pDst++ = clip_q63_to_q31(pIm[k] >> S->outShift);
+  }
+}
+
+/**
+  @} end of SDFT group
+ */
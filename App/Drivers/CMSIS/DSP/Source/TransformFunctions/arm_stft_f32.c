@@ -0,0 +1,339 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_f32.c
+ * Description:  Floating-point short-time Fourier transform with power, log and mel outputs
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/* Added to the powers before the log, so that silent bins give a finite output */
+#define ARM_STFT_LOG_OFFSET 1.0e-6f
+
+/* Number of bins post-processed at a time */
+#define ARM_STFT_BLOCK 32U
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @defgroup STFT Short-Time Fourier Transform
+
+  Computes the power spectrum, or the mel spectrum, of overlapping frames of a stream of
+  real samples, as used for spectrograms. Each frame is windowed, transformed by a real FFT,
+  and its bins reduced to powers, optionally projected onto a mel filterbank, and optionally
+  converted to their natural log.
+
+  @par           Algorithm
+                   The samples are kept in a ring of <code>fftLen</code> samples. When the ring is full, the frame
+                   is multiplied by the window as it is read from the ring into the FFT work buffer, in two parts
+                   on either side of the end of the ring. The frame is not copied otherwise. The complex FFT of
+                   <code>fftLen/2</code> points is computed in place in the work buffer.
+  @par
+                   The split stage of the real FFT, which gives the bins from the complex FFT, computes the
+                   power <code>re*re + im*im</code> of each bin instead of storing the bin. Every 32 bins, while
+                   they are still in registers or on the stack, the powers are added to the mel bands which overlap
+                   them, or are the outputs without mel bands. The spectrum is never stored. The log is taken of
+                   each power, or of each mel band once the bins have passed its last bin. The outputs are those of arm_mult_f32(), arm_rfft_fast_f32(),
+                   arm_cmplx_mag_squared_f32(), the mel projection and the log applied in turn, without the
+                   intermediate buffers and passes.
+  @par
+                   The ring then drops the <code>hopSize</code> oldest samples, and is filled again by the next inputs.
+                   The first frame holds the first <code>fftLen</code> samples.
+
+  @par           Outputs
+                   Each frame gives <code>fftLen/2+1</code> powers, from DC to the Nyquist frequency, or
+                   <code>numMels</code> mel bands. With <code>logOutput</code> set, the outputs are
+                   <code>log(x + 1e-6)</code>.
+
+  @par           Mel filterbank
+                   Band <code>m</code> covers the <code>pFilterLengths[m]</code> bins from <code>pFilterPos[m]</code>.
+                   Its weights follow those of band <code>m-1</code> in <code>pFilterCoefs</code>.
+                   The bands are sorted by their first bin, and must end at the Nyquist bin at the latest.
+                   This is the usual sparse form of a bank of triangular filters.
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/*
+ * Post-processes the powers of cnt bins from bin start, held in pPower. Without mel bands,
+ * pPower is the output and the log is taken in place. Otherwise the powers are added to the
+ * mel bands which overlap the bins, and the bands which end with them are finished.
+ * pFirst and pFirstOffset hold the first band which is not finished and the index of its weights.
+ */
+static void arm_stft_post_f32(
+  const arm_stft_instance_f32 * S,
+  const float32_t * pPower,
+        uint32_t start,
+        uint32_t cnt,
+        float32_t * pDst,
+        uint32_t * pFirst,
+        uint32_t * pFirstOffset)
+{
+  const uint32_t *pPos = S->pFilterPos;                /* First bins of the mel bands */
+  const uint32_t *pLen = S->pFilterLengths;            /* Numbers of bins of the mel bands */
+        uint32_t end = start + cnt;                    /* Bin after the last one */
+        uint32_t m, offset, lo, hi;
+        float32_t acc;
+
+  if (S->numMels == 0U)
+  {
+    if (S->logOutput != 0U)
+    {
+      for (m = start; m < end; m++)
+      {
+        pDst[m] = logf(pDst[m] + ARM_STFT_LOG_OFFSET);
+      }
+    }
+    return;
+  }
+
+  /* Add the weighted powers to the bands which overlap the bins */
+  offset = *pFirstOffset;
+  for (m = *pFirst; (m < S->numMels) && (pPos[m] < end); m++)
+  {
+    lo = (pPos[m] > start) ? pPos[m] : start;
+    hi = ((pPos[m] + pLen[m]) < end) ? (pPos[m] + pLen[m]) : end;
+
+    if (lo < hi)
+    {
+      arm_dot_prod_f32((float32_t *) S->pFilterCoefs + offset + (lo - pPos[m]),
+                       (float32_t *) pPower + (lo - start), hi - lo, &acc);
+      pDst[m] += acc;
+    }
+
+    offset += pLen[m];
+  }
+
+  /* Finish the bands which end with the bins */
+  while ((*pFirst < S->numMels) && ((pPos[*pFirst] + pLen[*pFirst]) <= end))
+  {
+    if (S->logOutput != 0U)
+    {
+      pDst[*pFirst] = logf(pDst[*pFirst] + ARM_STFT_LOG_OFFSET);
+    }
+
+    *pFirstOffset += pLen[*pFirst];
+    (*pFirst)++;
+  }
+}
+
+/*
+ * Split stage of the real FFT, as in stage_rfft_f32(), which gives the powers of the bins
+ * instead of the bins. The powers are post-processed every ARM_STFT_BLOCK bins, from a buffer
+ * on the stack, or from the output without mel bands.
+ */
+static void arm_stft_stage_f32(
+  const arm_stft_instance_f32 * S,
+  const float32_t * p,
+        float32_t * pDst)
+{
+        uint32_t  k;                                /* Loop Counter */
+        uint32_t  start = 0U;                       /* First bin of the block */
+        uint32_t  cnt;                              /* Number of bins in the block */
+        uint32_t  first = 0U;                       /* First mel band which is not finished */
+        uint32_t  firstOffset = 0U;                 /* Index of the weights of the first band */
+        float32_t twR, twI;                         /* RFFT Twiddle coefficients */
+  const float32_t * pCoeff = S->rfft.pTwiddleRFFT;  /* Points to RFFT Twiddle factors */
+  const float32_t *pA = p;                          /* increasing pointer */
+  const float32_t *pB = p;                          /* decreasing pointer */
+        float32_t xAR, xAI, xBR, xBI;               /* temporary variables */
+        float32_t t1a, t1b;                         /* temporary variables */
+        float32_t p0, p1, p2, p3;                   /* temporary variables */
+        float32_t re, im;                           /* Bin of the real FFT */
+        float32_t nyquist;                          /* Nyquist bin, packed with the DC bin */
+        float32_t block[ARM_STFT_BLOCK];            /* Powers of a block of bins, with mel bands */
+        float32_t *pPower;                          /* Powers of the block */
+
+   if (S->numMels != 0U)
+   {
+      arm_fill_f32(0.0f, pDst, S->numMels);
+      pPower = block;
+   }
+   else
+   {
+      pPower = pDst;
+   }
+
+   k = (S->rfft.Sint).fftLen - 1;
+
+   /* The first complex sample holds the DC and Nyquist bins, which are real */
+   xBR = pB[0];
+   xBI = pB[1];
+   xAR = pA[0];
+   xAI = pA[1];
+
+   pCoeff += 2;
+
+   t1a = xBR + xAR;
+   t1b = xBI + xAI;
+
+   re = 0.5f * (t1a + t1b);
+   nyquist = 0.5f * (t1a - t1b);
+
+   pPower[0] = re * re;
+   cnt = 1U;
+
+   pB  = p + 2*k;
+   pA += 2;
+
+   do
+   {
+      xBI = pB[1];
+      xBR = pB[0];
+      xAR = pA[0];
+      xAI = pA[1];
+
+      twR = *pCoeff++;
+      twI = *pCoeff++;
+
+      t1a = xBR - xAR ;
+      t1b = xBI + xAI ;
+
+      // real(tw * (xB - xA)) = twR * (xBR - xAR) - twI * (xBI - xAI);
+      // imag(tw * (xB - xA)) = twI * (xBR - xAR) + twR * (xBI - xAI);
+      p0 = twR * t1a;
+      p1 = twI * t1a;
+      p2 = twR * t1b;
+      p3 = twI * t1b;
+
+      re = 0.5f * (xAR + xBR + p0 + p3 );
+      im = 0.5f * (xAI - xBI + p1 - p2 );
+
+      pPower[cnt++] = (re * re) + (im * im);
+
+      if (cnt == ARM_STFT_BLOCK)
+      {
+         arm_stft_post_f32(S, pPower, start, cnt, pDst, &first, &firstOffset);
+
+         start += cnt;
+         cnt = 0U;
+         if (S->numMels == 0U)
+         {
+            pPower += ARM_STFT_BLOCK;
+         }
+      }
+
+      pA += 2;
+      pB -= 2;
+      k--;
+   } while (k > 0U);
+
+   pPower[cnt++] = nyquist * nyquist;
+
+   arm_stft_post_f32(S, pPower, start, cnt, pDst, &first, &firstOffset);
+}
+
+/**
+  @brief         Processing function for the floating-point short-time Fourier transform.
+  @param[in,out] S          points to an instance of the floating-point STFT structure
+  @param[in]     pSrc       points to the block of input samples
+  @param[out]    pDst       points to the outputs of the frames completed by the block
+  @param[in]     blockSize  number of input samples
+  @return        number of frames written to <code>pDst</code>
+
+  @par           Details
+                   The block can be of any size. The outputs of the frames it completes are written one frame
+                   after the other, <code>numMels</code> values per frame, or <code>fftLen/2+1</code> without
+                   mel bands. A block of <code>blockSize</code> samples completes at most
+                   <code>(blockSize-1)/hopSize+1</code> frames.
+ */
+
+uint32_t arm_stft_f32(
+        arm_stft_instance_f32 * S,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize)
+{
+        uint32_t fftLen = S->fftLen;                   /* Length of the frames and of the ring */
+        float32_t *pRing = S->pState;                  /* Ring of input samples */
+        float32_t *pWork = S->pState + fftLen;         /* FFT work buffer */
+        uint32_t numOut;                               /* Number of outputs per frame */
+        uint32_t numFrames = 0U;                       /* Number of frames computed */
+        uint32_t writeIndex;                           /* Index in the ring of the next input */
+        uint32_t cnt, n1;                              /* Numbers of samples */
+
+  numOut = (S->numMels != 0U) ? S->numMels : ((fftLen / 2U) + 1U);
+
+  while (blockSize > 0U)
+  {
+    /* Append as many inputs as fit in the ring */
+    writeIndex = S->frameStart + S->fill;
+    if (writeIndex >= fftLen)
+    {
+      writeIndex -= fftLen;
+    }
+
+    cnt = fftLen - S->fill;
+    cnt = (cnt < blockSize) ? cnt : blockSize;
+    n1 = fftLen - writeIndex;
+    n1 = (n1 < cnt) ? n1 : cnt;
+
+    arm_copy_f32(pSrc, pRing + writeIndex, n1);
+    arm_copy_f32(pSrc + n1, pRing, cnt - n1);
+
+    pSrc += cnt;
+    blockSize -= cnt;
+    S->fill += cnt;
+
+    /* A full ring holds one frame */
+    if (S->fill == fftLen)
+    {
+      /* Window the frame as it is read from the ring, on either side of the end of the ring */
+      n1 = fftLen - S->frameStart;
+      arm_mult_f32(pRing + S->frameStart, S->pWindow, pWork, n1);
+      arm_mult_f32(pRing, S->pWindow + n1, pWork + n1, fftLen - n1);
+
+      /* Complex FFT of the frame, seen as fftLen/2 complex samples */
+      arm_cfft_f32(&(S->rfft.Sint), pWork, 0U, 1U);
+
+      /* Split stage, power, mel bands and log */
+      arm_stft_stage_f32(S, pWork, pDst);
+
+      pDst += numOut;
+      numFrames++;
+
+      /* Drop the hopSize oldest samples */
+      S->frameStart += S->hopSize;
+      if (S->frameStart >= fftLen)
+      {
+        S->frameStart -= fftLen;
+      }
+      S->fill -= S->hopSize;
+    }
+  }
+
+  return (numFrames);
+}
+
+#undef ARM_STFT_LOG_OFFSET
+#undef ARM_STFT_BLOCK
+
+/**
+  @} end of STFT group
+ */
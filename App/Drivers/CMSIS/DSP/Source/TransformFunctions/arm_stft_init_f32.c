@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_stft_init_f32.c
+ * Description:  Floating-point short-time Fourier transform initialization function
+ *
+ * $Date:        18. March 2019
+ * $Revision:    V1.6.0
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2019 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+  @ingroup groupTransforms
+ */
+
+/**
+  @addtogroup STFT
+  @{
+ */
+
+/**
+  @brief         Initialization function for the floating-point short-time Fourier transform.
+  @param[in,out] S               points to an instance of the floating-point STFT structure
+  @param[in]     fftLen          length of the frames and of the FFT
+  @param[in]     hopSize         number of samples between the starts of two frames
+  @param[in]     pWindow         points to the window, of length <code>fftLen</code>
+  @param[in]     numMels         number of mel bands, or 0 for the power spectrum
+  @param[in]     pFilterPos      points to the first FFT bin of each mel band
+  @param[in]     pFilterLengths  points to the number of FFT bins of each mel band
+  @param[in]     pFilterCoefs    points to the weights of the bins of all the mel bands
+  @param[in]     logOutput       1 to output the natural log of the powers, 0 for the powers
+  @param[in]     pState          points to the state buffer
+  @return        execution status
+                   - \ref ARM_MATH_SUCCESS        : Operation successful
+                   - \ref ARM_MATH_ARGUMENT_ERROR : <code>fftLen</code> is not a supported length,
+                                                    <code>hopSize</code> is 0 or greater than <code>fftLen</code>,
+                                                    or a mel band is out of order or ends after the Nyquist bin
+
+  @par           Details
+                   <code>fftLen</code> is one of the lengths supported by arm_rfft_fast_init_f32().
+                   The filterbank pointers are not used when <code>numMels</code> is 0.
+                   <code>pState</code> points to an array of <code>2*fftLen</code> values, which holds
+                   the ring of input samples and the FFT work buffer.
+ */
+
+arm_status arm_stft_init_f32(
+        arm_stft_instance_f32 * S,
+        uint16_t fftLen,
+        uint16_t hopSize,
+  const float32_t * pWindow,
+        uint16_t numMels,
+  const uint32_t * pFilterPos,
+  const uint32_t * pFilterLengths,
+  const float32_t * pFilterCoefs,
+        uint8_t logOutput,
+        float32_t * pState)
+{
+  arm_status status;
+  uint32_t m;
+
+  if ((hopSize == 0U) || (hopSize > fftLen))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* Each band starts after the previous one and ends at the Nyquist bin at the latest */
+  for (m = 0U; m < numMels; m++)
+  {
+    if (((m > 0U) && (pFilterPos[m] < pFilterPos[m - 1U])) ||
+        ((pFilterPos[m] + pFilterLengths[m]) > ((fftLen / 2U) + 1U)))
+    {
+      return (ARM_MATH_ARGUMENT_ERROR);
+    }
+  }
+
+  status = arm_rfft_fast_init_f32(&(S->rfft), fftLen);
+  if (status != ARM_MATH_SUCCESS)
+  {
+    return (status);
+  }
+
+  S->fftLen = fftLen;
+  S->hopSize = hopSize;
+  S->pWindow = pWindow;
+
+  /* Assign the mel filterbank */
+  S->numMels = numMels;
+  S->pFilterPos = pFilterPos;
+  S->pFilterLengths = pFilterLengths;
+  S->pFilterCoefs = pFilterCoefs;
+  S->logOutput = logOutput;
+
+  /* The ring is empty */
+  S->frameStart = 0U;
+  S->fill = 0U;
+
+  /* Clear the ring and the work buffer */
+  memset(pState, 0, 2U * fftLen * sizeof(float32_t));
+
+  /* Assign state pointer */
+  S->pState = pState;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+  @} end of STFT group
+ */
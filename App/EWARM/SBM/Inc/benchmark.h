@@ -49,6 +49,14 @@ void sbm_benchmark_boot_start(void);
 */
 void sbm_benchmark_boot_stop(void);
 
+/** Record a point during boot at which a watchdog could be serviced.
+ *
+ * The longest interval between consecutive checkpoints is reported by
+ * sbm_benchmark_watchdog(). Boot start and stop, and the start and stop of
+ * each feature, are checkpoints implicitly.
+ */
+void sbm_benchmark_checkpoint(void);
+
 #include <stdint.h>
 
 /* This macro is defined here but could be moved to Security Manager control.
@@ -127,11 +135,12 @@ void sbm_benchmark_report(void);
 
 #else /* SBM_BENCHMARKING != 0 */
 
-/* If we're not benchmarking, all these calls just "evaporate" ... */
+/* If we're not benchmarking, all these calls just "evaporate",
+   except that feature boundaries remain checkpoints ... */
 
-#define sbm_benchmark_feature_start(feature) do { } while (0)
+#define sbm_benchmark_feature_start(feature) sbm_benchmark_checkpoint()
 #define sbm_benchmark_procedure_start(procedure) do { } while (0)
-#define sbm_benchmark_feature_stop(feature) do { } while (0)
+#define sbm_benchmark_feature_stop(feature) sbm_benchmark_checkpoint()
 #define sbm_benchmark_procedure_stop(procedure) do { } while (0)
 #define sbm_benchmark_report() do { } while (0)
 
@@ -144,12 +153,37 @@ void sbm_benchmark_report(void);
 /** Yield total boot time. */
 uint32_t sbm_benchmark_boot_time(void);
 
+/** Yield the watchdog figures recorded during boot.
+ *
+ * \param period Address of uint32_t to receive the watchdog period, or zero
+ *               if no watchdog was running.
+ * \param max_period Address of uint32_t to receive the longest interval
+ *                   between checkpoints.
+ * \param max_activity_start Address of uint32_t to receive the start of that
+ *                           interval, relative to boot start.
+ * \param max_activity_end Address of uint32_t to receive the end of that
+ *                         interval, relative to boot start.
+ *
+ * All values are in microseconds.
+ */
+void sbm_benchmark_watchdog(uint32_t *period, uint32_t *max_period,
+                            uint32_t *max_activity_start, uint32_t *max_activity_end);
+
+/** Yield the size of the SBM stack and the most of it used during boot.
+ *
+ * \param size Address of uint32_t to receive the stack size in bytes.
+ * \param used Address of uint32_t to receive the stack high-water mark in
+ *             bytes.
+ */
+void sbm_benchmark_stack(uint32_t *size, uint32_t *used);
+
 #else /* SBM_RECORD_BOOT_TIME != 0 */
 
 /* If we're not recording boot time, all these calls just "evaporate" ... */
 
 #define sbm_benchmark_boot_start() do { } while (0)
 #define sbm_benchmark_boot_stop() do { } while (0)
+#define sbm_benchmark_checkpoint() do { } while (0)
 #define sbm_benchmark_feature_start(feature) do { } while (0)
 #define sbm_benchmark_procedure_start(procedure) do { } while (0)
 #define sbm_benchmark_feature_stop(feature) do { } while (0)
@@ -169,6 +169,25 @@ hal_mem_result_t oem_ext_mm_erase(hal_mem_address_t address, size_t size);
  */
 hal_mem_result_t oem_ext_mm_verify_erased(hal_mem_address_t address, size_t size);
 
+/** Protect an area of external mapped memory against writes until the next reset.
+ *
+ * This is called before checking an application which executes in place
+ * from external mapped memory, with the extent of the update slot holding it.
+ * The application is not launched unless this succeeds.
+ *
+ * \note This function must be provided when an application can execute in
+ * place from external mapped memory. The default (weak) implementation
+ * fails, so such an application is never launched unprotected.
+ *
+ * \param[in] address The address of the first byte in the memory region to protect.
+ * \param[in] size    The size of the region to protect, in bytes.
+ *
+ * \return \c HAL_MEM_SUCCESS if the region is protected.
+ *         \c HAL_MEM_PARAM_ERROR if the region cannot be protected.
+ *         \c HAL_MEM_INTERNAL_ERROR if write protection is not supported.
+ */
+hal_mem_result_t oem_ext_mm_write_protect(hal_mem_address_t address, size_t size);
+
 /** Disable all caches (called prior to write/erase operations)
  *
  * This is called before the start of a sequence of erase or write operations.
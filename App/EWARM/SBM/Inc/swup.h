@@ -221,6 +221,44 @@ bool sbm_swup_can_install_update(const memory_slot *update_slot);
  */
 bool sbm_swup_get_executable_module_info(app_info_record *info);
 
+/** Get the address at which the installed application image starts.
+ *
+ * \return The start of the image within its update slot if it executes in
+ *         place, otherwise the start of the executable slot.
+ *
+ * \note The MUH must have been read (see sbm_executable_slot_module_valid()).
+ */
+uintptr_t sbm_swup_exec_image_address(void);
+
+#if SBM_EXECUTE_IN_PLACE != 0
+/** Does an update slot support executing an image in place?
+ *
+ * \param[in] slot The update slot to check.
+ *
+ * \return \b true if the slot is on a present, directly addressable device.
+ */
+bool sbm_swup_slot_executes_in_place(const memory_slot *slot);
+
+/** Get the update slot from which the installed application executes.
+ *
+ * \return The update slot, or \c NULL if the application was copied into
+ *         the executable slot.
+ *
+ * \note Called during boot process and from a secure API context.
+ */
+const memory_slot *sbm_swup_xip_slot(void);
+
+/** Write protect the update slot from which the installed application executes.
+ *
+ * \return \b true if there is no such slot or it has been protected,
+ *         \b false otherwise.
+ *
+ * \note Called during boot process, before the application is checked and
+ * started.
+ */
+bool sbm_swup_lock_xip_slot(void);
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 #ifdef SBM_PC_BUILD
 void sbm_swup_quiesce(void);
 #endif
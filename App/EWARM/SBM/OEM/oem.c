@@ -232,6 +232,13 @@ __WEAK_FUNC hal_mem_result_t oem_ext_mm_verify_erased(hal_mem_address_t address,
 	return HAL_MEM_INTERNAL_ERROR;
 }
 
+__WEAK_FUNC hal_mem_result_t oem_ext_mm_write_protect(hal_mem_address_t address, size_t size)
+{
+	(void)address;
+	(void)size;
+	return HAL_MEM_INTERNAL_ERROR;
+}
+
 __WEAK_FUNC void oem_ext_mm_disable_caches(void)
 {
 	/* No-op */
@@ -37,6 +37,122 @@
 #include "sha.h"
 #define ERROR(...)	do { (void) shaStatus; } while (0)
 
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+#include <string.h>
+
+#include "sbm_hal_crypto.h"
+
+/* Size of each of the buffers used to stage callback data for the HASH engine. */
+#ifndef SHA256_OFFLOAD_STAGE_SIZE
+#define SHA256_OFFLOAD_STAGE_SIZE 512u
+#endif
+
+/* Largest chunk list sha256_calc_hash_chunked() hands straight to the engine. */
+#ifndef SHA256_OFFLOAD_MAX_CHUNKS
+#define SHA256_OFFLOAD_MAX_CHUNKS 4u
+#endif
+
+/*
+ * The callback is only obliged to keep its data valid until it is next
+ * called, so whatever it returns is copied into one of two staging buffers.
+ * The engine hashes one buffer while the next chunk is fetched (typically a
+ * flash read) and copied into the other. Staging also means the engine is
+ * only ever given whole words, whatever chunk sizes the callback produces.
+ */
+static uint8_t sha256_stage[2][SHA256_OFFLOAD_STAGE_SIZE];
+
+static bool sha256_calc_hash_callback_internal(sha256_callback_fn_t fn, void *arg,
+												uint8_t *pHash)
+{
+	hal_crypto_block_t	block[2];
+	unsigned int		stage = 0;
+	size_t				fill = 0;
+	size_t				bytes;
+	const void			*buff;
+	bool				ok;
+
+	if (!hal_crypto_sha256_begin())
+		return false;
+
+	for (ok = true; ok;)
+	{
+		buff = (fn)(arg, &bytes);
+		if (buff == NULL || bytes == 0)
+			break;
+
+		const uint8_t *p = buff;
+		while (ok && bytes)
+		{
+			/* A full stage is only handed over once there is more to come,
+			   so that the final submission is never empty. */
+			if (fill == SHA256_OFFLOAD_STAGE_SIZE)
+			{
+				/* The engine must be done with the other buffer before
+				   we start filling it. */
+				ok = HAL_CRYPTO_IDLE == hal_crypto_complete(HAL_CRYPTO_ENGINE_HASH);
+				if (!ok)
+					break;
+
+				block[stage].data = sha256_stage[stage];
+				block[stage].length = fill;
+				ok = hal_crypto_sha256_submit(&block[stage], 1, false);
+
+				stage ^= 1u;
+				fill = 0;
+				continue;
+			}
+
+			size_t n = SHA256_OFFLOAD_STAGE_SIZE - fill;
+			if (n > bytes)
+				n = bytes;
+
+			memcpy(&sha256_stage[stage][fill], p, n);
+			fill += n;
+			p += n;
+			bytes -= n;
+		}
+	}
+
+	if (ok)
+	{
+		ok = HAL_CRYPTO_IDLE == hal_crypto_complete(HAL_CRYPTO_ENGINE_HASH);
+		if (ok)
+		{
+			block[stage].data = sha256_stage[stage];
+			block[stage].length = fill;
+			ok = hal_crypto_sha256_submit(&block[stage], 1, true);
+		}
+	}
+
+	/* Always collect the result, to leave the engine free for next time. */
+	return hal_crypto_sha256_end(pHash) && ok && buff != NULL;
+}
+
+/* Hand directly addressable chunks to the engine as a single multi-block
+   DMA job, avoiding the staging copy. */
+static bool sha256_calc_hash_chunked_direct(const sha256_hash_chunk_t *chunks,
+											unsigned int nchunks,
+											uint8_t *pHash)
+{
+	hal_crypto_block_t blocks[SHA256_OFFLOAD_MAX_CHUNKS];
+
+	for (unsigned int i = 0; i < nchunks; i++)
+	{
+		blocks[i].data = chunks[i].data;
+		blocks[i].length = chunks[i].length;
+	}
+
+	sbm_benchmark_procedure_start(BENCHMARK_CALCULATE_SHA256);
+	const bool ok = hal_crypto_sha256_begin() &&
+		hal_crypto_sha256_submit(blocks, nchunks, true);
+	const bool ret = hal_crypto_sha256_end(pHash) && ok;
+	sbm_benchmark_procedure_stop(BENCHMARK_CALCULATE_SHA256);
+
+	return ret;
+}
+
+#else /* SBM_HAL_CRYPTO_OFFLOAD == 0 */
+
 static bool sha256_calc_hash_callback_internal(sha256_callback_fn_t fn, void *arg,
 												uint8_t *pHash)
 {
@@ -73,6 +189,7 @@ static bool sha256_calc_hash_callback_internal(sha256_callback_fn_t fn, void *ar
 
 	return buff != NULL;
 }
+#endif /* SBM_HAL_CRYPTO_OFFLOAD == 0 */
 
 __weak bool sha256_calc_hash_callback(sha256_callback_fn_t fn, void *arg,
 									  uint8_t *pHash)
@@ -109,6 +226,16 @@ __weak bool sha256_calc_hash_chunked(const sha256_hash_chunk_t *chunks,
 {
 	struct chunked_args a;
 
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+	bool direct = (nchunks > 0) && (nchunks <= SHA256_OFFLOAD_MAX_CHUNKS);
+	/* Like the callback, the list ends at the first empty chunk. */
+	for (unsigned int i = 0; direct && i + 1 < nchunks; i++)
+		direct = chunks[i].length != 0 && (chunks[i].length & 3u) == 0;
+
+	if (direct)
+		return sha256_calc_hash_chunked_direct(chunks, nchunks, pHash);
+#endif /* SBM_HAL_CRYPTO_OFFLOAD != 0 */
+
 	a.chunks = chunks;
 	a.nchunks = (uint16_t)nchunks;
 	a.idx = 0;
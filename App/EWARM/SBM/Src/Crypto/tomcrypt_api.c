@@ -33,6 +33,7 @@
 */
 #include <assert.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "benchmark.h"
 #include "sbm_hal.h"
@@ -41,6 +42,10 @@
 #include "tomcrypt.h"
 #include "tomcrypt_api.h"
 
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+#include "sbm_hal_crypto.h"
+#endif /* SBM_HAL_CRYPTO_OFFLOAD != 0 */
+
 /* A workaround for Tomcrypt issues - see below. */
 #ifndef AES_GCM_DECRYPT_USE_GCM_MEMORY
 #define AES_GCM_DECRYPT_USE_GCM_MEMORY 0
@@ -126,7 +131,7 @@ __weak bool aes_gcm_encrypt(const uint8_t *pInput, const uint32_t length,
     const AesKey *pAesKey, const AesGcmIv *pAesIv,
     uint8_t *pDataOut, AesTag *pTag)
 {
-	uint32_t tmpTagLength = sizeof(AesTag);
+	unsigned long tmpTagLength = sizeof(AesTag);
 	AesTag  tmpTag;
 
 	if (NULL == pTag)
@@ -142,10 +147,12 @@ __weak bool aes_gcm_encrypt(const uint8_t *pInput, const uint32_t length,
 	    (const unsigned char*)pAad, lengthAad,
 	    (unsigned char*)pInput, length,
 	    (unsigned char *)pDataOut,
-	    (unsigned char *)pTag, (long unsigned int *)&tmpTagLength,
+	    (unsigned char *)pTag, &tmpTagLength,
 	    GCM_ENCRYPT));
 }
 
+#if !defined(SBM_HAL_CRYPTO_OFFLOAD) || (SBM_HAL_CRYPTO_OFFLOAD == 0)
+
 /** Prepare for a "chunked" AES-GCM encryption or decryption operation
  *
  * \param pAesKey AES key
@@ -256,6 +263,105 @@ __weak bool aes_gcm_chunked_done(void *pContext, AesTag *pTag)
 	return rv;
 }
 
+#else /* SBM_HAL_CRYPTO_OFFLOAD != 0 */
+
+/*
+ * The chunked operations run on the CRYP engine. The engine needs to know
+ * the direction before it is given the key, so starting it is deferred to
+ * the first chunk; until then the key, IV and AAD are held here.
+ */
+typedef struct
+{
+	AesKey key;
+	AesGcmIv iv;
+	const uint8_t *pAad;	/* Must remain valid until the first chunk */
+	uint32_t lengthAad;
+	bool started;
+	bool decrypt;
+} aes_gcm_offload_ctx;
+
+static aes_gcm_offload_ctx aes_gcm_offload SBM_PERSISTENT_RAM;
+static bool aes_gcm_offload_allocated SBM_PERSISTENT_RAM;
+
+static bool aes_gcm_offload_start(aes_gcm_offload_ctx *ctx, bool decrypt)
+{
+	if (ctx->started)
+		return ctx->decrypt == decrypt;
+
+	ctx->started = true;
+	ctx->decrypt = decrypt;
+	return hal_crypto_gcm_begin(ctx->key, ctx->iv, sizeof(AesGcmIv),
+	    ctx->pAad, ctx->lengthAad, decrypt);
+}
+
+/* Each chunk waits for the engine: callers use the result straight away. */
+static bool aes_gcm_offload_process(void *pContext, const uint8_t *pInput,
+    const uint32_t length, uint8_t *pDataOut, bool decrypt)
+{
+	aes_gcm_offload_ctx *const ctx = pContext;
+
+	return aes_gcm_offload_start(ctx, decrypt) &&
+	    hal_crypto_gcm_submit(pInput, pDataOut, length) &&
+	    HAL_CRYPTO_IDLE == hal_crypto_complete(HAL_CRYPTO_ENGINE_CRYP);
+}
+
+__weak void * aes_gcm_chunked_init(const AesKey *pAesKey, const AesGcmIv *pAesIv,
+    const uint8_t *pAad, const uint32_t lengthAad)
+{
+	if (pAad == NULL && lengthAad)
+		return NULL;
+
+	assert(aes_gcm_offload_allocated == false);
+	if (aes_gcm_offload_allocated != false)
+		return NULL;
+
+	aes_gcm_offload_allocated = true;
+	memcpy(aes_gcm_offload.key, pAesKey, sizeof(AesKey));
+	memcpy(aes_gcm_offload.iv, pAesIv, sizeof(AesGcmIv));
+	aes_gcm_offload.pAad = pAad;
+	aes_gcm_offload.lengthAad = lengthAad;
+	aes_gcm_offload.started = false;
+
+	return &aes_gcm_offload;
+}
+
+__weak bool aes_gcm_chunked_decrypt(void *pContext, const uint8_t *pInput,
+    const uint32_t length, uint8_t *pDataOut)
+{
+	sbm_benchmark_procedure_start(BENCHMARK_AES_GCM_DECRYPT);
+	const bool rv = aes_gcm_offload_process(pContext, pInput, length, pDataOut, true);
+	sbm_benchmark_procedure_stop(BENCHMARK_AES_GCM_DECRYPT);
+	return rv;
+}
+
+__weak bool aes_gcm_chunked_encrypt(void *pContext, const uint8_t *pInput,
+    const uint32_t length, uint8_t *pDataOut)
+{
+	return aes_gcm_offload_process(pContext, pInput, length, pDataOut, false);
+}
+
+__weak bool aes_gcm_chunked_done(void *pContext, AesTag *pTag)
+{
+	aes_gcm_offload_ctx *const ctx = pContext;
+	AesTag  tmpTag;
+	bool rv;
+
+	if (NULL == pTag)
+		pTag = &tmpTag;
+
+	/* A message with no text still has a tag. */
+	rv = aes_gcm_offload_start(ctx, ctx->started ? ctx->decrypt : true);
+	rv = hal_crypto_gcm_end(*pTag) && rv;
+
+	/* Don't leave the key lying around in RAM. */
+	memset(ctx, 0, sizeof(*ctx));
+	aes_gcm_offload_allocated = false;
+
+	return rv;
+}
+
+#endif /* SBM_HAL_CRYPTO_OFFLOAD != 0 */
+
 /** Initialise AES-GCM back-end.
  *
  * Since we use LibTomCrypt, this boils down to ensuring the AES cipher
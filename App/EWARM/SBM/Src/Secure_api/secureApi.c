@@ -636,8 +636,17 @@ static secure_api_internal_return_t sbm_updateSlotBeginWrite(const void *const i
 		return SECURE_API_INT_OK;
 	}
 
-	/* Erase the update slot. */
-	if (HAL_MEM_SUCCESS != hal_mem_erase(activeUpdateSlot, 0, activeUpdateSlot->size))
+#if SBM_EXECUTE_IN_PLACE != 0
+	/* The running application executes from this slot. */
+	if (activeUpdateSlot == sbm_swup_xip_slot())
+	{
+		*(int8_t *) out_buf = SECURE_API_ERR_COMMAND_FAILED;
+		return SECURE_API_INT_OK;
+	}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+	/* Erase the update slot, skipping any sectors which are already blank. */
+	if (HAL_MEM_SUCCESS != hal_mem_erase_if_needed(activeUpdateSlot, 0, activeUpdateSlot->size))
 	{
 		*(int8_t *) out_buf = SECURE_API_ERR_COMMAND_FAILED;
 		return SECURE_API_INT_OK;
@@ -694,6 +703,15 @@ static secure_api_internal_return_t sbm_updateSlotWrite(const void *const in_buf
 		return SECURE_API_INT_OK;
 	}
 
+#if SBM_EXECUTE_IN_PLACE != 0
+	/* The active slot may have been changed since sbm_updateSlotBeginWrite(). */
+	if (activeUpdateSlot == sbm_swup_xip_slot())
+	{
+		*(int8_t *) out_buf = SECURE_API_ERR_COMMAND_FAILED;
+		return SECURE_API_INT_OK;
+	}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 	/*
 	 * Ensure the supplied buffer size is a multiple of the device write size
 	 * and does not exceed the bounds of the update slot.
@@ -753,10 +771,9 @@ static secure_api_internal_return_t sbm_getSBMPerformance(const void *const in_b
 
 	*p->boot_time = sbm_benchmark_boot_time();
 	datastore_calculate_sizes(p->sbm_size, p->pd_size);
-	/* The rest are unused for now ... */
-	*p->watchdog_period = *p->watchdog_max_period =
-		*p->watchdog_max_activity_start = *p->watchdog_max_activity_end =
-		*p->sbm_stack_size = *p->sbm_stack_used = UINT32_C(0);
+	sbm_benchmark_watchdog(p->watchdog_period, p->watchdog_max_period,
+						   p->watchdog_max_activity_start, p->watchdog_max_activity_end);
+	sbm_benchmark_stack(p->sbm_stack_size, p->sbm_stack_used);
 
 	/* Return success */
 	*(int8_t *) out_buf = SECURE_API_RETURN_SUCCESS;
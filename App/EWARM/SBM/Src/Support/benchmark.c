@@ -34,6 +34,7 @@
 
 #if SBM_RECORD_BOOT_TIME != 0
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 
@@ -71,6 +72,29 @@ static uint32_t total_boot_time_start SBM_EPHEMERAL_RAM;
 /** Total time used at boot stop. */
 static uint32_t total_boot_time SBM_PERSISTENT_RAM = UINT32_C(0);
 
+/** True between boot start and boot stop.
+ *
+ * Like benchmark_feature below, this is kept in persistent RAM so calls
+ * arriving through the secure API after launch leave ephemeral RAM alone.
+ */
+static bool boot_in_progress SBM_PERSISTENT_RAM = false;
+
+/** Timer value at the most recent checkpoint. */
+static uint32_t checkpoint_time SBM_EPHEMERAL_RAM;
+
+/** Watchdog figures, kept for reporting after launch. */
+static struct
+{
+    uint32_t period;         /**< Watchdog period; zero if none. */
+    uint32_t max_period;     /**< Longest interval between checkpoints. */
+    uint32_t max_start;      /**< Start of that interval, from boot start. */
+    uint32_t max_end;        /**< End of that interval, from boot start. */
+} watchdog SBM_PERSISTENT_RAM = { 0 };
+
+/** SBM stack size and high-water mark at boot stop. */
+static uint32_t stack_size SBM_PERSISTENT_RAM = UINT32_C(0);
+static uint32_t stack_used SBM_PERSISTENT_RAM = UINT32_C(0);
+
 void sbm_benchmark_boot_start(void)
 {
 #ifdef EMIT_EVENTS
@@ -78,6 +102,27 @@ void sbm_benchmark_boot_start(void)
 #endif /* EMIT_EVENTS */
 
     total_boot_time_start = hal_timer_get();
+    checkpoint_time = total_boot_time_start;
+    boot_in_progress = true;
+}
+
+void sbm_benchmark_checkpoint(void)
+{
+    if (!boot_in_progress)
+    {
+        return;
+    }
+
+    const uint32_t now = hal_timer_get();
+
+    if (now - checkpoint_time > watchdog.max_period)
+    {
+        watchdog.max_period = now - checkpoint_time;
+        watchdog.max_start = checkpoint_time - total_boot_time_start;
+        watchdog.max_end = now - total_boot_time_start;
+    }
+
+    checkpoint_time = now;
 }
 
 #if SBM_BENCHMARKING != 0
@@ -98,6 +143,13 @@ void sbm_benchmark_boot_stop(void)
 
     total_boot_time = hal_timer_get() - total_boot_time_start;
 
+    sbm_benchmark_checkpoint();
+    boot_in_progress = false;
+
+    watchdog.period = hal_watchdog_period();
+    stack_size = cpu_stack_size();
+    stack_used = cpu_stack_used();
+
 #if SBM_BENCHMARKING != 0
     /* When we reach this point, we must suspend benchmarking ... */
     benchmark_feature = BENCHMARK_FEATURES_MAX;
@@ -131,18 +183,35 @@ void sbm_benchmark_boot_stop(void)
  *                                             total per feature.
  * \endcode
  *
- * Each cell holds the time at which timing was started
- * and accumulated execution time so far.
+ * Each cell holds the time at which timing was started,
+ * accumulated execution time so far and the longest single activity.
  */
 static struct
 {
     uint32_t accumulated; /**< Total time accumulated so far. */
     uint32_t started;     /**< Time at start of activity. */
+    uint32_t longest;     /**< Longest single activity. */
 #ifdef USE_HIT_COUNT
     uint32_t hits;
 #endif /* USE_HIT_COUNT */
 } activity_times[BENCHMARK_NUM_FEATURES][BENCHMARK_NUM_PROCEDURES + 2] SBM_EPHEMERAL_RAM;
 
+/** Account for the end of an activity of the current feature.
+ *
+ * \param column Procedure, or BENCHMARK_NUM_PROCEDURES for the feature total.
+ */
+static void benchmark_activity_stop(unsigned int column)
+{
+    const uint32_t elapsed =
+        hal_timer_get() - activity_times[benchmark_feature - 1][column].started;
+
+    activity_times[benchmark_feature - 1][column].accumulated += elapsed;
+    if (elapsed > activity_times[benchmark_feature - 1][column].longest)
+    {
+        activity_times[benchmark_feature - 1][column].longest = elapsed;
+    }
+}
+
 void sbm_benchmark_feature_start(benchmark_feature_t feature)
 {
     /* If we've stopped measuring the total boot time, return immediately ... */
@@ -155,6 +224,8 @@ void sbm_benchmark_feature_start(benchmark_feature_t feature)
     ITM_EVENT8(BENCHMARK_EVENT_FEATURE_START_CH, feature);
 #endif /* EMIT_EVENTS */
 
+    sbm_benchmark_checkpoint();
+
     benchmark_feature = feature; /* Remember what we're doing at the moment. */
 
     activity_times[benchmark_feature - 1][BENCHMARK_NUM_PROCEDURES].started = hal_timer_get();
@@ -199,8 +270,8 @@ void sbm_benchmark_feature_stop(benchmark_feature_t feature)
     ITM_EVENT8(BENCHMARK_EVENT_FEATURE_STOP_CH, feature);
 #endif /* EMIT_EVENTS */
 
-    activity_times[benchmark_feature - 1][BENCHMARK_NUM_PROCEDURES].accumulated +=
-        hal_timer_get() - activity_times[benchmark_feature - 1][BENCHMARK_NUM_PROCEDURES].started;
+    benchmark_activity_stop(BENCHMARK_NUM_PROCEDURES);
+    sbm_benchmark_checkpoint();
 
     benchmark_feature = BENCHMARK_FEATURE_NONE;
 }
@@ -219,8 +290,7 @@ void sbm_benchmark_procedure_stop(benchmark_procedure_t procedure)
     ITM_EVENT8(BENCHMARK_EVENT_PROCEDURE_STOP_CH, procedure);
 #endif /* EMIT_EVENTS */
 
-    activity_times[benchmark_feature - 1][procedure].accumulated +=
-        hal_timer_get() - activity_times[benchmark_feature - 1][procedure].started;
+    benchmark_activity_stop(procedure);
 }
 
 #if SBM_LOG_VERBOSITY >= SBM_LOG_LEVEL_INFO
@@ -244,24 +314,29 @@ void sbm_benchmark_report(void)
             if (activity_times[feature][procedure].accumulated)
             {
 #ifdef USE_HIT_COUNT
-                sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "%s, %s, %" PRIu32 ", %" PRIu32 "\n",
+                sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "%s, %s, %" PRIu32 ", %" PRIu32 ", %" PRIu32 "\n",
 #else /* USE_HIT_COUNT */
-                sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "%s, %s, %" PRIu32 "\n",
+                sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "%s, %s, %" PRIu32 ", %" PRIu32 "\n",
 #endif /* USE_HIT_COUNT */
                        feature_string[feature + 1],
                        BENCHMARK_NUM_PROCEDURES == procedure
                            ? "" : procedure_string[procedure],
-#ifdef USE_HIT_COUNT
                        activity_times[feature][procedure].accumulated,
+#ifdef USE_HIT_COUNT
+                       activity_times[feature][procedure].longest,
                        activity_times[feature][procedure].hits);
 #else /* USE_HIT_COUNT */
-                       activity_times[feature][procedure].accumulated);
+                       activity_times[feature][procedure].longest);
 #endif /* USE_HIT_COUNT */
             }
         }
     }
 
     sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "TOTAL_BOOT, %" PRIu32 "\n", total_boot_time);
+    sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "LONGEST_ACTIVITY, %" PRIu32 ", %" PRIu32 "-%" PRIu32 "\n",
+            watchdog.max_period, watchdog.max_start, watchdog.max_end);
+    sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "STACK, %" PRIu32 "/%" PRIu32 "\n",
+            stack_used, stack_size);
     if (BENCHMARK_FEATURES_MAX != benchmark_feature)
     {
         sbm_log(SBM_LOG_LEVEL_INFO, "benchmark", "warning: report incomplete\n");
@@ -277,4 +352,19 @@ uint32_t sbm_benchmark_boot_time(void)
     return total_boot_time;
 }
 
+void sbm_benchmark_watchdog(uint32_t *period, uint32_t *max_period,
+                            uint32_t *max_activity_start, uint32_t *max_activity_end)
+{
+    *period = watchdog.period;
+    *max_period = watchdog.max_period;
+    *max_activity_start = watchdog.max_start;
+    *max_activity_end = watchdog.max_end;
+}
+
+void sbm_benchmark_stack(uint32_t *size, uint32_t *used)
+{
+    *size = stack_size;
+    *used = stack_used;
+}
+
 #endif /* SBM_RECORD_BOOT_TIME != 0 */
@@ -54,6 +54,7 @@
 #include "swup_tlv.h"
 #include "swup_oem.h"
 #include "swup_muh.h"
+#include "benchmark.h"
 #include "dataStore.h"
 #include "ecc.h"
 #include "ecies_crypto.h"
@@ -81,7 +82,24 @@
 
 /* Installed module capability flags and masks ... */
 #define IAVVCS_CAP_MUF_SUPPLIED UINT16_C(1) /**< Bit 0: MUF supplied. */
+#define IAVVCS_CAP_XIP_SUPPLIED UINT16_C(2) /**< Bit 1: image executes in place at pie_module_sbm_exec_info_t.xip_image_address. */
+#if SBM_EXECUTE_IN_PLACE != 0
+#define IAVVCS_CAP_RESERVED_MASK UINT16_C(0xFFFC) /**< Reserved: must be all zero bits. */
+#else
 #define IAVVCS_CAP_RESERVED_MASK UINT16_C(0xFFFE) /**< Reserved: must be all zero bits. */
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+#if SBM_EXECUTE_IN_PLACE != 0
+#if SBM_SUPPORT_ENCRYPTED_UPDATES != 0
+#error Execute in place requires SBM_SUPPORT_ENCRYPTED_UPDATES == 0
+#endif /* SBM_SUPPORT_ENCRYPTED_UPDATES != 0 */
+
+/* Application images executed in place must start on this boundary
+   (the vector table alignment required by the CPU) */
+#ifndef SBM_XIP_IMAGE_ALIGNMENT
+#define SBM_XIP_IMAGE_ALIGNMENT 1024U
+#endif /* SBM_XIP_IMAGE_ALIGNMENT */
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
 
 /* Possible values of SBM_BOOT_INTEGRITY_CHECKING delivered by Security Manager ... */
 
@@ -159,6 +177,78 @@ static_assert(sizeof(pie_module_t) <= MAX_DECRYPT_SIZE, "pie_module_t size > MAX
 static uint8_t plain_eub_buffer[MAX_DECRYPT_SIZE] SBM_EPHEMERAL_RAM;
 static uint8_t plain_iavvcs_buffer[MAX_DECRYPT_SIZE] SBM_EPHEMERAL_RAM;
 
+#if SBM_EXECUTE_IN_PLACE != 0
+bool sbm_swup_slot_executes_in_place(const memory_slot *slot)
+{
+	const memory_device *const device = get_device_from_slot(slot);
+	if (NULL == device || !hal_mem_device_present(device))
+	{
+		return false;
+	}
+
+	return SOC_RAM_DRV == device->memory_drv ||
+	       EXT_MEM_MAPPED_DRV == device->memory_drv;
+}
+
+/** Find the update slot holding the image an IAVVCS says executes in place.
+ *
+ * \param[in] piem The IAVVCS to examine.
+ *
+ * \return The update slot containing the whole image (binary and footer),
+ *         or \c NULL if the IAVVCS does not describe an image executing in
+ *         place or no such slot exists.
+ */
+static const memory_slot *xip_slot_from_iavvcs(const pie_module_t *const piem)
+{
+	const pie_module_sbm_exec_info_t *const sei = (const pie_module_sbm_exec_info_t *) piem->header.sbm_exec_info;
+
+	if (!(sei->iavvcs_capability_flags & IAVVCS_CAP_XIP_SUPPLIED) ||
+	    piem->header.footer_offset < sizeof(pie_module_t))
+	{
+		return NULL;
+	}
+
+	const uintptr_t image_start = sei->xip_image_address;
+	const uintptr_t image_end = image_start + (piem->header.footer_offset - sizeof(pie_module_t)) + sizeof(pie_module_footer_t);
+
+	for (unsigned int i = 0U; i < NUM_UPDATE_SLOTS; ++i)
+	{
+		const memory_slot *const slot = &update_slots[i];
+		if (image_start >= slot->start_address &&
+		    image_end > image_start &&
+		    image_end <= slot->start_address + slot->size &&
+		    sbm_swup_slot_executes_in_place(slot))
+		{
+			return slot;
+		}
+	}
+
+	return NULL;
+}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+/** Get the address of the application image described by an IAVVCS.
+ *
+ * \param[in] piem The IAVVCS to examine.
+ *
+ * \return The start of the image in the update slot if it executes in place,
+ *         otherwise the start of the executable slot.
+ */
+static uintptr_t exec_image_address(const pie_module_t *const piem)
+{
+#if SBM_EXECUTE_IN_PLACE != 0
+	if (xip_slot_from_iavvcs(piem) != NULL)
+	{
+		const pie_module_sbm_exec_info_t *const sei = (const pie_module_sbm_exec_info_t *) piem->header.sbm_exec_info;
+		return sei->xip_image_address;
+	}
+#else
+	(void) piem;
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+	return exec_slot.start_address;
+}
+
 /** Establish the status of the module within the executable slot using
  * the specified PIEM.
  *
@@ -239,6 +329,18 @@ static bool sbm_executable_slot_module_valid_with_iavvcs(const pie_module_t *con
 		return false;
 	}
 
+#if SBM_EXECUTE_IN_PLACE != 0
+	if ((sei->iavvcs_capability_flags & IAVVCS_CAP_XIP_SUPPLIED) &&
+	    NULL == xip_slot_from_iavvcs(piem))
+	{
+		SBM_LOG_UPDATE_INFO("execute in place image at 0x%" PRIxPTR " not within an update slot\n",
+				 (uintptr_t) sei->xip_image_address);
+		return false;
+	}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+	const uintptr_t image_address = exec_image_address(piem);
+
 #if SBM_BOOT_INTEGRITY_CHECKING > SBM_BOOT_INTEGRITY_NONE
 	/* We must copy the PIEM from the MUH into a local buffer and zero the rest
 	   of the buffer (to nobble the fabricated pie_module_sbm_exec_info_t
@@ -252,7 +354,7 @@ static bool sbm_executable_slot_module_valid_with_iavvcs(const pie_module_t *con
 
 #if SBM_BOOT_INTEGRITY_CHECKING == SBM_BOOT_INTEGRITY_CHECKSUM
 	uint16_t lcs = swup_checksum(0, checked_piem, sizeof *checked_piem);
-	lcs = swup_checksum(lcs, (void *) exec_slot.start_address, piem->header.footer_offset - sizeof *piem);
+	lcs = swup_checksum(lcs, (void *) image_address, piem->header.footer_offset - sizeof *piem);
 	/* This section only spans the version number but this
 	   way of calculating the size is more general (i.e. future
 	   proof) than sizeof *piemf->version_number ... */
@@ -272,7 +374,7 @@ static bool sbm_executable_slot_module_valid_with_iavvcs(const pie_module_t *con
 			.length = sizeof *checked_piem
 		},
 		{
-			.data = (const void *) exec_slot.start_address,
+			.data = (const void *) image_address,
 			.length = piem->header.footer_offset - sizeof *piem
 		},
 		{
@@ -550,7 +652,26 @@ unsigned int sbm_swup_install_module(const memory_slot *update_slot, hal_mem_add
 		/* Find the length of the binary and footer which will be copied to the executable slot ... */
 		const size_t exec_length = payload_length - EUB_MODULE_HEADER_SIZE;
 
-		if (payload_length < EUB_MODULE_HEADER_SIZE || exec_length > exec_slot.size)
+#if SBM_EXECUTE_IN_PLACE != 0
+		/* An image in a directly addressable update slot is run from there
+		   rather than being copied into the executable slot */
+		const bool in_place = sbm_swup_slot_executes_in_place(update_slot);
+		const uintptr_t image_address = in_place ?
+		                                update_slot->start_address + payload_start + EUB_MODULE_HEADER_SIZE :
+		                                exec_slot.start_address;
+
+		if (in_place && (image_address % SBM_XIP_IMAGE_ALIGNMENT) != 0U)
+		{
+			SBM_LOG_UPDATE_ERROR("EUB %u image at 0x%" PRIxPTR " not aligned for execution in place\n", i,
+			                     image_address);
+			return SWUP_INSTALL_STATUS_FAILURE;
+		}
+#else
+		const bool in_place = false;
+		const uintptr_t image_address = exec_slot.start_address;
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
+		if (payload_length < EUB_MODULE_HEADER_SIZE || (!in_place && exec_length > exec_slot.size))
 		{
 			SBM_LOG_UPDATE_ERROR("EUB %u abnormal EUB payload length: 0x%" PRIx32 "\n", i,
 					   (uint32_t) payload_length);
@@ -566,8 +687,9 @@ unsigned int sbm_swup_install_module(const memory_slot *update_slot, hal_mem_add
 			                     (int)mem_result);
 			return SWUP_INSTALL_STATUS_BRICKED;
 		}
-		/* Clear enough of the executable slot to recieve the binary and footer ... */
-		mem_result = hal_mem_erase(&exec_slot, 0, exec_length);
+		/* Clear enough of the executable slot to recieve the binary and footer
+		   (sectors which are already blank are left alone) ... */
+		mem_result = in_place ? HAL_MEM_SUCCESS : hal_mem_erase_if_needed(&exec_slot, 0, exec_length);
 		if (HAL_MEM_SUCCESS != mem_result)
 		{
 			SBM_LOG_UPDATE_ERROR("Failed to erase EXEC at 0x%" PRIxPTR " (%u bytes), result: %d\n",
@@ -597,6 +719,16 @@ unsigned int sbm_swup_install_module(const memory_slot *update_slot, hal_mem_add
 
 		pie_module_t *const iavvcs = (pie_module_t *) plain_iavvcs_buffer;
 
+#if SBM_EXECUTE_IN_PLACE != 0
+		if (in_place)
+		{
+			/* The image stays where it is so only the module header is needed */
+			swup_read(update_slot, payload_start, max_offset, plain_eub_buffer, EUB_MODULE_HEADER_SIZE);
+			iavvcs->header = ((const pie_module_t *) plain_eub_buffer)->header;
+			payload_length = 0U;
+		}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 		/* Split the EUB payload into manageable chunks. */
 
 		for (unsigned int block_no = 0U; payload_length; ++block_no)
@@ -651,6 +783,8 @@ unsigned int sbm_swup_install_module(const memory_slot *update_slot, hal_mem_add
 
 			payload_start += block_size; /* Address the next chunk of EUB. */
 			payload_length -= block_size; /* How much we still need to do. */
+
+			sbm_benchmark_checkpoint();
 		}
 
 		/* Finish off the decryption */
@@ -683,12 +817,30 @@ unsigned int sbm_swup_install_module(const memory_slot *update_slot, hal_mem_add
 		sei->iavvcs_capability_indicator = EXPECTED_IAVVCS_CAPABILITY;
 		sei->iavvcs_capability_flags = IAVVCS_CAP_MUF_SUPPLIED;
 
+#if SBM_EXECUTE_IN_PLACE != 0
+		if (in_place)
+		{
+			sei->iavvcs_capability_flags |= IAVVCS_CAP_XIP_SUPPLIED;
+			sei->xip_image_address = image_address;
+
+			/* The footer offset is unchecked until now: it must keep the
+			   whole image within the update slot before the MUF is read */
+			if (xip_slot_from_iavvcs(iavvcs) != update_slot)
+			{
+				SBM_LOG_UPDATE_ERROR("EUB %u footer offset 0x%" PRIx32 " outside update slot\n", i,
+				                     iavvcs->header.footer_offset);
+				return SWUP_INSTALL_STATUS_BRICKED;
+			}
+		}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 		/* Make a copy of the MUF from the freshly decrypted executable slot ... */
-		sei->installed_muf = *((pie_module_footer_t *) (exec_slot.start_address - sizeof(pie_module_t) + iavvcs->header.footer_offset));
+		sei->installed_muf = *((pie_module_footer_t *) (image_address - sizeof(pie_module_t) + iavvcs->header.footer_offset));
 
 #if SBM_SUPPORT_ENCRYPTED_UPDATES == 0
+		/* An image executing in place is always verified now as it is never copied */
 		const memory_device *device = get_device_from_slot(update_slot);
-		if ((device != NULL) && device->removable)
+		if (in_place || ((device != NULL) && device->removable))
 		{
 			if (sbm_executable_slot_module_valid_with_iavvcs(iavvcs))
 			{
@@ -801,13 +953,32 @@ bool sbm_swup_get_executable_module_info(app_info_record *const info)
 	/* Write the relevant information */
 	info->app_type = 0U; /* Always 0 for v1.10, there is only the master application */
 	info->installed = 1U; /* Always 1 for v1.10, only the installed application */
-	info->start_addr = (uint32_t) exec_slot.start_address;
+	info->start_addr = (uint32_t) exec_image_address(piem);
 	info->end_addr = info->start_addr + piem->header.footer_offset - sizeof *piem - 1U;
 	info->app_version = piemf->version_number;
 
 	return true;
 }
 
+uintptr_t sbm_swup_exec_image_address(void)
+{
+	return exec_image_address(PIEM);
+}
+
+#if SBM_EXECUTE_IN_PLACE != 0
+const memory_slot *sbm_swup_xip_slot(void)
+{
+	return xip_slot_from_iavvcs(PIEM);
+}
+
+bool sbm_swup_lock_xip_slot(void)
+{
+	const memory_slot *const slot = sbm_swup_xip_slot();
+
+	return NULL == slot || HAL_MEM_SUCCESS == hal_mem_write_protect(slot);
+}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 void sbm_swup_init(void)
 {
 	/* Select flash driver for handling MUH slot */
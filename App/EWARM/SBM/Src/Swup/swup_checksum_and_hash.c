@@ -29,6 +29,7 @@
 *******************************************************************************/
 #include "swup_checksum_and_hash.h"
 
+#include "benchmark.h"
 #include "memory_devices_and_slots.h"
 #include "sha256_wrapper.h"
 #include "sbm_hal_mem.h"
@@ -85,6 +86,8 @@ static const void *swup_hash_callback(void *arg, size_t *pbytes)
 		a->bytes -= bytes;
 
 		a->sum = swup_checksum(a->sum, a->buffer, bytes);
+
+		sbm_benchmark_checkpoint();
 	}
 
 	/* Inform the caller of the next chunk's details. */
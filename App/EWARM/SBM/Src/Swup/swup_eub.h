@@ -120,6 +120,10 @@ typedef struct {
 	uint16_t iavvcs_capability_indicator;
 	uint16_t iavvcs_capability_flags; /**< What elements follow. */
 	pie_module_footer_t installed_muf; /**< Copy of module update footer. */
+#if SBM_EXECUTE_IN_PLACE != 0
+	/* Only with execute in place, so that the IAVVCS layout of other builds is unchanged */
+	uintptr_t xip_image_address; /**< Address of the image when it executes in place in an update slot. */
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
 } pie_module_sbm_exec_info_t;
 
 #endif /* SWUP_EUB_H */
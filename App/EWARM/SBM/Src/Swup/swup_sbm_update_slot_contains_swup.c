@@ -54,6 +54,7 @@
 #include "static.h"
 #include "memory_devices_and_slots.h"
 #include "sbm_log_update_status.h"
+#include "swup.h"
 
 /** Perform cheap (computationally inexpensive) sanity checks of a potential
  * SWUP in the update slot, providing a quick Go/NoGo indication to minimise
@@ -717,13 +718,22 @@ static unsigned int swup_validation_check_clear_eubs(const memory_slot *update_s
 
 		/* The EUB must be big enough to hold a module header and footer
 		   but not so big that it won't fit into the executable slot
-		   (after we allow for the header being copied elsewhere) */
+		   (after we allow for the header being copied elsewhere).
+		   An image executing in place is never copied so only the
+		   SWUP length limits it. */
 
 		swup_read(update_slot, eub_clear_next + SWUP_OFFSET_EUB_CLEAR_PAYLOAD_LENGTH,
 				  max_offset, &u.payload_length, sizeof u.payload_length);
 
+#if SBM_EXECUTE_IN_PLACE != 0
+		const size_t max_exec_length = sbm_swup_slot_executes_in_place(update_slot) ?
+		                               update_slot->size : exec_slot.size;
+#else
+		const size_t max_exec_length = exec_slot.size;
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 		if (u.payload_length < sizeof(pie_module_t) + sizeof(pie_module_footer_t) ||
-			u.payload_length - sizeof(pie_module_t) > exec_slot.size)
+			u.payload_length - sizeof(pie_module_t) > max_exec_length)
 		{
 			SBM_LOG_UPDATE_ERROR("EUB CD %u bogus payload_length 0x%" PRIx32 "\n", eub_idx, u.payload_length);
 			return SWUP_STATUS_ERROR_CODE(SWUP_STATUS_ERROR_BAD_EUB_PAYLOAD_LEN);
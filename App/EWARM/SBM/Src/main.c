@@ -485,6 +485,17 @@ int main(void)
 	oem_boot_status(OEM_BOOT_STAGE_EXAMINING_IMAGE);
 #endif
 
+#if SBM_EXECUTE_IN_PLACE != 0
+	/* An application executing from its update slot must not be able to
+	   rewrite itself behind our back. Lock the slot before it is
+	   checked, so what is checked is what runs */
+	if (!sbm_swup_lock_xip_slot())
+	{
+		SBM_LOG_BOOT_STATUS_ERROR("Failed to write protect execute in place slot\n");
+		launch_fail();
+	}
+#endif /* SBM_EXECUTE_IN_PLACE != 0 */
+
 #if NUM_UPDATE_SLOTS > 0
 	/* Skip verification if it was already done during installation */
 	if (install_result_final != SWUP_INSTALL_STATUS_SUCCESS_VERIFIED)
@@ -538,7 +549,7 @@ int main(void)
 
 	SBM_LOG_DISABLE();
 
-	hal_run_application(exec_slot.start_address);
+	hal_run_application(sbm_swup_exec_image_address());
 
 	/* Should never return but, just in case... */
 
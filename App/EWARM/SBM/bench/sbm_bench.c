@@ -0,0 +1,445 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief Host micro-benchmark for SBM primitives.
+ *
+ * Times the hashing, decryption, signature and lookup functions on the
+ * SBM's boot and update paths over a range of input sizes and writes the
+ * results to stdout as JSON. Each result gives the cost per operation in
+ * cycles, the cost per input byte, the achieved operations per second and
+ * the peak stack used by a single operation.
+ *
+ * Cycles are read from the x86 time stamp counter where there is one and
+ * are otherwise nanoseconds; the "counter" member of the output says which.
+ *
+ * The optional argument is the minimum time, in milliseconds, to spend on
+ * each measurement (default 50).
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#else
+#define BENCH_HAVE_TSC 0
+#endif
+
+#include "aesgcm_types.h"
+#include "dataStore.h"
+#include "dataStore_types.h"
+#include "ecc.h"
+#include "memory_devices_and_slots.h"
+#include "sbm_api.h"
+#include "sbm_hal_crypto.h"
+#include "sbm_hal_mem.h"
+#include "sha256_wrapper.h"
+#include "swup_checksum_and_hash.h"
+#include "tomcrypt_api.h"
+
+/** Largest input used by the size-scaled benchmarks. */
+#define BENCH_MAX_BYTES 65536u
+
+/** Size of the stack each operation is run on when measuring stack use. */
+#define BENCH_STACK_SIZE (64u * 1024u)
+
+/** Value painted over the measurement stack before an operation runs. */
+#define BENCH_STACK_PAINT 0xa5u
+
+/** Iterations to run before each timed measurement. */
+#define BENCH_WARMUP 3u
+
+/** Address of the Provisioning Summary Record used by dataStore.c. */
+void *pd_offset_reg;
+
+typedef void (*bench_fn)(size_t size);
+
+typedef struct
+{
+	const char *name;
+	bench_fn fn;
+	bench_fn setup;
+	const size_t *sizes;
+	size_t nsizes;
+	const char *unit; /**< What size counts: input bytes or list entries. */
+} bench_case;
+
+static uint8_t bench_in[BENCH_MAX_BYTES];
+static uint8_t bench_out[BENCH_MAX_BYTES];
+static volatile uint32_t bench_sink;
+
+static const size_t byte_sizes[] = { 16u, 64u, 256u, 1024u, 4096u, 16384u, 65536u };
+static const size_t ecc_sizes[] = { 32u };
+static const size_t tlv_sizes[] = { 4u, 16u, 64u, 256u, 1024u };
+static const size_t slot_sizes[] = { 4u, 16u, 64u, 127u };
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/* ---- Clocks ------------------------------------------------------------ */
+
+static uint64_t bench_ns(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t) ts.tv_sec * UINT64_C(1000000000)) + (uint64_t) ts.tv_nsec;
+}
+
+static uint64_t bench_cycles(void)
+{
+#if BENCH_HAVE_TSC != 0
+	return __rdtsc();
+#else
+	return bench_ns();
+#endif
+}
+
+/* ---- Primitives under test ---------------------------------------------- */
+
+static void run_sha256(size_t size)
+{
+	uint8_t hash[32];
+
+	(void) sha256_calc_hash(bench_in, (uint32_t) size, hash);
+	bench_sink += hash[0];
+}
+
+static const AesKey gcm_key = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const AesGcmIv gcm_iv = {
+	0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad,
+	0xde, 0xca, 0xf8, 0x88, 0x00, 0x00, 0x00, 0x00
+};
+
+static void run_gcm_decrypt(size_t size)
+{
+	AesTag tag;
+	void *const ctx = aes_gcm_chunked_init(&gcm_key, &gcm_iv, NULL, 0u);
+
+	if (NULL == ctx)
+	{
+		return;
+	}
+
+	(void) aes_gcm_chunked_decrypt(ctx, bench_in, (uint32_t) size, bench_out);
+	(void) aes_gcm_chunked_done(ctx, &tag);
+	bench_sink += tag[0];
+}
+
+static uint8_t ecc_private[32];
+static uint8_t ecc_public[64];
+static uint8_t ecc_peer_public[64];
+static uint8_t ecc_hash[32];
+static uint8_t ecc_signature[64];
+
+static void setup_ecc(size_t size)
+{
+	uint8_t peer_private[32];
+
+	(void) size;
+	(void) sha256_calc_hash("sbm_bench", 9u, ecc_hash);
+	if (!uECC_make_key(ecc_public, ecc_private, uECC_CURVE()) ||
+		!uECC_make_key(ecc_peer_public, peer_private, uECC_CURVE()) ||
+		!uECC_sign(ecc_private, ecc_hash, sizeof ecc_hash, ecc_signature, uECC_CURVE()))
+	{
+		fprintf(stderr, "sbm_bench: ECC key setup failed\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+static void run_ecc_verify(size_t size)
+{
+	bench_sink += (uint32_t) uECC_verify(ecc_public, ecc_hash, (unsigned) size, ecc_signature, uECC_CURVE());
+}
+
+static void run_ecc_sign(size_t size)
+{
+	uint8_t signature[64];
+
+	bench_sink += (uint32_t) uECC_sign(ecc_private, ecc_hash, (unsigned) size, signature, uECC_CURVE());
+}
+
+static void run_ecc_shared_secret(size_t size)
+{
+	uint8_t secret[32];
+
+	(void) size;
+	bench_sink += (uint32_t) uECC_shared_secret(ecc_peer_public, ecc_private, secret, uECC_CURVE());
+}
+
+/** Bytes of payload carried by each node of the benchmark TLV lists. */
+#define TLV_PAYLOAD 12u
+
+static uint16_t tlv_bytes;
+static uint16_t tlv_target;
+
+/** Build a list of \a size nodes and search for the last of them. */
+static void setup_tlv(size_t size)
+{
+	uint8_t *p = bench_in;
+
+	for (size_t i = 0u; i < size; i++)
+	{
+		tlv_node *const n = (tlv_node *) p;
+
+		n->t = (uint16_t) (i + 1u);
+		n->l = TLV_PAYLOAD;
+		(void) memset(n->v, (int) i, TLV_PAYLOAD);
+		p += sizeof *n + TLV_PAYLOAD;
+	}
+	((tlv_node *) p)->t = TLV_END_MARKER;
+	((tlv_node *) p)->l = 0u;
+
+	tlv_bytes = (uint16_t) (p - bench_in);
+	tlv_target = (uint16_t) size;
+}
+
+static void run_tlv_find_node(size_t size)
+{
+	const uint8_t *field;
+	uint16_t len;
+
+	(void) size;
+	if (0 == tlv_find_node(bench_in, tlv_bytes, tlv_target, &field, &len))
+	{
+		bench_sink += len;
+	}
+}
+
+/** Build provisioned data with \a size key slots, only the last matching. */
+static void setup_datastore(size_t size)
+{
+	psr *const summary = (psr *) bench_in;
+	pdsh_usage *const sh = (pdsh_usage *) (bench_in + sizeof *summary);
+
+	(void) memset(bench_in, 0, sizeof *summary + (size * sizeof *sh));
+	summary->presence = 0xffffu ^ 0x8888u;
+	summary->data_slots = (uint16_t) size;
+	summary->pdsh_offset = sizeof *summary;
+
+	for (size_t i = 0u; i < size; i++)
+	{
+		sh[i].sh_type = (uint16_t) (0x0100u + (i & 0xffu));
+		sh[i].usage = 1u;
+	}
+	sh[size - 1u].usage = 2u;
+
+	pd_offset_reg = bench_in;
+}
+
+static void run_datastore_find(size_t size)
+{
+	(void) size;
+	bench_sink += (uint32_t) datastore_find(0u, 2u, 0u, 0u);
+}
+
+static void run_swup_checksum(size_t size)
+{
+	bench_sink += swup_checksum(0u, bench_in, size);
+}
+
+/** Erase the start of the update slot. */
+static void setup_slot_erased(size_t size)
+{
+	(void) hal_mem_erase(&update_slots[0], 0u, size);
+}
+
+/** Program the start of the update slot with the input pattern. */
+static void setup_slot_programmed(size_t size)
+{
+	setup_slot_erased(size);
+	(void) hal_mem_program(&update_slots[0], 0u, bench_in, size);
+}
+
+static void run_verify_erased(size_t size)
+{
+	bench_sink += (uint32_t) hal_mem_verify_erased(&update_slots[0], 0u, size);
+}
+
+static void run_verify(size_t size)
+{
+	bench_sink += (uint32_t) hal_mem_verify(&update_slots[0], 0u, bench_in, size);
+}
+
+static const bench_case bench_cases[] = {
+	{ "sha256_calc_hash", run_sha256, NULL, byte_sizes, ARRAY_SIZE(byte_sizes), "bytes" },
+	{ "aes_gcm_chunked_decrypt", run_gcm_decrypt, NULL, byte_sizes, ARRAY_SIZE(byte_sizes), "bytes" },
+	{ "uECC_verify", run_ecc_verify, setup_ecc, ecc_sizes, ARRAY_SIZE(ecc_sizes), "bytes" },
+	{ "uECC_sign", run_ecc_sign, setup_ecc, ecc_sizes, ARRAY_SIZE(ecc_sizes), "bytes" },
+	{ "uECC_shared_secret", run_ecc_shared_secret, setup_ecc, ecc_sizes, ARRAY_SIZE(ecc_sizes), "bytes" },
+	{ "tlv_find_node", run_tlv_find_node, setup_tlv, tlv_sizes, ARRAY_SIZE(tlv_sizes), "nodes" },
+	{ "datastore_find", run_datastore_find, setup_datastore, slot_sizes, ARRAY_SIZE(slot_sizes), "slots" },
+	{ "swup_checksum", run_swup_checksum, NULL, byte_sizes, ARRAY_SIZE(byte_sizes), "bytes" },
+	{ "hal_mem_verify_erased", run_verify_erased, setup_slot_erased, byte_sizes, ARRAY_SIZE(byte_sizes), "bytes" },
+	{ "hal_mem_verify", run_verify, setup_slot_programmed, byte_sizes, ARRAY_SIZE(byte_sizes), "bytes" },
+};
+
+/* ---- Stack high-water ---------------------------------------------------- */
+
+static ucontext_t bench_main_ctx;
+static ucontext_t bench_op_ctx;
+static uint8_t bench_stack[BENCH_STACK_SIZE] __attribute__((aligned(16)));
+static bench_fn bench_stack_fn;
+static size_t bench_stack_arg;
+
+static void bench_stack_trampoline(void)
+{
+	bench_stack_fn(bench_stack_arg);
+}
+
+/** Run one operation on a painted stack and return the bytes it touched. */
+static size_t bench_stack_usage(bench_fn fn, size_t size)
+{
+	(void) memset(bench_stack, BENCH_STACK_PAINT, sizeof bench_stack);
+
+	bench_stack_fn = fn;
+	bench_stack_arg = size;
+	(void) getcontext(&bench_op_ctx);
+	bench_op_ctx.uc_stack.ss_sp = bench_stack;
+	bench_op_ctx.uc_stack.ss_size = sizeof bench_stack;
+	bench_op_ctx.uc_link = &bench_main_ctx;
+	makecontext(&bench_op_ctx, bench_stack_trampoline, 0);
+	(void) swapcontext(&bench_main_ctx, &bench_op_ctx);
+
+	/* The stack grows down: the first disturbed byte marks the high-water. */
+	size_t untouched = 0u;
+	while ((untouched < sizeof bench_stack) && (BENCH_STACK_PAINT == bench_stack[untouched]))
+	{
+		untouched++;
+	}
+
+	return sizeof bench_stack - untouched;
+}
+
+/* ---- Driver -------------------------------------------------------------- */
+
+static void bench_run(const bench_case *c, size_t size, uint64_t min_ns, bool *first)
+{
+	for (unsigned i = 0u; i < BENCH_WARMUP; i++)
+	{
+		c->fn(size);
+	}
+
+	/* Double the batch until it runs long enough to time reliably. */
+	uint64_t iterations = 1u;
+	uint64_t ns;
+	uint64_t cycles;
+	for (;;)
+	{
+		const uint64_t ns0 = bench_ns();
+		const uint64_t c0 = bench_cycles();
+		for (uint64_t i = 0u; i < iterations; i++)
+		{
+			c->fn(size);
+		}
+		cycles = bench_cycles() - c0;
+		ns = bench_ns() - ns0;
+
+		if ((ns >= min_ns) || (iterations >= (UINT64_C(1) << 40)))
+		{
+			break;
+		}
+		iterations *= 2u;
+	}
+
+	const size_t stack = bench_stack_usage(c->fn, size);
+	const double per_op = (double) cycles / (double) iterations;
+	const double bytes = (0 == strcmp(c->unit, "bytes")) ? (double) size : 0.0;
+
+	printf("%s\n    {\"name\": \"%s\", \"size\": %zu, \"unit\": \"%s\", "
+		   "\"iterations\": %" PRIu64 ", \"cycles_per_op\": %.1f, ",
+		   *first ? "" : ",", c->name, size, c->unit, iterations, per_op);
+	if (bytes > 0.0)
+	{
+		printf("\"cycles_per_byte\": %.3f, ", per_op / bytes);
+	}
+	else
+	{
+		printf("\"cycles_per_byte\": null, ");
+	}
+	printf("\"ops_per_sec\": %.1f, \"stack_bytes\": %zu}",
+		   (double) iterations * 1e9 / (double) ns, stack);
+
+	*first = false;
+}
+
+int main(int argc, char *argv[])
+{
+	const uint64_t min_ns = ((argc > 1) ? strtoull(argv[1], NULL, 0) : 50u) * UINT64_C(1000000);
+
+	for (size_t i = 0u; i < sizeof bench_in; i++)
+	{
+		bench_in[i] = (uint8_t) (i * 131u + 7u);
+	}
+
+	hal_mem_init();
+
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+	hal_crypto_offload_init();
+#endif /* SBM_HAL_CRYPTO_OFFLOAD != 0 */
+
+	if (!aes_gcm_init())
+	{
+		fprintf(stderr, "sbm_bench: AES-GCM initialisation failed\n");
+		return EXIT_FAILURE;
+	}
+
+	printf("{\n  \"counter\": \"%s\",\n  \"results\": [", BENCH_HAVE_TSC ? "tsc" : "ns");
+
+	bool first = true;
+	for (size_t i = 0u; i < ARRAY_SIZE(bench_cases); i++)
+	{
+		const bench_case *const c = &bench_cases[i];
+
+		for (size_t s = 0u; s < c->nsizes; s++)
+		{
+			if (NULL != c->setup)
+			{
+				c->setup(c->sizes[s]);
+			}
+			bench_run(c, c->sizes[s], min_ns, &first);
+		}
+	}
+
+	printf("\n  ]\n}\n");
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,266 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief Host check of the crypto offload paths against the software ones.
+ *
+ * Hashes and encrypts messages of a range of lengths, cut into chunks of
+ * several patterns, through the offload paths of sha256_wrapper.c and
+ * tomcrypt_api.c, which run on the host engine model, and compares the
+ * digests, texts and tags with the software SHA-256 and gcm_memory(). The
+ * engine model is run with several amounts of work per poll, so that jobs
+ * complete on the first poll or after many.
+ *
+ * Exits with a failure status, after listing the mismatches on stderr, if
+ * any result differs.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "aesgcm_types.h"
+#include "sbm_hal_crypto.h"
+#include "sha.h"
+#include "sha256_wrapper.h"
+#include "soc_host_crypto.h"
+#include "tomcrypt_api.h"
+
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+/** Address of the Provisioning Summary Record used by dataStore.c, which the checks do not use. */
+void *pd_offset_reg;
+
+/** Longest message checked. */
+#define CHECK_MAX_BYTES 2100u
+
+/** Message lengths, around the word, block and staging buffer sizes. */
+static const uint32_t check_lengths[] = {
+	0u, 1u, 3u, 4u, 5u, 15u, 16u, 17u, 31u, 32u, 55u, 56u, 63u, 64u, 65u,
+	127u, 128u, 129u, 511u, 512u, 513u, 1000u, 1024u, 1025u, 2048u, CHECK_MAX_BYTES,
+};
+
+/** Work done by the engine model per poll; 0 completes a job on its first poll. */
+static const size_t check_bytes_per_poll[] = { 0u, 1u, 64u, 1000u };
+
+/*
+ * Chunk sizes of the hash patterns, used in turn until the message is cut.
+ * A single chunk and word-multiple chunks take the direct multi-block path,
+ * the others the staged callback path, with chunks above the staging size.
+ */
+static const uint32_t hash_pattern_whole[] = { CHECK_MAX_BYTES };
+static const uint32_t hash_pattern_words[] = { 64u, 4u, 512u };
+static const uint32_t hash_pattern_bytes[] = { 1u, 7u, 13u, 64u };
+static const uint32_t hash_pattern_large[] = { 600u, 3u, 512u };
+
+/* Chunk sizes of the GCM patterns: every chunk but the last is a whole number of blocks */
+static const uint32_t gcm_pattern_whole[] = { CHECK_MAX_BYTES };
+static const uint32_t gcm_pattern_blocks[] = { 16u };
+static const uint32_t gcm_pattern_mixed[] = { 48u, 16u, 512u };
+
+typedef struct
+{
+	const char *name;
+	const uint32_t *sizes;
+	size_t nsizes;
+} check_pattern;
+
+static const check_pattern hash_patterns[] = {
+	{ "whole", hash_pattern_whole, ARRAY_SIZE(hash_pattern_whole) },
+	{ "words", hash_pattern_words, ARRAY_SIZE(hash_pattern_words) },
+	{ "bytes", hash_pattern_bytes, ARRAY_SIZE(hash_pattern_bytes) },
+	{ "large", hash_pattern_large, ARRAY_SIZE(hash_pattern_large) },
+};
+
+static const check_pattern gcm_patterns[] = {
+	{ "whole", gcm_pattern_whole, ARRAY_SIZE(gcm_pattern_whole) },
+	{ "blocks", gcm_pattern_blocks, ARRAY_SIZE(gcm_pattern_blocks) },
+	{ "mixed", gcm_pattern_mixed, ARRAY_SIZE(gcm_pattern_mixed) },
+};
+
+static uint8_t check_msg[CHECK_MAX_BYTES];
+static uint8_t check_ref[CHECK_MAX_BYTES];
+static uint8_t check_out[CHECK_MAX_BYTES];
+static sha256_hash_chunk_t check_chunks[CHECK_MAX_BYTES + 1u];
+
+static const AesKey check_key = {
+	0x2bu, 0x7eu, 0x15u, 0x16u, 0x28u, 0xaeu, 0xd2u, 0xa6u,
+	0xabu, 0xf7u, 0x15u, 0x88u, 0x09u, 0xcfu, 0x4fu, 0x3cu,
+};
+
+static const AesGcmIv check_iv = {
+	0xcau, 0xfeu, 0xbau, 0xbeu, 0xfau, 0xceu, 0xdbu, 0xadu,
+	0xdeu, 0xcau, 0xf8u, 0x88u,
+};
+
+static const uint8_t check_aad[13] = "SBM header v1";
+
+static unsigned int check_failures;
+
+static void check_fail(const char *what, const char *pattern, uint32_t length, size_t per_poll)
+{
+	fprintf(stderr, "sbm_offload_check: %s differs, pattern %s, length %" PRIu32 ", %zu bytes per poll\n",
+			what, pattern, length, per_poll);
+	check_failures++;
+}
+
+/* Cuts length bytes into chunks of the pattern; a message of no bytes is one empty chunk. */
+static unsigned int check_cut(const check_pattern *p, uint32_t length)
+{
+	unsigned int n = 0u;
+	uint32_t offset = 0u;
+
+	do
+	{
+		uint32_t size = p->sizes[n % p->nsizes];
+
+		if (size > length - offset)
+		{
+			size = length - offset;
+		}
+		check_chunks[n].data = &check_msg[offset];
+		check_chunks[n].length = size;
+		offset += size;
+		n++;
+	} while (offset < length);
+
+	return n;
+}
+
+static void check_hash(const check_pattern *p, uint32_t length, size_t per_poll)
+{
+	SHA256Context ctx;
+	uint8_t ref[SHA256HashSize];
+	uint8_t hash[SHA256HashSize];
+
+	(void) SHA256Reset(&ctx);
+	(void) SHA256Input(&ctx, check_msg, length);
+	(void) SHA256Result(&ctx, ref);
+
+	if (!sha256_calc_hash_chunked(check_chunks, check_cut(p, length), hash) ||
+		(0 != memcmp(hash, ref, sizeof ref)))
+	{
+		check_fail("SHA-256 digest", p->name, length, per_poll);
+	}
+}
+
+static void check_gcm(const check_pattern *p, uint32_t length, uint32_t aad_len, size_t per_poll)
+{
+	const uint8_t *const aad = (0u != aad_len) ? check_aad : NULL;
+	AesTag ref_tag;
+	AesTag tag;
+	unsigned int n = check_cut(p, length);
+	void *ctx;
+	bool ok;
+
+	if (!aes_gcm_encrypt(check_msg, length, aad, aad_len, &check_key, &check_iv, check_ref, &ref_tag))
+	{
+		check_fail("reference encryption", p->name, length, per_poll);
+		return;
+	}
+
+	/* Encryption into a separate buffer */
+	ok = NULL != (ctx = aes_gcm_chunked_init(&check_key, &check_iv, aad, aad_len));
+	for (unsigned int i = 0u; ok && (i < n) && (0u != check_chunks[i].length); i++)
+	{
+		const size_t offset = (size_t) ((const uint8_t *) check_chunks[i].data - check_msg);
+
+		ok = aes_gcm_chunked_encrypt(ctx, check_msg + offset, check_chunks[i].length, check_out + offset);
+	}
+	ok = (NULL != ctx) && aes_gcm_chunked_done(ctx, &tag) && ok;
+
+	if (!ok || (0 != memcmp(check_out, check_ref, length)) || (0 != memcmp(tag, ref_tag, sizeof tag)))
+	{
+		check_fail("GCM encryption", p->name, length, per_poll);
+	}
+
+	/* Decryption in place */
+	memcpy(check_out, check_ref, length);
+	ok = NULL != (ctx = aes_gcm_chunked_init(&check_key, &check_iv, aad, aad_len));
+	for (unsigned int i = 0u; ok && (i < n) && (0u != check_chunks[i].length); i++)
+	{
+		const size_t offset = (size_t) ((const uint8_t *) check_chunks[i].data - check_msg);
+
+		ok = aes_gcm_chunked_decrypt(ctx, check_out + offset, check_chunks[i].length, check_out + offset);
+	}
+	ok = (NULL != ctx) && aes_gcm_chunked_done(ctx, &tag) && ok;
+
+	if (!ok || (0 != memcmp(check_out, check_msg, length)) || (0 != memcmp(tag, ref_tag, sizeof tag)))
+	{
+		check_fail("GCM decryption", p->name, length, per_poll);
+	}
+}
+
+int main(void)
+{
+	unsigned int checks = 0u;
+
+	for (size_t i = 0u; i < sizeof check_msg; i++)
+	{
+		check_msg[i] = (uint8_t) (i * 131u + 7u);
+	}
+
+	hal_crypto_offload_init();
+
+	if (!aes_gcm_init())
+	{
+		fprintf(stderr, "sbm_offload_check: AES-GCM initialisation failed\n");
+		return EXIT_FAILURE;
+	}
+
+	for (size_t b = 0u; b < ARRAY_SIZE(check_bytes_per_poll); b++)
+	{
+		soc_host_crypto_bytes_per_poll = check_bytes_per_poll[b];
+
+		for (size_t l = 0u; l < ARRAY_SIZE(check_lengths); l++)
+		{
+			for (size_t p = 0u; p < ARRAY_SIZE(hash_patterns); p++)
+			{
+				check_hash(&hash_patterns[p], check_lengths[l], check_bytes_per_poll[b]);
+				checks++;
+			}
+
+			for (size_t p = 0u; p < ARRAY_SIZE(gcm_patterns); p++)
+			{
+				check_gcm(&gcm_patterns[p], check_lengths[l], 0u, check_bytes_per_poll[b]);
+				check_gcm(&gcm_patterns[p], check_lengths[l], sizeof check_aad, check_bytes_per_poll[b]);
+				checks += 2u;
+			}
+		}
+	}
+
+	printf("sbm_offload_check: %u of %u checks failed\n", check_failures, checks);
+
+	return (0u == check_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
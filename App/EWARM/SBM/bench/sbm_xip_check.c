@@ -0,0 +1,309 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief Host check of applications executing in place.
+ *
+ * Every slot is laid out in host RAM (see
+ * xip/autogenerated_memory_devices_and_slots.h): two update slots on a
+ * SOC_RAM_DRV device and one on an EXT_MEM_MAPPED_DRV device. The check
+ * writes an IAVVCS describing an image which executes in place in one of
+ * them and confirms that:
+ * - the image is validated where it lies and launched from there;
+ * - its slot can be write protected, except on the external device, whose
+ *   OEM layer (the weak default) offers no protection;
+ * - the secure API refuses to erase or write the slot, but not the other
+ *   update slot.
+ *
+ * Exits with a failure status, after listing the failed checks on stderr,
+ * if any check fails.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bufferCheck.h"
+#include "memory_devices_and_slots.h"
+#include "sbm_hal.h"
+#include "secureApiInternal.h"
+#include "secureApiReturnCodes.h"
+#include "sha.h"
+#include "swup.h"
+#include "swup_eub.h"
+
+/** Address of the Provisioning Summary Record used by dataStore.c, which the check does not use. */
+void *pd_offset_reg;
+
+/* The host has no RAM set aside for the SBM (see memoryMap.h), so every
+   buffer belongs to the application. */
+bool buffer_check_app_permissions_ram(const void *const buffer, const uint32_t bytes, const bool can_write)
+{
+	(void) can_write;
+	return NULL != buffer && 0u != bytes;
+}
+
+bool buffer_check_app_permissions_rom(const void *const buffer, const uint32_t bytes)
+{
+	return NULL != buffer && 0u != bytes;
+}
+
+/* Only installUpdate() resets, and the check does not call it. */
+void cpu_reset(void)
+{
+	abort();
+}
+
+/* Backing store of the memory devices. Images must start on an SBM_XIP_IMAGE_ALIGNMENT boundary. */
+uint8_t xip_check_ram[XIP_CHECK_RAM_SIZE] __attribute__((aligned(1024)));
+uint8_t xip_check_ext[XIP_CHECK_EXT_SIZE] __attribute__((aligned(1024)));
+
+/* IAVVCS values, as defined in swup.c */
+#define XIP_CHECK_MODULE_STATUS UINT32_C(0x5555AAAA)
+#define XIP_CHECK_IAVVCS_CAPABILITY UINT16_C(0x55AA)
+#define XIP_CHECK_CAP_MUF_SUPPLIED UINT16_C(1)
+#define XIP_CHECK_CAP_XIP_SUPPLIED UINT16_C(2)
+
+/** Size of the application binary. */
+#define XIP_CHECK_IMAGE_BYTES 0x1000u
+
+/** Offset in an update slot of the binary, after the EUB's module header. */
+#define XIP_CHECK_IMAGE_OFFSET 0x400u
+
+/* Secure API function numbers, in the order of the routing table */
+#define SECFUNC(it, i, o, a, f) XIP_CHECK_FIDX_ ## f,
+enum {
+#include "secureApiFunctionList.i"
+};
+#undef SECFUNC
+
+static unsigned int check_failures;
+
+static void check(bool ok, const char *what)
+{
+	if (!ok)
+	{
+		fprintf(stderr, "sbm_xip_check: %s\n", what);
+		check_failures++;
+	}
+}
+
+/** Write an application binary and its footer at image, and an IAVVCS describing it.
+ *
+ * \param image Start of the binary.
+ * \param xip   \b true if the IAVVCS says the binary executes in place.
+ */
+static void xip_check_install(uintptr_t image, bool xip)
+{
+	pie_module_t *const piem = (pie_module_t *) app_status_slot.start_address;
+	pie_module_sbm_exec_info_t *const sei = (pie_module_sbm_exec_info_t *) piem->header.sbm_exec_info;
+	pie_module_footer_t *const muf = &sei->installed_muf;
+	uint8_t *const binary = (uint8_t *) image;
+	SHA256Context ctx;
+
+	for (size_t i = 0u; i < XIP_CHECK_IMAGE_BYTES; i++)
+	{
+		binary[i] = (uint8_t) (i * 29u + 3u);
+	}
+
+	memset(piem, 0, sizeof *piem);
+	piem->header.module_status = XIP_CHECK_MODULE_STATUS;
+	piem->header.footer_offset = sizeof *piem + XIP_CHECK_IMAGE_BYTES;
+	piem->header.header_random = UINT32_C(0x1badcafe);
+	piem->header.num_signatures = 1u;
+	piem->header.footer_length = sizeof *muf;
+
+	memset(muf, 0, sizeof *muf);
+	muf->version_number = 1u;
+	muf->footer_random = piem->header.header_random;
+
+	/* The hash covers the header as it was in the SWUP, without the SBM's additions */
+	static pie_module_t swup_piem;
+	swup_piem.header = piem->header;
+	(void) SHA256Reset(&ctx);
+	(void) SHA256Input(&ctx, (const uint8_t *) &swup_piem, sizeof swup_piem);
+	(void) SHA256Input(&ctx, binary, XIP_CHECK_IMAGE_BYTES);
+	(void) SHA256Input(&ctx, (const uint8_t *) muf, (unsigned int) offsetof(pie_module_footer_t, block_hash));
+	(void) SHA256Result(&ctx, muf->block_hash);
+	memcpy(binary + XIP_CHECK_IMAGE_BYTES, muf, sizeof *muf);
+
+	memset(sei->installed_uuid, 0x5a, sizeof sei->installed_uuid);
+	sei->iavvcs_capability_indicator = XIP_CHECK_IAVVCS_CAPABILITY;
+	sei->iavvcs_capability_flags = XIP_CHECK_CAP_MUF_SUPPLIED;
+	if (xip)
+	{
+		sei->iavvcs_capability_flags |= XIP_CHECK_CAP_XIP_SUPPLIED;
+		sei->xip_image_address = image;
+	}
+
+	/* Drop the IAVVCS cached by the previous check */
+	sbm_swup_init();
+}
+
+static int8_t xip_check_set_active_slot(memory_slot_id_t id)
+{
+	const set_active_update_slot_in_args in = { .slot_id = id };
+	int8_t out = SECURE_API_ERR_COMMAND_FAILED;
+
+	check(SECURE_API_INT_OK == sbm_secure_api(XIP_CHECK_FIDX_setActiveUpdateSlot, &in, sizeof in, &out, sizeof out),
+	      "setActiveUpdateSlot not routed");
+	return out;
+}
+
+static int8_t xip_check_begin_write(uint32_t *write_size)
+{
+	const update_slot_begin_write_in_args in = { .write_size = write_size };
+	int8_t out = SECURE_API_ERR_COMMAND_FAILED;
+
+	check(SECURE_API_INT_OK == sbm_secure_api(XIP_CHECK_FIDX_updateSlotBeginWrite, &in, sizeof in, &out, sizeof out),
+	      "updateSlotBeginWrite not routed");
+	return out;
+}
+
+static int8_t xip_check_write(const void *buffer, size_t bytes)
+{
+	const update_slot_write_in_args in = { .buffer = buffer, .bytes = bytes };
+	int8_t out = SECURE_API_ERR_COMMAND_FAILED;
+
+	check(SECURE_API_INT_OK == sbm_secure_api(XIP_CHECK_FIDX_updateSlotWrite, &in, sizeof in, &out, sizeof out),
+	      "updateSlotWrite not routed");
+	return out;
+}
+
+/* An image copied into the executable slot runs from there and leaves the update slots alone. */
+static void check_copied(void)
+{
+	xip_check_install(exec_slot.start_address, false);
+
+	check(sbm_executable_slot_module_valid(), "copied image not valid");
+	check(exec_slot.start_address == sbm_swup_exec_image_address(), "copied image not launched from the executable slot");
+	check(NULL == sbm_swup_xip_slot(), "copied image has an execute in place slot");
+	check(sbm_swup_lock_xip_slot(), "locking with no execute in place slot failed");
+}
+
+/* An image in a RAM update slot is validated, locked and launched where it lies. */
+static void check_in_place(void)
+{
+	const memory_slot *const slot = &update_slots[0];
+	const uintptr_t image = slot->start_address + XIP_CHECK_IMAGE_OFFSET;
+	uint8_t *const binary = (uint8_t *) image;
+
+	xip_check_install(image, true);
+	memset((void *) exec_slot.start_address, 0xff, exec_slot.size);
+
+	check(sbm_executable_slot_module_valid(), "image executing in place not valid");
+	check(image == sbm_swup_exec_image_address(), "image not launched in place");
+	check(slot == sbm_swup_xip_slot(), "wrong execute in place slot");
+	check(sbm_swup_lock_xip_slot(), "locking the RAM slot failed");
+
+	/* The image is checked where it lies */
+	binary[XIP_CHECK_IMAGE_BYTES / 2u] ^= 1u;
+	sbm_swup_init();
+	check(!sbm_executable_slot_module_valid(), "altered image executing in place still valid");
+	binary[XIP_CHECK_IMAGE_BYTES / 2u] ^= 1u;
+	sbm_swup_init();
+	check(sbm_executable_slot_module_valid(), "restored image executing in place not valid");
+
+	/* An image not wholly within an update slot is refused */
+	pie_module_t *const piem = (pie_module_t *) app_status_slot.start_address;
+	pie_module_sbm_exec_info_t *const sei = (pie_module_sbm_exec_info_t *) piem->header.sbm_exec_info;
+	sei->xip_image_address = slot->start_address + slot->size - XIP_CHECK_IMAGE_BYTES;
+	sbm_swup_init();
+	check(!sbm_executable_slot_module_valid(), "image overrunning its slot valid");
+	check(NULL == sbm_swup_xip_slot(), "image overrunning its slot has an execute in place slot");
+	sei->xip_image_address = image;
+	sbm_swup_init();
+}
+
+/* The secure API keeps its hands off the slot the application runs from. */
+static void check_secure_api(void)
+{
+	const memory_slot *const slot = &update_slots[0];
+	const memory_slot *const other = &update_slots[1];
+	static uint8_t before[0x8000u];
+	uint8_t data[0x40u];
+	uint32_t write_size = 0u;
+
+	xip_check_install(slot->start_address + XIP_CHECK_IMAGE_OFFSET, true);
+	memcpy(before, (const void *) slot->start_address, slot->size);
+	memset(data, 0xa5, sizeof data);
+
+	/* The default active slot is the first, which holds the image */
+	check(SECURE_API_ERR_COMMAND_FAILED == xip_check_begin_write(&write_size), "erase of the default slot allowed");
+	check(SECURE_API_ERR_COMMAND_FAILED == xip_check_write(data, sizeof data), "write to the default slot allowed");
+
+	check(SECURE_API_RETURN_SUCCESS == xip_check_set_active_slot(slot->id), "selecting the execute in place slot failed");
+	check(SECURE_API_ERR_COMMAND_FAILED == xip_check_begin_write(&write_size), "erase of the execute in place slot allowed");
+	check(SECURE_API_ERR_COMMAND_FAILED == xip_check_write(data, sizeof data), "write to the execute in place slot allowed");
+	check(0 == memcmp(before, (const void *) slot->start_address, slot->size), "execute in place slot changed");
+
+	/* The other slot takes the next update */
+	memset((void *) other->start_address, 0, other->size);
+	check(SECURE_API_RETURN_SUCCESS == xip_check_set_active_slot(other->id), "selecting the other slot failed");
+	check(SECURE_API_RETURN_SUCCESS == xip_check_begin_write(&write_size), "erase of the other slot refused");
+	check(0u != write_size && 0u == sizeof data % write_size, "unexpected write size");
+	check(SECURE_API_RETURN_SUCCESS == xip_check_write(data, sizeof data), "write to the other slot refused");
+	check(0 == memcmp(data, (const void *) other->start_address, sizeof data), "other slot not written");
+	check(0xffu == ((const uint8_t *) other->start_address)[other->size - 1u], "other slot not erased");
+
+	check(sbm_executable_slot_module_valid(), "image executing in place not valid after the update");
+	check(0 == memcmp(before, (const void *) slot->start_address, slot->size), "execute in place slot changed by the update");
+}
+
+/* Without write protection from the OEM layer, an image on external mapped memory is not launched. */
+static void check_unprotected(void)
+{
+	const memory_slot *const slot = &update_slots[2];
+	const uintptr_t image = slot->start_address + XIP_CHECK_IMAGE_OFFSET;
+
+	xip_check_install(image, true);
+
+	check(sbm_executable_slot_module_valid(), "image executing in place on external memory not valid");
+	check(image == sbm_swup_exec_image_address(), "image on external memory not launched in place");
+	check(slot == sbm_swup_xip_slot(), "wrong execute in place slot on external memory");
+	check(!sbm_swup_lock_xip_slot(), "locking without OEM write protection succeeded");
+}
+
+int main(void)
+{
+	hal_mem_init();
+
+	check_copied();
+	check_in_place();
+	check_secure_api();
+	check_unprotected();
+
+	printf("sbm_xip_check: %u checks failed\n", check_failures);
+
+	return (0u == check_failures) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,70 @@
+/** Memory devices and slots for sbm_xip_check.
+ *
+ * Stands in for the generated file of the same name. Every slot lives in
+ * host RAM: the SBM's own slots and two update slots on a SOC_RAM_DRV
+ * device, and a third update slot on an EXT_MEM_MAPPED_DRV device.
+ */
+
+#include <stdint.h>
+
+/** Backing store of the two devices (see sbm_xip_check.c). */
+#define XIP_CHECK_RAM_SIZE 0x20000u
+#define XIP_CHECK_EXT_SIZE 0x8000u
+extern uint8_t xip_check_ram[XIP_CHECK_RAM_SIZE];
+extern uint8_t xip_check_ext[XIP_CHECK_EXT_SIZE];
+
+#define XIP_CHECK_RAM(offset) ((uintptr_t) &xip_check_ram[(offset)])
+#define XIP_CHECK_EXT(offset) ((uintptr_t) &xip_check_ext[(offset)])
+
+/** Enabled memory drivers. */
+#define SOC_RAM_DRV_ENABLED 1
+#define SOC_FLASH_DRV_ENABLED 0
+#define EXT_FLASH_DRV_ENABLED 0
+#define EXT_MAPPED_MEM_DRV_ENABLED 1
+
+/** Unique names and IDs for devices as supplied by the OEM. */
+#define DEVICE_ID_XIP_CHECK_RAM 0x0000
+#define DEVICE_ID_XIP_CHECK_EXT 0x0001
+
+/** Memory subregion table initialiser. */
+#define MEMORY_SUBREGIONS_INIT \
+{ \
+    {XIP_CHECK_RAM(0), XIP_CHECK_RAM(XIP_CHECK_RAM_SIZE - 1u), 0x1000u, 0x20u, 0xffu}, \
+    {XIP_CHECK_EXT(0), XIP_CHECK_EXT(XIP_CHECK_EXT_SIZE - 1u), 0x1000u, 0x20u, 0xffu} \
+}
+
+/** Memory device table initialiser. */
+#define MEMORY_DEVICES_INIT \
+{ \
+    {DEVICE_ID_XIP_CHECK_RAM, "XIP_CHECK_RAM", SOC_RAM_DRV, 0, 0, false}, \
+    {DEVICE_ID_XIP_CHECK_EXT, "XIP_CHECK_EXT", EXT_MEM_MAPPED_DRV, 1, 1, false} \
+}
+
+/** Unique IDs for SWUP slots supplied by the OEM. */
+#define SLOT_ID_XIP_CHECK_SLOT_A 0x0
+#define SLOT_ID_XIP_CHECK_SLOT_B 0x1
+#define SLOT_ID_XIP_CHECK_SLOT_EXT 0x2
+
+/** Total number of update slots. */
+#define NUM_UPDATE_SLOTS 3
+
+/** Unique IDs for other SBM slots that cannot be modified. */
+#define SLOT_ID_SBM_SLOT 0x50
+#define SLOT_ID_APP_STATUS_SLOT 0x51
+#define SLOT_ID_APP_SLOT 0x52
+
+
+/** Memory slot table initialisers. */
+#define SBM_MEMORY_SLOT_INIT \
+    {SLOT_ID_SBM_SLOT, "SBM_SLOT", SBM_SLOT_TYPE, 0, XIP_CHECK_RAM(0x0000u), 0x1000u, true}
+
+#define APP_STATUS_MEMORY_SLOT_INIT \
+    {SLOT_ID_APP_STATUS_SLOT, "APP_STATUS_SLOT", ASS_SLOT_TYPE, 0, XIP_CHECK_RAM(0x1000u), 0x1000u, false}
+
+#define EXEC_MEMORY_SLOT_INIT \
+    {SLOT_ID_APP_SLOT, "APP_SLOT", EXEC_SLOT_TYPE, 0, XIP_CHECK_RAM(0x2000u), 0x6000u, false}
+
+#define UPDATE_MEMORY_SLOTS_INIT \
+    {SLOT_ID_XIP_CHECK_SLOT_A, "XIP_CHECK_SLOT_A", UPDATE_SLOT_TYPE, 0, XIP_CHECK_RAM(0x8000u), 0x8000u, false}, \
+    {SLOT_ID_XIP_CHECK_SLOT_B, "XIP_CHECK_SLOT_B", UPDATE_SLOT_TYPE, 0, XIP_CHECK_RAM(0x10000u), 0x8000u, false}, \
+    {SLOT_ID_XIP_CHECK_SLOT_EXT, "XIP_CHECK_SLOT_EXT", UPDATE_SLOT_TYPE, 1, XIP_CHECK_EXT(0x0000u), 0x8000u, false}
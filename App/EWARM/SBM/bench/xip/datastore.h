@@ -0,0 +1,3 @@
+/* Some SBM sources spell dataStore.h in lower case, which only a
+   case-insensitive file system finds. */
+#include "dataStore.h"
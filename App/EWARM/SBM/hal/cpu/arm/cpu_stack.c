@@ -0,0 +1,81 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief SBM stack usage measurement
+ */
+
+#if SBM_RECORD_BOOT_TIME != 0
+
+#include <stdint.h>
+
+#include "sbm_hal.h"
+
+/* The SBM stack is defined in the SoC-specific linker script. */
+#pragma section = "CSTACK"
+#define	SBM_STACK_BASE	((uint32_t *)__section_begin("CSTACK"))
+#define	SBM_STACK_TOP	((uint32_t *)__section_end("CSTACK"))
+
+/** Pattern painted over the unused part of the stack. */
+#define	SBM_STACK_PAINT	UINT32_C(0xa5a5a5a5)
+
+/** Number of words immediately below the stack pointer left unpainted. */
+#define	SBM_STACK_PAINT_MARGIN	16u
+
+void cpu_stack_paint(void)
+{
+	uint32_t *const limit = (uint32_t *)__get_MSP() - SBM_STACK_PAINT_MARGIN;
+
+	for (uint32_t *p = SBM_STACK_BASE; p < limit; p++)
+	{
+		*p = SBM_STACK_PAINT;
+	}
+}
+
+uint32_t cpu_stack_size(void)
+{
+	return (uint32_t)((uintptr_t)SBM_STACK_TOP - (uintptr_t)SBM_STACK_BASE);
+}
+
+uint32_t cpu_stack_used(void)
+{
+	const uint32_t *p = SBM_STACK_BASE;
+
+	/* The stack grows down, so the lowest overwritten word marks the
+	   high-water mark. */
+	while (p < SBM_STACK_TOP && SBM_STACK_PAINT == *p)
+	{
+		p++;
+	}
+
+	return (uint32_t)((uintptr_t)SBM_STACK_TOP - (uintptr_t)p);
+}
+
+#endif /* SBM_RECORD_BOOT_TIME != 0 */
@@ -132,6 +132,25 @@ extern void *cpu_push_exception_handler(exception_handler_t handler);
  */
 extern void cpu_pop_exception_handler(void *context);
 
+#if SBM_RECORD_BOOT_TIME != 0
+/** Fill the unused part of the SBM stack with a known pattern.
+ *
+ * Only the region below the caller's frame is painted, so this is best
+ * called as early as possible.
+ */
+extern void cpu_stack_paint(void);
+
+/** Return the size of the SBM stack in bytes. */
+extern uint32_t cpu_stack_size(void);
+
+/** Return the greatest depth the SBM stack has reached since
+ * cpu_stack_paint() was called.
+ *
+ * \return The number of bytes of stack used.
+ */
+extern uint32_t cpu_stack_used(void);
+#endif /* SBM_RECORD_BOOT_TIME != 0 */
+
 /** Set up MSP and ISP, clear ephmemeral RAM and invoke the application
  *
  * \param[in] sp The application's stack pointer
@@ -55,11 +55,21 @@ void hal_init(void)
 
 	hal_tick_init();
 
+#if SBM_RECORD_BOOT_TIME != 0
+	/* Paint the stack so its high-water mark can be found before launch */
+	cpu_stack_paint();
+#endif /* SBM_RECORD_BOOT_TIME != 0 */
+
 	/* Board-specific initialisation */
 	oem_init();
 
 	/* Initialise supported memory devices */
 	hal_mem_init();
+
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+	/* Bring up the HASH/CRYP offload engines */
+	hal_crypto_offload_init();
+#endif /* defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0) */
 }
 
 /** Return the target to a quiescent state
@@ -72,6 +82,11 @@ void hal_init(void)
  */
 void hal_quiesce(void)
 {
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+	/* Make sure no DMA is left running into application memory */
+	hal_crypto_offload_quiesce();
+#endif /* defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0) */
+
 	/* Quiesce the board-specific parts of the target */
 	oem_flash_quiesce();
 	oem_quiesce();
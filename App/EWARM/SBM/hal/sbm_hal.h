@@ -170,6 +170,13 @@ void hal_timer_quiesce(void);
  * \return The number of 1us ticks since initialised.
  */
 uint32_t hal_timer_get(void);
+
+/** Return the period of the watchdog left running by the SoC.
+ *
+ * \return The watchdog period in 1us ticks, or zero if no watchdog runs
+ *         while the SBM boots.
+ */
+uint32_t hal_watchdog_period(void);
 #endif /* SBM_RECORD_BOOT_TIME != 0 */
 
 /*============================================================================*/
@@ -237,6 +244,12 @@ void soc_timer_quiesce(void);
  * \return The number of 1us ticks since initialised.
  */
 uint32_t soc_timer_get(void);
+
+/** Return the period of any watchdog running from reset.
+ *
+ * \return The watchdog period in 1us ticks, or zero if there is none.
+ */
+uint32_t soc_watchdog_period(void);
 #endif /* SBM_RECORD_BOOT_TIME != 0 */
 
 #if defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0)
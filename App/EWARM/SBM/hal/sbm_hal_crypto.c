@@ -31,10 +31,11 @@
 #include "sbm_hal_crypto.h"
 #include "sbm_hal.h"
 
-#if defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0)
+#if (defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0)) || \
+    (defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0))
 #include "soc_hal_crypto.h"
 
-#endif /* defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0) */
+#endif /* SBM_PROVISIONED_DATA_ENCRYPTED != 0 || SBM_HAL_CRYPTO_OFFLOAD != 0 */
 
 void hal_crypto_init(void)
 {
@@ -121,3 +122,92 @@ int hal_crypto_authenticate_data(uint8_t *p_data, uint8_t *krd, size_t data_len,
 }
 
 #endif /* defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0) */
+
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+
+void hal_crypto_offload_init(void)
+{
+    soc_hal_crypto_offload_init();
+}
+
+void hal_crypto_offload_quiesce(void)
+{
+    soc_hal_crypto_offload_quiesce();
+}
+
+hal_crypto_status_t hal_crypto_poll(hal_crypto_engine_t engine)
+{
+    return soc_hal_crypto_poll(engine);
+}
+
+hal_crypto_status_t hal_crypto_complete(hal_crypto_engine_t engine)
+{
+    hal_crypto_status_t status;
+
+    while (HAL_CRYPTO_BUSY == (status = soc_hal_crypto_poll(engine)))
+    {
+        /* Spin: the engine needs nothing from us while it runs */
+    }
+
+    return status;
+}
+
+bool hal_crypto_sha256_begin(void)
+{
+    return soc_hal_crypto_sha256_begin();
+}
+
+bool hal_crypto_sha256_submit(const hal_crypto_block_t *blocks, size_t nblocks, bool last)
+{
+    /* Only the final block of a message may be a partial word */
+    for (size_t i = 0; i < nblocks; i++)
+    {
+        if (((i + 1u < nblocks) || !last) && (0u != (blocks[i].length & 3u)))
+        {
+            return false;
+        }
+    }
+
+    return soc_hal_crypto_sha256_submit(blocks, nblocks, last);
+}
+
+bool hal_crypto_sha256_end(uint8_t *hash)
+{
+    if (HAL_CRYPTO_IDLE != hal_crypto_complete(HAL_CRYPTO_ENGINE_HASH))
+    {
+        /* Still let the SoC code tidy up */
+        (void) soc_hal_crypto_sha256_end(hash);
+        return false;
+    }
+
+    return soc_hal_crypto_sha256_end(hash);
+}
+
+bool hal_crypto_gcm_begin(const uint8_t *key, const uint8_t *iv, size_t iv_len,
+                          const uint8_t *aad, size_t aad_len, bool decrypt)
+{
+    if ((NULL == aad) && (0u != aad_len))
+    {
+        return false;
+    }
+
+    return soc_hal_crypto_gcm_begin(key, iv, iv_len, aad, aad_len, decrypt);
+}
+
+bool hal_crypto_gcm_submit(const uint8_t *in, uint8_t *out, size_t length)
+{
+    return soc_hal_crypto_gcm_submit(in, out, length);
+}
+
+bool hal_crypto_gcm_end(uint8_t *tag)
+{
+    if (HAL_CRYPTO_IDLE != hal_crypto_complete(HAL_CRYPTO_ENGINE_CRYP))
+    {
+        (void) soc_hal_crypto_gcm_end(tag);
+        return false;
+    }
+
+    return soc_hal_crypto_gcm_end(tag);
+}
+
+#endif /* defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0) */
@@ -31,6 +31,7 @@
 #ifndef SBM_HAL_CRYPTO_H
 #define SBM_HAL_CRYPTO_H
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
 
@@ -78,4 +79,133 @@ int hal_crypto_authenticate_data(uint8_t *p_data, uint8_t *krd, size_t data_len,
 
 #endif /* defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0) */
 
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+/*
+ * Asynchronous offload of SHA-256 and AES-GCM to the SoC's HASH and CRYP
+ * engines.
+ *
+ * Work is submitted to an engine and runs in the background (normally fed by
+ * DMA) while the caller gets on with something else, such as reading the next
+ * chunk from flash. hal_crypto_poll() reports progress without blocking and
+ * hal_crypto_complete() waits for the engine to go idle. Each engine runs one
+ * job at a time: a submission while the engine is busy is rejected.
+ *
+ * Buffers and block descriptors handed to an engine belong to it until the
+ * job has completed.
+ */
+
+/** The offload engines. */
+typedef enum
+{
+    HAL_CRYPTO_ENGINE_HASH, /**< SHA-256 */
+    HAL_CRYPTO_ENGINE_CRYP, /**< AES-GCM */
+} hal_crypto_engine_t;
+
+/** State of an offload engine. */
+typedef enum
+{
+    HAL_CRYPTO_IDLE,  /**< No job outstanding; the last one (if any) succeeded */
+    HAL_CRYPTO_BUSY,  /**< A submitted job is still running */
+    HAL_CRYPTO_ERROR, /**< The last job failed; the operation must be restarted */
+} hal_crypto_status_t;
+
+/** One input block of a multi-block (scatter-gather) hash submission. */
+typedef struct
+{
+    const void *data; /**< Start of the block */
+    size_t length;    /**< Length of the block in bytes */
+} hal_crypto_block_t;
+
+/** Initialise the offload engines. Called by hal_init(). */
+void hal_crypto_offload_init(void);
+
+/** Abort any outstanding work and quiesce the offload engines.
+ * Called by hal_quiesce().
+ */
+void hal_crypto_offload_quiesce(void);
+
+/** Check an engine's progress without blocking.
+ *
+ * \param engine Engine to check.
+ *
+ * \return State of the engine.
+ */
+hal_crypto_status_t hal_crypto_poll(hal_crypto_engine_t engine);
+
+/** Wait for an engine to finish its current job.
+ *
+ * \param engine Engine to wait for.
+ *
+ * \return \c HAL_CRYPTO_IDLE if the job succeeded, \c HAL_CRYPTO_ERROR if not.
+ */
+hal_crypto_status_t hal_crypto_complete(hal_crypto_engine_t engine);
+
+/** Start a SHA-256 calculation on the HASH engine.
+ *
+ * \return true on success, false if the engine is busy or failed to start.
+ */
+bool hal_crypto_sha256_begin(void);
+
+/** Submit message data to the HASH engine.
+ *
+ * The blocks are hashed in order as though they were contiguous. Every
+ * block, except the final block of the message, must be a multiple of four
+ * bytes long.
+ *
+ * \param blocks Array of input blocks.
+ * \param nblocks Number of entries in \a blocks.
+ * \param last true if this submission ends the message.
+ *
+ * \return true if the job was accepted, else false.
+ */
+bool hal_crypto_sha256_submit(const hal_crypto_block_t *blocks, size_t nblocks, bool last);
+
+/** Collect the result of a SHA-256 calculation.
+ *
+ * Waits for any outstanding submission to complete.
+ *
+ * \param hash Destination for the 32 byte digest.
+ *
+ * \return true on success, else false.
+ */
+bool hal_crypto_sha256_end(uint8_t *hash);
+
+/** Start an AES-128-GCM operation on the CRYP engine.
+ *
+ * \param key 16 byte AES key.
+ * \param iv Initialisation vector.
+ * \param iv_len Length of \a iv in bytes.
+ * \param aad Additional authentication data, or NULL.
+ * \param aad_len Length of \a aad in bytes.
+ * \param decrypt true to decrypt, false to encrypt.
+ *
+ * \return true on success, false if the engine is busy or failed to start.
+ */
+bool hal_crypto_gcm_begin(const uint8_t *key, const uint8_t *iv, size_t iv_len,
+                          const uint8_t *aad, size_t aad_len, bool decrypt);
+
+/** Submit text to the CRYP engine.
+ *
+ * The result is written to \a out once the job has completed. Every
+ * submission except the last must be a multiple of 16 bytes long.
+ *
+ * \param in Input text.
+ * \param out Output text; may be the same as \a in.
+ * \param length Number of bytes to process.
+ *
+ * \return true if the job was accepted, else false.
+ */
+bool hal_crypto_gcm_submit(const uint8_t *in, uint8_t *out, size_t length);
+
+/** Finish an AES-GCM operation and collect the tag.
+ *
+ * Waits for any outstanding submission to complete.
+ *
+ * \param tag Destination for the 16 byte tag.
+ *
+ * \return true on success, else false.
+ */
+bool hal_crypto_gcm_end(uint8_t *tag);
+#endif /* defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0) */
+
 #endif /* SBM_HAL_CRYPTO_H */
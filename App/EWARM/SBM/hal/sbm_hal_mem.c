@@ -75,6 +75,13 @@ static hal_mem_result_t page_program(const memory_device *device,
                                      size_t size);
 static void disable_caches(const memory_device *device);
 static void enable_and_flush_caches(const memory_device *device);
+static const void *mapped_pointer(const memory_device *device,
+                                  hal_mem_address_t address,
+                                  size_t size);
+static size_t get_sector_piece(const memory_device *device,
+                               hal_mem_address_t address,
+                               hal_mem_address_t end);
+static bool blank_is_programmable(const memory_device *device);
 
 #if SOC_RAM_DRV_ENABLED != 0
 static hal_mem_result_t verify_erased_ram(const memory_device *device,
@@ -110,10 +117,10 @@ bool hal_mem_device_present(const memory_device *device)
             return oem_flash_ext_present(device->id);
 #endif /* EXT_FLASH_DRV_ENABLED != 0 */
 
-#if EXT_MEM_MAPPED_DRV_ENABLED != 0
+#if EXT_MAPPED_MEM_DRV_ENABLED != 0
         case EXT_MEM_MAPPED_DRV:
             return oem_ext_mm_present();
-#endif /* EXT_MEM_MAPPED_DRV_ENABLED != 0 */
+#endif /* EXT_MAPPED_MEM_DRV_ENABLED != 0 */
 
 #if SOC_RAM_DRV_ENABLED != 0
         case SOC_RAM_DRV: /* fall through */
@@ -283,6 +290,15 @@ hal_mem_result_t hal_mem_verify(const memory_slot *slot,
     }
 #endif /* NDEBUG */
 
+    /* Compare directly addressable memory in place */
+    hal_mem_address_t address;
+    const memory_device *device = lookup_device_and_address(slot, offset_in_slot, size, &address);
+    const void *const mapped = (NULL == device) ? NULL : mapped_pointer(device, address, size);
+    if (NULL != mapped)
+    {
+        return (0 == memcmp(mapped, src, size)) ? HAL_MEM_SUCCESS : HAL_MEM_VERIFY_ERROR;
+    }
+
     uint8_t verify_buf[SBM_VERIFY_BUF_SIZE];
     hal_mem_result_t mem_result;
 
@@ -419,6 +435,233 @@ hal_mem_result_t hal_mem_verify_erased(const memory_slot *slot,
     }
 }
 
+hal_mem_result_t hal_mem_write_protect(const memory_slot *slot)
+{
+#ifndef NDEBUG
+    if (NULL == slot)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+#endif /* NDEBUG */
+
+    hal_mem_address_t address;
+    const memory_device *device = lookup_device_and_address(slot, 0, slot->size, &address);
+    if (NULL == device)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    switch (device->memory_drv)
+    {
+#if SOC_RAM_DRV_ENABLED != 0
+        case SOC_RAM_DRV:
+            /* Nothing to program; the SBM's own checks keep writers out */
+            return HAL_MEM_SUCCESS;
+#endif /* SOC_RAM_DRV_ENABLED != 0 */
+
+#if EXT_MAPPED_MEM_DRV_ENABLED != 0
+        case EXT_MEM_MAPPED_DRV:
+            return oem_ext_mm_write_protect(address, slot->size);
+#endif /* EXT_MAPPED_MEM_DRV_ENABLED != 0 */
+
+        default:
+            return HAL_MEM_PARAM_ERROR;
+    }
+}
+
+hal_mem_result_t hal_mem_erased_sector_map(const memory_slot *slot,
+                                           hal_mem_address_t offset_in_slot,
+                                           size_t size,
+                                           uint32_t *bitmap,
+                                           size_t *num_sectors)
+{
+#ifndef NDEBUG
+    if ((NULL == slot) || (NULL == bitmap) || (NULL == num_sectors))
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+#endif /* NDEBUG */
+
+    hal_mem_address_t address;
+    const memory_device *device = lookup_device_and_address(slot, offset_in_slot, size, &address);
+    if (NULL == device)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    *bitmap = 0u;
+    *num_sectors = 0u;
+
+    const hal_mem_address_t end = address + size;
+    while (address < end)
+    {
+        const size_t piece = get_sector_piece(device, address, end);
+        if ((0u == piece) || (*num_sectors >= HAL_MEM_SECTOR_MAP_BITS))
+        {
+            return HAL_MEM_PARAM_ERROR;
+        }
+
+        const hal_mem_result_t result = hal_mem_verify_erased(slot, address - slot->start_address, piece);
+        if (HAL_MEM_SUCCESS == result)
+        {
+            *bitmap |= UINT32_C(1) << *num_sectors;
+        }
+        else if (HAL_MEM_NOT_ERASED != result)
+        {
+            return result;
+        }
+
+        ++*num_sectors;
+        address += piece;
+    }
+
+    return HAL_MEM_SUCCESS;
+}
+
+hal_mem_result_t hal_mem_erase_if_needed(const memory_slot *slot,
+                                         hal_mem_address_t offset_in_slot,
+                                         size_t size)
+{
+#ifndef NDEBUG
+    if (NULL == slot)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+#endif /* NDEBUG */
+
+    if (slot->prevent_erase)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    hal_mem_address_t address;
+    const memory_device *device = lookup_device_and_address(slot, offset_in_slot, size, &address);
+    if (NULL == device)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    /* A sector reading as erased is only known to be blank on some devices */
+    if (!blank_is_programmable(device))
+    {
+        return hal_mem_erase(slot, offset_in_slot, size);
+    }
+
+    const hal_mem_address_t end = address + size;
+    while (address < end)
+    {
+        /* Take as many sectors as one map can describe */
+        size_t batch = 0u;
+        for (size_t n = 0u; (n < HAL_MEM_SECTOR_MAP_BITS) && (address + batch < end); n++)
+        {
+            const size_t piece = get_sector_piece(device, address + batch, end);
+            if (0u == piece)
+            {
+                return HAL_MEM_PARAM_ERROR;
+            }
+            batch += piece;
+        }
+
+        uint32_t bitmap;
+        size_t num_sectors;
+        hal_mem_result_t result = hal_mem_erased_sector_map(slot, address - slot->start_address,
+                                                            batch, &bitmap, &num_sectors);
+        if (HAL_MEM_SUCCESS != result)
+        {
+            return result;
+        }
+
+        /* Erase each run of sectors which are not blank with a single call */
+        hal_mem_address_t run_start = address;
+        size_t run_size = 0u;
+        for (size_t n = 0u; n <= num_sectors; n++)
+        {
+            const bool erased = (n == num_sectors) || (0u != (bitmap & (UINT32_C(1) << n)));
+            const size_t piece = (n == num_sectors) ? 0u : get_sector_piece(device, address, end);
+
+            if (!erased)
+            {
+                if (0u == run_size)
+                {
+                    run_start = address;
+                }
+                run_size += piece;
+            }
+            else if (0u != run_size)
+            {
+                result = hal_mem_erase(slot, run_start - slot->start_address, run_size);
+                if (HAL_MEM_SUCCESS != result)
+                {
+                    return result;
+                }
+                run_size = 0u;
+            }
+
+            address += piece;
+        }
+    }
+
+    return HAL_MEM_SUCCESS;
+}
+
+bool hal_mem_is_filled(const void *src, size_t size, uint8_t value)
+{
+    const uint8_t *bytes = (const uint8_t*)src;
+
+    /* Step up to a word boundary */
+    while ((size > 0u) && !IS_ADDRESS_4BYTE_ALIGNED((uintptr_t)bytes))
+    {
+        if (*bytes != value)
+        {
+            return false;
+        }
+        ++bytes;
+        --size;
+    }
+
+    /* Check 32 bytes per iteration: the differences are merged so there
+       is a single test (and early exit) per iteration */
+    const uint32_t pattern = (uint32_t)value * UINT32_C(0x01010101);
+    const uint32_t *words = (const uint32_t*)bytes;
+    while (size >= 8u * sizeof *words)
+    {
+        const uint32_t diff = (words[0] ^ pattern) | (words[1] ^ pattern) |
+                              (words[2] ^ pattern) | (words[3] ^ pattern) |
+                              (words[4] ^ pattern) | (words[5] ^ pattern) |
+                              (words[6] ^ pattern) | (words[7] ^ pattern);
+        if (0u != diff)
+        {
+            return false;
+        }
+        words += 8;
+        size  -= 8u * sizeof *words;
+    }
+
+    while (size >= sizeof *words)
+    {
+        if (*words != pattern)
+        {
+            return false;
+        }
+        ++words;
+        size -= sizeof *words;
+    }
+
+    /* Trailing bytes */
+    bytes = (const uint8_t*)words;
+    while (size > 0u)
+    {
+        if (*bytes != value)
+        {
+            return false;
+        }
+        ++bytes;
+        --size;
+    }
+
+    return true;
+}
+
 /** Looks up the memory device and physical address from a sub-region of a slot.
  *
  * This also validates the parameters and returns \c NULL if any parameters
@@ -493,18 +736,10 @@ static hal_mem_result_t verify_erased_ram(const memory_device *device,
                                           hal_mem_address_t address,
                                           size_t size)
 {
-    const uint8_t *src_bytes = (const uint8_t*)address;
     const uint8_t erase_value = get_erase_value(device, address);
 
-    for (size_t i = 0; i < size; i++)
-    {
-        if (src_bytes[i] != erase_value)
-        {
-            return HAL_MEM_NOT_ERASED;
-        }
-    }
-
-    return HAL_MEM_SUCCESS;
+    return hal_mem_is_filled((const void*)address, size, erase_value) ?
+           HAL_MEM_SUCCESS : HAL_MEM_NOT_ERASED;
 }
 #endif /* SOC_RAM_DRV_ENABLED != 0 */
 
@@ -652,3 +887,91 @@ static void enable_and_flush_caches(const memory_device *device)
             break;
     }
 }
+
+/** Get a CPU pointer through which a region of a memory device can be read.
+ *
+ * \pre device != NULL
+ *
+ * \param[in] device  The memory device to query.
+ * \param[in] address The address of the first byte in the region.
+ * \param[in] size    The size of the region, in bytes.
+ *
+ * \return A pointer to the first byte, or \c NULL if the region must be read
+ *         through the driver.
+ */
+static const void *mapped_pointer(const memory_device *device,
+                                  hal_mem_address_t address,
+                                  size_t size)
+{
+    assert(NULL != device);
+
+    switch (device->memory_drv)
+    {
+#if SOC_RAM_DRV_ENABLED != 0
+        case SOC_RAM_DRV:
+            return (const void*)address;
+#endif /* SOC_RAM_DRV_ENABLED != 0 */
+
+        case SOC_FLASH_DRV:
+            return soc_flash_mapped_pointer(address, size);
+
+        default:
+            /* External devices are only guaranteed to be readable through the OEM driver */
+            return NULL;
+    }
+}
+
+/** Get the size of the part of an erase sector which starts at an address.
+ *
+ * The erase sector size is the page size of the subregion containing the address.
+ *
+ * \pre device != NULL
+ *
+ * \param[in] device  The memory device to query.
+ * \param[in] address The address of the first byte.
+ * \param[in] end     The address following the last byte of interest.
+ *
+ * \return The number of bytes from \p address to the end of its sector or
+ *         to \p end, whichever is nearer. 0 if the sector size is unknown.
+ */
+static size_t get_sector_piece(const memory_device *device,
+                               hal_mem_address_t address,
+                               hal_mem_address_t end)
+{
+    const memory_subregion *const subregion = get_subregion_from_address(device, address);
+
+    if ((NULL == subregion) || (0u == subregion->page_size))
+    {
+        return 0u;
+    }
+
+    const size_t piece = subregion->page_size - ((address - subregion->start_address) % subregion->page_size);
+
+    return (piece < end - address) ? piece : (size_t)(end - address);
+}
+
+/** Query whether memory of a device which reads as erased can be programmed.
+ *
+ * \pre device != NULL
+ *
+ * \param[in] device The memory device to query.
+ *
+ * \return \c true if memory which reads as erased can be programmed without
+ *         an erase, \c false if it must be erased first.
+ */
+static bool blank_is_programmable(const memory_device *device)
+{
+    assert(NULL != device);
+
+    switch (device->memory_drv)
+    {
+        case SOC_FLASH_DRV:
+            return soc_flash_blank_is_programmable();
+
+        case SOC_RAM_DRV:           /* fall through */
+        case EXT_FLASH_DRV:         /* fall through */
+        case EXT_MEM_MAPPED_DRV:    /* fall through */
+        default:
+            return true;
+    }
+}
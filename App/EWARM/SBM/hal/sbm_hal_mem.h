@@ -147,6 +147,9 @@ hal_mem_result_t hal_mem_program(const memory_slot *slot,
  * \param[in] src            The data is compared against the contents of this buffer.
  * \param[in] size           The number of bytes to read & verify, starting at \p offset_in_slot.
  *
+ * \note Directly addressable memory is compared in place; other devices are
+ * read back through a buffer of SBM_VERIFY_BUF_SIZE bytes.
+ *
  * \return \c HAL_MEM_SUCCESS if the data was successfully verified.
  *         \c HAL_MEM_READ_ERROR if the region could not be successfully read for verification.
  *         \c HAL_MEM_VERIFY_ERROR if the memory was successfully read, but the memory contents
@@ -213,4 +216,84 @@ hal_mem_result_t hal_mem_verify_erased(const memory_slot *slot,
                                        hal_mem_address_t offset_in_slot,
                                        size_t size);
 
+/** Maximum number of sectors reported by one call to hal_mem_erased_sector_map(). */
+#define HAL_MEM_SECTOR_MAP_BITS 32u
+
+/** Find which erase sectors of an area of memory are already erased.
+ *
+ * The area is split at the erase sector boundaries of the device (the
+ * subregion page size) and each piece is checked with hal_mem_verify_erased().
+ * Bit \c n of \p bitmap is set if the \c n th piece is erased.
+ *
+ * \pre slot != NULL
+ * \pre bitmap != NULL
+ * \pre num_sectors != NULL
+ *
+ * \param[in]  slot           The memory slot to query.
+ * \param[in]  offset_in_slot The offset of the first byte to check relative to the
+ *                            start of the slot.
+ * \param[in]  size           The size of the region to check, in bytes.
+ * \param[out] bitmap         Populated with one bit per sector, set if that sector is erased.
+ * \param[out] num_sectors    Populated with the number of sectors spanned by the region.
+ *
+ * \return \c HAL_MEM_SUCCESS if the map was built.
+ *         \c HAL_MEM_READ_ERROR if part of the specified region could not be checked.
+ *         \c HAL_MEM_PARAM_ERROR if one or more parameters are invalid or the region
+ *                                spans more than #HAL_MEM_SECTOR_MAP_BITS sectors.
+ */
+hal_mem_result_t hal_mem_erased_sector_map(const memory_slot *slot,
+                                           hal_mem_address_t offset_in_slot,
+                                           size_t size,
+                                           uint32_t *bitmap,
+                                           size_t *num_sectors);
+
+/** Erase an area of memory, skipping the sectors which are already erased.
+ *
+ * This has the same effect as hal_mem_erase() but avoids the (slow) erase
+ * of sectors which are already blank. A sector is taken to be blank when it
+ * reads as erased. On devices where memory reading as erased may not be
+ * programmable (see soc_flash_blank_is_programmable(), false for STM32H7
+ * flash, where programming adds ECC), the whole area is erased.
+ *
+ * \pre slot != NULL
+ *
+ * \param[in] slot           The memory slot to erase.
+ * \param[in] offset_in_slot The offset of the first byte to erase relative to the
+ *                           start of the slot.
+ * \param[in] size           The size of the region to erase, in bytes.
+ *
+ * \return As hal_mem_erase().
+ */
+hal_mem_result_t hal_mem_erase_if_needed(const memory_slot *slot,
+                                         hal_mem_address_t offset_in_slot,
+                                         size_t size);
+
+/** Check whether every byte of a memory-mapped buffer has a given value.
+ *
+ * The buffer is scanned a word at a time and the scan stops at the first
+ * mismatch. This is used by the drivers to check directly addressable
+ * memory is erased.
+ *
+ * \param[in] src   The buffer to check.
+ * \param[in] size  The size of the buffer, in bytes.
+ * \param[in] value The expected value of every byte.
+ *
+ * \return \b true if all bytes equal \p value, \b false otherwise.
+ */
+bool hal_mem_is_filled(const void *src, size_t size, uint8_t value);
+
+/** Protect a memory slot against writes until the next reset.
+ *
+ * This is used to lock down an update slot holding an application which
+ * executes in place. Only directly addressable devices are supported.
+ *
+ * \pre slot != NULL
+ *
+ * \param[in] slot The memory slot to protect.
+ *
+ * \return \c HAL_MEM_SUCCESS if the slot is protected.
+ *         \c HAL_MEM_PARAM_ERROR if the slot cannot be protected.
+ */
+hal_mem_result_t hal_mem_write_protect(const memory_slot *slot);
+
 #endif /* SBM_HAL_MEM_H */
@@ -47,4 +47,9 @@ uint32_t hal_timer_get(void)
     return soc_timer_get();
 }
 
+uint32_t hal_watchdog_period(void)
+{
+    return soc_watchdog_period();
+}
+
 #endif /* SBM_RECORD_BOOT_TIME != 0 */
@@ -101,6 +101,17 @@ hal_mem_result_t soc_flash_write(hal_mem_address_t address, const void *src, siz
          address   += FLASH_PROGRAM_SIZE,
          src_words += FLASH_NB_32BITWORD_IN_FLASHWORD)
     {
+        /*
+        * A flash word carries ECC once programmed, even with all bits set, and
+        * cannot then be programmed again without an erase. Leave words which
+        * are to stay blank untouched, so that they stay programmable.
+        */
+        if (hal_mem_is_filled(src_words, FLASH_PROGRAM_SIZE, FLASH_ERASE_VALUE) &&
+            hal_mem_is_filled((const void*)address, FLASH_PROGRAM_SIZE, FLASH_ERASE_VALUE))
+        {
+            continue;
+        }
+
         const uint32_t bank = get_address_bank(address);
 
         /*
@@ -211,16 +222,22 @@ hal_mem_result_t soc_flash_erase(hal_mem_address_t address, size_t size)
 hal_mem_result_t soc_flash_verify_erased(hal_mem_address_t address, size_t size)
 {
     /* Check that all bytes in the specified range are at their erased value */
-    const uint8_t *source = (const uint8_t*)address;
-    for (size_t i = 0U; i < size; i++)
-    {
-        if (source[i] != FLASH_ERASE_VALUE)
-        {
-            return HAL_MEM_NOT_ERASED;
-        }
-    }
+    return hal_mem_is_filled((const void*)address, size, FLASH_ERASE_VALUE) ?
+           HAL_MEM_SUCCESS : HAL_MEM_NOT_ERASED;
+}
 
-    return HAL_MEM_SUCCESS;
+const void *soc_flash_mapped_pointer(hal_mem_address_t address, size_t size)
+{
+    (void) size;
+
+    /* The whole of the flash is mapped into the CPU's address space */
+    return (const void*)address;
+}
+
+bool soc_flash_blank_is_programmable(void)
+{
+    /* A flash word programmed with all bits set reads as erased but carries ECC */
+    return false;
 }
 
 /*
@@ -96,4 +96,25 @@ uint32_t soc_timer_get(void)
     return TIM2->CNT;
 }
 
+uint32_t soc_watchdog_period(void)
+{
+    /* IWDG1 only runs from reset when the option bytes put it under
+       hardware control; the SBM never starts it itself. */
+    if (0u != (FLASH->OPTSR_CUR & FLASH_OPTSR_IWDG1_SW))
+    {
+        return 0u;
+    }
+
+    /* The counter is clocked from the 32kHz LSI through a 4..256 prescaler */
+    uint32_t pr = IWDG1->PR & IWDG_PR_PR;
+    if (pr > 6u)
+    {
+        pr = 6u;
+    }
+
+    const uint32_t reload = (IWDG1->RLR & IWDG_RLR_RL) + 1u;
+
+    return ((UINT32_C(4) << pr) * reload * 125u) / 4u;
+}
+
 #endif /* SBM_RECORD_BOOT_TIME != 0 */
@@ -0,0 +1,52 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef MEMORYMAP_H
+#define MEMORYMAP_H
+
+/** \file
+ * \brief Memory map for host (PC) builds.
+ *
+ * Flash addresses are those of the emulated device (see memory_map_flash.h).
+ * There is no separate SBM or application RAM on the host, so the RAM
+ * range covers the whole address space.
+ */
+
+#include <stdint.h>
+
+#include "memory_map_flash.h"
+
+#define SOC_RAM_START_ADDRESS ((uintptr_t) 0u)
+#define SOC_RAM_END_ADDRESS   ((uintptr_t) UINTPTR_MAX)
+
+#define SOC_APP_RAM_START_ADDRESS SOC_RAM_START_ADDRESS
+#define SOC_APP_RAM_END_ADDRESS   SOC_RAM_END_ADDRESS
+
+#endif /* MEMORYMAP_H */
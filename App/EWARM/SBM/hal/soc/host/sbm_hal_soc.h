@@ -0,0 +1,77 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SBM_HAL_SOC_H
+#define SBM_HAL_SOC_H
+
+/** \file
+ * \brief SoC definitions for host (PC) builds of the SBM sources.
+ *
+ * There is no CPU or SoC underneath a host build, so the critical section
+ * primitives normally provided by sbm_hal_cpu.h reduce to compiler barriers.
+ */
+
+#include <stdint.h>
+
+#include "soc_read_device_id.h"
+
+static inline uint32_t cpu_critical_enter(void)
+{
+	__asm__ volatile("" ::: "memory");
+
+	return 0u;
+}
+
+static inline void cpu_critical_exit(uint32_t mask)
+{
+	(void) mask;
+
+	__asm__ volatile("" ::: "memory");
+}
+
+#if SBM_RECORD_BOOT_TIME != 0
+/* The host has no SBM stack of its own to measure, so these report zero. */
+static inline void cpu_stack_paint(void)
+{
+}
+
+static inline uint32_t cpu_stack_size(void)
+{
+	return 0u;
+}
+
+static inline uint32_t cpu_stack_used(void)
+{
+	return 0u;
+}
+#endif /* SBM_RECORD_BOOT_TIME != 0 */
+
+#define	SBM_HAL_FC_SIZE(nrecords)	((nrecords) * 32)
+#endif /* SBM_HAL_SOC_H */
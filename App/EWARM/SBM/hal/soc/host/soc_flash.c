@@ -0,0 +1,142 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief Host model of the on-chip flash.
+ *
+ * The device is emulated by a RAM array addressed exactly as the real part
+ * (see memory_map_flash.h). Programming can only clear bits and erasing is
+ * done a whole sector at a time, so code which forgets to erase before it
+ * writes fails here as it would on the target.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "memory_map_flash.h"
+#include "soc_flash.h"
+
+#define FLASH_ERASE_VALUE 0xFFu
+
+/** Backing store for the emulated device. */
+uint8_t soc_host_flash[SOC_FLASH_SIZE];
+
+/** Check that a range lies within the emulated device.
+ *
+ * \return Pointer to the first byte of the range in the backing store,
+ *         or NULL if the range is out of bounds.
+ */
+static uint8_t *host_flash_ptr(hal_mem_address_t address, size_t size)
+{
+    if ((address < SOC_FLASH_START_ADDRESS) ||
+        (address > SOC_FLASH_END_ADDRESS) ||
+        (size > (SOC_FLASH_END_ADDRESS - address) + 1u))
+    {
+        return NULL;
+    }
+
+    return &soc_host_flash[address - SOC_FLASH_START_ADDRESS];
+}
+
+void soc_flash_init(void)
+{
+    (void) memset(soc_host_flash, FLASH_ERASE_VALUE, sizeof soc_host_flash);
+}
+
+size_t soc_flash_page_size(void)
+{
+    return SOC_FLASH_PAGE_SIZE;
+}
+
+hal_mem_result_t soc_flash_read(hal_mem_address_t address, void *dst, size_t size)
+{
+    const uint8_t *const p = host_flash_ptr(address, size);
+    if (NULL == p)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    (void) memcpy(dst, p, size);
+    return HAL_MEM_SUCCESS;
+}
+
+hal_mem_result_t soc_flash_write(hal_mem_address_t address, const void *src, size_t size)
+{
+    uint8_t *const p = host_flash_ptr(address, size);
+    if ((NULL == p) || (0u != (address % SOC_FLASH_PAGE_SIZE)) || (0u != (size % SOC_FLASH_PAGE_SIZE)))
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    const uint8_t *const s = src;
+    for (size_t i = 0u; i < size; i++)
+    {
+        p[i] &= s[i];
+    }
+
+    return HAL_MEM_SUCCESS;
+}
+
+hal_mem_result_t soc_flash_erase(hal_mem_address_t address, size_t size)
+{
+    if (0u == size)
+    {
+        return HAL_MEM_SUCCESS;
+    }
+
+    const hal_mem_address_t first = address - ((address - SOC_FLASH_START_ADDRESS) % SOC_FLASH_SECTOR_SIZE);
+    const hal_mem_address_t last = address + size - 1u;
+    uint8_t *const p = host_flash_ptr(first, last - first + 1u);
+    if (NULL == p)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    const size_t sectors = ((last - first) / SOC_FLASH_SECTOR_SIZE) + 1u;
+    (void) memset(p, FLASH_ERASE_VALUE, sectors * SOC_FLASH_SECTOR_SIZE);
+
+    return HAL_MEM_SUCCESS;
+}
+
+hal_mem_result_t soc_flash_verify_erased(hal_mem_address_t address, size_t size)
+{
+    const uint8_t *const p = host_flash_ptr(address, size);
+    if (NULL == p)
+    {
+        return HAL_MEM_PARAM_ERROR;
+    }
+
+    return hal_mem_is_filled(p, size, FLASH_ERASE_VALUE) ? HAL_MEM_SUCCESS : HAL_MEM_NOT_ERASED;
+}
+
+const void *soc_flash_mapped_pointer(hal_mem_address_t address, size_t size)
+{
+    return host_flash_ptr(address, size);
+}
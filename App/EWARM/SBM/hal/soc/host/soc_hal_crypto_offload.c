@@ -0,0 +1,313 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief Host software model of the HASH and CRYP offload engines.
+ *
+ * Implements the soc_hal_crypto offload interface with the same software
+ * SHA-256 and GCM code the SBM otherwise uses, and enforces the rules the
+ * hardware imposes (one job per engine, word- or block-multiple submissions)
+ * so that pipeline bugs show up on the host rather than on silicon.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "sha.h"
+#include "tomcrypt.h"
+
+#include "soc_hal_crypto.h"
+#include "soc_host_crypto.h"
+
+#define GCM_BLOCK_SIZE 16u
+
+size_t soc_host_crypto_bytes_per_poll = 64u;
+soc_host_crypto_stats_t soc_host_crypto_stats;
+
+static struct
+{
+	bool active;                      /**< Between begin and end */
+	hal_crypto_status_t status;
+	const hal_crypto_block_t *blocks; /**< Descriptor list of the current job */
+	size_t nblocks;
+	size_t block;                     /**< Descriptor being processed */
+	size_t offset;                    /**< Progress through that descriptor */
+	bool last;                        /**< Message has been fully submitted */
+	SHA256Context ctx;
+} host_hash;
+
+static struct
+{
+	bool active;
+	hal_crypto_status_t status;
+	int direction;                    /**< GCM_ENCRYPT or GCM_DECRYPT */
+	const uint8_t *in;
+	uint8_t *out;
+	size_t length;
+	size_t done;
+	bool last;                        /**< A partial block has been submitted */
+	gcm_state gcm;
+} host_cryp;
+
+static size_t host_budget(void)
+{
+	return (0u == soc_host_crypto_bytes_per_poll) ? SIZE_MAX : soc_host_crypto_bytes_per_poll;
+}
+
+static void host_hash_step(void)
+{
+	size_t budget = host_budget();
+
+	while ((budget > 0u) && (host_hash.block < host_hash.nblocks))
+	{
+		const hal_crypto_block_t *const b = &host_hash.blocks[host_hash.block];
+		size_t n = b->length - host_hash.offset;
+
+		if (n > budget)
+		{
+			n = budget;
+		}
+
+		if (shaSuccess != SHA256Input(&host_hash.ctx,
+		                              (const uint8_t *) b->data + host_hash.offset,
+		                              (unsigned int) n))
+		{
+			host_hash.status = HAL_CRYPTO_ERROR;
+			return;
+		}
+
+		soc_host_crypto_stats.bytes[HAL_CRYPTO_ENGINE_HASH] += n;
+		budget -= n;
+		host_hash.offset += n;
+		if (host_hash.offset == b->length)
+		{
+			host_hash.block++;
+			host_hash.offset = 0u;
+		}
+	}
+
+	if (host_hash.block == host_hash.nblocks)
+	{
+		host_hash.status = HAL_CRYPTO_IDLE;
+	}
+}
+
+static void host_cryp_step(void)
+{
+	const size_t budget = host_budget();
+	size_t n = host_cryp.length - host_cryp.done;
+
+	if (n > budget)
+	{
+		/* Keep to whole blocks until the tail of the job */
+		n = budget - (budget % GCM_BLOCK_SIZE);
+		if (0u == n)
+		{
+			n = GCM_BLOCK_SIZE;
+		}
+	}
+
+	if (n > host_cryp.length - host_cryp.done)
+	{
+		n = host_cryp.length - host_cryp.done;
+	}
+
+	/* gcm_process() takes the plain text first whichever way it is going */
+	uint8_t *const in = (uint8_t *) (uintptr_t) (host_cryp.in + host_cryp.done);
+	uint8_t *const out = host_cryp.out + host_cryp.done;
+	const int rv = (GCM_ENCRYPT == host_cryp.direction) ?
+		gcm_process(&host_cryp.gcm, in, (unsigned long) n, out, GCM_ENCRYPT) :
+		gcm_process(&host_cryp.gcm, out, (unsigned long) n, in, GCM_DECRYPT);
+
+	if (CRYPT_OK != rv)
+	{
+		host_cryp.status = HAL_CRYPTO_ERROR;
+		return;
+	}
+
+	soc_host_crypto_stats.bytes[HAL_CRYPTO_ENGINE_CRYP] += n;
+	host_cryp.done += n;
+	if (host_cryp.done == host_cryp.length)
+	{
+		host_cryp.status = HAL_CRYPTO_IDLE;
+	}
+}
+
+void soc_hal_crypto_offload_init(void)
+{
+	extern const struct ltc_cipher_descriptor aes_desc;
+
+	soc_hal_crypto_offload_quiesce();
+	(void) memset(&soc_host_crypto_stats, 0, sizeof soc_host_crypto_stats);
+
+	/* The model borrows LibTomCrypt's AES */
+	(void) register_cipher(&aes_desc);
+}
+
+void soc_hal_crypto_offload_quiesce(void)
+{
+	(void) memset(&host_hash, 0, sizeof host_hash);
+	(void) memset(&host_cryp, 0, sizeof host_cryp);
+}
+
+hal_crypto_status_t soc_hal_crypto_poll(hal_crypto_engine_t engine)
+{
+	hal_crypto_status_t *status;
+
+	switch (engine)
+	{
+	case HAL_CRYPTO_ENGINE_HASH:
+		status = &host_hash.status;
+		if (HAL_CRYPTO_BUSY == *status)
+		{
+			host_hash_step();
+		}
+		break;
+
+	case HAL_CRYPTO_ENGINE_CRYP:
+		status = &host_cryp.status;
+		if (HAL_CRYPTO_BUSY == *status)
+		{
+			host_cryp_step();
+		}
+		break;
+
+	default:
+		return HAL_CRYPTO_ERROR;
+	}
+
+	soc_host_crypto_stats.polls[engine]++;
+	if (HAL_CRYPTO_BUSY == *status)
+	{
+		soc_host_crypto_stats.busy_polls[engine]++;
+	}
+
+	return *status;
+}
+
+bool soc_hal_crypto_sha256_begin(void)
+{
+	if (HAL_CRYPTO_BUSY == host_hash.status)
+	{
+		return false;
+	}
+
+	(void) memset(&host_hash, 0, sizeof host_hash);
+	if (shaSuccess != SHA256Reset(&host_hash.ctx))
+	{
+		return false;
+	}
+
+	host_hash.active = true;
+	host_hash.status = HAL_CRYPTO_IDLE;
+	return true;
+}
+
+bool soc_hal_crypto_sha256_submit(const hal_crypto_block_t *blocks, size_t nblocks, bool last)
+{
+	if (!host_hash.active || host_hash.last || (HAL_CRYPTO_IDLE != host_hash.status))
+	{
+		return false;
+	}
+
+	host_hash.blocks = blocks;
+	host_hash.nblocks = nblocks;
+	host_hash.block = 0u;
+	host_hash.offset = 0u;
+	host_hash.last = last;
+	host_hash.status = HAL_CRYPTO_BUSY;
+	soc_host_crypto_stats.jobs[HAL_CRYPTO_ENGINE_HASH]++;
+
+	return true;
+}
+
+bool soc_hal_crypto_sha256_end(uint8_t *hash)
+{
+	const bool ok = host_hash.active && (HAL_CRYPTO_IDLE == host_hash.status) &&
+		(shaSuccess == SHA256FinalBits(&host_hash.ctx, 0, 0)) &&
+		(shaSuccess == SHA256Result(&host_hash.ctx, hash));
+
+	(void) memset(&host_hash, 0, sizeof host_hash);
+	return ok;
+}
+
+bool soc_hal_crypto_gcm_begin(const uint8_t *key, const uint8_t *iv, size_t iv_len,
+                              const uint8_t *aad, size_t aad_len, bool decrypt)
+{
+	if (HAL_CRYPTO_BUSY == host_cryp.status)
+	{
+		return false;
+	}
+
+	(void) memset(&host_cryp, 0, sizeof host_cryp);
+	if ((CRYPT_OK != gcm_init(&host_cryp.gcm, find_cipher("aes"), key, 16)) ||
+	    (CRYPT_OK != gcm_add_iv(&host_cryp.gcm, iv, (unsigned long) iv_len)) ||
+	    (CRYPT_OK != gcm_add_aad(&host_cryp.gcm, aad, (unsigned long) aad_len)))
+	{
+		(void) memset(&host_cryp, 0, sizeof host_cryp);
+		return false;
+	}
+
+	host_cryp.active = true;
+	host_cryp.status = HAL_CRYPTO_IDLE;
+	host_cryp.direction = decrypt ? GCM_DECRYPT : GCM_ENCRYPT;
+	return true;
+}
+
+bool soc_hal_crypto_gcm_submit(const uint8_t *in, uint8_t *out, size_t length)
+{
+	if (!host_cryp.active || host_cryp.last || (HAL_CRYPTO_IDLE != host_cryp.status))
+	{
+		return false;
+	}
+
+	host_cryp.in = in;
+	host_cryp.out = out;
+	host_cryp.length = length;
+	host_cryp.done = 0u;
+	host_cryp.last = (0u != (length % GCM_BLOCK_SIZE));
+	host_cryp.status = (0u == length) ? HAL_CRYPTO_IDLE : HAL_CRYPTO_BUSY;
+	soc_host_crypto_stats.jobs[HAL_CRYPTO_ENGINE_CRYP]++;
+
+	return true;
+}
+
+bool soc_hal_crypto_gcm_end(uint8_t *tag)
+{
+	unsigned long tag_len = GCM_BLOCK_SIZE;
+	/* An empty gcm_process() takes a message with no text out of AAD mode */
+	const bool ok = host_cryp.active && (HAL_CRYPTO_IDLE == host_cryp.status) &&
+		(CRYPT_OK == gcm_process(&host_cryp.gcm, NULL, 0u, NULL, host_cryp.direction)) &&
+		(CRYPT_OK == gcm_done(&host_cryp.gcm, tag, &tag_len));
+
+	(void) memset(&host_cryp, 0, sizeof host_cryp);
+	return ok;
+}
@@ -0,0 +1,109 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+/** \file
+ * \brief SoC entry points for host (PC) builds of the SBM sources.
+ *
+ * These let the portable parts of the SBM, along with the HAL layers above
+ * the SoC, be linked into host programs such as the benchmark in SBM/bench.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sbm_hal.h"
+
+void soc_init(void)
+{
+	/* Nothing to do */
+}
+
+void soc_quiesce(void)
+{
+	/* Nothing to do */
+}
+
+void soc_reset(void)
+{
+	exit(EXIT_FAILURE);
+}
+
+const char *soc_target_string(void)
+{
+	return "Host";
+}
+
+void soc_app_start(uintptr_t app_address)
+{
+	/* There is no application to run on the host */
+	(void) app_address;
+}
+
+__weak size_t soc_read_device_id(uint8_t *dst, size_t size)
+{
+	static const uint8_t host_id[UNIQUE_ID_SIZE] = "SBM-HOST-ID";
+	const size_t n = (size < sizeof host_id) ? size : sizeof host_id;
+
+	(void) memcpy(dst, host_id, n);
+	return n;
+}
+
+#if SBM_RECORD_BOOT_TIME != 0
+static struct timespec soc_timer_epoch;
+
+void soc_timer_init(void)
+{
+	(void) clock_gettime(CLOCK_MONOTONIC, &soc_timer_epoch);
+}
+
+void soc_timer_quiesce(void)
+{
+	/* Nothing to do */
+}
+
+uint32_t soc_timer_get(void)
+{
+	struct timespec now;
+
+	(void) clock_gettime(CLOCK_MONOTONIC, &now);
+
+	const int64_t us = ((int64_t) (now.tv_sec - soc_timer_epoch.tv_sec) * INT64_C(1000000)) +
+		((now.tv_nsec - soc_timer_epoch.tv_nsec) / 1000);
+
+	return (uint32_t) us;
+}
+
+uint32_t soc_watchdog_period(void)
+{
+	/* No watchdog on the host */
+	return 0u;
+}
+#endif /* SBM_RECORD_BOOT_TIME != 0 */
@@ -0,0 +1,65 @@
+/********************************************************************************
+* Copyright 2017-2022 Secure Thingz Ltd.
+* All rights reserved.
+*
+* This source file and its use is subject to a Secure Thingz Embedded Trust
+* License agreement. This source file may contain licensed source code from
+* other third-parties and is subject to those license agreements as well.
+*
+* Permission to use, copy, modify, compile and distribute compiled binary of the
+* source code for use as specified in the Embedded Trust license agreement is
+* hereby granted provided that the this copyright notice and other third-party
+* copyright notices appear in all copies of the source code.
+*
+* Distribution of Embedded Trust source code in any form is governed by the
+* Embedded Trust license agreement. Use of the Secure Thingz name or trademark
+* in any form is prohibited.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+* ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+* LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+* CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+* SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+* INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+* CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+* ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*******************************************************************************/
+
+#ifndef SOC_HOST_CRYPTO_H
+#define SOC_HOST_CRYPTO_H
+
+/** \file
+ * \brief Controls and statistics for the host model of the HASH/CRYP engines.
+ *
+ * The model in soc_hal_crypto_offload.c only advances a job when it is polled,
+ * processing at most #soc_host_crypto_bytes_per_poll bytes each time. This
+ * stands in for the engine's throughput: callers which find useful work to
+ * do between polls see their jobs finish "for free", whereas callers which
+ * wait straight away pay the full cost. The statistics record which of the
+ * two happened.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "sbm_hal_crypto.h"
+
+/** Per-engine counters, indexed by hal_crypto_engine_t. */
+typedef struct
+{
+	uint32_t jobs[2];       /**< Submissions accepted */
+	uint64_t bytes[2];      /**< Bytes processed */
+	uint32_t polls[2];      /**< Calls to soc_hal_crypto_poll() */
+	uint32_t busy_polls[2]; /**< Polls which found the engine still busy */
+} soc_host_crypto_stats_t;
+
+/** Bytes an engine processes per poll; zero completes a job on its first poll. */
+extern size_t soc_host_crypto_bytes_per_poll;
+
+/** Counters, cleared by soc_hal_crypto_offload_init(). */
+extern soc_host_crypto_stats_t soc_host_crypto_stats;
+
+#endif /* SOC_HOST_CRYPTO_H */
@@ -137,6 +137,36 @@ hal_mem_result_t soc_flash_erase(hal_mem_address_t address, size_t size);
  */
 hal_mem_result_t soc_flash_verify_erased(hal_mem_address_t address, size_t size);
 
+/** Get a CPU pointer through which an area of SOC flash memory can be read.
+ *
+ * This lets the caller read (e.g. compare) the flash in place rather than
+ * copying it out with soc_flash_read().
+ *
+ * \note This function is optional.
+ * The default (weak) implementation returns \c NULL.
+ *
+ * \param[in] address The address of the first byte in the memory region.
+ * \param[in] size    The size of the region, in bytes.
+ *
+ * \return A pointer to the first byte, or \c NULL if the region is not
+ *         directly readable.
+ */
+const void *soc_flash_mapped_pointer(hal_mem_address_t address, size_t size);
+
+/** Query whether SOC flash memory which reads as erased can always be programmed.
+ *
+ * This is not so when a program operation can leave memory reading as erased
+ * but unable to be programmed again, for example because it adds ECC. A sector
+ * is then only known to be programmable after it has been erased.
+ *
+ * \note This function is optional.
+ * The default (weak) implementation returns \c true.
+ *
+ * \return \c true if memory which reads as erased can be programmed, or
+ *         \c false if it must be erased first.
+ */
+bool soc_flash_blank_is_programmable(void);
+
 /** Disable all caches (called prior to write/erase operations)
  *
  * This is called before the start of a sequence of erase or write operations.
@@ -38,6 +38,9 @@
  * these weak ones.
  */
 
+#include <stddef.h>
+#include "soc_flash.h"
+
 __weak void soc_flash_disable_caches(void)
 {
     /* Nothing to do */
@@ -47,3 +50,18 @@ __weak void soc_flash_enable_and_flush_caches(void)
 {
     /* Nothing to do */
 }
+
+__weak const void *soc_flash_mapped_pointer(hal_mem_address_t address, size_t size)
+{
+    (void) address;
+    (void) size;
+
+    /* Read through soc_flash_read() */
+    return NULL;
+}
+
+__weak bool soc_flash_blank_is_programmable(void)
+{
+    /* Programming only clears bits */
+    return true;
+}
@@ -181,4 +181,49 @@ extern bool soc_hal_crypto_sha256_hash(const uint8_t *p_data, size_t data_len, u
 
 #endif /* defined(SBM_PROVISIONED_DATA_ENCRYPTED) && (SBM_PROVISIONED_DATA_ENCRYPTED != 0) */
 
+#if defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0)
+
+#include "sbm_hal_crypto.h"
+
+/**
+ * =============================================
+ * HAL crypto offload engine function prototypes
+ * =============================================
+ *
+ * \note Functions defined in device specific soc_hal_crypto_offload.c. Their
+ *       contracts are those of the hal_crypto_* functions of the same name
+ *       in sbm_hal_crypto.h; hal_crypto_complete() is built on
+ *       soc_hal_crypto_poll().
+ *
+ * \note Only the host engine model in hal/soc/host implements them so far,
+ *       so SBM_HAL_CRYPTO_OFFLOAD can only be enabled in host builds.
+ *
+ */
+
+/** Initialise the HASH and CRYP engines and their DMA channels */
+extern void soc_hal_crypto_offload_init(void);
+
+/** Abort outstanding jobs and return the engines to their reset state */
+extern void soc_hal_crypto_offload_quiesce(void);
+
+/**
+ * \brief Advance and report the state of an offload engine
+ *
+ * \param engine Engine to check
+ *
+ * \return State of the engine
+ */
+extern hal_crypto_status_t soc_hal_crypto_poll(hal_crypto_engine_t engine);
+
+extern bool soc_hal_crypto_sha256_begin(void);
+extern bool soc_hal_crypto_sha256_submit(const hal_crypto_block_t *blocks, size_t nblocks, bool last);
+extern bool soc_hal_crypto_sha256_end(uint8_t *hash);
+
+extern bool soc_hal_crypto_gcm_begin(const uint8_t *key, const uint8_t *iv, size_t iv_len,
+                                     const uint8_t *aad, size_t aad_len, bool decrypt);
+extern bool soc_hal_crypto_gcm_submit(const uint8_t *in, uint8_t *out, size_t length);
+extern bool soc_hal_crypto_gcm_end(uint8_t *tag);
+
+#endif /* defined(SBM_HAL_CRYPTO_OFFLOAD) && (SBM_HAL_CRYPTO_OFFLOAD != 0) */
+
 #endif /* SOC_HAL_CRYPTO_H */
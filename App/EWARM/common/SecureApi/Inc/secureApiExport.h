@@ -316,12 +316,20 @@ int8_t STZ_updateSlotWrite(const void *buffer, size_t size);
  * \param boot_time Address of uint32_t to recieve total SBM boot time.
  * \param sbm_size Address of uint32_t to recieve SBM size.
  * \param pd_size Address of uint32_t to recieve provisioned data size.
- * \param watchdog_period Unused.
- * \param watchdog_max_period Unused.
- * \param watchdog_max_activity_start Unused.
- * \param watchdog_max_activity_end Unused.
- * \param sbm_stack_size Unused.
- * \param sbm_stack_used Unused.
+ * \param watchdog_period Address of uint32_t to recieve the period of the
+ *                        watchdog running during boot, or zero if none.
+ * \param watchdog_max_period Address of uint32_t to recieve the longest
+ *                            interval between SBM watchdog checkpoints.
+ * \param watchdog_max_activity_start Address of uint32_t to recieve the start
+ *                                    of that interval.
+ * \param watchdog_max_activity_end Address of uint32_t to recieve the end of
+ *                                  that interval.
+ * \param sbm_stack_size Address of uint32_t to recieve the SBM stack size.
+ * \param sbm_stack_used Address of uint32_t to recieve the SBM stack
+ *                       high-water mark at launch.
+ *
+ * Times are in microseconds, with interval start and end measured from the
+ * start of boot. Sizes are in bytes.
  *
  * \return zero on success, else SECURE_API_ERR_COMMAND_FAILED on failure.
  */